@@ -6,11 +6,15 @@
 #ifndef BOOST_MATH_DIFFERENTIATION_LANCZOS_SMOOTHING_HPP
 #define BOOST_MATH_DIFFERENTIATION_LANCZOS_SMOOTHING_HPP
 #include <cmath> // for std::abs
+#include <algorithm>
+#include <cstddef>
 #include <limits> // to nan initialize
+#include <memory>
 #include <vector>
 #include <string>
 #include <stdexcept>
 #include <boost/math/tools/assert.hpp>
+#include <boost/math/tools/detail/fft_correlate.hpp>
 
 namespace boost::math::differentiation {
 
@@ -241,6 +245,9 @@ std::vector<Real> acceleration_filter(std::size_t n, std::size_t p, int64_t s)
 
 } // namespace detail
 
+template <typename Real, std::size_t order>
+class discrete_lanczos_derivative_stream;
+
 template <typename Real, std::size_t order = 1>
 class discrete_lanczos_derivative {
 public:
@@ -358,6 +365,24 @@ public:
         {
             BOOST_MATH_ASSERT_MSG(false, "Derivatives of order 3 and higher are not implemented.");
         }
+
+        // For long filters, the interior is computed by FFT correlation with the full filter:
+        if (n >= fft_threshold)
+        {
+            std::vector<Real> kernel(2*n + 1);
+            kernel[n] = m_f[0];
+            for (std::size_t j = 1; j <= n; ++j)
+            {
+                kernel[n + j] = m_f[j];
+                kernel[n - j] = order == 1 ? -m_f[j] : m_f[j];
+            }
+            std::size_t N = 1;
+            while (N < 8*kernel.size())
+            {
+                N <<= 1;
+            }
+            m_correlator = std::make_unique<tools::detail::fft_correlator<Real>>(kernel.data(), kernel.size(), N);
+        }
     }
 
     Real get_spacing() const
@@ -455,15 +480,12 @@ public:
         return std::numeric_limits<Real>::quiet_NaN();
     }
 
+    // w may be the same container as v, in which case the derivative overwrites the signal.
     template<class RandomAccessContainer>
     void operator()(RandomAccessContainer const & v, RandomAccessContainer & w) const
     {
         static_assert(std::is_same_v<typename RandomAccessContainer::value_type, Real>,
                       "The type of the values in the vector provided does not match the type in the filters.");
-        if (&w[0] == &v[0])
-        {
-            throw std::logic_error("This transform cannot be performed in-place.");
-        }
 
         if (std::size(v) < m_boundary_filters[0].size())
         {
@@ -479,78 +501,49 @@ public:
             throw std::length_error(msg);
         }
 
-        if constexpr (order==1)
+        // The boundary filters read the first and last 2n+1 samples, which the interior may overwrite if w is v:
+        const std::size_t n = m_f.size() - 1;
+        const std::size_t length = std::size(v);
+        std::vector<Real> head(2*n + 1);
+        std::vector<Real> tail(2*n + 1);
+        for (std::size_t i = 0; i < head.size(); ++i)
         {
-            for (std::size_t i = 0; i < m_f.size() - 1; ++i)
-            {
-                auto &bf = m_boundary_filters[i];
-                Real dvdt = bf[0] * v[0];
-                for (std::size_t j = 1; j < bf.size(); ++j)
-                {
-                    dvdt += bf[j] * v[j];
-                }
-                w[i] = dvdt;
-            }
-
-            for(std::size_t i = m_f.size() - 1; i <= std::size(v) - m_f.size(); ++i)
-            {
-                Real dvdt = m_f[1] * (v[i + 1] - v[i - 1]);
-                for (std::size_t j = 2; j < m_f.size(); ++j)
-                {
-                    dvdt += m_f[j] *(v[i + j] - v[i - j]);
-                }
-                w[i] = dvdt;
-            }
-
-
-            for(std::size_t i = std::size(v) - m_f.size() + 1; i < std::size(v); ++i)
-            {
-                int k = std::size(v) - 1 - i;
-                auto &f = m_boundary_filters[k];
-                Real dvdt = f[0] * v[std::size(v) - 1];;
-                for (std::size_t j = 1; j < f.size(); ++j)
-                {
-                    dvdt += f[j] * v[std::size(v) - 1 - j];
-                }
-                w[i] = -dvdt;
-            }
+            head[i] = v[i];
+            tail[i] = v[length - tail.size() + i];
         }
-        else if constexpr (order==2)
+
+        // Overlap-save: buffer holds the samples v[i0 - n], ..., v[i0 + m + n - 1] needed by the outputs w[i0], ..., w[i0 + m - 1].
+        // The last 2n samples of each block are carried over to the next, so each sample is read once, before it is overwritten.
+        const std::size_t interior_end = length - n;
+        const std::size_t block = m_correlator ? 2*m_correlator->block_size() : 1024;
+        std::vector<Real> buffer(block + 2*n);
+        std::vector<Real> out(block);
+        interior_workspace workspace;
+        std::size_t filled = 0;
+        for (std::size_t i0 = n; i0 < interior_end; i0 += block)
         {
-            // m_f.size() = N+1
-            for (std::size_t i = 0; i < m_f.size() - 1; ++i)
+            const std::size_t m = (std::min)(block, interior_end - i0);
+            if (filled > 0)
             {
-                auto &bf = m_boundary_filters[i];
-                Real d2vdt2 = 0;
-                for (std::size_t j = 0; j < bf.size(); ++j)
-                {
-                    d2vdt2 += bf[j] * v[j];
-                }
-                w[i] = d2vdt2;
+                std::copy(buffer.begin() + filled - 2*n, buffer.begin() + filled, buffer.begin());
             }
-
-            for (std::size_t i = m_f.size() - 1; i <= std::size(v) - m_f.size(); ++i)
+            filled = m + 2*n;
+            for (std::size_t k = (i0 == n ? 0 : 2*n); k < filled; ++k)
             {
-                Real d2vdt2 = m_f[0]*v[i];
-                for (std::size_t j = 1; j < m_f.size(); ++j)
-                {
-                    d2vdt2 += m_f[j] * (v[i + j] + v[i - j]);
-                }
-                w[i] = d2vdt2;
+                buffer[k] = v[i0 - n + k];
             }
-
-            for (std::size_t i = std::size(v) - m_f.size() + 1; i < std::size(v); ++i)
+            this->interior(buffer.data() + n, m, out.data(), workspace);
+            for (std::size_t k = 0; k < m; ++k)
             {
-                int k = std::size(v) - 1 - i;
-                auto &bf = m_boundary_filters[k];
-                Real d2vdt2 = bf[0] * v[std::size(v) - 1];
-                for (std::size_t j = 1; j < bf.size(); ++j)
-                {
-                    d2vdt2 += bf[j] * v[std::size(v) - 1 - j];
-                }
-                w[i] = d2vdt2;
+                w[i0 + k] = out[k];
             }
         }
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            w[i] = this->left_boundary(head.data(), i);
+            w[length - 1 - i] = this->right_boundary(tail.data() + tail.size() - 1, i);
+        }
     }
 
     template<class RandomAccessContainer>
@@ -571,9 +564,230 @@ public:
     discrete_lanczos_derivative& operator=(discrete_lanczos_derivative&&) = default;
 
 private:
+    friend class discrete_lanczos_derivative_stream<Real, order>;
+
+    // Filters with at least this many points on each side of the center are applied by FFT rather than directly.
+    static constexpr std::size_t fft_threshold = 256;
+
+    struct interior_workspace
+    {
+        std::vector<Real> re;
+        std::vector<Real> im;
+    };
+
+    // w[i] for 0 <= i < m from v[i - n], ..., v[i + n]; v points to the sample of the first output.
+    void interior(const Real* v, std::size_t m, Real* w, interior_workspace& workspace) const
+    {
+        const std::size_t n = m_f.size() - 1;
+        std::size_t i = 0;
+        if (m_correlator)
+        {
+            const std::size_t b = m_correlator->block_size();
+            for (; i + 2*b <= m; i += 2*b)
+            {
+                (*m_correlator)(v + i - n, v + i + b - n, w + i, w + i + b, workspace.re, workspace.im);
+            }
+            if (i + b <= m)
+            {
+                (*m_correlator)(v + i - n, nullptr, w + i, nullptr, workspace.re, workspace.im);
+                i += b;
+            }
+        }
+        // A tile of outputs at a time, with the taps in the outer loop: the accumulators stay in registers,
+        // and the inner loop is independent across outputs, so it vectorizes.
+        constexpr std::size_t tile = 32;
+        for (; i + tile <= m; i += tile)
+        {
+            const Real* x = v + i;
+            Real acc[tile];
+            for (std::size_t k = 0; k < tile; ++k)
+            {
+                acc[k] = order == 1 ? Real(0) : m_f[0]*x[k];
+            }
+            for (std::size_t j = 1; j <= n; ++j)
+            {
+                const Real fj = m_f[j];
+                const Real* right = x + j;
+                const Real* left = x - j;
+                for (std::size_t k = 0; k < tile; ++k)
+                {
+                    if constexpr (order == 1)
+                    {
+                        acc[k] += fj*(right[k] - left[k]);
+                    }
+                    else
+                    {
+                        acc[k] += fj*(right[k] + left[k]);
+                    }
+                }
+            }
+            for (std::size_t k = 0; k < tile; ++k)
+            {
+                w[i + k] = acc[k];
+            }
+        }
+        for (; i < m; ++i)
+        {
+            const Real* x = v + i;
+            Real a = order == 1 ? Real(0) : m_f[0]*x[0];
+            for (std::size_t j = 1; j <= n; ++j)
+            {
+                const std::ptrdiff_t sj = static_cast<std::ptrdiff_t>(j);
+                if constexpr (order == 1)
+                {
+                    a += m_f[j]*(x[sj] - x[-sj]);
+                }
+                else
+                {
+                    a += m_f[j]*(x[sj] + x[-sj]);
+                }
+            }
+            w[i] = a;
+        }
+    }
+
+    // w[i] for 0 <= i < n; v points to the first of the 2n+1 samples at the start of the signal.
+    Real left_boundary(const Real* v, std::size_t i) const
+    {
+        auto const & bf = m_boundary_filters[i];
+        Real dvdt = bf[0]*v[0];
+        for (std::size_t j = 1; j < bf.size(); ++j)
+        {
+            dvdt += bf[j]*v[j];
+        }
+        return dvdt;
+    }
+
+    // w[length - 1 - k] for 0 <= k < n; v points to the last of the 2n+1 samples at the end of the signal.
+    Real right_boundary(const Real* v, std::size_t k) const
+    {
+        auto const & bf = m_boundary_filters[k];
+        Real dvdt = bf[0]*v[0];
+        for (std::size_t j = 1; j < bf.size(); ++j)
+        {
+            dvdt += bf[j]*v[-static_cast<std::ptrdiff_t>(j)];
+        }
+        // The velocity filters are odd under reflection, the acceleration filters even:
+        return order == 1 ? -dvdt : dvdt;
+    }
+
     std::vector<Real> m_f;
     std::vector<std::vector<Real>> m_boundary_filters;
     Real m_dt;
+    std::unique_ptr<const tools::detail::fft_correlator<Real>> m_correlator;
+};
+
+// Applies a discrete_lanczos_derivative to a signal which arrives in chunks, such as an unbounded stream from a sensor.
+// The derivative at each sample is written once the n samples after it have arrived,
+// and flush() writes the derivatives of the last n samples using the boundary filters.
+// Given the same samples, the output is identical to that of discrete_lanczos_derivative, however the signal is chunked.
+template <typename Real, std::size_t order = 1>
+class discrete_lanczos_derivative_stream {
+public:
+    discrete_lanczos_derivative_stream(Real const & spacing,
+                                       std::size_t n = 18,
+                                       std::size_t approximation_order = 3)
+        : m_lanczos(spacing, n, approximation_order)
+    {
+        reset();
+    }
+
+    explicit discrete_lanczos_derivative_stream(discrete_lanczos_derivative<Real, order>&& lanczos)
+        : m_lanczos{std::move(lanczos)}
+    {
+        reset();
+    }
+
+    // Consumes the samples in [first, last), and writes the derivatives which can now be computed to out.
+    // Returns the end of the output.
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out)
+    {
+        const std::size_t n = this->delay();
+        for (; first != last; ++first)
+        {
+            m_buffer.push_back(*first);
+        }
+        const std::size_t count = m_offset + m_buffer.size();
+        if (count < 2*n + 1)
+        {
+            return out;
+        }
+        if (m_next == 0)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                *out++ = m_lanczos.left_boundary(m_buffer.data(), i);
+            }
+            m_next = n;
+        }
+        // The interior derivatives at m_next, ..., count - n - 1:
+        if (m_next + n < count)
+        {
+            const std::size_t m = count - n - m_next;
+            m_out.resize(m);
+            m_lanczos.interior(m_buffer.data() + (m_next - m_offset), m, m_out.data(), m_workspace);
+            out = std::copy(m_out.begin(), m_out.end(), out);
+            m_next += m;
+        }
+        // Keep the last 2n+1 samples, which is all the interior filter and the right boundary filters need:
+        const std::size_t keep = m_next - n - 1;
+        if (keep > m_offset)
+        {
+            m_buffer.erase(m_buffer.begin(), m_buffer.begin() + (keep - m_offset));
+            m_offset = keep;
+        }
+        return out;
+    }
+
+    // Writes the derivatives of the last n samples, and resets the stream so that a new signal can be started.
+    template<class OutputIterator>
+    OutputIterator flush(OutputIterator out)
+    {
+        const std::size_t n = this->delay();
+        const std::size_t count = m_offset + m_buffer.size();
+        if (count < 2*n + 1)
+        {
+            std::string msg = "The signal must be at least as long as the filter length. ";
+            msg += "The signal has length = " + std::to_string(count) + ", the filter has length " + std::to_string(2*n + 1);
+            throw std::length_error(msg);
+        }
+        const Real* back = m_buffer.data() + m_buffer.size() - 1;
+        for (std::size_t k = n; k > 0; --k)
+        {
+            *out++ = m_lanczos.right_boundary(back, k - 1);
+        }
+        reset();
+        return out;
+    }
+
+    // Discards any buffered samples.
+    void reset()
+    {
+        m_buffer.clear();
+        m_offset = 0;
+        m_next = 0;
+    }
+
+    // The number of samples which must arrive after a sample before its derivative can be computed.
+    std::size_t delay() const
+    {
+        return m_lanczos.m_f.size() - 1;
+    }
+
+    Real get_spacing() const
+    {
+        return m_lanczos.get_spacing();
+    }
+
+private:
+    discrete_lanczos_derivative<Real, order> m_lanczos;
+    // m_buffer[k] is sample m_offset + k, and m_next is the index of the next derivative to be written:
+    std::vector<Real> m_buffer;
+    std::size_t m_offset;
+    std::size_t m_next;
+    std::vector<Real> m_out;
+    typename discrete_lanczos_derivative<Real, order>::interior_workspace m_workspace;
 };
 
 } // namespaces
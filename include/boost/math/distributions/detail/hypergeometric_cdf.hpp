@@ -10,6 +10,7 @@
 
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/distributions/detail/hypergeometric_pdf.hpp>
+#include <vector>
 
 namespace boost{ namespace math{ namespace detail{
 
@@ -68,6 +69,72 @@ namespace boost{ namespace math{ namespace detail{
 #endif
    }
 
+   template <class T, class Policy>
+   void hypergeometric_table_imp(unsigned r, unsigned n, unsigned N, std::vector<T>& pdf, std::vector<T>& cdf, std::vector<T>& ccdf, const Policy& pol)
+   {
+      //
+      // Fills in the pdf over the whole support [lower, upper] together with the
+      // lower tail sums cdf[i] = P(X <= lower + i) and upper tail sums
+      // ccdf[i] = P(X > lower + i).  The pdf is seeded at the mode, where it
+      // can not underflow, and the term recurrence is then run outwards in
+      // both directions: once the terms underflow they stay at zero, as the
+      // distribution is unimodal.  To stop the rounding errors in the
+      // recurrence from accumulating over very wide supports, the pdf is
+      // re-evaluated directly every so often:
+      //
+#ifdef _MSC_VER
+#  pragma warning(push)
+#  pragma warning(disable:4267)
+#endif
+      BOOST_MATH_STD_USING
+      static const unsigned refresh_interval = 256;
+      unsigned lower = static_cast<unsigned>((std::max)(0, (int)(n + r) - (int)(N)));
+      unsigned upper = (std::min)(r, n);
+      unsigned size = upper - lower + 1;
+      unsigned mode = static_cast<unsigned>(floor(T(r + 1) * T(n + 1) / (N + 2)));
+      mode = (std::min)((std::max)(mode, lower), upper);
+
+      pdf.assign(size, T(0));
+      cdf.assign(size, T(0));
+      ccdf.assign(size, T(0));
+
+      T term = hypergeometric_pdf<T>(mode, r, n, N, pol);
+      pdf[mode - lower] = term;
+      for(unsigned x = mode; (x < upper) && (term != 0); ++x)
+      {
+         if((x + 1 - mode) % refresh_interval == 0)
+            term = hypergeometric_pdf<T>(x + 1, r, n, N, pol);
+         else
+            term = T(n - x) * T(r - x) * term / (T(x + 1) * T((N + x + 1) - n - r));
+         pdf[x + 1 - lower] = term;
+      }
+      term = pdf[mode - lower];
+      for(unsigned x = mode; (x > lower) && (term != 0); --x)
+      {
+         if((mode - x + 1) % refresh_interval == 0)
+            term = hypergeometric_pdf<T>(x - 1, r, n, N, pol);
+         else
+            term = T(x) * T((N + x) - n - r) * term / (T(1 + n - x) * T(1 + r - x));
+         pdf[x - 1 - lower] = term;
+      }
+
+      T sum = 0;
+      for(unsigned i = 0; i < size; ++i)
+      {
+         sum += pdf[i];
+         cdf[i] = sum;
+      }
+      sum = 0;
+      for(unsigned i = size - 1; i > 0; --i)
+      {
+         sum += pdf[i];
+         ccdf[i - 1] = sum;
+      }
+#ifdef _MSC_VER
+#  pragma warning(pop)
+#endif
+   }
+
    template <class T, class Policy>
    inline T hypergeometric_cdf(unsigned x, unsigned r, unsigned n, unsigned N, bool invert, const Policy&)
    {
@@ -24,6 +24,7 @@
 #include <boost/math/tools/precision.hpp>
 #include <boost/math/tools/roots.hpp>
 #include <boost/math/tools/is_detected.hpp>
+#include <array>
 #include <cstddef>
 #include <iterator>
 #include <limits>
@@ -53,18 +54,22 @@ typename Dist::value_type generic_quantile(const Dist& dist, const typename Dist
 template <typename RealT, typename PolicyT>
 class hyperexponential_distribution;
 
+template <typename RealT, std::size_t N, typename PolicyT>
+class fixed_hyperexponential_distribution;
+
 
 namespace /*<unnamed>*/ { namespace hyperexp_detail {
 
-template <typename T>
-void normalize(std::vector<T>& v)
+template <typename ContainerT>
+void normalize(ContainerT& v)
 {
+   typedef typename ContainerT::value_type T;
    if(!v.size())
       return;  // Our error handlers will get this later
     const T sum = std::accumulate(v.begin(), v.end(), static_cast<T>(0));
     T final_sum = 0;
-    const typename std::vector<T>::iterator end = --v.end();
-    for (typename std::vector<T>::iterator it = v.begin();
+    const typename ContainerT::iterator end = std::prev(v.end());
+    for (typename ContainerT::iterator it = v.begin();
          it != end;
          ++it)
     {
@@ -74,8 +79,8 @@ void normalize(std::vector<T>& v)
     *end = 1 - final_sum;  // avoids round off errors, ensures the probs really do sum to 1.
 }
 
-template <typename RealT, typename PolicyT>
-bool check_probabilities(char const* function, std::vector<RealT> const& probabilities, RealT* presult, PolicyT const& pol)
+template <typename RealT, typename ContainerT, typename PolicyT>
+bool check_probabilities(char const* function, ContainerT const& probabilities, RealT* presult, PolicyT const& pol)
 {
     BOOST_MATH_STD_USING
     const std::size_t n = probabilities.size();
@@ -111,8 +116,8 @@ bool check_probabilities(char const* function, std::vector<RealT> const& probabi
     return true;
 }
 
-template <typename RealT, typename PolicyT>
-bool check_rates(char const* function, std::vector<RealT> const& rates, RealT* presult, PolicyT const& pol)
+template <typename RealT, typename ContainerT, typename PolicyT>
+bool check_rates(char const* function, ContainerT const& rates, RealT* presult, PolicyT const& pol)
 {
     const std::size_t n = rates.size();
     for (std::size_t i = 0; i < n; ++i)
@@ -130,8 +135,8 @@ bool check_rates(char const* function, std::vector<RealT> const& rates, RealT* p
     return true;
 }
 
-template <typename RealT, typename PolicyT>
-bool check_dist(char const* function, std::vector<RealT> const& probabilities, std::vector<RealT> const& rates, RealT* presult, PolicyT const& pol)
+template <typename RealT, typename ContainerT, typename PolicyT>
+bool check_dist(char const* function, ContainerT const& probabilities, ContainerT const& rates, RealT* presult, PolicyT const& pol)
 {
     BOOST_MATH_STD_USING
     if (probabilities.size() != rates.size())
@@ -169,9 +174,157 @@ bool check_probability(char const* function, RealT p, RealT* presult, PolicyT co
     return true;
 }
 
+//
+// The mixture sums below work directly on the contiguous phase probabilities and rates held by the
+// distribution, with the per-phase exponential terms written out in full: the loops are then simple
+// reductions over the phases, which the compiler can vectorize where it has a vector exp to call
+// (and is permitted to reorder the sum).  They give the same results as summing the pdf/cdf of an
+// exponential_distribution for each phase.
+//
+template <typename RealT>
+RealT pdf_sum(RealT const* probs, RealT const* rates, std::size_t n, RealT const& x)
+{
+    BOOST_MATH_STD_USING
+    RealT result = 0;
+    if ((boost::math::isinf)(x))
+    {
+        return result;
+    }
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        result += probs[i]*(rates[i]*exp(-rates[i]*x));
+    }
+    return result;
+}
+
 template <typename RealT, typename PolicyT>
-RealT quantile_impl(hyperexponential_distribution<RealT, PolicyT> const& dist, RealT const& p, bool comp)
+RealT cdf_sum(RealT const* probs, RealT const* rates, std::size_t n, RealT const& x, PolicyT const& pol)
+{
+    RealT result = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        result += probs[i]*-boost::math::expm1(-x*rates[i], pol);
+    }
+    return result;
+}
+
+template <typename RealT>
+RealT ccdf_sum(RealT const* probs, RealT const* rates, std::size_t n, RealT const& x)
+{
+    BOOST_MATH_STD_USING
+    RealT result = 0;
+    if (x >= tools::max_value<RealT>())
+    {
+        return result;
+    }
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        result += probs[i]*exp(-x*rates[i]);
+    }
+    return result;
+}
+
+template <typename RealT>
+RealT mean_sum(RealT const* probs, RealT const* rates, std::size_t n)
 {
+    RealT result = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        result += probs[i]*(1/rates[i]);
+    }
+    return result;
+}
+
+template <typename RealT>
+RealT variance_sum(RealT const* probs, RealT const* rates, std::size_t n)
+{
+    RealT result = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        result += probs[i]/(rates[i]*rates[i]);
+    }
+
+    const RealT mean = mean_sum(probs, rates, n);
+
+    return 2*result-mean*mean;
+}
+
+template <typename RealT>
+RealT skewness_sum(RealT const* probs, RealT const* rates, std::size_t n)
+{
+    BOOST_MATH_STD_USING
+    RealT s1 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i}
+    RealT s2 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i^2}
+    RealT s3 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i^3}
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const RealT p = probs[i];
+        const RealT r = rates[i];
+        const RealT r2 = r*r;
+        const RealT r3 = r2*r;
+
+        s1 += p/r;
+        s2 += p/r2;
+        s3 += p/r3;
+    }
+
+    const RealT s1s1 = s1*s1;
+
+    const RealT num = (6*s3 - (3*(2*s2 - s1s1) + s1s1)*s1);
+    const RealT den = (2*s2 - s1s1);
+
+    return num / pow(den, static_cast<RealT>(1.5));
+}
+
+template <typename RealT>
+RealT kurtosis_sum(RealT const* probs, RealT const* rates, std::size_t n)
+{
+    RealT s1 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i}
+    RealT s2 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i^2}
+    RealT s3 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i^3}
+    RealT s4 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i^4}
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const RealT p = probs[i];
+        const RealT r = rates[i];
+        const RealT r2 = r*r;
+        const RealT r3 = r2*r;
+        const RealT r4 = r3*r;
+
+        s1 += p/r;
+        s2 += p/r2;
+        s3 += p/r3;
+        s4 += p/r4;
+    }
+
+    const RealT s1s1 = s1*s1;
+
+    const RealT num = (24*s4 - 24*s3*s1 + 3*(2*(2*s2 - s1s1) + s1s1)*s1s1);
+    const RealT den = (2*s2 - s1s1);
+
+    return num/(den*den);
+}
+
+// The same distribution with a different policy, used for the root finding in quantile_impl:
+template <typename RealT, typename PolicyT, typename ForwardingPolicyT>
+hyperexponential_distribution<RealT, ForwardingPolicyT> rebind_policy(hyperexponential_distribution<RealT, PolicyT> const& dist, ForwardingPolicyT const&)
+{
+    return hyperexponential_distribution<RealT, ForwardingPolicyT>(dist.probabilities_data(), dist.probabilities_data() + dist.num_phases(),
+                                                                   dist.rates_data(), dist.rates_data() + dist.num_phases());
+}
+
+template <typename RealT, std::size_t N, typename PolicyT, typename ForwardingPolicyT>
+fixed_hyperexponential_distribution<RealT, N, ForwardingPolicyT> rebind_policy(fixed_hyperexponential_distribution<RealT, N, PolicyT> const& dist, ForwardingPolicyT const&)
+{
+    return fixed_hyperexponential_distribution<RealT, N, ForwardingPolicyT>(dist.probabilities(), dist.rates());
+}
+
+template <typename DistT>
+typename DistT::value_type quantile_impl(DistT const& dist, typename DistT::value_type const& p, bool comp)
+{
+    typedef typename DistT::value_type RealT;
+    typedef typename DistT::policy_type PolicyT;
+
     // Don't have a closed form so try to numerically solve the inverse CDF...
 
     typedef typename policies::evaluation<RealT, PolicyT>::type value_type;
@@ -192,8 +345,8 @@ RealT quantile_impl(hyperexponential_distribution<RealT, PolicyT> const& dist, R
     }
 
     const std::size_t n = dist.num_phases();
-    const std::vector<RealT> probs = dist.probabilities();
-    const std::vector<RealT> rates = dist.rates();
+    RealT const* probs = dist.probabilities_data();
+    RealT const* rates = dist.rates_data();
 
     // A possible (but inaccurate) approximation is given below, where the
     // quantile is given by the weighted sum of exponential quantiles:
@@ -224,7 +377,7 @@ RealT quantile_impl(hyperexponential_distribution<RealT, PolicyT> const& dist, R
     }
 
     value_type q;
-    q = detail::generic_quantile(hyperexponential_distribution<RealT,forwarding_policy>(probs, rates),
+    q = detail::generic_quantile(rebind_policy(dist, forwarding_policy()),
                                  p,
                                  guess,
                                  comp,
@@ -388,6 +541,19 @@ public: hyperexponential_distribution(std::initializer_list<RealT> l1)
         return rates_.size();
     }
 
+    // Pointers to the num_phases() probabilities and rates, stored contiguously: these
+    // let the parameters be read without copying them, and remain valid for the
+    // lifetime of the distribution.
+    public: RealT const* probabilities_data() const
+    {
+        return probs_.data();
+    }
+
+    public: RealT const* rates_data() const
+    {
+        return rates_.data();
+    }
+
 
     private: std::vector<RealT> probs_;
     private: std::vector<RealT> rates_;
@@ -398,6 +564,86 @@ public: hyperexponential_distribution(std::initializer_list<RealT> l1)
 typedef hyperexponential_distribution<double> hyperexponential;
 
 
+// A hyperexponential distribution with a number of phases N fixed at compile time:
+// the parameters are held in std::array's rather than std::vector's, so that the
+// distribution never allocates, and the loops over the phases have a constant trip count.
+template <typename RealT, std::size_t N, typename PolicyT = policies::policy<> >
+class fixed_hyperexponential_distribution
+{
+    static_assert(N > 0, "A hyperexponential distribution must have at least one phase.");
+
+    public: typedef RealT value_type;
+    public: typedef PolicyT policy_type;
+
+
+    // Default constructor: N phases with equal probabilities, each with rate 1.
+    public: fixed_hyperexponential_distribution()
+    {
+        probs_.fill(1);
+        rates_.fill(1);
+        hyperexp_detail::normalize(probs_);
+    }
+
+    public: fixed_hyperexponential_distribution(std::array<RealT, N> const& probabilities, std::array<RealT, N> const& rates)
+    : probs_(probabilities),
+      rates_(rates)
+    {
+        hyperexp_detail::normalize(probs_);
+
+        RealT err;
+        hyperexp_detail::check_dist("boost::math::fixed_hyperexponential_distribution<%1%>::fixed_hyperexponential_distribution",
+                                    probs_,
+                                    rates_,
+                                    &err,
+                                    PolicyT());
+    }
+
+    // Rates only: all phase probabilities are equal.
+    public: explicit fixed_hyperexponential_distribution(std::array<RealT, N> const& rates)
+    : rates_(rates)
+    {
+        probs_.fill(1);
+        hyperexp_detail::normalize(probs_);
+
+        RealT err;
+        hyperexp_detail::check_dist("boost::math::fixed_hyperexponential_distribution<%1%>::fixed_hyperexponential_distribution",
+                                    probs_,
+                                    rates_,
+                                    &err,
+                                    PolicyT());
+    }
+
+    public: std::array<RealT, N> const& probabilities() const
+    {
+        return probs_;
+    }
+
+    public: std::array<RealT, N> const& rates() const
+    {
+        return rates_;
+    }
+
+    public: static constexpr std::size_t num_phases()
+    {
+        return N;
+    }
+
+    public: RealT const* probabilities_data() const
+    {
+        return probs_.data();
+    }
+
+    public: RealT const* rates_data() const
+    {
+        return rates_.data();
+    }
+
+
+    private: std::array<RealT, N> probs_;
+    private: std::array<RealT, N> rates_;
+}; // class fixed_hyperexponential_distribution
+
+
 // Range of permissible values for random variable x
 template <typename RealT, typename PolicyT>
 std::pair<RealT,RealT> range(hyperexponential_distribution<RealT,PolicyT> const&)
@@ -421,7 +667,6 @@ std::pair<RealT,RealT> support(hyperexponential_distribution<RealT,PolicyT> cons
 template <typename RealT, typename PolicyT>
 RealT pdf(hyperexponential_distribution<RealT, PolicyT> const& dist, RealT const& x)
 {
-    BOOST_MATH_STD_USING
     RealT result = 0;
 
     if (!hyperexp_detail::check_x("boost::math::pdf(const boost::math::hyperexponential_distribution<%1%>&, %1%)", x, &result, PolicyT()))
@@ -429,19 +674,7 @@ RealT pdf(hyperexponential_distribution<RealT, PolicyT> const& dist, RealT const
         return result;
     }
 
-    const std::size_t n = dist.num_phases();
-    const std::vector<RealT> probs = dist.probabilities();
-    const std::vector<RealT> rates = dist.rates();
-
-    for (std::size_t i = 0; i < n; ++i)
-    {
-        const exponential_distribution<RealT,PolicyT> exp(rates[i]);
-
-        result += probs[i]*pdf(exp, x);
-        //result += probs[i]*rates[i]*exp(-rates[i]*x);
-    }
-
-    return result;
+    return hyperexp_detail::pdf_sum(dist.probabilities_data(), dist.rates_data(), dist.num_phases(), x);
 }
 
 template <typename RealT, typename PolicyT>
@@ -454,18 +687,7 @@ RealT cdf(hyperexponential_distribution<RealT, PolicyT> const& dist, RealT const
         return result;
     }
 
-    const std::size_t n = dist.num_phases();
-    const std::vector<RealT> probs = dist.probabilities();
-    const std::vector<RealT> rates = dist.rates();
-
-    for (std::size_t i = 0; i < n; ++i)
-    {
-        const exponential_distribution<RealT,PolicyT> exp(rates[i]);
-
-        result += probs[i]*cdf(exp, x);
-    }
-
-    return result;
+    return hyperexp_detail::cdf_sum(dist.probabilities_data(), dist.rates_data(), dist.num_phases(), x, PolicyT());
 }
 
 template <typename RealT, typename PolicyT>
@@ -487,18 +709,7 @@ RealT cdf(complemented2_type<hyperexponential_distribution<RealT,PolicyT>, RealT
         return result;
     }
 
-    const std::size_t n = dist.num_phases();
-    const std::vector<RealT> probs = dist.probabilities();
-    const std::vector<RealT> rates = dist.rates();
-
-    for (std::size_t i = 0; i < n; ++i)
-    {
-        const exponential_distribution<RealT,PolicyT> exp(rates[i]);
-
-        result += probs[i]*cdf(complement(exp, x));
-    }
-
-    return result;
+    return hyperexp_detail::ccdf_sum(dist.probabilities_data(), dist.rates_data(), dist.num_phases(), x);
 }
 
 
@@ -514,115 +725,142 @@ RealT quantile(complemented2_type<hyperexponential_distribution<RealT, PolicyT>,
 template <typename RealT, typename PolicyT>
 RealT mean(hyperexponential_distribution<RealT, PolicyT> const& dist)
 {
-    RealT result = 0;
-
-    const std::size_t n = dist.num_phases();
-    const std::vector<RealT> probs = dist.probabilities();
-    const std::vector<RealT> rates = dist.rates();
+    return hyperexp_detail::mean_sum(dist.probabilities_data(), dist.rates_data(), dist.num_phases());
+}
 
-    for (std::size_t i = 0; i < n; ++i)
-    {
-        const exponential_distribution<RealT,PolicyT> exp(rates[i]);
+template <typename RealT, typename PolicyT>
+RealT variance(hyperexponential_distribution<RealT, PolicyT> const& dist)
+{
+    return hyperexp_detail::variance_sum(dist.probabilities_data(), dist.rates_data(), dist.num_phases());
+}
 
-        result += probs[i]*mean(exp);
-    }
+template <typename RealT, typename PolicyT>
+RealT skewness(hyperexponential_distribution<RealT,PolicyT> const& dist)
+{
+    return hyperexp_detail::skewness_sum(dist.probabilities_data(), dist.rates_data(), dist.num_phases());
+}
 
-    return result;
+template <typename RealT, typename PolicyT>
+RealT kurtosis(hyperexponential_distribution<RealT,PolicyT> const& dist)
+{
+    return hyperexp_detail::kurtosis_sum(dist.probabilities_data(), dist.rates_data(), dist.num_phases());
 }
 
 template <typename RealT, typename PolicyT>
-RealT variance(hyperexponential_distribution<RealT, PolicyT> const& dist)
+RealT kurtosis_excess(hyperexponential_distribution<RealT,PolicyT> const& dist)
 {
-    RealT result = 0;
+    return kurtosis(dist) - 3;
+}
 
-    const std::size_t n = dist.num_phases();
-    const std::vector<RealT> probs = dist.probabilities();
-    const std::vector<RealT> rates = dist.rates();
+template <typename RealT, typename PolicyT>
+RealT mode(hyperexponential_distribution<RealT,PolicyT> const& /*dist*/)
+{
+    return 0;
+}
 
-    for (std::size_t i = 0; i < n; ++i)
+// The same functions for the fixed number of phases:
+template <typename RealT, std::size_t N, typename PolicyT>
+std::pair<RealT,RealT> range(fixed_hyperexponential_distribution<RealT,N,PolicyT> const&)
+{
+    if (std::numeric_limits<RealT>::has_infinity)
     {
-        result += probs[i]/(rates[i]*rates[i]);
+        return std::make_pair(static_cast<RealT>(0), std::numeric_limits<RealT>::infinity()); // 0 to +inf.
     }
 
-    const RealT mean = boost::math::mean(dist);
-
-    result = 2*result-mean*mean;
+    return std::make_pair(static_cast<RealT>(0), tools::max_value<RealT>()); // 0 to +<max value>
+}
 
-    return result;
+template <typename RealT, std::size_t N, typename PolicyT>
+std::pair<RealT,RealT> support(fixed_hyperexponential_distribution<RealT,N,PolicyT> const&)
+{
+    return std::make_pair(tools::min_value<RealT>(), tools::max_value<RealT>()); // <min value> to +<max value>.
 }
 
-template <typename RealT, typename PolicyT>
-RealT skewness(hyperexponential_distribution<RealT,PolicyT> const& dist)
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT pdf(fixed_hyperexponential_distribution<RealT, N, PolicyT> const& dist, RealT const& x)
 {
-    BOOST_MATH_STD_USING
-    const std::size_t n = dist.num_phases();
-    const std::vector<RealT> probs = dist.probabilities();
-    const std::vector<RealT> rates = dist.rates();
+    RealT result = 0;
 
-    RealT s1 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i}
-    RealT s2 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i^2}
-    RealT s3 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i^3}
-    for (std::size_t i = 0; i < n; ++i)
+    if (!hyperexp_detail::check_x("boost::math::pdf(const boost::math::fixed_hyperexponential_distribution<%1%>&, %1%)", x, &result, PolicyT()))
     {
-        const RealT p = probs[i];
-        const RealT r = rates[i];
-        const RealT r2 = r*r;
-        const RealT r3 = r2*r;
-
-        s1 += p/r;
-        s2 += p/r2;
-        s3 += p/r3;
+        return result;
     }
 
-    const RealT s1s1 = s1*s1;
+    return hyperexp_detail::pdf_sum(dist.probabilities_data(), dist.rates_data(), N, x);
+}
 
-    const RealT num = (6*s3 - (3*(2*s2 - s1s1) + s1s1)*s1);
-    const RealT den = (2*s2 - s1s1);
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT cdf(fixed_hyperexponential_distribution<RealT, N, PolicyT> const& dist, RealT const& x)
+{
+    RealT result = 0;
 
-    return num / pow(den, static_cast<RealT>(1.5));
+    if (!hyperexp_detail::check_x("boost::math::cdf(const boost::math::fixed_hyperexponential_distribution<%1%>&, %1%)", x, &result, PolicyT()))
+    {
+        return result;
+    }
+
+    return hyperexp_detail::cdf_sum(dist.probabilities_data(), dist.rates_data(), N, x, PolicyT());
 }
 
-template <typename RealT, typename PolicyT>
-RealT kurtosis(hyperexponential_distribution<RealT,PolicyT> const& dist)
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT quantile(fixed_hyperexponential_distribution<RealT, N, PolicyT> const& dist, RealT const& p)
 {
-    const std::size_t n = dist.num_phases();
-    const std::vector<RealT> probs = dist.probabilities();
-    const std::vector<RealT> rates = dist.rates();
+    return hyperexp_detail::quantile_impl(dist, p , false);
+}
 
-    RealT s1 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i}
-    RealT s2 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i^2}
-    RealT s3 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i^3}
-    RealT s4 = 0; // \sum_{i=1}^n \frac{p_i}{\lambda_i^4}
-    for (std::size_t i = 0; i < n; ++i)
-    {
-        const RealT p = probs[i];
-        const RealT r = rates[i];
-        const RealT r2 = r*r;
-        const RealT r3 = r2*r;
-        const RealT r4 = r3*r;
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT cdf(complemented2_type<fixed_hyperexponential_distribution<RealT,N,PolicyT>, RealT> const& c)
+{
+    RealT const& x = c.param;
 
-        s1 += p/r;
-        s2 += p/r2;
-        s3 += p/r3;
-        s4 += p/r4;
+    RealT result = 0;
+
+    if (!hyperexp_detail::check_x("boost::math::cdf(boost::math::complemented2_type<const boost::math::fixed_hyperexponential_distribution<%1%>&, %1%>)", x, &result, PolicyT()))
+    {
+        return result;
     }
 
-    const RealT s1s1 = s1*s1;
+    return hyperexp_detail::ccdf_sum(c.dist.probabilities_data(), c.dist.rates_data(), N, x);
+}
 
-    const RealT num = (24*s4 - 24*s3*s1 + 3*(2*(2*s2 - s1s1) + s1s1)*s1s1);
-    const RealT den = (2*s2 - s1s1);
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT quantile(complemented2_type<fixed_hyperexponential_distribution<RealT, N, PolicyT>, RealT> const& c)
+{
+    return hyperexp_detail::quantile_impl(c.dist, c.param , true);
+}
 
-    return num/(den*den);
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT mean(fixed_hyperexponential_distribution<RealT, N, PolicyT> const& dist)
+{
+    return hyperexp_detail::mean_sum(dist.probabilities_data(), dist.rates_data(), N);
 }
 
-template <typename RealT, typename PolicyT>
-RealT kurtosis_excess(hyperexponential_distribution<RealT,PolicyT> const& dist)
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT variance(fixed_hyperexponential_distribution<RealT, N, PolicyT> const& dist)
+{
+    return hyperexp_detail::variance_sum(dist.probabilities_data(), dist.rates_data(), N);
+}
+
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT skewness(fixed_hyperexponential_distribution<RealT, N, PolicyT> const& dist)
+{
+    return hyperexp_detail::skewness_sum(dist.probabilities_data(), dist.rates_data(), N);
+}
+
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT kurtosis(fixed_hyperexponential_distribution<RealT, N, PolicyT> const& dist)
+{
+    return hyperexp_detail::kurtosis_sum(dist.probabilities_data(), dist.rates_data(), N);
+}
+
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT kurtosis_excess(fixed_hyperexponential_distribution<RealT, N, PolicyT> const& dist)
 {
     return kurtosis(dist) - 3;
 }
 
-template <typename RealT, typename PolicyT>
-RealT mode(hyperexponential_distribution<RealT,PolicyT> const& /*dist*/)
+template <typename RealT, std::size_t N, typename PolicyT>
+RealT mode(fixed_hyperexponential_distribution<RealT, N, PolicyT> const& /*dist*/)
 {
     return 0;
 }
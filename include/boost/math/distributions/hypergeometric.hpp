@@ -15,6 +15,7 @@
 #include <boost/math/distributions/detail/hypergeometric_cdf.hpp>
 #include <boost/math/distributions/detail/hypergeometric_quantile.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
+#include <vector>
 
 
 namespace boost { namespace math {
@@ -283,6 +284,219 @@ namespace boost { namespace math {
    {
       return kurtosis_excess(dist) + 3;
    } // RealType kurtosis_excess(const hypergeometric_distribution<RealType, Policy>& dist)
+
+   template <class RealType = double, class Policy = policies::policy<> >
+   class hypergeometric_table
+   {
+      //
+      // Tabulates the pdf and both tails of a hypergeometric distribution over its
+      // whole support in a single pass of the term recurrence, so that repeated
+      // pdf/cdf evaluations are just lookups, and quantiles of a sorted sequence of
+      // probabilities can be found with a single walk over the table.
+      //
+      typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+      typedef typename policies::normalise<
+         Policy,
+         policies::promote_float<false>,
+         policies::promote_double<false>,
+         policies::discrete_quantile<>,
+         policies::assert_undefined<> >::type forwarding_policy;
+      typedef typename policies::normalise<
+         Policy,
+         policies::promote_float<false>,
+         policies::promote_double<false>,
+         policies::assert_undefined<> >::type quantile_policy;
+   public:
+      typedef RealType value_type;
+      typedef Policy policy_type;
+      typedef hypergeometric_distribution<RealType, Policy> distribution_type;
+
+      explicit hypergeometric_table(const distribution_type& d)
+         : dist(d)
+      {
+         BOOST_MATH_STD_USING
+         std::pair<unsigned, unsigned> r = range(dist);
+         m_lower = r.first;
+         m_upper = r.second;
+         m_mode = static_cast<unsigned>(floor(eval_type(dist.defective() + 1) * eval_type(dist.sample_count() + 1) / (dist.total() + 2)));
+         m_mode = (std::min)((std::max)(m_mode, m_lower), m_upper);
+         m_fudge_factor = 1 + tools::epsilon<eval_type>() * ((dist.total() <= boost::math::prime(boost::math::max_prime - 1)) ? 50 : 2 * dist.total());
+         detail::hypergeometric_table_imp<eval_type>(dist.defective(), dist.sample_count(), dist.total(), m_pdf, m_cdf, m_ccdf, forwarding_policy());
+      }
+
+      const distribution_type& distribution()const
+      {
+         return dist;
+      }
+      unsigned lower()const
+      {
+         return m_lower;
+      }
+      unsigned upper()const
+      {
+         return m_upper;
+      }
+
+      RealType pdf(unsigned x)const
+      {
+         static const char* function = "boost::math::hypergeometric_table<%1%>::pdf(%1%)";
+         RealType result = 0;
+         if(!dist.check_x(x, function, &result))
+            return result;
+         return policies::checked_narrowing_cast<RealType, forwarding_policy>(m_pdf[x - m_lower], function);
+      }
+      RealType cdf(unsigned x)const
+      {
+         static const char* function = "boost::math::hypergeometric_table<%1%>::cdf(%1%)";
+         RealType result = 0;
+         if(!dist.check_x(x, function, &result))
+            return result;
+         return policies::checked_narrowing_cast<RealType, forwarding_policy>(tail(x, false), function);
+      }
+      RealType cdf_complement(unsigned x)const
+      {
+         static const char* function = "boost::math::hypergeometric_table<%1%>::cdf_complement(%1%)";
+         RealType result = 0;
+         if(!dist.check_x(x, function, &result))
+            return result;
+         return policies::checked_narrowing_cast<RealType, forwarding_policy>(tail(x, true), function);
+      }
+
+      //
+      // Copies the whole table, from lower() to upper(), to out:
+      //
+      template <class OutputIterator>
+      OutputIterator pdf_values(OutputIterator out)const
+      {
+         for(unsigned x = m_lower; x <= m_upper; ++x)
+            *out++ = pdf(x);
+         return out;
+      }
+      template <class OutputIterator>
+      OutputIterator cdf_values(OutputIterator out)const
+      {
+         for(unsigned x = m_lower; x <= m_upper; ++x)
+            *out++ = cdf(x);
+         return out;
+      }
+      template <class OutputIterator>
+      OutputIterator cdf_complement_values(OutputIterator out)const
+      {
+         for(unsigned x = m_lower; x <= m_upper; ++x)
+            *out++ = cdf_complement(x);
+         return out;
+      }
+
+      RealType quantile(const RealType& p)const
+      {
+         unsigned i = m_mode - m_lower;
+         return quantile_imp(p, RealType(1 - p), false, i, "boost::math::hypergeometric_table<%1%>::quantile(%1%)");
+      }
+      RealType quantile_complement(const RealType& q)const
+      {
+         unsigned i = m_mode - m_lower;
+         return quantile_imp(RealType(1 - q), q, true, i, "boost::math::hypergeometric_table<%1%>::quantile_complement(%1%)");
+      }
+      //
+      // Each search starts from where the previous one finished, so a sorted
+      // sequence of probabilities is handled with one walk over the table,
+      // (any order is accepted, it's just slower):
+      //
+      template <class InputIterator, class OutputIterator>
+      OutputIterator quantile(InputIterator first, InputIterator last, OutputIterator out)const
+      {
+         unsigned i = m_mode - m_lower;
+         for(; first != last; ++first)
+         {
+            RealType p = *first;
+            *out++ = quantile_imp(p, RealType(1 - p), false, i, "boost::math::hypergeometric_table<%1%>::quantile(%1%)");
+         }
+         return out;
+      }
+      template <class InputIterator, class OutputIterator>
+      OutputIterator quantile_complement(InputIterator first, InputIterator last, OutputIterator out)const
+      {
+         unsigned i = m_mode - m_lower;
+         for(; first != last; ++first)
+         {
+            RealType q = *first;
+            *out++ = quantile_imp(RealType(1 - q), q, true, i, "boost::math::hypergeometric_table<%1%>::quantile_complement(%1%)");
+         }
+         return out;
+      }
+
+   private:
+      eval_type tail(unsigned x, bool invert)const
+      {
+         //
+         // Use whichever tail sum was accumulated from the small end, exactly as
+         // hypergeometric_cdf_imp does:
+         //
+         eval_type result = x < m_mode ? m_cdf[x - m_lower] : m_ccdf[x - m_lower];
+         if(invert == (x < m_mode))
+            result = 1 - result;
+         if(result > 1)
+            result = 1;
+         if(result < 0)
+            result = 0;
+         return result;
+      }
+
+      RealType quantile_imp(const RealType& p, const RealType& q, bool complement, unsigned& i, const char* function)const
+      {
+         typedef typename quantile_policy::discrete_quantile_type discrete_quantile_type;
+         RealType result = 0;
+         if(false == detail::check_probability(function, complement ? q : p, &result, Policy()))
+            return result;
+         //
+         // These are the stopping criteria of hypergeometric_quantile_imp: when walking up
+         // from the lower end we stop at the first i with cdf[i] >= p or cdf[i] + pdf[i+1]/2 > p,
+         // and when walking down from the upper end at the last i with ccdf[i] + pdf[i]/2 >= q.
+         // Both are monotone in i, so we can search from wherever we are:
+         //
+         unsigned last = m_upper - m_lower;
+         eval_type ep = p;
+         eval_type eq = q;
+         if(ep <= 0.5)
+         {
+            if(at_or_above_p(i, ep))
+            {
+               while((i > 0) && at_or_above_p(i - 1, ep))
+                  --i;
+            }
+            else
+            {
+               while((i < last) && !at_or_above_p(i, ep))
+                  ++i;
+            }
+            return static_cast<RealType>(detail::round_x_from_p(i + m_lower, ep, m_cdf[i], m_fudge_factor, m_lower, m_upper, discrete_quantile_type()));
+         }
+         if(at_or_below_q(i, eq))
+         {
+            while((i < last) && at_or_below_q(i + 1, eq))
+               ++i;
+         }
+         else
+         {
+            while((i > 0) && !at_or_below_q(i, eq))
+               --i;
+         }
+         return static_cast<RealType>(detail::round_x_from_q(i + m_lower, eq, m_ccdf[i], m_fudge_factor, m_lower, m_upper, discrete_quantile_type()));
+      }
+      bool at_or_above_p(unsigned i, const eval_type& p)const
+      {
+         return (m_cdf[i] >= p) || (i + m_lower == m_upper) || (m_cdf[i] + m_pdf[i + 1] / 2 > p);
+      }
+      bool at_or_below_q(unsigned i, const eval_type& q)const
+      {
+         return m_ccdf[i] + m_pdf[i] / 2 >= q;
+      }
+
+      distribution_type dist;
+      unsigned m_lower, m_upper, m_mode;
+      eval_type m_fudge_factor;
+      std::vector<eval_type> m_pdf, m_cdf, m_ccdf;
+   };
 }} // namespaces
 
 // This include must be at the end, *after* the accessors
@@ -28,19 +28,17 @@ namespace boost
       template <class RealType, class Policy>
       class non_central_beta_distribution;
 
+      template <class RealType, class Policy>
+      class non_central_beta_cdf_evaluator;
+
       namespace detail{
 
-         template <class T, class Policy>
-         T non_central_beta_p(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0)
+         //
+         // Starting points for the series in non_central_beta_p and non_central_beta_q:
+         //
+         template <class T>
+         int non_central_beta_p_start(T l2)
          {
-            BOOST_MATH_STD_USING
-               using namespace boost::math;
-            //
-            // Variables come first:
-            //
-            std::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
-            T errtol = boost::math::policies::get_epsilon<T, Policy>();
-            T l2 = lam / 2;
             //
             // k is the starting point for iteration, and is the
             // maximum of the poisson weighting term,
@@ -51,8 +49,77 @@ namespace boost
             int k = itrunc(l2);
             if(k == 0)
                k = 1;
+            return k;
+         }
+
+         template <class T>
+         int non_central_beta_q_start(T a, T b, T l2)
+         {
+            //
+            // k is the starting point for iteration, and is the
+            // maximum of the poisson weighting term:
+            //
+            int k = itrunc(l2);
+            if(k <= 30)
+            {
+               //
+               // Might as well start at 0 since we'll likely have this number of terms anyway:
+               //
+               if(a + b > 1)
+                  k = 0;
+               else if(k == 0)
+                  k = 1;
+            }
+            return k;
+         }
+
+         template <class T, class Policy>
+         T non_central_beta_q_weight(int k, T l2, const Policy& pol)
+         {
+            BOOST_MATH_STD_USING
+            if(k == 0)
+            {
                // Starting Poisson weight:
-            T pois = gamma_p_derivative(T(k+1), l2, pol);
+               return exp(-l2);
+            }
+            // Starting Poisson weight:
+            return gamma_p_derivative(T(k+1), l2, pol);
+         }
+
+         //
+         // The starting Poisson weights depend only on the distribution, not on x,
+         // so when evaluating the cdf of one distribution at many points they can
+         // be computed just once:
+         //
+         template <class T>
+         struct non_central_beta_seeds
+         {
+            non_central_beta_seeds() : p_weight(0), q_weight(0) {}
+            template <class Policy>
+            non_central_beta_seeds(T a, T b, T lam, const Policy& pol)
+            {
+               T l2 = lam / 2;
+               p_weight = gamma_p_derivative(T(non_central_beta_p_start(l2) + 1), l2, pol);
+               q_weight = non_central_beta_q_weight(non_central_beta_q_start(a, b, l2), l2, pol);
+            }
+            T p_weight;  // Starting Poisson weight for non_central_beta_p.
+            T q_weight;  // Starting Poisson weight for non_central_beta_q.
+         };
+
+         template <class T, class Policy>
+         T non_central_beta_p(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0, const non_central_beta_seeds<T>* seeds = 0)
+         {
+            BOOST_MATH_STD_USING
+               using namespace boost::math;
+            //
+            // Variables come first:
+            //
+            std::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+            T errtol = boost::math::policies::get_epsilon<T, Policy>();
+            T l2 = lam / 2;
+            int k = non_central_beta_p_start(l2);
+            // Starting Poisson weight:
+            T pois = seeds ? seeds->p_weight : gamma_p_derivative(T(k+1), l2, pol);
             if(pois == 0)
                return init_val;
             // recurance term:
@@ -112,7 +179,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_beta_q(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0)
+         T non_central_beta_q(T a, T b, T lam, T x, T y, const Policy& pol, T init_val = 0, const non_central_beta_seeds<T>* seeds = 0)
          {
             BOOST_MATH_STD_USING
                using namespace boost::math;
@@ -122,32 +189,8 @@ namespace boost
             std::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
             T errtol = boost::math::policies::get_epsilon<T, Policy>();
             T l2 = lam / 2;
-            //
-            // k is the starting point for iteration, and is the
-            // maximum of the poisson weighting term:
-            //
-            int k = itrunc(l2);
-            T pois;
-            if(k <= 30)
-            {
-               //
-               // Might as well start at 0 since we'll likely have this number of terms anyway:
-               //
-               if(a + b > 1)
-                  k = 0;
-               else if(k == 0)
-                  k = 1;
-            }
-            if(k == 0)
-            {
-               // Starting Poisson weight:
-               pois = exp(-l2);
-            }
-            else
-            {
-               // Starting Poisson weight:
-               pois = gamma_p_derivative(T(k+1), l2, pol);
-            }
+            int k = non_central_beta_q_start(a, b, l2);
+            T pois = seeds ? seeds->q_weight : non_central_beta_q_weight(k, l2, pol);
             if(pois == 0)
                return init_val;
             // recurance term:
@@ -212,7 +255,8 @@ namespace boost
          }
 
          template <class RealType, class Policy>
-         inline RealType non_central_beta_cdf(RealType x, RealType y, RealType a, RealType b, RealType l, bool invert, const Policy&)
+         inline RealType non_central_beta_cdf(RealType x, RealType y, RealType a, RealType b, RealType l, bool invert, const Policy&,
+            const non_central_beta_seeds<typename policies::evaluation<RealType, Policy>::type>* seeds = 0)
          {
             typedef typename policies::evaluation<RealType, Policy>::type value_type;
             typedef typename policies::normalise<
@@ -243,7 +287,8 @@ namespace boost
                   static_cast<value_type>(x),
                   static_cast<value_type>(y),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? 0 : -1));
+                  static_cast<value_type>(invert ? 0 : -1),
+                  seeds);
                invert = !invert;
             }
             else
@@ -255,7 +300,8 @@ namespace boost
                   static_cast<value_type>(x),
                   static_cast<value_type>(y),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? -1 : 0));
+                  static_cast<value_type>(invert ? -1 : 0),
+                  seeds);
             }
             if(invert)
                result = -result;
@@ -268,17 +314,18 @@ namespace boost
          struct nc_beta_quantile_functor
          {
             nc_beta_quantile_functor(const non_central_beta_distribution<T,Policy>& d, T t, bool c)
-               : dist(d), target(t), comp(c) {}
+               : eval(d), target(t), comp(c) {}
 
             T operator()(const T& x)
             {
                return comp ?
-                  T(target - cdf(complement(dist, x)))
-                  : T(cdf(dist, x) - target);
+                  T(target - eval.cdf_complement(x))
+                  : T(eval.cdf(x) - target);
             }
 
          private:
-            non_central_beta_distribution<T,Policy> dist;
+            // All the cdf evaluations are for the same distribution:
+            non_central_beta_cdf_evaluator<T,Policy> eval;
             T target;
             bool comp;
          };
@@ -914,6 +961,111 @@ namespace boost
          return detail::nc_beta_quantile(c.dist, c.param, true);
       } // quantile complement.
 
+      //
+      // Evaluates the cdf of one non-central beta distribution at many points:
+      // the Poisson weights which start the series are computed once on construction,
+      // rather than on every call.  The results are identical to those of
+      // cdf(dist, x) and cdf(complement(dist, x)).
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class non_central_beta_cdf_evaluator
+      {
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+         typedef non_central_beta_distribution<RealType, Policy> distribution_type;
+
+         explicit non_central_beta_cdf_evaluator(const distribution_type& d)
+            : dist(d), has_seeds(false)
+         {
+            RealType a = dist.alpha();
+            RealType b = dist.beta();
+            RealType l = dist.non_centrality();
+            if((l > 0) && (boost::math::isfinite)(l) && (a > 0) && (b > 0) && (boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+            {
+               seeds = detail::non_central_beta_seeds<eval_type>(static_cast<eval_type>(a), static_cast<eval_type>(b), static_cast<eval_type>(l), forwarding_policy());
+               has_seeds = true;
+            }
+         }
+
+         const distribution_type& distribution() const
+         {
+            return dist;
+         }
+
+         RealType cdf(const RealType& x) const
+         {
+            return evaluate(x, false);
+         }
+
+         RealType cdf_complement(const RealType& x) const
+         {
+            return evaluate(x, true);
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf(InputIterator first, InputIterator last, OutputIterator out) const
+         {
+            for(; first != last; ++first, ++out)
+               *out = evaluate(static_cast<RealType>(*first), false);
+            return out;
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf_complement(InputIterator first, InputIterator last, OutputIterator out) const
+         {
+            for(; first != last; ++first, ++out)
+               *out = evaluate(static_cast<RealType>(*first), true);
+            return out;
+         }
+
+      private:
+         RealType evaluate(const RealType& x, bool comp) const
+         {
+            const char* function = "boost::math::non_central_beta_distribution<%1%>::cdf(%1%)";
+            RealType a = dist.alpha();
+            RealType b = dist.beta();
+            RealType l = dist.non_centrality();
+            RealType r;
+            if(!beta_detail::check_alpha(
+               function,
+               a, &r, Policy())
+               ||
+            !beta_detail::check_beta(
+               function,
+               b, &r, Policy())
+               ||
+            !detail::check_non_centrality(
+               function,
+               l,
+               &r,
+               Policy())
+               ||
+            !beta_detail::check_x(
+               function,
+               x,
+               &r,
+               Policy()))
+                  return (RealType)r;
+
+            if(l == 0)
+               return comp ? boost::math::cdf(complement(beta_distribution<RealType, Policy>(a, b), x)) : boost::math::cdf(beta_distribution<RealType, Policy>(a, b), x);
+
+            return detail::non_central_beta_cdf(x, RealType(1 - x), a, b, l, comp, Policy(), has_seeds ? &seeds : 0);
+         }
+
+         distribution_type dist;
+         detail::non_central_beta_seeds<eval_type> seeds;
+         bool has_seeds;
+      };
+
    } // namespace math
 } // namespace boost
 
@@ -32,8 +32,30 @@ namespace boost
 
       namespace detail{
 
+         //
+         // The Poisson weights which start the series below depend only on the
+         // non-centrality, so when evaluating the cdf of one distribution at
+         // many points they can be computed just once:
+         //
+         template <class T>
+         struct non_central_chi_square_seeds
+         {
+            non_central_chi_square_seeds() : peak_weight(0), zero_weight(0) {}
+            template <class Policy>
+            non_central_chi_square_seeds(T theta, const Policy& pol)
+            {
+               BOOST_MATH_STD_USING
+               T lambda = theta / 2;
+               int k = iround(lambda, pol);
+               peak_weight = boost::math::gamma_p_derivative(static_cast<T>(1 + k), lambda, pol);
+               zero_weight = exp(-lambda);
+            }
+            T peak_weight;  // Poisson weight at k = iround(theta / 2).
+            T zero_weight;  // Poisson weight at k = 0.
+         };
+
          template <class T, class Policy>
-         T non_central_chi_square_q(T x, T f, T theta, const Policy& pol, T init_sum = 0)
+         T non_central_chi_square_q(T x, T f, T theta, const Policy& pol, T init_sum = 0, const non_central_chi_square_seeds<T>* seeds = 0)
          {
             //
             // Computes the complement of the Non-Central Chi-Square
@@ -73,7 +95,7 @@ namespace boost
             //
             int k = iround(lambda, pol);
             // Forwards and backwards Poisson weights:
-            T poisf = boost::math::gamma_p_derivative(static_cast<T>(1 + k), lambda, pol);
+            T poisf = seeds ? seeds->peak_weight : boost::math::gamma_p_derivative(static_cast<T>(1 + k), lambda, pol);
             T poisb = poisf * k / lambda;
             // Initial forwards central chi squared term:
             T gamf = boost::math::gamma_q(del + k, y, pol);
@@ -128,7 +150,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_chi_square_p_ding(T x, T f, T theta, const Policy& pol, T init_sum = 0)
+         T non_central_chi_square_p_ding(T x, T f, T theta, const Policy& pol, T init_sum = 0, const non_central_chi_square_seeds<T>* seeds = 0)
          {
             //
             // This is an implementation of:
@@ -151,7 +173,7 @@ namespace boost
                return 0;
             T tk = boost::math::gamma_p_derivative(f/2 + 1, x/2, pol);
             T lambda = theta / 2;
-            T vk = exp(-lambda);
+            T vk = seeds ? seeds->zero_weight : exp(-lambda);
             T uk = vk;
             T sum = init_sum + tk * vk;
             if(sum == 0)
@@ -183,7 +205,7 @@ namespace boost
 
 
          template <class T, class Policy>
-         T non_central_chi_square_p(T y, T n, T lambda, const Policy& pol, T init_sum)
+         T non_central_chi_square_p(T y, T n, T lambda, const Policy& pol, T init_sum, const non_central_chi_square_seeds<T>* seeds = 0)
          {
             //
             // This is taken more or less directly from:
@@ -225,7 +247,7 @@ namespace boost
             // Central chi squared term for backward iteration:
             T gamkb = gamkf;
             // Forwards Poisson weight:
-            T poiskf = gamma_p_derivative(static_cast<T>(k+1), del, pol);
+            T poiskf = seeds ? seeds->peak_weight : gamma_p_derivative(static_cast<T>(k+1), del, pol);
             // Backwards Poisson weight:
             T poiskb = poiskf;
             // Forwards gamma function recursion term:
@@ -321,7 +343,8 @@ namespace boost
          }
 
          template <class RealType, class Policy>
-         inline RealType non_central_chi_squared_cdf(RealType x, RealType k, RealType l, bool invert, const Policy&)
+         inline RealType non_central_chi_squared_cdf(RealType x, RealType k, RealType l, bool invert, const Policy&,
+            const non_central_chi_square_seeds<typename policies::evaluation<RealType, Policy>::type>* seeds = 0)
          {
             typedef typename policies::evaluation<RealType, Policy>::type value_type;
             typedef typename policies::normalise<
@@ -343,7 +366,8 @@ namespace boost
                   static_cast<value_type>(k),
                   static_cast<value_type>(l),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? 0 : -1));
+                  static_cast<value_type>(invert ? 0 : -1),
+                  seeds);
                invert = !invert;
             }
             else if(l < 200)
@@ -355,7 +379,8 @@ namespace boost
                   static_cast<value_type>(k),
                   static_cast<value_type>(l),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? -1 : 0));
+                  static_cast<value_type>(invert ? -1 : 0),
+                  seeds);
             }
             else
             {
@@ -369,7 +394,8 @@ namespace boost
                   static_cast<value_type>(k),
                   static_cast<value_type>(l),
                   forwarding_policy(),
-                  static_cast<value_type>(invert ? -1 : 0));
+                  static_cast<value_type>(invert ? -1 : 0),
+                  seeds);
             }
             if(invert)
                result = -result;
@@ -985,6 +1011,127 @@ namespace boost
          return detail::nccs_quantile(c.dist, c.param, true);
       } // quantile complement.
 
+      //
+      // Evaluates the cdf of one non-central chi squared distribution at many points:
+      // the Poisson weights which start the series are computed once on construction,
+      // rather than on every call.  The results are identical to those of
+      // cdf(dist, x) and cdf(complement(dist, x)).
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class non_central_chi_squared_cdf_evaluator
+      {
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+         typedef non_central_chi_squared_distribution<RealType, Policy> distribution_type;
+
+         explicit non_central_chi_squared_cdf_evaluator(const distribution_type& d)
+            : dist(d), has_seeds(false)
+         {
+            RealType l = dist.non_centrality();
+            if((l > 0) && (boost::math::isfinite)(l))
+            {
+               seeds = detail::non_central_chi_square_seeds<eval_type>(static_cast<eval_type>(l), forwarding_policy());
+               has_seeds = true;
+            }
+         }
+
+         const distribution_type& distribution() const
+         {
+            return dist;
+         }
+
+         RealType cdf(const RealType& x) const
+         {
+            return evaluate(x, false);
+         }
+
+         RealType cdf_complement(const RealType& x) const
+         {
+            return evaluate(x, true);
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf(InputIterator first, InputIterator last, OutputIterator out) const
+         {
+            for(; first != last; ++first, ++out)
+               *out = evaluate(static_cast<RealType>(*first), false);
+            return out;
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf_complement(InputIterator first, InputIterator last, OutputIterator out) const
+         {
+            for(; first != last; ++first, ++out)
+               *out = evaluate(static_cast<RealType>(*first), true);
+            return out;
+         }
+
+      private:
+         RealType evaluate(const RealType& x, bool comp) const
+         {
+            const char* function = "boost::math::non_central_chi_squared_distribution<%1%>::cdf(%1%)";
+            RealType k = dist.degrees_of_freedom();
+            RealType l = dist.non_centrality();
+            RealType r;
+            if(!detail::check_df(
+               function,
+               k, &r, Policy())
+               ||
+            !detail::check_non_centrality(
+               function,
+               l,
+               &r,
+               Policy())
+               ||
+            !detail::check_positive_x(
+               function,
+               x,
+               &r,
+               Policy()))
+                  return r;
+
+            return detail::non_central_chi_squared_cdf(x, k, l, comp, Policy(), has_seeds ? &seeds : 0);
+         }
+
+         distribution_type dist;
+         detail::non_central_chi_square_seeds<eval_type> seeds;
+         bool has_seeds;
+      };
+
+      namespace detail{
+
+         //
+         // The quantile is found by root finding on the cdf, all at the same distribution:
+         //
+         template <class RealType, class Policy>
+         struct generic_quantile_finder<non_central_chi_squared_distribution<RealType, Policy> >
+         {
+            generic_quantile_finder(const non_central_chi_squared_distribution<RealType, Policy>& d, RealType t, bool c)
+               : eval(d), target(t), comp(c) {}
+
+            RealType operator()(const RealType& x)
+            {
+               return comp ?
+                  RealType(target - eval.cdf_complement(x))
+                  : RealType(eval.cdf(x) - target);
+            }
+
+         private:
+            non_central_chi_squared_cdf_evaluator<RealType, Policy> eval;
+            RealType target;
+            bool comp;
+         };
+
+      } // namespace detail
+
    } // namespace math
 } // namespace boost
 
@@ -396,6 +396,111 @@ namespace boost
          return (x / (1 - x)) * (c.dist.degrees_of_freedom2() / c.dist.degrees_of_freedom1());
       } // quantile complement.
 
+      //
+      // Evaluates the cdf of one non-central F distribution at many points:
+      // the Poisson weights which start the non-central beta series are computed
+      // once on construction, rather than on every call.  The results are identical
+      // to those of cdf(dist, x) and cdf(complement(dist, x)).
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class non_central_f_cdf_evaluator
+      {
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+         typedef non_central_f_distribution<RealType, Policy> distribution_type;
+
+         explicit non_central_f_cdf_evaluator(const distribution_type& d)
+            : dist(d), has_seeds(false)
+         {
+            RealType alpha = dist.degrees_of_freedom1() / 2;
+            RealType beta = dist.degrees_of_freedom2() / 2;
+            RealType l = dist.non_centrality();
+            if((l > 0) && (boost::math::isfinite)(l) && (alpha > 0) && (beta > 0) && (boost::math::isfinite)(alpha) && (boost::math::isfinite)(beta))
+            {
+               seeds = detail::non_central_beta_seeds<eval_type>(static_cast<eval_type>(alpha), static_cast<eval_type>(beta), static_cast<eval_type>(l), forwarding_policy());
+               has_seeds = true;
+            }
+         }
+
+         const distribution_type& distribution() const
+         {
+            return dist;
+         }
+
+         RealType cdf(const RealType& x) const
+         {
+            return evaluate(x, false);
+         }
+
+         RealType cdf_complement(const RealType& x) const
+         {
+            return evaluate(x, true);
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf(InputIterator first, InputIterator last, OutputIterator out) const
+         {
+            for(; first != last; ++first, ++out)
+               *out = evaluate(static_cast<RealType>(*first), false);
+            return out;
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf_complement(InputIterator first, InputIterator last, OutputIterator out) const
+         {
+            for(; first != last; ++first, ++out)
+               *out = evaluate(static_cast<RealType>(*first), true);
+            return out;
+         }
+
+      private:
+         RealType evaluate(const RealType& x, bool comp) const
+         {
+            const char* function = comp ? "cdf(complement(const non_central_f_distribution<%1%>&, %1%))" : "cdf(const non_central_f_distribution<%1%>&, %1%)";
+            RealType r;
+            if(!detail::check_df(
+               function,
+               dist.degrees_of_freedom1(), &r, Policy())
+                  ||
+               !detail::check_df(
+                  function,
+                  dist.degrees_of_freedom2(), &r, Policy())
+                  ||
+               !detail::check_non_centrality(
+                  function,
+                  dist.non_centrality(),
+                  &r,
+                  Policy()))
+                  return r;
+
+            if((x < 0) || !(boost::math::isfinite)(x))
+            {
+               return policies::raise_domain_error<RealType>(
+                  function, "Random Variable parameter was %1%, but must be > 0 !", x, Policy());
+            }
+
+            RealType alpha = dist.degrees_of_freedom1() / 2;
+            RealType beta = dist.degrees_of_freedom2() / 2;
+            RealType y = x * alpha / beta;
+            RealType c = y / (1 + y);
+            RealType cp = 1 / (1 + y);
+            return detail::non_central_beta_cdf(c, cp, alpha, beta,
+               dist.non_centrality(), comp, Policy(), has_seeds ? &seeds : 0);
+         }
+
+         distribution_type dist;
+         detail::non_central_beta_seeds<eval_type> seeds;
+         bool has_seeds;
+      };
+
    } // namespace math
 } // namespace boost
 
@@ -26,8 +26,43 @@ namespace boost
 
       namespace detail{
 
+         //
+         // Starting Poisson weights for non_central_t2_p and non_central_t2_q,
+         // k is the starting point for the iteration:
+         //
+         template <class T, class Policy>
+         T non_central_t2_p_weight(T delta, T d2, int k, const Policy& pol)
+         {
+            return gamma_p_derivative(T(k+1), d2, pol) 
+               * tgamma_delta_ratio(T(k + 1), T(0.5f))
+               * delta / constants::root_two<T>();
+         }
+
          template <class T, class Policy>
-         T non_central_t2_p(T v, T delta, T x, T y, const Policy& pol, T init_val)
+         T non_central_t2_q_weight(T delta, T d2, int k, const Policy& pol)
+         {
+            BOOST_MATH_STD_USING
+            T pois;
+            if((k < (int)(max_factorial<T>::value)) && (d2 < tools::log_max_value<T>()) && (log(d2) * k < tools::log_max_value<T>()))
+            {
+               //
+               // For small k we can optimise this calculation by using
+               // a simpler reduced formula:
+               //
+               pois = exp(-d2);
+               pois *= pow(d2, static_cast<T>(k));
+               pois /= boost::math::tgamma(T(k + 1 + 0.5), pol);
+               pois *= delta / constants::root_two<T>();
+            }
+            else
+            {
+               pois = non_central_t2_p_weight(delta, d2, k, pol);
+            }
+            return pois;
+         }
+
+         template <class T, class Policy>
+         T non_central_t2_p(T v, T delta, T x, T y, const Policy& pol, T init_val, const T* weight = 0)
          {
             BOOST_MATH_STD_USING
             //
@@ -44,12 +79,9 @@ namespace boost
             // delta = 0.16212868690490723, x = 0.86987415482475994).
             //
             int k = itrunc(d2);
-            T pois;
             if(k == 0) k = 1;
             // Starting Poisson weight:
-            pois = gamma_p_derivative(T(k+1), d2, pol) 
-               * tgamma_delta_ratio(T(k + 1), T(0.5f))
-               * delta / constants::root_two<T>();
+            T pois = weight ? *weight : non_central_t2_p_weight(delta, d2, k, pol);
             if(pois == 0)
                return init_val;
             T xterm, beta;
@@ -105,7 +137,7 @@ namespace boost
          }
 
          template <class T, class Policy>
-         T non_central_t2_q(T v, T delta, T x, T y, const Policy& pol, T init_val)
+         T non_central_t2_q(T v, T delta, T x, T y, const Policy& pol, T init_val, const T* weight = 0)
          {
             BOOST_MATH_STD_USING
             //
@@ -124,24 +156,7 @@ namespace boost
             int k = itrunc(d2);
             if(k == 0) k = 1;
             // Starting Poisson weight:
-            T pois;
-            if((k < (int)(max_factorial<T>::value)) && (d2 < tools::log_max_value<T>()) && (log(d2) * k < tools::log_max_value<T>()))
-            {
-               //
-               // For small k we can optimise this calculation by using
-               // a simpler reduced formula:
-               //
-               pois = exp(-d2);
-               pois *= pow(d2, static_cast<T>(k));
-               pois /= boost::math::tgamma(T(k + 1 + 0.5), pol);
-               pois *= delta / constants::root_two<T>();
-            }
-            else
-            {
-               pois = gamma_p_derivative(T(k+1), d2, pol) 
-                  * tgamma_delta_ratio(T(k + 1), T(0.5f))
-                  * delta / constants::root_two<T>();
-            }
+            T pois = weight ? *weight : non_central_t2_q_weight(delta, d2, k, pol);
             if(pois == 0)
                return init_val;
             // Recurance term:
@@ -202,8 +217,45 @@ namespace boost
             return sum;
          }
 
+         //
+         // Everything in non_central_t_cdf which depends only on the distribution
+         // and not on t, so that when evaluating the cdf of one distribution at
+         // many points it can be computed just once.  The weights for the
+         // reflected distribution (t < 0) are those for -delta: the Poisson weights
+         // are odd functions of delta, and IEEE arithmetic is symmetric under
+         // negation, so these are obtained exactly by changing sign.
+         //
+         template <class T>
+         struct non_central_t_seeds
+         {
+            non_central_t_seeds() : t2_p_weight(0), t2_q_weight(0)
+            {
+               normal_p[0] = normal_p[1] = normal_q[0] = normal_q[1] = 0;
+            }
+            template <class Policy>
+            non_central_t_seeds(T v, T delta, const Policy& pol)
+               : beta(T(0.5f), T(v / 2), T(delta * delta), pol)
+            {
+               BOOST_MATH_STD_USING
+               T d2 = delta * delta / 2;
+               int k = itrunc(d2);
+               if(k == 0) k = 1;
+               t2_p_weight = non_central_t2_p_weight(delta, d2, k, pol);
+               t2_q_weight = non_central_t2_q_weight(delta, d2, k, pol);
+               normal_p[0] = cdf(boost::math::normal_distribution<T, Policy>(), -delta);
+               normal_p[1] = cdf(boost::math::normal_distribution<T, Policy>(), delta);
+               normal_q[0] = cdf(complement(boost::math::normal_distribution<T, Policy>(), -delta));
+               normal_q[1] = cdf(complement(boost::math::normal_distribution<T, Policy>(), delta));
+            }
+            non_central_beta_seeds<T> beta;  // For the non-central beta part of the sum.
+            T t2_p_weight;  // Starting weight for non_central_t2_p.
+            T t2_q_weight;  // Starting weight for non_central_t2_q.
+            T normal_p[2];  // cdf of the standard normal at -delta, and (reflected) delta.
+            T normal_q[2];  // Likewise the complement.
+         };
+
          template <class T, class Policy>
-         T non_central_t_cdf(T v, T delta, T t, bool invert, const Policy& pol)
+         T non_central_t_cdf(T v, T delta, T t, bool invert, const Policy& pol, const non_central_t_seeds<T>* seeds = 0)
          {
             BOOST_MATH_STD_USING
             if ((boost::math::isinf)(v))
@@ -213,11 +265,13 @@ namespace boost
             }
             //
             // Otherwise, for t < 0 we have to use the reflection formula:
+            int reflected = 0;
             if(t < 0)
             {
                t = -t;
                delta = -delta;
                invert = !invert;
+               reflected = 1;
             }
             if(fabs(delta / (4 * v)) < policies::get_epsilon<T, Policy>())
             {
@@ -258,13 +312,14 @@ namespace boost
                //
                if(x != 0)
                {
-                  result = non_central_beta_p(a, b, d2, x, y, pol);
-                  result = non_central_t2_p(v, delta, x, y, pol, result);
+                  T weight = seeds ? (reflected ? T(-seeds->t2_p_weight) : seeds->t2_p_weight) : T(0);
+                  result = non_central_beta_p(a, b, d2, x, y, pol, T(0), seeds ? &seeds->beta : 0);
+                  result = non_central_t2_p(v, delta, x, y, pol, result, seeds ? &weight : 0);
                   result /= 2;
                }
                else
                   result = 0;
-               result += cdf(boost::math::normal_distribution<T, Policy>(), -delta);
+               result += seeds ? seeds->normal_p[reflected] : cdf(boost::math::normal_distribution<T, Policy>(), -delta);
             }
             else
             {
@@ -274,12 +329,13 @@ namespace boost
                invert = !invert;
                if(x != 0)
                {
-                  result = non_central_beta_q(a, b, d2, x, y, pol);
-                  result = non_central_t2_q(v, delta, x, y, pol, result);
+                  T weight = seeds ? (reflected ? T(-seeds->t2_q_weight) : seeds->t2_q_weight) : T(0);
+                  result = non_central_beta_q(a, b, d2, x, y, pol, T(0), seeds ? &seeds->beta : 0);
+                  result = non_central_t2_q(v, delta, x, y, pol, result, seeds ? &weight : 0);
                   result /= 2;
                }
                else // x == 0
-                  result = cdf(complement(boost::math::normal_distribution<T, Policy>(), -delta));
+                  result = seeds ? seeds->normal_q[reflected] : cdf(complement(boost::math::normal_distribution<T, Policy>(), -delta));
             }
             if(invert)
                result = 1 - result;
@@ -1190,6 +1246,145 @@ namespace boost
          return detail::non_central_t_quantile(function, v, l, RealType(1-q), q, Policy());
       } // quantile complement.
 
+      //
+      // Evaluates the cdf of one non-central t distribution at many points:
+      // the Poisson weights which start the series, and the normal cdf terms,
+      // are computed once on construction, rather than on every call.
+      // The results are identical to those of cdf(dist, x) and cdf(complement(dist, x)).
+      //
+      template <class RealType = double, class Policy = policies::policy<> >
+      class non_central_t_cdf_evaluator
+      {
+         typedef typename policies::evaluation<RealType, Policy>::type eval_type;
+         typedef typename policies::normalise<
+            Policy, 
+            policies::promote_float<false>, 
+            policies::promote_double<false>, 
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+      public:
+         typedef RealType value_type;
+         typedef Policy policy_type;
+         typedef non_central_t_distribution<RealType, Policy> distribution_type;
+
+         explicit non_central_t_cdf_evaluator(const distribution_type& d)
+            : dist(d), has_seeds(false)
+         {
+            BOOST_MATH_STD_USING
+            eval_type v = dist.degrees_of_freedom();
+            eval_type l = dist.non_centrality();
+            // Only needed when non_central_t_cdf sums the series:
+            if((v > 0) && (boost::math::isfinite)(v) && (l != 0) && (boost::math::isfinite)(l)
+               && !(fabs(l / (4 * v)) < policies::get_epsilon<eval_type, Policy>()))
+            {
+               seeds = detail::non_central_t_seeds<eval_type>(v, l, Policy());
+               has_seeds = true;
+            }
+         }
+
+         const distribution_type& distribution() const
+         {
+            return dist;
+         }
+
+         RealType cdf(const RealType& x) const
+         {
+            return evaluate(x, false);
+         }
+
+         RealType cdf_complement(const RealType& x) const
+         {
+            return evaluate(x, true);
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf(InputIterator first, InputIterator last, OutputIterator out) const
+         {
+            for(; first != last; ++first, ++out)
+               *out = evaluate(static_cast<RealType>(*first), false);
+            return out;
+         }
+
+         template <class InputIterator, class OutputIterator>
+         OutputIterator cdf_complement(InputIterator first, InputIterator last, OutputIterator out) const
+         {
+            for(; first != last; ++first, ++out)
+               *out = evaluate(static_cast<RealType>(*first), true);
+            return out;
+         }
+
+      private:
+         RealType evaluate(const RealType& x, bool comp) const
+         {
+            const char* function = comp ? "boost::math::cdf(const complement(non_central_t_distribution<%1%>&), %1%)" : "boost::math::cdf(non_central_t_distribution<%1%>&, %1%)";
+            RealType v = dist.degrees_of_freedom();
+            RealType l = dist.non_centrality();
+            RealType r;
+            if(!detail::check_df_gt0_to_inf(
+               function,
+               v, &r, Policy())
+               ||
+            !detail::check_finite(
+               function,
+               l,
+               &r,
+               Policy())
+               ||
+            !detail::check_x(
+               function,
+               x,
+               &r,
+               Policy()))
+                  return (RealType)r;
+
+            if (comp && (boost::math::isinf)(v))
+            { // Infinite degrees of freedom, so use normal distribution located at delta.
+               return boost::math::cdf(complement(normal_distribution<RealType, Policy>(l, 1), x));
+            }
+            if(l == 0)
+            { // No non-centrality, so use Student's t instead.
+               return comp ? boost::math::cdf(complement(students_t_distribution<RealType, Policy>(v), x)) : boost::math::cdf(students_t_distribution<RealType, Policy>(v), x);
+            }
+            return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+               detail::non_central_t_cdf(
+                  static_cast<eval_type>(v), 
+                  static_cast<eval_type>(l), 
+                  static_cast<eval_type>(x), 
+                  comp, Policy(), has_seeds ? &seeds : 0),
+               function);
+         }
+
+         distribution_type dist;
+         detail::non_central_t_seeds<eval_type> seeds;
+         bool has_seeds;
+      };
+
+      namespace detail{
+
+         //
+         // The quantile is found by root finding on the cdf, all at the same distribution:
+         //
+         template <class RealType, class Policy>
+         struct generic_quantile_finder<non_central_t_distribution<RealType, Policy> >
+         {
+            generic_quantile_finder(const non_central_t_distribution<RealType, Policy>& d, RealType t, bool c)
+               : eval(d), target(t), comp(c) {}
+
+            RealType operator()(const RealType& x)
+            {
+               return comp ?
+                  RealType(target - eval.cdf_complement(x))
+                  : RealType(eval.cdf(x) - target);
+            }
+
+         private:
+            non_central_t_cdf_evaluator<RealType, Policy> eval;
+            RealType target;
+            bool comp;
+         };
+
+      } // namespace detail
+
    } // namespace math
 } // namespace boost
 
@@ -0,0 +1,511 @@
+/*
+ * Copyright agent 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_FILTERS_DAUBECHIES_TRANSFORM_HPP
+#define BOOST_MATH_FILTERS_DAUBECHIES_TRANSFORM_HPP
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <boost/math/filters/daubechies.hpp>
+#include <boost/math/constants/constants.hpp>
+
+namespace boost::math::filters {
+
+namespace detail {
+
+template<class Real, std::size_t L>
+constexpr std::array<Real, L> dwt_wavelet_filter(const std::array<Real, L>& h)
+{
+    // Same as daubechies_wavelet_filter, but usable in constant expressions:
+    std::array<Real, L> g{};
+    for (std::size_t i = 0; i < L; i += 2)
+    {
+        g[i] = h[L - i - 1];
+        g[i+1] = -h[L - i - 2];
+    }
+    return g;
+}
+
+// One level of the periodized filter bank:
+// a[k] = sum_m h[m] x[(2k+m) mod n], d[k] = sum_m g[m] x[(2k+m) mod n].
+template<class Real, std::size_t L, class InputIterator, class OutputIterator>
+void dwt_periodic_step(const std::array<Real, L>& h, const std::array<Real, L>& g, InputIterator x, std::size_t n, OutputIterator a, OutputIterator d)
+{
+    std::size_t half = n/2;
+    std::size_t k = 0;
+    // The bulk of the signal needs no wraparound:
+    for (; k < half && 2*k + L <= n; ++k)
+    {
+        Real ak = 0;
+        Real dk = 0;
+        for (std::size_t m = 0; m < L; ++m)
+        {
+            Real xm = x[2*k + m];
+            ak += h[m]*xm;
+            dk += g[m]*xm;
+        }
+        a[k] = ak;
+        d[k] = dk;
+    }
+    for (; k < half; ++k)
+    {
+        Real ak = 0;
+        Real dk = 0;
+        for (std::size_t m = 0; m < L; ++m)
+        {
+            Real xm = x[(2*k + m) % n];
+            ak += h[m]*xm;
+            dk += g[m]*xm;
+        }
+        a[k] = ak;
+        d[k] = dk;
+    }
+}
+
+// The transpose of dwt_periodic_step, written as a gather so that each output is written once:
+// x[2j] = sum_i h[2i]a[j-i] + g[2i]d[j-i], x[2j+1] = sum_i h[2i+1]a[j-i] + g[2i+1]d[j-i].
+template<class Real, std::size_t L, class InputIterator, class OutputIterator>
+void idwt_periodic_step(const std::array<Real, L>& h, const std::array<Real, L>& g, InputIterator a, InputIterator d, std::size_t n, OutputIterator x)
+{
+    std::size_t half = n/2;
+    for (std::size_t j = 0; j < half; ++j)
+    {
+        Real even = 0;
+        Real odd = 0;
+        if (j + 1 >= L/2)
+        {
+            for (std::size_t i = 0; i < L/2; ++i)
+            {
+                Real ak = a[j - i];
+                Real dk = d[j - i];
+                even += h[2*i]*ak + g[2*i]*dk;
+                odd += h[2*i+1]*ak + g[2*i+1]*dk;
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < L/2; ++i)
+            {
+                // (j - i) mod half, without going negative:
+                std::size_t k = (j + half*(i/half + 1) - i) % half;
+                Real ak = a[k];
+                Real dk = d[k];
+                even += h[2*i]*ak + g[2*i]*dk;
+                odd += h[2*i+1]*ak + g[2*i+1]*dk;
+            }
+        }
+        x[2*j] = even;
+        x[2*j+1] = odd;
+    }
+}
+
+// Half-sample symmetric extension, x[-1] = x[0], x[n] = x[n-1], as used by PyWavelets' "symmetric" mode:
+inline std::size_t symmetric_index(std::ptrdiff_t i, std::size_t n)
+{
+    std::ptrdiff_t period = 2*static_cast<std::ptrdiff_t>(n);
+    i %= period;
+    if (i < 0)
+    {
+        i += period;
+    }
+    if (i >= static_cast<std::ptrdiff_t>(n))
+    {
+        i = period - 1 - i;
+    }
+    return static_cast<std::size_t>(i);
+}
+
+// Length of the approximation produced from a signal of length n by the symmetric transform:
+template<std::size_t L>
+constexpr std::size_t symmetric_output_length(std::size_t n)
+{
+    return (n + L - 1)/2;
+}
+
+inline void check_dyadic_length(std::size_t n, std::size_t levels, const char* function)
+{
+    using std::to_string;
+    if (levels == 0 || levels >= sizeof(std::size_t)*8 || n == 0 || n % (std::size_t(1) << levels) != 0)
+    {
+        throw std::domain_error(std::string("In ") + function + ": the signal length " + to_string(n)
+                                + " must be a nonzero multiple of 2^levels = 2^" + to_string(levels) + ".");
+    }
+}
+
+} // namespace detail
+
+// Multilevel periodized discrete wavelet transform, computed in place.
+// After the call [first, last) holds [a_J, d_J, d_{J-1}, ..., d_1], with J = levels.
+// workspace must have room for std::distance(first, last) values.
+template<unsigned p, class RandomAccessIterator, class WorkspaceIterator>
+void daubechies_dwt(RandomAccessIterator first, RandomAccessIterator last, WorkspaceIterator workspace, std::size_t levels = 1)
+{
+    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    const auto h = daubechies_scaling_filter<Real, p>();
+    const auto g = detail::dwt_wavelet_filter(h);
+    std::size_t n = std::distance(first, last);
+    detail::check_dyadic_length(n, levels, "daubechies_dwt");
+    for (std::size_t level = 0; level < levels; ++level)
+    {
+        std::size_t len = n >> level;
+        detail::dwt_periodic_step(h, g, first, len, workspace, workspace + len/2);
+        std::copy(workspace, workspace + len, first);
+    }
+}
+
+// Inverse of daubechies_dwt.
+template<unsigned p, class RandomAccessIterator, class WorkspaceIterator>
+void daubechies_idwt(RandomAccessIterator first, RandomAccessIterator last, WorkspaceIterator workspace, std::size_t levels = 1)
+{
+    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    const auto h = daubechies_scaling_filter<Real, p>();
+    const auto g = detail::dwt_wavelet_filter(h);
+    std::size_t n = std::distance(first, last);
+    detail::check_dyadic_length(n, levels, "daubechies_idwt");
+    for (std::size_t level = levels; level > 0; --level)
+    {
+        std::size_t len = n >> (level - 1);
+        detail::idwt_periodic_step(h, g, first, first + len/2, len, workspace);
+        std::copy(workspace, workspace + len, first);
+    }
+}
+
+// Separable two dimensional transform of the rows x cols row-major array starting at first.
+// Each level transforms the rows and then the columns of the low-pass block left by the previous level.
+// workspace must have room for 2*max(rows, cols) values.
+template<unsigned p, class RandomAccessIterator, class WorkspaceIterator>
+void daubechies_dwt_2d(RandomAccessIterator first, std::size_t rows, std::size_t cols, WorkspaceIterator workspace, std::size_t levels = 1)
+{
+    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    const auto h = daubechies_scaling_filter<Real, p>();
+    const auto g = detail::dwt_wavelet_filter(h);
+    detail::check_dyadic_length(rows, levels, "daubechies_dwt_2d");
+    detail::check_dyadic_length(cols, levels, "daubechies_dwt_2d");
+    for (std::size_t level = 0; level < levels; ++level)
+    {
+        std::size_t r = rows >> level;
+        std::size_t c = cols >> level;
+        for (std::size_t i = 0; i < r; ++i)
+        {
+            auto row = first + i*cols;
+            detail::dwt_periodic_step(h, g, row, c, workspace, workspace + c/2);
+            std::copy(workspace, workspace + c, row);
+        }
+        for (std::size_t j = 0; j < c; ++j)
+        {
+            for (std::size_t i = 0; i < r; ++i)
+            {
+                workspace[i] = first[i*cols + j];
+            }
+            detail::dwt_periodic_step(h, g, workspace, r, workspace + r, workspace + r + r/2);
+            for (std::size_t i = 0; i < r; ++i)
+            {
+                first[i*cols + j] = workspace[r + i];
+            }
+        }
+    }
+}
+
+// Inverse of daubechies_dwt_2d.
+template<unsigned p, class RandomAccessIterator, class WorkspaceIterator>
+void daubechies_idwt_2d(RandomAccessIterator first, std::size_t rows, std::size_t cols, WorkspaceIterator workspace, std::size_t levels = 1)
+{
+    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    const auto h = daubechies_scaling_filter<Real, p>();
+    const auto g = detail::dwt_wavelet_filter(h);
+    detail::check_dyadic_length(rows, levels, "daubechies_idwt_2d");
+    detail::check_dyadic_length(cols, levels, "daubechies_idwt_2d");
+    for (std::size_t level = levels; level > 0; --level)
+    {
+        std::size_t r = rows >> (level - 1);
+        std::size_t c = cols >> (level - 1);
+        for (std::size_t j = 0; j < c; ++j)
+        {
+            for (std::size_t i = 0; i < r; ++i)
+            {
+                workspace[i] = first[i*cols + j];
+            }
+            detail::idwt_periodic_step(h, g, workspace, workspace + r/2, r, workspace + r);
+            for (std::size_t i = 0; i < r; ++i)
+            {
+                first[i*cols + j] = workspace[r + i];
+            }
+        }
+        for (std::size_t i = 0; i < r; ++i)
+        {
+            auto row = first + i*cols;
+            detail::idwt_periodic_step(h, g, row, row + c/2, c, workspace);
+            std::copy(workspace, workspace + c, row);
+        }
+    }
+}
+
+// In place lifting implementation of the periodized transform for p = 1 (Haar) and p = 2 (D4),
+// see Daubechies and Sweldens, "Factoring wavelet transforms into lifting steps".
+// No workspace is needed, but the coefficients are left interleaved: after level j the
+// approximation and detail coefficients of that level alternate at a stride of 2^(j-1),
+// so that a_J[k] = x[k*2^J] and d_j[k] = x[k*2^j + 2^(j-1)].
+// The coefficients are the same as those computed by daubechies_dwt.
+template<unsigned p, class RandomAccessIterator>
+void daubechies_lifting_dwt(RandomAccessIterator first, RandomAccessIterator last, std::size_t levels = 1)
+{
+    static_assert(p == 1 || p == 2, "The lifting scheme is only implemented for 1 and 2 vanishing moments.");
+    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    std::size_t n = std::distance(first, last);
+    detail::check_dyadic_length(n, levels, "daubechies_lifting_dwt");
+    for (std::size_t level = 0; level < levels; ++level)
+    {
+        std::size_t s = std::size_t(1) << level;
+        std::size_t m = (n >> level)/2;
+        auto e = [&](std::size_t k) -> decltype(first[0]) { return first[2*k*s]; };
+        auto o = [&](std::size_t k) -> decltype(first[0]) { return first[(2*k+1)*s]; };
+        if constexpr (p == 1)
+        {
+            for (std::size_t k = 0; k < m; ++k)
+            {
+                Real d = o(k) - e(k);
+                Real a = e(k) + d/2;
+                e(k) = constants::root_two<Real>()*a;
+                o(k) = -d*constants::half_root_two<Real>();
+            }
+        }
+        else
+        {
+            using constants::root_three;
+            using constants::half_root_two;
+            const Real u0 = root_three<Real>()/4;
+            const Real u1 = (root_three<Real>() - 2)/4;
+            // (sqrt(3) + 1)/sqrt(2) and its reciprocal:
+            const Real K = (root_three<Real>() + 1)*half_root_two<Real>();
+            const Real K_inv = (root_three<Real>() - 1)*half_root_two<Real>();
+            for (std::size_t k = 0; k < m; ++k)
+            {
+                o(k) -= root_three<Real>()*e(k);
+            }
+            for (std::size_t k = 0; k + 1 < m; ++k)
+            {
+                e(k) += u0*o(k) + u1*o(k+1);
+            }
+            e(m-1) += u0*o(m-1) + u1*o(0);
+            for (std::size_t k = m - 1; k > 0; --k)
+            {
+                o(k) += e(k-1);
+            }
+            o(0) += e(m-1);
+            // The last factor of the polyphase matrix advances the detail coefficients by one:
+            Real o0 = o(0);
+            for (std::size_t k = 0; k < m; ++k)
+            {
+                e(k) *= K;
+                if (k + 1 < m)
+                {
+                    o(k) = -K_inv*o(k+1);
+                }
+            }
+            o(m-1) = -K_inv*o0;
+        }
+    }
+}
+
+// Inverse of daubechies_lifting_dwt.
+template<unsigned p, class RandomAccessIterator>
+void daubechies_lifting_idwt(RandomAccessIterator first, RandomAccessIterator last, std::size_t levels = 1)
+{
+    static_assert(p == 1 || p == 2, "The lifting scheme is only implemented for 1 and 2 vanishing moments.");
+    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    std::size_t n = std::distance(first, last);
+    detail::check_dyadic_length(n, levels, "daubechies_lifting_idwt");
+    for (std::size_t level = levels; level > 0; --level)
+    {
+        std::size_t s = std::size_t(1) << (level - 1);
+        std::size_t m = (n >> (level - 1))/2;
+        auto e = [&](std::size_t k) -> decltype(first[0]) { return first[2*k*s]; };
+        auto o = [&](std::size_t k) -> decltype(first[0]) { return first[(2*k+1)*s]; };
+        if constexpr (p == 1)
+        {
+            for (std::size_t k = 0; k < m; ++k)
+            {
+                Real a = e(k)*constants::half_root_two<Real>();
+                Real d = -constants::root_two<Real>()*o(k);
+                Real x0 = a - d/2;
+                e(k) = x0;
+                o(k) = d + x0;
+            }
+        }
+        else
+        {
+            using constants::root_three;
+            using constants::half_root_two;
+            const Real u0 = root_three<Real>()/4;
+            const Real u1 = (root_three<Real>() - 2)/4;
+            const Real K = (root_three<Real>() + 1)*half_root_two<Real>();
+            const Real K_inv = (root_three<Real>() - 1)*half_root_two<Real>();
+            Real last_odd = o(m-1);
+            for (std::size_t k = m - 1; k > 0; --k)
+            {
+                e(k) *= K_inv;
+                o(k) = -K*o(k-1);
+            }
+            e(0) *= K_inv;
+            o(0) = -K*last_odd;
+            o(0) -= e(m-1);
+            for (std::size_t k = 1; k < m; ++k)
+            {
+                o(k) -= e(k-1);
+            }
+            for (std::size_t k = 0; k + 1 < m; ++k)
+            {
+                e(k) -= u0*o(k) + u1*o(k+1);
+            }
+            e(m-1) -= u0*o(m-1) + u1*o(0);
+            for (std::size_t k = 0; k < m; ++k)
+            {
+                o(k) += root_three<Real>()*e(k);
+            }
+        }
+    }
+}
+
+// Number of coefficients produced by daubechies_dwt_symmetric from a signal of length n.
+template<unsigned p>
+constexpr std::size_t daubechies_dwt_symmetric_size(std::size_t n, std::size_t levels = 1)
+{
+    std::size_t total = 0;
+    for (std::size_t level = 0; level < levels; ++level)
+    {
+        n = detail::symmetric_output_length<2*p>(n);
+        total += n;
+    }
+    return total + n;
+}
+
+// Workspace needed by daubechies_dwt_symmetric and daubechies_idwt_symmetric for a signal of length n.
+template<unsigned p>
+constexpr std::size_t daubechies_dwt_symmetric_workspace_size(std::size_t n)
+{
+    // No approximation is ever longer than max(n, 2p), and the extended signal adds 2(2p-1) values:
+    std::size_t len = (std::max)(n, std::size_t(2*p));
+    return 2*len + 4*p;
+}
+
+// Multilevel transform of a signal of any length, extended symmetrically across its ends rather than periodically.
+// This is the "symmetric" mode of PyWavelets: it has no wraparound artifacts, at the price of
+// daubechies_dwt_symmetric_size(n, levels) coefficients rather than n.
+// The coefficients are written as [a_J, d_J, d_{J-1}, ..., d_1], so that levels = 0 copies the signal.
+template<unsigned p, class InputIterator, class OutputIterator, class WorkspaceIterator>
+void daubechies_dwt_symmetric(InputIterator first, InputIterator last, OutputIterator coefficients, WorkspaceIterator workspace, std::size_t levels = 1)
+{
+    using Real = typename std::iterator_traits<InputIterator>::value_type;
+    const auto h = daubechies_scaling_filter<Real, p>();
+    const auto g = detail::dwt_wavelet_filter(h);
+    constexpr std::size_t L = 2*p;
+    std::size_t n = std::distance(first, last);
+    if (n == 0)
+    {
+        throw std::domain_error("In daubechies_dwt_symmetric: the signal must not be empty.");
+    }
+    if (levels == 0)
+    {
+        // The signal is its own approximation at level zero:
+        std::copy(first, last, coefficients);
+        return;
+    }
+    std::size_t offset = daubechies_dwt_symmetric_size<p>(n, levels);
+    for (std::size_t level = 0; level < levels; ++level)
+    {
+        std::size_t len = detail::symmetric_output_length<L>(n);
+        // Extend the current approximation into the workspace, after the first level it lives in the output:
+        for (std::size_t i = 0; i < n + 2*(L-1); ++i)
+        {
+            std::size_t j = detail::symmetric_index(static_cast<std::ptrdiff_t>(i) - static_cast<std::ptrdiff_t>(L - 1), n);
+            workspace[i] = level == 0 ? Real(first[j]) : Real(coefficients[j]);
+        }
+        offset -= len;
+        for (std::size_t k = 0; k < len; ++k)
+        {
+            // a[k] = sum_m h[m] x[2k + 2 - L + m], shifted by the L - 1 values of extension:
+            auto xk = workspace + 2*k + 1;
+            Real ak = 0;
+            Real dk = 0;
+            for (std::size_t m = 0; m < L; ++m)
+            {
+                ak += h[m]*xk[m];
+                dk += g[m]*xk[m];
+            }
+            coefficients[k] = ak;
+            coefficients[offset + k] = dk;
+        }
+        n = len;
+    }
+}
+
+// Inverse of daubechies_dwt_symmetric: n is the length of the original signal.
+template<unsigned p, class InputIterator, class OutputIterator, class WorkspaceIterator>
+void daubechies_idwt_symmetric(InputIterator coefficients, std::size_t n, OutputIterator out, WorkspaceIterator workspace, std::size_t levels = 1)
+{
+    using Real = typename std::iterator_traits<InputIterator>::value_type;
+    const auto h = daubechies_scaling_filter<Real, p>();
+    const auto g = detail::dwt_wavelet_filter(h);
+    constexpr std::size_t L = 2*p;
+    if (n == 0)
+    {
+        throw std::domain_error("In daubechies_idwt_symmetric: the signal must not be empty.");
+    }
+    if (levels == 0)
+    {
+        std::copy(coefficients, coefficients + n, out);
+        return;
+    }
+    // Lengths of the approximations at each level, working back from n:
+    std::array<std::size_t, sizeof(std::size_t)*8> lengths{};
+    if (levels >= lengths.size())
+    {
+        throw std::domain_error("In daubechies_idwt_symmetric: too many levels.");
+    }
+    lengths[0] = n;
+    for (std::size_t level = 1; level <= levels; ++level)
+    {
+        lengths[level] = detail::symmetric_output_length<L>(lengths[level - 1]);
+    }
+    // The approximation being reconstructed ping-pongs between the two halves of the workspace:
+    std::size_t buffer = (std::max)(n, std::size_t(L));
+    WorkspaceIterator a = workspace;
+    std::copy(coefficients, coefficients + lengths[levels], a);
+    std::size_t offset = lengths[levels];
+    for (std::size_t level = levels; level > 0; --level)
+    {
+        std::size_t len = lengths[level];
+        std::size_t target = lengths[level - 1];
+        auto d = coefficients + offset;
+        offset += len;
+        WorkspaceIterator next = (a == workspace) ? workspace + buffer : workspace;
+        // x[t] = sum_k h[t + L - 2 - 2k] a[k] + g[t + L - 2 - 2k] d[k], over ceil((t-1)/2) <= k <= floor((t+L-2)/2).
+        for (std::size_t t = 0; t < target; ++t)
+        {
+            Real xt = 0;
+            for (std::size_t k = t/2; k <= (t + L - 2)/2; ++k)
+            {
+                std::size_t m = t + L - 2 - 2*k;
+                xt += h[m]*a[k] + g[m]*d[k];
+            }
+            if (level == 1)
+            {
+                out[t] = xt;
+            }
+            else
+            {
+                next[t] = xt;
+            }
+        }
+        a = next;
+    }
+}
+
+} // namespaces
+#endif
@@ -39,6 +39,17 @@ public:
     cardinal_cubic_b_spline(const Real* const f, size_t length, Real left_endpoint, Real step_size,
        Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
        Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    // As above, but large data are solved for in parallel unless exec is std::execution::seq.
+    template<class ExecutionPolicy, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    cardinal_cubic_b_spline(ExecutionPolicy&& exec, const Real* const f, size_t length, Real left_endpoint, Real step_size,
+       Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN())
+       : m_imp(std::make_shared<detail::cardinal_cubic_b_spline_imp<Real>>(f, f + length, left_endpoint, step_size, left_endpoint_derivative, right_endpoint_derivative,
+                                                                          detail::cardinal_b_spline_max_threads(exec)))
+    {
+    }
+#endif
 
     cardinal_cubic_b_spline() = default;
     Real operator()(Real x) const;
@@ -47,6 +58,9 @@ public:
 
     Real double_prime(Real x) const;
 
+    // y[i] = s(x[i]) for 0 <= i < n, and the derivatives too unless dydx or d2ydx2 are null.
+    void evaluate(const Real* x, size_t n, Real* y, Real* dydx = nullptr, Real* d2ydx2 = nullptr) const;
+
 private:
     std::shared_ptr<detail::cardinal_cubic_b_spline_imp<Real>> m_imp;
 };
@@ -82,6 +96,11 @@ Real cardinal_cubic_b_spline<Real>::double_prime(Real x) const
     return m_imp->double_prime(x);
 }
 
+template<class Real>
+void cardinal_cubic_b_spline<Real>::evaluate(const Real* x, size_t n, Real* y, Real* dydx, Real* d2ydx2) const
+{
+    m_imp->evaluate(x, n, y, dydx, d2ydx2);
+}
 
 }}}
 #endif
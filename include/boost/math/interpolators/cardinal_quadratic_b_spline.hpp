@@ -36,6 +36,32 @@ public:
      : impl_(std::make_shared<detail::cardinal_quadratic_b_spline_detail<Real>>(y.data(), y.size(), t0, h, left_endpoint_derivative, right_endpoint_derivative))
     {}
 
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    // As above, but large data are solved for in parallel unless exec is std::execution::seq.
+    template<class ExecutionPolicy, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    cardinal_quadratic_b_spline(ExecutionPolicy&& exec,
+                                const Real* const y,
+                                size_t n,
+                                Real t0 /* initial time, left endpoint */,
+                                Real h  /*spacing, stepsize*/,
+                                Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                                Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN())
+     : impl_(std::make_shared<detail::cardinal_quadratic_b_spline_detail<Real>>(y, n, t0, h, left_endpoint_derivative, right_endpoint_derivative,
+                                                                                detail::cardinal_b_spline_max_threads(exec)))
+    {}
+
+    template<class ExecutionPolicy, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    cardinal_quadratic_b_spline(ExecutionPolicy&& exec,
+                                std::vector<Real> const & y,
+                                Real t0 /* initial time, left endpoint */,
+                                Real h  /*spacing, stepsize*/,
+                                Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                                Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN())
+     : impl_(std::make_shared<detail::cardinal_quadratic_b_spline_detail<Real>>(y.data(), y.size(), t0, h, left_endpoint_derivative, right_endpoint_derivative,
+                                                                                detail::cardinal_b_spline_max_threads(exec)))
+    {}
+#endif
+
 
     Real operator()(Real t) const {
         return impl_->operator()(t);
@@ -45,6 +71,11 @@ public:
        return impl_->prime(t);
     }
 
+    // y[i] = s(t[i]) for 0 <= i < n, and dydt[i] = s'(t[i]) too unless dydt is null.
+    void evaluate(const Real* t, size_t n, Real* y, Real* dydt = nullptr) const {
+        impl_->evaluate(t, n, y, dydt);
+    }
+
     Real t_max() const {
         return impl_->t_max();
     }
@@ -37,6 +37,32 @@ public:
      : impl_(std::make_shared<detail::cardinal_quintic_b_spline_detail<Real>>(y.data(), y.size(), t0, h, left_endpoint_derivatives, right_endpoint_derivatives))
     {}
 
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    // As above, but large data are solved for in parallel unless exec is std::execution::seq.
+    template<class ExecutionPolicy, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    cardinal_quintic_b_spline(ExecutionPolicy&& exec,
+                                const Real* const y,
+                                size_t n,
+                                Real t0 /* initial time, left endpoint */,
+                                Real h  /*spacing, stepsize*/,
+                                std::pair<Real, Real> left_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
+                                std::pair<Real, Real> right_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()})
+     : impl_(std::make_shared<detail::cardinal_quintic_b_spline_detail<Real>>(y, n, t0, h, left_endpoint_derivatives, right_endpoint_derivatives,
+                                                                              detail::cardinal_b_spline_max_threads(exec)))
+    {}
+
+    template<class ExecutionPolicy, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    cardinal_quintic_b_spline(ExecutionPolicy&& exec,
+                                std::vector<Real> const & y,
+                                Real t0 /* initial time, left endpoint */,
+                                Real h  /*spacing, stepsize*/,
+                                std::pair<Real, Real> left_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()},
+                                std::pair<Real, Real> right_endpoint_derivatives = {std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN()})
+     : impl_(std::make_shared<detail::cardinal_quintic_b_spline_detail<Real>>(y.data(), y.size(), t0, h, left_endpoint_derivatives, right_endpoint_derivatives,
+                                                                              detail::cardinal_b_spline_max_threads(exec)))
+    {}
+#endif
+
 
     Real operator()(Real t) const {
         return impl_->operator()(t);
@@ -50,6 +76,11 @@ public:
         return impl_->double_prime(t);
     }
 
+    // y[i] = s(t[i]) for 0 <= i < n, and the derivatives too unless dydt or d2ydt2 are null.
+    void evaluate(const Real* t, size_t n, Real* y, Real* dydt = nullptr, Real* d2ydt2 = nullptr) const {
+        impl_->evaluate(t, n, y, dydt, d2ydt2);
+    }
+
     Real t_max() const {
         return impl_->t_max();
     }
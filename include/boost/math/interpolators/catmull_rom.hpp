@@ -76,12 +76,23 @@ public:
 
     Point prime(const value_type s) const;
 
+    // x[i] = P(s[i]) and dxds[i] = P'(s[i]) for 0 <= i < n, where either x or dxds may be null.
+    // Consecutive parameters in the same segment share its coefficients, and the segments are found by a search
+    // forward from the previous one, so that a sorted s costs O(n + number of points) in total.
+    void evaluate(const value_type* s, size_t n, Point* x, Point* dxds = nullptr) const;
+
     RandomAccessContainer&& get_points()
     {
         return std::move(m_pnts);
     }
 
 private:
+    // The index i with m_s[i] <= s < m_s[i+1], except that s = max_parameter() belongs to the last segment.
+    size_t segment(const value_type s) const;
+
+    // The coefficients c[k*dimension + j] of (s - m_s[i])^k in coordinate j of the cubic on segment i.
+    void power_basis(size_t i, value_type* c) const;
+
     RandomAccessContainer m_pnts;
     std::vector<value_type> m_s;
     value_type m_max_s;
@@ -142,6 +153,16 @@ catmull_rom<Point, RandomAccessContainer>::catmull_rom(RandomAccessContainer&& p
 }
 
 
+template<class Point, class RandomAccessContainer >
+size_t catmull_rom<Point, RandomAccessContainer>::segment(const typename Point::value_type s) const
+{
+    auto it = std::upper_bound(m_s.begin(), m_s.end(), s);
+    //Now *it >= s. We want the index such that m_s[i] <= s < m_s[i+1]:
+    size_t i = std::distance(m_s.begin(), it - 1);
+    // The end of a closed curve is the start of a segment which would need a point past the end of m_pnts:
+    return (std::min)(i, m_s.size() - 3);
+}
+
 template<class Point, class RandomAccessContainer >
 Point catmull_rom<Point, RandomAccessContainer>::operator()(const typename Point::value_type s) const
 {
@@ -150,9 +171,7 @@ Point catmull_rom<Point, RandomAccessContainer>::operator()(const typename Point
     {
         throw std::domain_error("Parameter outside bounds.");
     }
-    auto it = std::upper_bound(m_s.begin(), m_s.end(), s);
-    //Now *it >= s. We want the index such that m_s[i] <= s < m_s[i+1]:
-    size_t i = std::distance(m_s.begin(), it - 1);
+    size_t i = segment(s);
 
     // Only denom21 is used twice:
     typename Point::value_type denom21 = 1/(m_s[i+1] - m_s[i]);
@@ -212,9 +231,7 @@ Point catmull_rom<Point, RandomAccessContainer>::prime(const typename Point::val
     {
         throw std::domain_error("Parameter outside bounds.\n");
     }
-    auto it = std::upper_bound(m_s.begin(), m_s.end(), s);
-    //Now *it >= s. We want the index such that m_s[i] <= s < m_s[i+1]:
-    size_t i = std::distance(m_s.begin(), it - 1);
+    size_t i = segment(s);
     Point A1;
     typename Point::value_type denom = 1/(m_s[i] - m_s[i-1]);
     typename Point::value_type k1 = (m_s[i]-s)*denom;
@@ -247,6 +264,9 @@ Point catmull_rom<Point, RandomAccessContainer>::prime(const typename Point::val
 
 
     Point B1;
+    denom = 1/(m_s[i+1] - m_s[i-1]);
+    k1 = (m_s[i+1]-s)*denom;
+    k2 = (s - m_s[i-1])*denom;
     for (size_t j = 0; j < size(m_pnts[0]); ++j)
     {
         B1[j] = k1*A1[j] + k2*A2[j];
@@ -299,6 +319,270 @@ Point catmull_rom<Point, RandomAccessContainer>::prime(const typename Point::val
     return Cp;
 }
 
+template<class Point, class RandomAccessContainer >
+void catmull_rom<Point, RandomAccessContainer>::power_basis(size_t i, typename Point::value_type* c) const
+{
+    using std_workaround::size;
+    typedef typename Point::value_type Real;
+    // The same recursion as operator(), on polynomials in tau = s - m_s[i].
+    // Blending X and Y of degree m with the weights (s_r - s)/(s_r - s_l) and (s - s_l)/(s_r - s_l) raises the degree by one:
+    auto blend = [](const Real* X, const Real* Y, size_t m, Real dl, Real dr, Real* R) {
+        Real denom = 1/(dr - dl);
+        for (size_t k = m + 2; k-- > 0;)
+        {
+            Real z = (k <= m) ? dr*X[k] - dl*Y[k] : Real(0);
+            if (k > 0)
+            {
+                z += Y[k-1] - X[k-1];
+            }
+            R[k] = denom*z;
+        }
+    };
+    Real d0 = m_s[i-1] - m_s[i];
+    Real d2 = m_s[i+1] - m_s[i];
+    Real d3 = m_s[i+2] - m_s[i];
+    const size_t dimension = size(m_pnts[0]);
+    for (size_t j = 0; j < dimension; ++j)
+    {
+        Real P0 = m_pnts[i-1][j];
+        Real P1 = m_pnts[i][j];
+        Real P2 = m_pnts[i+1][j];
+        Real P3 = m_pnts[i+2][j];
+        Real A1[2], A2[2], A3[2], B1[3], B2[3], C[4];
+        blend(&P0, &P1, 0, d0, Real(0), A1);
+        blend(&P1, &P2, 0, Real(0), d2, A2);
+        blend(&P2, &P3, 0, d2, d3, A3);
+        blend(A1, A2, 1, d0, d2, B1);
+        blend(A2, A3, 1, Real(0), d3, B2);
+        blend(B1, B2, 2, Real(0), d2, C);
+        for (size_t k = 0; k < 4; ++k)
+        {
+            c[k*dimension + j] = C[k];
+        }
+    }
+}
+
+template<class Point, class RandomAccessContainer >
+void catmull_rom<Point, RandomAccessContainer>::evaluate(const typename Point::value_type* s, size_t n, Point* x, Point* dxds) const
+{
+    using std_workaround::size;
+    typedef typename Point::value_type Real;
+    const size_t dimension = size(m_pnts[0]);
+    const size_t last = m_s.size() - 3;
+    std::vector<Real> c(4*dimension);
+    // Segments start at 1, so 0 means that none has been found yet:
+    size_t i = 0;
+    for (size_t q = 0; q < n; ++q)
+    {
+        Real t = s[q];
+        if (t < 0 || t > m_max_s)
+        {
+            throw std::domain_error("Parameter outside bounds.");
+        }
+        if (i == 0 || t < m_s[i])
+        {
+            i = segment(t);
+            power_basis(i, c.data());
+        }
+        else if (t >= m_s[i+1] && i < last)
+        {
+            // Gallop forward from the current segment, so that sparse sorted parameters don't cost a full search each:
+            size_t k = i + 1;
+            size_t step = 1;
+            while (k + step <= last && m_s[k + step] <= t)
+            {
+                k += step;
+                step *= 2;
+            }
+            auto it = std::upper_bound(m_s.begin() + k, m_s.begin() + (std::min)(k + step, last) + 1, t);
+            i = (std::min)(static_cast<size_t>(std::distance(m_s.begin(), it) - 1), last);
+            power_basis(i, c.data());
+        }
+        Real tau = t - m_s[i];
+        for (size_t j = 0; j < dimension; ++j)
+        {
+            const Real* cj = c.data() + j;
+            if (x)
+            {
+                x[q][j] = cj[0] + tau*(cj[dimension] + tau*(cj[2*dimension] + tau*cj[3*dimension]));
+            }
+            if (dxds)
+            {
+                dxds[q][j] = cj[dimension] + tau*(2*cj[2*dimension] + 3*tau*cj[3*dimension]);
+            }
+        }
+    }
+}
+
+// The arc length of a Catmull-Rom curve as a function of its parameter, tabulated once so that
+// the parameters of points evenly spaced along the curve cost O(1) each.
+// Each segment of the curve is split into a number of pieces, whose lengths are found by four point Gauss-Lobatto quadrature of |P'(s)|,
+// and s(l) is interpolated within each piece by the cubic Hermite polynomial with ds/dl = 1/|P'(s)| at its ends.
+template <class Point, class RandomAccessContainer = std::vector<Point> >
+class catmull_rom_arc_length
+{
+   typedef typename Point::value_type value_type;
+public:
+
+    catmull_rom_arc_length(catmull_rom<Point, RandomAccessContainer> const & curve, size_t pieces_per_segment = 4);
+
+    value_type length() const
+    {
+        return m_l.back();
+    }
+
+    // The parameter s of the point of the curve at arc length l from its start.
+    value_type parameter(value_type l) const;
+
+    // s[k] = parameter(k*length()/(n-1)) for 0 <= k < n, in O(n + number of points) operations.
+    void parameters(size_t n, value_type* s) const;
+
+private:
+    value_type interpolate(size_t k, value_type l) const;
+
+    // The knots s_k, the arc lengths up to them, and ds/dl there (or zero where the curve stops):
+    std::vector<value_type> m_s;
+    std::vector<value_type> m_l;
+    std::vector<value_type> m_dsdl;
+};
+
+template<class Point, class RandomAccessContainer >
+catmull_rom_arc_length<Point, RandomAccessContainer>::catmull_rom_arc_length(catmull_rom<Point, RandomAccessContainer> const & curve, size_t pieces_per_segment)
+{
+    using std::sqrt;
+    using std_workaround::size;
+    if (pieces_per_segment == 0)
+    {
+        throw std::domain_error("Each segment must be split into at least one piece.");
+    }
+    value_type max_s = curve.max_parameter();
+    m_s.push_back(0);
+    for (size_t i = 0; curve.parameter_at_point(i) < max_s; ++i)
+    {
+        value_type a = curve.parameter_at_point(i);
+        value_type b = (std::min)(curve.parameter_at_point(i + 1), max_s);
+        for (size_t r = 1; r < pieces_per_segment; ++r)
+        {
+            m_s.push_back(a + (b - a)*r/pieces_per_segment);
+        }
+        m_s.push_back(b);
+    }
+
+    // The knots and the two interior Gauss-Lobatto nodes of each piece, in increasing order:
+    value_type g = 1/sqrt(value_type(5));
+    size_t pieces = m_s.size() - 1;
+    std::vector<value_type> nodes(3*pieces + 1);
+    for (size_t k = 0; k < pieces; ++k)
+    {
+        value_type mid = (m_s[k] + m_s[k+1])/2;
+        value_type half = (m_s[k+1] - m_s[k])/2;
+        nodes[3*k] = m_s[k];
+        nodes[3*k + 1] = mid - g*half;
+        nodes[3*k + 2] = mid + g*half;
+    }
+    nodes[3*pieces] = m_s[pieces];
+    std::vector<Point> tangents(nodes.size());
+    curve.evaluate(nodes.data(), nodes.size(), nullptr, tangents.data());
+    std::vector<value_type> speed(nodes.size());
+    for (size_t k = 0; k < nodes.size(); ++k)
+    {
+        value_type dsq = 0;
+        for (size_t j = 0; j < size(tangents[k]); ++j)
+        {
+            dsq += tangents[k][j]*tangents[k][j];
+        }
+        speed[k] = sqrt(dsq);
+    }
+
+    m_l.resize(pieces + 1);
+    m_dsdl.resize(pieces + 1);
+    m_l[0] = 0;
+    for (size_t k = 0; k < pieces; ++k)
+    {
+        value_type h = m_s[k+1] - m_s[k];
+        m_l[k+1] = m_l[k] + h*((speed[3*k] + speed[3*k + 3]) + 5*(speed[3*k + 1] + speed[3*k + 2]))/12;
+    }
+    for (size_t k = 0; k <= pieces; ++k)
+    {
+        m_dsdl[k] = speed[3*k] > 0 ? 1/speed[3*k] : value_type(0);
+    }
+}
+
+template<class Point, class RandomAccessContainer >
+typename Point::value_type catmull_rom_arc_length<Point, RandomAccessContainer>::interpolate(size_t k, typename Point::value_type l) const
+{
+    value_type h = m_l[k+1] - m_l[k];
+    if (h <= 0)
+    {
+        return m_s[k];
+    }
+    using std::sqrt;
+    value_type t = (l - m_l[k])/h;
+    value_type ds = m_s[k+1] - m_s[k];
+    // The slopes relative to the secant. The Hermite cubic is monotone when both are at most 3;
+    // a larger one means that the curve (nearly) stops there, so that l - l_k grows like (s - s_k)^2.
+    value_type D0 = h*m_dsdl[k]/ds;
+    value_type D1 = h*m_dsdl[k+1]/ds;
+    bool stop0 = !(m_dsdl[k] > 0) || D0 > 3;
+    bool stop1 = !(m_dsdl[k+1] > 0) || D1 > 3;
+    value_type s;
+    if (!stop0 && !stop1)
+    {
+        value_type r = 1 - t;
+        s = r*r*(m_s[k]*(1 + 2*t) + h*m_dsdl[k]*t) + t*t*(m_s[k+1]*(3 - 2*t) - h*m_dsdl[k+1]*r);
+    }
+    else if (!stop1)
+    {
+        // s is smooth in u = sqrt(t); take the monotone quadratic in u through both ends with the slope ds/dl at the far end:
+        value_type u = sqrt(t);
+        value_type D = (std::min)(2*D1, value_type(2));
+        s = m_s[k] + ds*u*((2 - D) + (D - 1)*u);
+    }
+    else if (!stop0)
+    {
+        value_type u = sqrt(1 - t);
+        value_type D = (std::min)(2*D0, value_type(2));
+        s = m_s[k+1] - ds*u*((2 - D) + (D - 1)*u);
+    }
+    else
+    {
+        s = m_s[k] + t*ds;
+    }
+    return (std::max)(m_s[k], (std::min)(s, m_s[k+1]));
+}
+
+template<class Point, class RandomAccessContainer >
+typename Point::value_type catmull_rom_arc_length<Point, RandomAccessContainer>::parameter(typename Point::value_type l) const
+{
+    if (l < 0 || l > m_l.back())
+    {
+        throw std::domain_error("Arc length outside bounds.");
+    }
+    auto it = std::upper_bound(m_l.begin(), m_l.end(), l);
+    size_t k = (std::min)(static_cast<size_t>(std::distance(m_l.begin(), it) - 1), m_l.size() - 2);
+    return interpolate(k, l);
+}
+
+template<class Point, class RandomAccessContainer >
+void catmull_rom_arc_length<Point, RandomAccessContainer>::parameters(size_t n, typename Point::value_type* s) const
+{
+    if (n == 1)
+    {
+        s[0] = 0;
+        return;
+    }
+    size_t k = 0;
+    for (size_t q = 0; q < n; ++q)
+    {
+        value_type l = (q + 1 == n) ? m_l.back() : m_l.back()*q/(n - 1);
+        while (k + 2 < m_l.size() && m_l[k+1] <= l)
+        {
+            ++k;
+        }
+        s[q] = interpolate(k, l);
+    }
+}
+
 
 }}
 #endif
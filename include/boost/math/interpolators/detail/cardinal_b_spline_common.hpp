@@ -0,0 +1,266 @@
+// Copyright agent, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Pieces shared by the cardinal quadratic, cubic and quintic B-spline interpolators:
+// the solution of the constant coefficient recurrences left by row reduction of their coefficient systems,
+// and the evaluation of a spline at many points at once.
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_CARDINAL_B_SPLINE_COMMON_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_CARDINAL_B_SPLINE_COMMON_HPP
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <future>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+#include <execution>
+#endif
+
+namespace boost{ namespace math{ namespace interpolators{ namespace detail{
+
+// The number of threads worth using on n points, at most max_threads: starting a thread costs about as much as a few thousand steps of a solve.
+inline unsigned cardinal_b_spline_threads(std::size_t n, unsigned max_threads)
+{
+    constexpr std::size_t min_block = 1 << 16;
+    return static_cast<unsigned>((std::max)(std::size_t(1), (std::min)(std::size_t(max_threads), n/min_block)));
+}
+
+// All the threads there are, for the parts whose results don't depend on how the work is split.
+inline unsigned cardinal_b_spline_hardware_threads()
+{
+    unsigned threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1u : threads;
+}
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+// The threads a constructor taking an execution policy may use: one for std::execution::seq, otherwise all of them.
+template<class ExecutionPolicy>
+unsigned cardinal_b_spline_max_threads(ExecutionPolicy&&)
+{
+    if (std::is_same<typename std::decay<ExecutionPolicy>::type, std::execution::sequenced_policy>::value)
+    {
+        return 1;
+    }
+    return cardinal_b_spline_hardware_threads();
+}
+#endif
+
+// Calls f(i, first_i, last_i) for each of the pieces 0 <= i < pieces of [first, last), on the calling thread for i = 0.
+template<class F>
+void cardinal_b_spline_parallel_for(std::size_t first, std::size_t last, unsigned pieces, F f)
+{
+    std::size_t n = last - first;
+    std::vector<std::future<void>> futures;
+    for (unsigned i = 1; i < pieces; ++i)
+    {
+        futures.push_back(std::async(std::launch::async, f, i, first + i*n/pieces, first + (i+1)*n/pieces));
+    }
+    f(0u, first, first + n/pieces);
+    for (auto & fut : futures)
+    {
+        fut.get();
+    }
+}
+
+// Sets x[i] = step(x[i], x[i-1], x[i-2]) for first <= i < last in turn, where x[first-1] = x1 and x[first-2] = x2;
+// or if backward, x[i] = step(x[i], x[i+1], x[i+2]) for last > i >= first, where x[last] = x1 and x[last+1] = x2.
+// The step must be affine in the previous two values with constant coefficients, so that the difference
+// of two solutions obeys e[i] = a1*e[i-1] + a2*e[i-2], and it must be stable, so that e dies out.
+// Then the range can be split into blocks which are solved concurrently, each but the first starting from zero;
+// the error so made is the solution of the homogeneous recurrence started from the values which
+// end the previous block, and falls below the precision after a handful of terms.
+template<class Real, class Step>
+void solve_linear_recurrence(Real* x, std::size_t first, std::size_t last, bool backward, Real x1, Real x2,
+                             Real a1, Real a2, Step step, unsigned threads)
+{
+    using std::abs;
+    std::size_t n = last - first;
+    auto idx = [=](std::size_t k) { return backward ? last - 1 - k : first + k; };
+    auto solve = [=](std::size_t k_first, std::size_t k_last, Real s1, Real s2) {
+        for (std::size_t k = k_first; k < k_last; ++k)
+        {
+            Real& xk = x[idx(k)];
+            xk = step(xk, s1, s2);
+            s2 = s1;
+            s1 = xk;
+        }
+    };
+
+    unsigned pieces = 1;
+    std::size_t transient = 0;
+    if (threads > 1)
+    {
+        // Both fundamental solutions of the homogeneous recurrence, until they are negligible:
+        Real tol = std::numeric_limits<Real>::epsilon()/64;
+        Real g1 = 1, g2 = 0, h1 = 0, h2 = 1;
+        while (transient < n && (abs(g1) + abs(g2) + abs(h1) + abs(h2) > tol))
+        {
+            Real g = a1*g1 + a2*g2;
+            Real h = a1*h1 + a2*h2;
+            g2 = g1;
+            g1 = g;
+            h2 = h1;
+            h1 = h;
+            ++transient;
+        }
+        // The correction of a block mustn't reach the two values ending it, which the next block is corrected from:
+        pieces = static_cast<unsigned>((std::min)(std::size_t(threads), n/(2*transient + 4)));
+    }
+    if (pieces <= 1)
+    {
+        solve(0, n, x1, x2);
+        return;
+    }
+
+    cardinal_b_spline_parallel_for(0, n, pieces, [&](unsigned i, std::size_t k_first, std::size_t k_last) {
+        if (i == 0)
+        {
+            solve(k_first, k_last, x1, x2);
+        }
+        else
+        {
+            solve(k_first, k_last, Real(0), Real(0));
+        }
+    });
+    for (unsigned i = 1; i < pieces; ++i)
+    {
+        std::size_t k_first = i*n/pieces;
+        std::size_t k_last = (std::min)(k_first + transient, (i+1)*n/pieces);
+        Real e1 = x[idx(k_first - 1)];
+        Real e2 = x[idx(k_first - 2)];
+        for (std::size_t k = k_first; k < k_last; ++k)
+        {
+            Real e = a1*e1 + a2*e2;
+            x[idx(k)] += e;
+            e2 = e1;
+            e1 = e;
+        }
+    }
+}
+
+// Evaluates y0 + sum_r c[k-r]*M(s - k + r) for 0 <= r <= degree at the n points t[i], where s = (t[i] - t0)*inv_h + shift,
+// k = floor(s), and M is the cardinal B-spline of the given degree supported on [0, degree + 1].
+// The first and second derivatives with respect to t are written too unless dydt or d2ydt2 are null.
+// The weights of all three come from one run of the Cox-de Boor recursion, and the coefficients are read once.
+// Points with some of c[k-degree], ..., c[k] outside [0, size), or which are nan, are handed to fallback(i) instead.
+template<unsigned degree, class Real, class Fallback>
+void cardinal_b_spline_evaluate(const Real* c, std::size_t size, Real t0, Real inv_h, Real shift, Real y0,
+                                const Real* t, std::size_t n, Real* y, Real* dydt, Real* d2ydt2, Fallback fallback)
+{
+    static_assert(degree >= 2, "The second derivative needs at least a quadratic B-spline.");
+    constexpr std::size_t block = 64;
+    constexpr unsigned m = degree + 1;
+    Real u[block];
+    std::size_t k[block];
+    bool inside[block];
+    // cs[r][i] = c[k[i] - r], and w[r][i] = M(u[i] + r) at the current degree of the recursion:
+    Real cs[m][block];
+    Real w[m][block];
+    Real size_r = static_cast<Real>(size);
+    for (std::size_t i0 = 0; i0 < n; i0 += block)
+    {
+        std::size_t len = (std::min)(block, n - i0);
+        for (std::size_t i = 0; i < len; ++i)
+        {
+            Real s = (t[i0 + i] - t0)*inv_h + shift;
+            inside[i] = s >= Real(degree) && s < size_r;
+            // Points outside read a safe window, and are overwritten by the fallback:
+            Real sc = inside[i] ? s : Real(degree);
+            k[i] = static_cast<std::size_t>(sc);
+            u[i] = sc - static_cast<Real>(k[i]);
+        }
+        for (unsigned r = 0; r < m; ++r)
+        {
+            for (std::size_t i = 0; i < len; ++i)
+            {
+                cs[r][i] = c[k[i] - r];
+            }
+        }
+
+        for (unsigned d = 0; d <= degree; ++d)
+        {
+            if (d == 0)
+            {
+                for (std::size_t i = 0; i < len; ++i)
+                {
+                    w[0][i] = 1;
+                }
+            }
+            else
+            {
+                // M_d(u + r) = ((u + r)M_{d-1}(u + r) + (d + 1 - u - r)M_{d-1}(u + r - 1))/d, in place from the top down:
+                Real inv_d = Real(1)/Real(d);
+                for (std::size_t i = 0; i < len; ++i)
+                {
+                    w[d][i] = (1 - u[i])*w[d-1][i]*inv_d;
+                }
+                for (unsigned r = d - 1; r > 0; --r)
+                {
+                    for (std::size_t i = 0; i < len; ++i)
+                    {
+                        w[r][i] = ((u[i] + r)*w[r][i] + (d + 1 - r - u[i])*w[r-1][i])*inv_d;
+                    }
+                }
+                for (std::size_t i = 0; i < len; ++i)
+                {
+                    w[0][i] = u[i]*w[0][i]*inv_d;
+                }
+            }
+
+            // M'' = M_{d-2}(y) - 2M_{d-2}(y-1) + M_{d-2}(y-2) and M' = M_{d-1}(y) - M_{d-1}(y-1) are differences of the lower degree weights:
+            if (d + 2 == degree && d2ydt2)
+            {
+                Real scale = inv_h*inv_h;
+                for (std::size_t i = 0; i < len; ++i)
+                {
+                    Real z = 0;
+                    for (unsigned r = 0; r <= d; ++r)
+                    {
+                        z += w[r][i]*(cs[r][i] - 2*cs[r+1][i] + cs[r+2][i]);
+                    }
+                    d2ydt2[i0 + i] = z*scale;
+                }
+            }
+            if (d + 1 == degree && dydt)
+            {
+                for (std::size_t i = 0; i < len; ++i)
+                {
+                    Real z = 0;
+                    for (unsigned r = 0; r <= d; ++r)
+                    {
+                        z += w[r][i]*(cs[r][i] - cs[r+1][i]);
+                    }
+                    dydt[i0 + i] = z*inv_h;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < len; ++i)
+        {
+            Real z = y0;
+            for (unsigned r = 0; r < m; ++r)
+            {
+                z += w[r][i]*cs[r][i];
+            }
+            y[i0 + i] = z;
+        }
+
+        for (std::size_t i = 0; i < len; ++i)
+        {
+            if (!inside[i])
+            {
+                fallback(i0 + i);
+            }
+        }
+    }
+}
+
+}}}}
+#endif
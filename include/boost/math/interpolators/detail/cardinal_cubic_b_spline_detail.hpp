@@ -14,6 +14,7 @@
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/math/special_functions/trunc.hpp>
+#include <boost/math/interpolators/detail/cardinal_b_spline_common.hpp>
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
 
@@ -24,10 +25,12 @@ class cardinal_cubic_b_spline_imp
 public:
     // If you don't know the value of the derivative at the endpoints, leave them as nans and the routine will estimate them.
     // f[0] = f(a), f[length -1] = b, step_size = (b - a)/(length -1).
+    // Large data are solved for on up to max_threads threads.
     template <class BidiIterator>
     cardinal_cubic_b_spline_imp(BidiIterator f, BidiIterator end_p, Real left_endpoint, Real step_size,
                        Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
-                       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN());
+                       Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                       unsigned max_threads = 1);
 
     Real operator()(Real x) const;
 
@@ -35,6 +38,8 @@ public:
 
     Real double_prime(Real x) const;
 
+    void evaluate(const Real* x, size_t n, Real* y, Real* dydx, Real* d2ydx2) const;
+
 private:
     std::vector<Real> m_beta;
     Real m_h_inv;
@@ -105,7 +110,7 @@ Real b3_spline_double_prime(Real x)
 template <class Real>
 template <class BidiIterator>
 cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, BidiIterator end_p, Real left_endpoint, Real step_size,
-                                             Real left_endpoint_derivative, Real right_endpoint_derivative) : m_a(left_endpoint), m_avg(0)
+                                             Real left_endpoint_derivative, Real right_endpoint_derivative, unsigned max_threads) : m_a(left_endpoint), m_avg(0)
 {
     using boost::math::constants::third;
 
@@ -175,16 +180,31 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
     // A simple way to deal with this is just to subtract the DC component off the signal, so we need the average.
     // This algorithm for computing the average is recommended in
     // http://www.heikohoffmann.de/htmlthesis/node134.html
-    Real t = 1;
-    for (size_t i = 0; i < length; ++i)
-    {
-        if (boost::math::isnan(f[i]))
+    // Large data are split into pieces for several threads, and the running means of the pieces combined by the same rule:
+    unsigned threads = cardinal_b_spline_threads(length, max_threads);
+    std::vector<Real> means(threads);
+    cardinal_b_spline_parallel_for(0, length, threads, [&](unsigned j, size_t first, size_t last) {
+        Real avg = 0;
+        Real t = 1;
+        for (size_t i = first; i < last; ++i)
         {
-            std::string err = "This function you are trying to interpolate is a nan at index " + std::to_string(i) + "\n";
-            throw std::logic_error(err);
+            if (boost::math::isnan(f[i]))
+            {
+                std::string err = "This function you are trying to interpolate is a nan at index " + std::to_string(i) + "\n";
+                throw std::logic_error(err);
+            }
+            avg += (f[i] - avg) / t;
+            t += 1;
         }
-        m_avg += (f[i] - m_avg) / t;
-        t += 1;
+        means[j] = avg;
+    });
+    m_avg = means[0];
+    Real count = static_cast<Real>(length/threads);
+    for (unsigned j = 1; j < threads; ++j)
+    {
+        Real piece = static_cast<Real>(length*(j+1)/threads - length*j/threads);
+        count += piece;
+        m_avg += (means[j] - m_avg)*piece/count;
     }
 
 
@@ -201,20 +221,16 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
     //          1  4  1
     //          1  0 -1
     // Numerical estimate indicate that as N->Infinity, cond(A) -> 6.9, so this matrix is good.
-    std::vector<Real> rhs(length + 2, std::numeric_limits<Real>::quiet_NaN());
-    std::vector<Real> super_diagonal(length + 2, std::numeric_limits<Real>::quiet_NaN());
-
-    rhs[0] = -2*step_size*a1;
-    rhs[rhs.size() - 1] = -2*step_size*b1;
-
-    super_diagonal[0] = 0;
-
-    for(size_t i = 1; i < rhs.size() - 1; ++i)
-    {
-        rhs[i] = 6*(f[i - 1] - m_avg);
-        super_diagonal[i] = 1;
-    }
-
+    // The right hand side is reduced in place in m_beta, and then overwritten by the solution.
+    size_t last = m_beta.size() - 1;
+    m_beta[0] = -2*step_size*a1;
+    m_beta[last] = -2*step_size*b1;
+    cardinal_b_spline_parallel_for(1, last, threads, [&](unsigned, size_t first, size_t end) {
+        for (size_t i = first; i < end; ++i)
+        {
+            m_beta[i] = 6*(f[i - 1] - m_avg);
+        }
+    });
 
     // One step of row reduction on the first row to patch up the 5-diagonal problem:
     // 1 0 -1 | r0
@@ -225,40 +241,53 @@ cardinal_cubic_b_spline_imp<Real>::cardinal_cubic_b_spline_imp(BidiIterator f, B
     // mapsto
     // 1 0 -1 | r0
     // 0 1 1/2| (r1 - r0)/4
-    super_diagonal[1] = 0.5;
-    rhs[1] = (rhs[1] - rhs[0])/4;
-
-    // Now do a tridiagonal row reduction the standard way, until just before the last row:
-    for (size_t i = 2; i < rhs.size() - 1; ++i)
+    std::vector<Real> super_diagonal{0, Real(0.5)};
+    m_beta[1] = (m_beta[1] - m_beta[0])/4;
+
+    // Now do a tridiagonal row reduction the standard way, until just before the last row.
+    // The reduced super diagonal converges to 2 - sqrt(3) within a few dozen rows, and once it repeats exactly it is constant,
+    // so only that many need be stored; after that the reduction of the right hand side is a recurrence with constant coefficients.
+    size_t i = 2;
+    bool converged = false;
+    for (; i < last && !converged; ++i)
     {
         Real diagonal = 4 - super_diagonal[i - 1];
-        rhs[i] = (rhs[i] - rhs[i - 1])/diagonal;
-        super_diagonal[i] /= diagonal;
+        m_beta[i] = (m_beta[i] - m_beta[i - 1])/diagonal;
+        super_diagonal.push_back(1/diagonal);
+        converged = super_diagonal[i] == super_diagonal[i - 1];
     }
+    Real diagonal = 4 - super_diagonal.back();
+    solve_linear_recurrence(m_beta.data(), i, last, false, m_beta[i - 1], Real(0), -1/diagonal, Real(0),
+                            [diagonal](Real r, Real r1, Real) { return (r - r1)/diagonal; }, threads);
+    auto sd = [&](size_t j) { return j < super_diagonal.size() ? super_diagonal[j] : super_diagonal.back(); };
 
     // Now the last row, which is in the form
     // 1 sd[n-3] 0      | rhs[n-3]
     // 0  1     sd[n-2] | rhs[n-2]
     // 1  0     -1      | rhs[n-1]
-    Real final_subdiag = -super_diagonal[rhs.size() - 3];
-    rhs[rhs.size() - 1] = (rhs[rhs.size() - 1] - rhs[rhs.size() - 3])/final_subdiag;
+    Real final_subdiag = -sd(last - 2);
+    m_beta[last] = (m_beta[last] - m_beta[last - 2])/final_subdiag;
     Real final_diag = -1/final_subdiag;
     // Now we're here:
     // 1 sd[n-3] 0         | rhs[n-3]
     // 0  1     sd[n-2]    | rhs[n-2]
     // 0  1     final_diag | (rhs[n-1] - rhs[n-3])/diag
 
-    final_diag = final_diag - super_diagonal[rhs.size() - 2];
-    rhs[rhs.size() - 1] = rhs[rhs.size() - 1] - rhs[rhs.size() - 2];
+    final_diag = final_diag - sd(last - 1);
+    m_beta[last] = m_beta[last] - m_beta[last - 1];
 
 
-    // Back substitutions:
-    m_beta[rhs.size() - 1] = rhs[rhs.size() - 1]/final_diag;
-    for(size_t i = rhs.size() - 2; i > 0; --i)
+    // Back substitutions, the rows with the constant super diagonal first:
+    m_beta[last] = m_beta[last]/final_diag;
+    size_t k = converged ? super_diagonal.size() - 1 : last;
+    Real c = super_diagonal.back();
+    solve_linear_recurrence(m_beta.data(), k, last, true, m_beta[last], Real(0), -c, Real(0),
+                            [c](Real r, Real b1, Real) { return r - c*b1; }, threads);
+    for(size_t j = k - 1; j > 0; --j)
     {
-        m_beta[i] = rhs[i] - super_diagonal[i]*m_beta[i + 1];
+        m_beta[j] = m_beta[j] - super_diagonal[j]*m_beta[j + 1];
     }
-    m_beta[0] = m_beta[2] + rhs[0];
+    m_beta[0] = m_beta[2] + m_beta[0];
 }
 
 template<class Real>
@@ -327,5 +356,23 @@ Real cardinal_cubic_b_spline_imp<Real>::double_prime(Real x) const
     return z*m_h_inv*m_h_inv;
 }
 
+template<class Real>
+void cardinal_cubic_b_spline_imp<Real>::evaluate(const Real* x, size_t n, Real* y, Real* dydx, Real* d2ydx2) const
+{
+    // b3_spline(t - k) is the B-spline supported on [0, 4] evaluated at t - k + 2:
+    cardinal_b_spline_evaluate<3>(m_beta.data(), m_beta.size(), m_a, m_h_inv, Real(3), m_avg, x, n, y, dydx, d2ydx2,
+        [&](size_t i) {
+            y[i] = (*this)(x[i]);
+            if (dydx)
+            {
+                dydx[i] = prime(x[i]);
+            }
+            if (d2ydx2)
+            {
+                d2ydx2[i] = double_prime(x[i]);
+            }
+        });
+}
+
 }}}}
 #endif
@@ -9,6 +9,7 @@
 #include <vector>
 #include <cmath>
 #include <stdexcept>
+#include <boost/math/interpolators/detail/cardinal_b_spline_common.hpp>
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
 
@@ -60,7 +61,8 @@ public:
                                 Real t0 /* initial time, left endpoint */,
                                 Real h  /*spacing, stepsize*/,
                                 Real left_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
-                                Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN())
+                                Real right_endpoint_derivative = std::numeric_limits<Real>::quiet_NaN(),
+                                unsigned max_threads = 1 /* threads to solve large data on */)
     {
         if (h <= 0) {
             throw std::logic_error("Spacing must be > 0.");
@@ -92,54 +94,62 @@ public:
 
         m_alpha.resize(n + 2);
 
-        // Begin row reduction:
-        std::vector<Real> rhs(n + 2, std::numeric_limits<Real>::quiet_NaN());
-        std::vector<Real> super_diagonal(n + 2, std::numeric_limits<Real>::quiet_NaN());
-
-        rhs[0] = -a;
-        rhs[rhs.size() - 1] = b;
-
-        super_diagonal[0] = 0;
-
-        for(size_t i = 1; i < rhs.size() - 1; ++i) {
-            rhs[i] = 8*y[i - 1];
-            super_diagonal[i] = 1;
-        }
+        // Begin row reduction, in place in m_alpha:
+        unsigned threads = cardinal_b_spline_threads(n, max_threads);
+        m_alpha[0] = -a;
+        m_alpha[n+1] = b;
+        cardinal_b_spline_parallel_for(1, n + 1, threads, [&](unsigned, size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                m_alpha[i] = 8*y[i - 1];
+            }
+        });
 
         // Patch up 5-diagonal problem:
-        rhs[1] = (rhs[1] - rhs[0])/6;
-        super_diagonal[1] = Real(1)/Real(3);
+        m_alpha[1] = (m_alpha[1] - m_alpha[0])/6;
+        std::vector<Real> super_diagonal{0, Real(1)/Real(3)};
         // First two rows are now:
         // 1 0 -1 | -2hy0'
         // 0 1 1/3| (8y0+2hy0')/6
 
 
-        // Start traditional tridiagonal row reduction:
-        for (size_t i = 2; i < rhs.size() - 1; ++i) {
+        // Start traditional tridiagonal row reduction.
+        // The super diagonal converges to 3 - 2sqrt(2), and is constant once it repeats,
+        // after which the right hand side obeys a recurrence with constant coefficients:
+        size_t i = 2;
+        bool converged = false;
+        for (; i < n + 1 && !converged; ++i) {
             Real diagonal = 6 - super_diagonal[i - 1];
-            rhs[i] = (rhs[i] - rhs[i - 1])/diagonal;
-            super_diagonal[i] /= diagonal;
+            m_alpha[i] = (m_alpha[i] - m_alpha[i - 1])/diagonal;
+            super_diagonal.push_back(1/diagonal);
+            converged = super_diagonal[i] == super_diagonal[i - 1];
         }
+        Real diagonal = 6 - super_diagonal.back();
+        solve_linear_recurrence(m_alpha.data(), i, n + 1, false, m_alpha[i - 1], Real(0), -1/diagonal, Real(0),
+                                [diagonal](Real r, Real r1, Real) { return (r - r1)/diagonal; }, threads);
+        auto sd = [&](size_t j) { return j < super_diagonal.size() ? super_diagonal[j] : super_diagonal.back(); };
 
         //  1 sd[n-1] 0     | rhs[n-1]
         //  0 1       sd[n] | rhs[n]
         // -1 0       1     | rhs[n+1]
 
-        rhs[n+1] = rhs[n+1] + rhs[n-1];
-        Real bottom_subdiagonal = super_diagonal[n-1];
+        m_alpha[n+1] = m_alpha[n+1] + m_alpha[n-1];
+        Real bottom_subdiagonal = sd(n-1);
 
         // We're here:
         //  1 sd[n-1] 0     | rhs[n-1]
         //  0 1       sd[n] | rhs[n]
         //  0 bs      1     | rhs[n+1]
 
-        rhs[n+1] = (rhs[n+1]-bottom_subdiagonal*rhs[n])/(1-bottom_subdiagonal*super_diagonal[n]);
+        m_alpha[n+1] = (m_alpha[n+1]-bottom_subdiagonal*m_alpha[n])/(1-bottom_subdiagonal*sd(n));
 
-        m_alpha[n+1] = rhs[n+1];
-        for (size_t i = n; i > 0; --i) {
-            m_alpha[i] = rhs[i] - m_alpha[i+1]*super_diagonal[i];
+        size_t k = converged ? super_diagonal.size() - 1 : n + 1;
+        Real c = super_diagonal.back();
+        solve_linear_recurrence(m_alpha.data(), k, n + 1, true, m_alpha[n+1], Real(0), -c, Real(0),
+                                [c](Real r, Real a1, Real) { return r - a1*c; }, threads);
+        for (size_t j = k - 1; j > 0; --j) {
+            m_alpha[j] = m_alpha[j] - m_alpha[j+1]*super_diagonal[j];
         }
-        m_alpha[0] = m_alpha[2] + rhs[0];
+        m_alpha[0] = m_alpha[2] + m_alpha[0];
     }
 
     Real operator()(Real t) const {
@@ -194,6 +204,23 @@ public:
         return y*m_inv_h;
     }
 
+    void evaluate(const Real* t, size_t n, Real* y, Real* dydt) const {
+        for (size_t i = 0; i < n; ++i) {
+            if (!(t[i] >= m_t0 && t[i] <= m_t0 + (m_alpha.size()-2)/m_inv_h)) {
+                const char* err_msg = "Tried to evaluate the cardinal quadratic b-spline outside the domain of of interpolation; extrapolation does not work.";
+                throw std::domain_error(err_msg);
+            }
+        }
+        // b2_spline(x + 1 - j) is the B-spline supported on [0, 3] evaluated at x - j + 5/2:
+        cardinal_b_spline_evaluate<2>(m_alpha.data(), m_alpha.size(), m_t0, m_inv_h, Real(5)/Real(2), Real(0), t, n, y, dydt, static_cast<Real*>(nullptr),
+            [&](size_t i) {
+                y[i] = (*this)(t[i]);
+                if (dydt) {
+                    dydt[i] = prime(t[i]);
+                }
+            });
+    }
+
     Real t_max() const {
         return m_t0 + (m_alpha.size()-3)/m_inv_h;
     }
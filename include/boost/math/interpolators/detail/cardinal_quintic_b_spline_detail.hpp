@@ -7,9 +7,12 @@
 #ifndef BOOST_MATH_INTERPOLATORS_CARDINAL_QUINTIC_B_SPLINE_DETAIL_HPP
 #define BOOST_MATH_INTERPOLATORS_CARDINAL_QUINTIC_B_SPLINE_DETAIL_HPP
 #include <cmath>
+#include <limits>
+#include <stdexcept>
 #include <vector>
 #include <utility>
 #include <boost/math/special_functions/cardinal_b_spline.hpp>
+#include <boost/math/interpolators/detail/cardinal_b_spline_common.hpp>
 
 namespace boost{ namespace math{ namespace interpolators{ namespace detail{
 
@@ -26,7 +29,8 @@ public:
                                      Real t0 /* initial time, left endpoint */,
                                      Real h  /*spacing, stepsize*/,
                                      std::pair<Real, Real> left_endpoint_derivatives,
-                                     std::pair<Real, Real> right_endpoint_derivatives)
+                                     std::pair<Real, Real> right_endpoint_derivatives,
+                                     unsigned max_threads = 1 /* threads to solve large data on */)
     {
         static_assert(!std::is_integral<Real>::value, "The quintic B-spline interpolator only works with floating point types.");
         if (h <= 0) {
@@ -61,106 +65,155 @@ public:
 
         // This is really challenging my mental limits on by-hand row reduction.
         // I debated bringing in a dependency on a sparse linear solver, but given that that would cause much agony for users I decided against it.
+        // The right hand side is reduced in place in m_alpha, and then overwritten by the solution.
 
-        std::vector<Real> rhs(n+4);
-        rhs[0] = 20*y[0] - 12*h*left_endpoint_derivatives.first +  2*h*h*left_endpoint_derivatives.second;
-        rhs[1] = 60*y[0] - 12*h*left_endpoint_derivatives.first;
-        for (size_t i = 2; i < n + 2; ++i) {
-            rhs[i] = 120*y[i-2];
-        }
-        rhs[n+2] = 60*y[n-1] + 12*h*right_endpoint_derivatives.first;
-        rhs[n+3] = 20*y[n-1] + 12*h*right_endpoint_derivatives.first +  2*h*h*right_endpoint_derivatives.second;
-
-        std::vector<Real> diagonal(n+4, 66);
-        diagonal[0] = 1;
-        diagonal[1] = 18;
-        diagonal[n+2] = 18;
-        diagonal[n+3] = 1;
-
-        std::vector<Real> first_superdiagonal(n+4, 26);
-        first_superdiagonal[0] = 10;
-        first_superdiagonal[1] = 33;
-        first_superdiagonal[n+2] = 1;
-        // There is one less superdiagonal than diagonal; make sure that if we read it, it shows up as a bug:
-        first_superdiagonal[n+3] = std::numeric_limits<Real>::quiet_NaN();
-
-        std::vector<Real> second_superdiagonal(n+4, 1);
-        second_superdiagonal[0] = 9;
-        second_superdiagonal[1] = 8;
-        second_superdiagonal[n+2] = std::numeric_limits<Real>::quiet_NaN();
-        second_superdiagonal[n+3] = std::numeric_limits<Real>::quiet_NaN();
-
-        std::vector<Real> first_subdiagonal(n+4, 26);
-        first_subdiagonal[0] = std::numeric_limits<Real>::quiet_NaN();
-        first_subdiagonal[1] = 1;
-        first_subdiagonal[n+2] = 33;
-        first_subdiagonal[n+3] = 10;
-
-        std::vector<Real> second_subdiagonal(n+4, 1);
-        second_subdiagonal[0] = std::numeric_limits<Real>::quiet_NaN();
-        second_subdiagonal[1] = std::numeric_limits<Real>::quiet_NaN();
-        second_subdiagonal[n+2] = 8;
-        second_subdiagonal[n+3] = 9;
-
-
+        m_alpha.resize(n + 4, std::numeric_limits<Real>::quiet_NaN());
+        unsigned threads = cardinal_b_spline_threads(n, max_threads);
+        m_alpha[0] = 20*y[0] - 12*h*left_endpoint_derivatives.first +  2*h*h*left_endpoint_derivatives.second;
+        m_alpha[1] = 60*y[0] - 12*h*left_endpoint_derivatives.first;
+        cardinal_b_spline_parallel_for(2, n + 2, threads, [&](unsigned, size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                m_alpha[i] = 120*y[i-2];
+            }
+        });
+        m_alpha[n+2] = 60*y[n-1] + 12*h*right_endpoint_derivatives.first;
+        m_alpha[n+3] = 20*y[n-1] + 12*h*right_endpoint_derivatives.first +  2*h*h*right_endpoint_derivatives.second;
+
+        // The reduction sweeps down the rows, and at step i only touches rows i, i+1 and i+2, so it only needs a window of three rows.
+        // The window converges quickly in the interior, and once it repeats exactly it repeats until the last rows come into it;
+        // so only the first few steps need be recorded, and the right hand side is reduced by a recurrence with constant coefficients.
+        struct band_row {
+            Real first_subdiagonal, second_subdiagonal, diagonal, first_superdiagonal, second_superdiagonal;
+        };
+        auto matrix_row = [n](size_t i) -> band_row {
+            const Real nan = std::numeric_limits<Real>::quiet_NaN();
+            if (i == 0) {
+                return {nan, nan, 1, 10, 9};
+            }
+            if (i == 1) {
+                return {1, nan, 18, 33, 8};
+            }
+            if (i == n + 2) {
+                return {33, 8, 18, 1, nan};
+            }
+            if (i == n + 3) {
+                return {10, 9, 1, nan, nan};
+            }
+            return {26, 1, 66, 26, 1};
+        };
+        auto same = [](band_row const & p, band_row const & q) {
+            return p.first_subdiagonal == q.first_subdiagonal && p.second_subdiagonal == q.second_subdiagonal && p.diagonal == q.diagonal
+                && p.first_superdiagonal == q.first_superdiagonal && p.second_superdiagonal == q.second_superdiagonal;
+        };
+
+        // What step i divides by: the diagonal of row i, and the negated subdiagonals of rows i+1 and i+2;
+        // and the superdiagonals of row i once normalized, which the back substitution needs.
+        struct step_record {
+            Real di, nfsub, nssub, first_superdiagonal, second_superdiagonal;
+        };
+        std::vector<step_record> head;
+        std::vector<step_record> tail;
+        band_row w0 = matrix_row(0);
+        band_row w1 = matrix_row(1);
+        band_row w2 = matrix_row(2);
         for (size_t i = 0; i < n+2; ++i) {
-            Real di = diagonal[i];
-            diagonal[i] = 1;
-            first_superdiagonal[i] /= di;
-            second_superdiagonal[i] /= di;
-            rhs[i] /= di;
+            band_row v0 = w0;
+            band_row v1 = w1;
+            Real di = w0.diagonal;
+            w0.diagonal = 1;
+            w0.first_superdiagonal /= di;
+            w0.second_superdiagonal /= di;
 
             // Eliminate first subdiagonal:
-            Real nfsub = -first_subdiagonal[i+1];
-            // Superfluous:
-            first_subdiagonal[i+1] /= nfsub;
-            // Not superfluous:
-            diagonal[i+1] /= nfsub;
-            first_superdiagonal[i+1] /= nfsub;
-            second_superdiagonal[i+1] /= nfsub;
-            rhs[i+1] /= nfsub;
-
-            diagonal[i+1] += first_superdiagonal[i];
-            first_superdiagonal[i+1] += second_superdiagonal[i];
-            rhs[i+1] += rhs[i];
-            // Superfluous, but clarifying:
-            first_subdiagonal[i+1] = 0;
+            Real nfsub = -w1.first_subdiagonal;
+            w1.diagonal /= nfsub;
+            w1.first_superdiagonal /= nfsub;
+            w1.second_superdiagonal /= nfsub;
+            w1.diagonal += w0.first_superdiagonal;
+            w1.first_superdiagonal += w0.second_superdiagonal;
+            w1.first_subdiagonal = 0;
 
             // Eliminate second subdiagonal:
-            Real nssub = -second_subdiagonal[i+2];
-            first_subdiagonal[i+2] /= nssub;
-            diagonal[i+2] /= nssub;
-            first_superdiagonal[i+2] /= nssub;
-            second_superdiagonal[i+2] /= nssub;
-            rhs[i+2] /= nssub;
-
-            first_subdiagonal[i+2] += first_superdiagonal[i];
-            diagonal[i+2] += second_superdiagonal[i];
-            rhs[i+2] += rhs[i];
-            // Superfluous, but clarifying:
-            second_subdiagonal[i+2] = 0;
+            Real nssub = -w2.second_subdiagonal;
+            w2.first_subdiagonal /= nssub;
+            w2.diagonal /= nssub;
+            w2.first_superdiagonal /= nssub;
+            w2.second_superdiagonal /= nssub;
+            w2.first_subdiagonal += w0.first_superdiagonal;
+            w2.diagonal += w0.second_superdiagonal;
+            w2.second_subdiagonal = 0;
+
+            step_record r{di, nfsub, nssub, w0.first_superdiagonal, w0.second_superdiagonal};
+            (i < n ? head : tail).push_back(r);
+            w0 = w1;
+            w1 = w2;
+            w2 = matrix_row(i + 3);
+            // Steps i + 1 up to n - 1 start from the same window as step i did, so they repeat it:
+            if (i >= 2 && i + 1 < n && same(w0, v0) && same(w1, v1)) {
+                i = n - 1;
+                w2 = matrix_row(n + 2);
+            }
         }
-
         // Eliminate last subdiagonal:
-        Real dnp2 = diagonal[n+2];
-        diagonal[n+2] = 1;
-        first_superdiagonal[n+2] /= dnp2;
-        rhs[n+2] /= dnp2;
-        Real nfsubnp3 = -first_subdiagonal[n+3];
-        diagonal[n+3] /= nfsubnp3;
-        rhs[n+3] /= nfsubnp3;
-
-        diagonal[n+3] += first_superdiagonal[n+2];
-        rhs[n+3] += rhs[n+2];
-
-        m_alpha.resize(n + 4, std::numeric_limits<Real>::quiet_NaN());
-
-        m_alpha[n+3] = rhs[n+3]/diagonal[n+3];
-        m_alpha[n+2] = rhs[n+2] - first_superdiagonal[n+2]*m_alpha[n+3];
-        for (int64_t i = int64_t(n+1); i >= 0; --i) {
-            m_alpha[i] = rhs[i] - first_superdiagonal[i]*m_alpha[i+1] - second_superdiagonal[i]*m_alpha[i+2];
+        Real dnp2 = w0.diagonal;
+        w0.first_superdiagonal /= dnp2;
+        Real nfsubnp3 = -w1.first_subdiagonal;
+        w1.diagonal /= nfsubnp3;
+        w1.diagonal += w0.first_superdiagonal;
+        const Real nan = std::numeric_limits<Real>::quiet_NaN();
+        tail.push_back({dnp2, nfsubnp3, nan, w0.first_superdiagonal, nan});
+        tail.push_back({w1.diagonal, nan, nan, nan, nan});
+        if (head.size() == n) {
+            head.insert(head.end(), tail.begin(), tail.end());
+            tail.clear();
+        }
+        auto step = [&](size_t i) -> step_record const & {
+            if (i < head.size()) {
+                return head[i];
+            }
+            return i < n ? head.back() : tail[i - n];
+        };
+
+        // Row j of the right hand side was divided by nssub at step j-2, by nfsub at step j-1, and by its diagonal at step j;
+        // in between it had the reduced rows j-2 and j-1 added:
+        auto reduce = [&](size_t j) {
+            Real r = m_alpha[j];
+            if (j >= 2) {
+                r /= step(j-2).nssub;
+                r += m_alpha[j-2];
+            }
+            if (j >= 1) {
+                r /= step(j-1).nfsub;
+                r += m_alpha[j-1];
+            }
+            m_alpha[j] = r/step(j).di;
+        };
+        // Rows whose three steps are all the repeated one:
+        size_t constant_first = (std::min)(head.size() + 1, n);
+        size_t constant_last = head.size() < n ? n : constant_first;
+        for (size_t j = 0; j < constant_first; ++j) {
+            reduce(j);
+        }
+        step_record c = head.back();
+        solve_linear_recurrence(m_alpha.data(), constant_first, constant_last, false, m_alpha[constant_first-1], m_alpha[constant_first-2],
+                                1/c.di, 1/(c.nfsub*c.di),
+                                [c](Real r, Real r1, Real r2) { return ((r/c.nssub + r2)/c.nfsub + r1)/c.di; }, threads);
+        for (size_t j = constant_last; j < n + 4; ++j) {
+            reduce(j);
         }
 
+        // Back substitution:
+        m_alpha[n+2] = m_alpha[n+2] - step(n+2).first_superdiagonal*m_alpha[n+3];
+        for (size_t j = n + 2; j-- > constant_last;) {
+            m_alpha[j] = m_alpha[j] - step(j).first_superdiagonal*m_alpha[j+1] - step(j).second_superdiagonal*m_alpha[j+2];
+        }
+        size_t k = head.size() < n ? head.size() : constant_last;
+        solve_linear_recurrence(m_alpha.data(), k, constant_last, true, m_alpha[constant_last], m_alpha[constant_last+1],
+                                -c.first_superdiagonal, -c.second_superdiagonal,
+                                [c](Real r, Real a1, Real a2) { return r - c.first_superdiagonal*a1 - c.second_superdiagonal*a2; }, threads);
+        for (size_t j = k; j-- > 0;) {
+            m_alpha[j] = m_alpha[j] - step(j).first_superdiagonal*m_alpha[j+1] - step(j).second_superdiagonal*m_alpha[j+2];
+        }
     }
 
     Real operator()(Real t) const {
@@ -226,6 +279,26 @@ public:
     }
 
 
+    void evaluate(const Real* t, size_t n, Real* y, Real* dydt, Real* d2ydt2) const {
+        for (size_t i = 0; i < n; ++i) {
+            if (!(t[i] >= m_t0 && t[i] <= m_t0 + (m_alpha.size()-5)/m_inv_h)) {
+                const char* err_msg = "Tried to evaluate the cardinal quintic b-spline outside the domain of of interpolation; extrapolation does not work.";
+                throw std::domain_error(err_msg);
+            }
+        }
+        // cardinal_b_spline<5>(x - j + 2) is the B-spline supported on [0, 6] evaluated at x - j + 5:
+        cardinal_b_spline_evaluate<5>(m_alpha.data(), m_alpha.size(), m_t0, m_inv_h, Real(5), Real(0), t, n, y, dydt, d2ydt2,
+            [&](size_t i) {
+                y[i] = (*this)(t[i]);
+                if (dydt) {
+                    dydt[i] = prime(t[i]);
+                }
+                if (d2ydt2) {
+                    d2ydt2[i] = double_prime(t[i]);
+                }
+            });
+    }
+
     Real t_max() const {
         return m_t0 + (m_alpha.size()-5)/m_inv_h;
     }
@@ -8,6 +8,7 @@
 #define BOOST_MATH_INTERPOLATORS_DETAIL_CUBIC_HERMITE_DETAIL_HPP
 #include <stdexcept>
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
 #include <sstream>
@@ -410,6 +411,51 @@ public:
         return dat_.size();
     }
 
+    // Values, and first derivatives if dydx is not null, at the n abscissas x, which must lie in the domain.
+    // The abscissas are located a block at a time and the data they need is gathered into contiguous arrays,
+    // so that the polynomial evaluation is a branch free loop which the compiler can vectorize.
+    void unchecked_evaluation(const Real* x, std::size_t n, Real* y, Real* dydx) const
+    {
+        using std::floor;
+        constexpr std::size_t block = 64;
+        std::array<Real, block> t, y0, y1, dy0, dy1;
+        const std::size_t last = dat_.size() - 1;
+        for (std::size_t start = 0; start < n; start += block)
+        {
+            const std::size_t m = (std::min)(block, n - start);
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                Real s = (x[start + j] - x0_)*inv_dx_;
+                Real ii = floor(s);
+                auto i = static_cast<std::size_t>(ii);
+                // The right endpoint is the end of the last interval:
+                if (i >= last)
+                {
+                    i = last - 1;
+                    ii = static_cast<Real>(i);
+                }
+                t[j] = s - ii;
+                y0[j] = dat_[i][0];
+                dy0[j] = dat_[i][1];
+                y1[j] = dat_[i+1][0];
+                dy1[j] = dat_[i+1][1];
+            }
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                Real r = 1 - t[j];
+                y[start + j] = r*r*(y0[j]*(1 + 2*t[j]) + dy0[j]*t[j]) + t[j]*t[j]*(y1[j]*(3 - 2*t[j]) - dy1[j]*r);
+            }
+            if (dydx)
+            {
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    Real tj = t[j];
+                    dydx[start + j] = (6*tj*(1 - tj)*(y1[j] - y0[j]) + (3*tj*tj - 4*tj + 1)*dy0[j] + tj*(3*tj - 2)*dy1[j])*inv_dx_;
+                }
+            }
+        }
+    }
+
     int64_t bytes() const
     {
         return dat_.size()*dat_[0].size()*sizeof(Real) + sizeof(dat_) + 2*sizeof(Real);
@@ -7,6 +7,7 @@
 #ifndef BOOST_MATH_INTERPOLATORS_DETAIL_QUINTIC_HERMITE_DETAIL_HPP
 #define BOOST_MATH_INTERPOLATORS_DETAIL_QUINTIC_HERMITE_DETAIL_HPP
 #include <algorithm>
+#include <array>
 #include <stdexcept>
 #include <sstream>
 #include <cmath>
@@ -374,7 +375,7 @@ public:
         Real d2y1 = d2y_[i+1];
 
         Real d2ydx2 = 60*t*(1 - 3*t + 2*t*t)*(y1 - y0)*inv_dx_*inv_dx_;
-        d2ydx2 += (12*t)*((-3 + 8*t - 5*t*t)*dy0 - (2 - 7*t + 5*t*t)*dy1);
+        d2ydx2 += (12*t)*((-3 + 8*t - 5*t*t)*dy0 - (2 - 7*t + 5*t*t)*dy1)*inv_dx_*inv_dx_;
         d2ydx2 += (1 - 9*t + 18*t*t - 10*t*t*t)*d2y0*(2*inv_dx_*inv_dx_) + t*(3 - 12*t + 10*t*t)*d2y1*(2*inv_dx_*inv_dx_);
         return d2ydx2;
     }
@@ -555,11 +556,65 @@ public:
         Real d2y1 = data_[i+1][2];
 
         Real d2ydx2 = 60*t*(1 - 3*t + 2*t*t)*(y1 - y0)*inv_dx_*inv_dx_;
-        d2ydx2 += (12*t)*((-3 + 8*t - 5*t*t)*dy0 - (2 - 7*t + 5*t*t)*dy1);
+        d2ydx2 += (12*t)*((-3 + 8*t - 5*t*t)*dy0 - (2 - 7*t + 5*t*t)*dy1)*inv_dx_*inv_dx_;
         d2ydx2 += (1 - 9*t + 18*t*t - 10*t*t*t)*d2y0*(2*inv_dx_*inv_dx_) + t*(3 - 12*t + 10*t*t)*d2y1*(2*inv_dx_*inv_dx_);
         return d2ydx2;
     }
 
+    // Values, and first derivatives if dydx is not null, at the n abscissas x, which must lie in the domain.
+    // The abscissas are located a block at a time and the data they need is gathered into contiguous arrays,
+    // so that the polynomial evaluation is a branch free loop which the compiler can vectorize.
+    void unchecked_evaluation(const Real* x, std::size_t n, Real* y, Real* dydx) const
+    {
+        using std::floor;
+        constexpr std::size_t block = 64;
+        std::array<Real, block> t, y0, y1, v0, v1, a0, a1;
+        const std::size_t last = data_.size() - 1;
+        for (std::size_t start = 0; start < n; start += block)
+        {
+            const std::size_t m = (std::min)(block, n - start);
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                Real s = (x[start + j] - x0_)*inv_dx_;
+                Real ii = floor(s);
+                auto i = static_cast<std::size_t>(ii);
+                // The right endpoint is the end of the last interval:
+                if (i >= last)
+                {
+                    i = last - 1;
+                    ii = static_cast<Real>(i);
+                }
+                t[j] = s - ii;
+                y0[j] = data_[i][0];
+                v0[j] = data_[i][1];
+                a0[j] = data_[i][2];
+                y1[j] = data_[i+1][0];
+                v1[j] = data_[i+1][1];
+                a1[j] = data_[i+1][2];
+            }
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                Real tj = t[j];
+                Real yj = (1 - tj*tj*tj*(10 + tj*(-15 + 6*tj)))*y0[j];
+                yj += tj*(1 + tj*tj*(-6 + tj*(8 - 3*tj)))*v0[j];
+                yj += tj*tj*(1 + tj*(-3 + tj*(3 - tj)))*a0[j];
+                yj += tj*tj*tj*((1 + tj*(-2 + tj))*a1[j] + (-4 + tj*(7 - 3*tj))*v1[j] + (10 + tj*(-15 + 6*tj))*y1[j]);
+                y[start + j] = yj;
+            }
+            if (dydx)
+            {
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    Real tj = t[j];
+                    Real dy = 30*tj*tj*(1 - 2*tj + tj*tj)*(y1[j] - y0[j]);
+                    dy += (1 - 18*tj*tj + 32*tj*tj*tj - 15*tj*tj*tj*tj)*v0[j] - tj*tj*(12 - 28*tj + 15*tj*tj)*v1[j];
+                    dy += tj*((2 - 9*tj + 12*tj*tj - 5*tj*tj*tj)*a0[j] + tj*(3 - 8*tj + 5*tj*tj)*a1[j]);
+                    dydx[start + j] = dy*inv_dx_;
+                }
+            }
+        }
+    }
+
     int64_t bytes() const
     {
         return data_.size()*data_[0].size()*sizeof(Real) + 2*sizeof(Real);
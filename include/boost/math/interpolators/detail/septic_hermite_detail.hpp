@@ -7,6 +7,7 @@
 #ifndef BOOST_MATH_INTERPOLATORS_DETAIL_SEPTIC_HERMITE_DETAIL_HPP
 #define BOOST_MATH_INTERPOLATORS_DETAIL_SEPTIC_HERMITE_DETAIL_HPP
 #include <algorithm>
+#include <array>
 #include <stdexcept>
 #include <sstream>
 #include <cmath>
@@ -318,7 +319,7 @@ public:
         }
         if (x == xf)
         {
-            return dy_.back()/inv_dx_;
+            return dy_.back()*inv_dx_;
         }
 
         return this->unchecked_prime(x);
@@ -333,7 +334,7 @@ public:
         Real t = s3 - ii;
         if (t==0)
         {
-            return dy_[i]/inv_dx_;
+            return dy_[i]*inv_dx_;
         }
  
         Real y0 = y_[i];
@@ -357,7 +358,7 @@ public:
         Real dydx = z0*(y1-y0)*inv_dx_;
         dydx += (z1*dy0 + z2*dy1)*inv_dx_;
         dydx += 2*t*(z3*a0 + z4*a1)*inv_dx_;
-        dydx += t*t*(z5*j0 + z6*j1);
+        dydx += t*t*(z5*j0 + z6*j1)*inv_dx_;
         return dydx;
     }
 
@@ -413,7 +414,7 @@ public:
         Real d2ydx2 = z0*(y1-y0)*inv_dx_*inv_dx_;
         d2ydx2 += (z1*dy0 + z2*dy1)*inv_dx_*inv_dx_;
         d2ydx2 += (z3*a0 + z4*a1)*2*inv_dx_*inv_dx_;
-        d2ydx2 += 6*(z5*j0 + z6*j1)/(inv_dx_*inv_dx_);
+        d2ydx2 += 6*(z5*j0 + z6*j1)*inv_dx_*inv_dx_;
 
         return d2ydx2;
     }
@@ -568,7 +569,7 @@ public:
         Real dydx = z0*(y1-y0)*inv_dx_;
         dydx += (z1*dy0 + z2*dy1)*inv_dx_;
         dydx += 2*t*(z3*a0 + z4*a1)*inv_dx_;
-        dydx += t*t*(z5*j0 + z6*j1);
+        dydx += t*t*(z5*j0 + z6*j1)*inv_dx_;
         return dydx;
     }
 
@@ -623,11 +624,79 @@ public:
         Real d2ydx2 = z0*(y1-y0)*inv_dx_*inv_dx_;
         d2ydx2 += (z1*dy0 + z2*dy1)*inv_dx_*inv_dx_;
         d2ydx2 += (z3*a0 + z4*a1)*2*inv_dx_*inv_dx_;
-        d2ydx2 += 6*(z5*j0 + z6*j1)/(inv_dx_*inv_dx_);
+        d2ydx2 += 6*(z5*j0 + z6*j1)*inv_dx_*inv_dx_;
 
         return d2ydx2;
     }
 
+    // Values, and first derivatives if dydx is not null, at the n abscissas x, which must lie in the domain.
+    // The abscissas are located a block at a time and the data they need is gathered into contiguous arrays,
+    // so that the polynomial evaluation is a branch free loop which the compiler can vectorize.
+    void unchecked_evaluation(const Real* x, std::size_t n, Real* y, Real* dydx) const
+    {
+        using std::floor;
+        constexpr std::size_t block = 64;
+        std::array<Real, block> t, y0, y1, dy0, dy1, a0, a1, j0, j1;
+        const std::size_t last = data_.size() - 1;
+        for (std::size_t start = 0; start < n; start += block)
+        {
+            const std::size_t m = (std::min)(block, n - start);
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                Real s = (x[start + j] - x0_)*inv_dx_;
+                Real ii = floor(s);
+                auto i = static_cast<std::size_t>(ii);
+                // The right endpoint is the end of the last interval:
+                if (i >= last)
+                {
+                    i = last - 1;
+                    ii = static_cast<Real>(i);
+                }
+                t[j] = s - ii;
+                y0[j] = data_[i][0];
+                dy0[j] = data_[i][1];
+                a0[j] = data_[i][2];
+                j0[j] = data_[i][3];
+                y1[j] = data_[i+1][0];
+                dy1[j] = data_[i+1][1];
+                a1[j] = data_[i+1][2];
+                j1[j] = data_[i+1][3];
+            }
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                Real tj = t[j];
+                Real t2 = tj*tj;
+                Real t3 = t2*tj;
+                Real t4 = t3*tj;
+                Real s = t4*(-35 + tj*(84 + tj*(-70 + 20*tj)));
+                Real z1 = tj*(1 + t3*(-20 + tj*(45 + tj*(-36 + 10*tj))));
+                Real z2 = t2*(1 + t2*(-10 + tj*(20 + tj*(-15 + 4*tj))));
+                Real z3 = t3*(1 + tj*(-4 + tj*(6 + tj*(-4 + tj))));
+                Real z5 = t4*(-15 + tj*(39 + tj*(-34 + 10*tj)));
+                Real z6 = t4*(5 + tj*(-14 + tj*(13 - 4*tj)));
+                Real z7 = t4*(-1 + tj*(3 + tj*(-3 + tj)));
+                y[start + j] = (s + 1)*y0[j] + z1*dy0[j] + z2*a0[j] + z3*j0[j] - s*y1[j] + z5*dy1[j] + z6*a1[j] + z7*j1[j];
+            }
+            if (dydx)
+            {
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    Real tj = t[j];
+                    Real t2 = tj*tj;
+                    Real t3 = t2*tj;
+                    Real z0 = 140*t3*(1 + tj*(-3 + tj*(3 - tj)));
+                    Real z1 = 1 + t3*(-80 + tj*(225 + tj*(-216 + 70*tj)));
+                    Real z2 = t3*(-60 + tj*(195 + tj*(-204 + 70*tj)));
+                    Real z3 = 1 + t2*(-20 + tj*(50 + tj*(-45 + 14*tj)));
+                    Real z4 = t2*(10 + tj*(-35 + tj*(39 - 14*tj)));
+                    Real z5 = 3 + tj*(-16 + tj*(30 + tj*(-24 + 7*tj)));
+                    Real z6 = tj*(-4 + tj*(15 + tj*(-18 + 7*tj)));
+                    dydx[start + j] = (z0*(y1[j] - y0[j]) + z1*dy0[j] + z2*dy1[j] + 2*tj*(z3*a0[j] + z4*a1[j]) + t2*(z5*j0[j] + z6*j1[j]))*inv_dx_;
+                }
+            }
+        }
+    }
+
     int64_t bytes() const
     {
         return data_.size()*data_[0].size()*sizeof(Real) + 2*sizeof(Real) + sizeof(data_);
@@ -0,0 +1,247 @@
+// Copyright agent, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_TENSOR_CARDINAL_CUBIC_B_SPLINE_DETAIL_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_TENSOR_CARDINAL_CUBIC_B_SPLINE_DETAIL_HPP
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/interpolators/detail/cardinal_b_spline_common.hpp>
+#include <boost/math/interpolators/detail/tensor_product_detail.hpp>
+
+namespace boost{ namespace math{ namespace interpolators{ namespace detail{
+
+template<class Real, std::size_t Dimension>
+class tensor_cardinal_cubic_b_spline_imp
+{
+public:
+    // The lines of large data are solved for on up to max_threads threads.
+    template<class RandomAccessIterator>
+    tensor_cardinal_cubic_b_spline_imp(RandomAccessIterator f, std::array<std::size_t, Dimension> const & extents,
+                                       std::array<Real, Dimension> const & x0, std::array<Real, Dimension> const & dx,
+                                       unsigned max_threads = 1)
+        : m_extents{extents}, m_x0{x0}
+    {
+        static_assert(Dimension > 0, "The dimension must be at least 1.");
+        std::size_t size = 1;
+        std::size_t coefficients = 1;
+        for (std::size_t a = 0; a < Dimension; ++a)
+        {
+            if (!(dx[a] > 0))
+            {
+                throw std::logic_error("Spacing must be > 0.");
+            }
+            // The derivatives at the ends are estimated from five samples:
+            if (extents[a] < 5)
+            {
+                throw std::logic_error("The tensor product cubic B-spline interpolator requires at least 5 points along each axis.");
+            }
+            if (boost::math::isnan(x0[a]))
+            {
+                throw std::logic_error("Left endpoint is NAN; this is disallowed.");
+            }
+            m_inv_h[a] = 1/dx[a];
+            m_xf[a] = x0[a] + static_cast<Real>(extents[a] - 1)*dx[a];
+            size *= extents[a];
+            coefficients *= extents[a] + 2;
+        }
+        std::ptrdiff_t stride = 1;
+        for (std::size_t a = Dimension; a-- > 0;)
+        {
+            m_strides[a] = stride;
+            stride *= static_cast<std::ptrdiff_t>(extents[a] + 2);
+        }
+
+        // The interpolant is the tensor product of the one dimensional ones, so its coefficients
+        // come from solving the one dimensional systems along each axis in turn, each time on every line of the array.
+        std::vector<Real> in(f, f + size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (boost::math::isnan(in[i]))
+            {
+                std::string err = "This function you are trying to interpolate is a nan at index " + std::to_string(i) + "\n";
+                throw std::logic_error(err);
+            }
+        }
+        // Each pass grows one axis by two, so both buffers are sized for the final coefficients:
+        in.resize(coefficients);
+        std::vector<Real> out(coefficients);
+        unsigned threads = cardinal_b_spline_threads(coefficients, max_threads);
+        std::size_t outer = 1;
+        for (std::size_t a = 0; a < Dimension; ++a)
+        {
+            std::size_t n = extents[a];
+            std::size_t inner = 1;
+            for (std::size_t b = a + 1; b < Dimension; ++b)
+            {
+                inner *= extents[b];
+            }
+            // Lines are independent, so they are split between threads along the longer of the two dimensions which hold them:
+            if (outer >= inner)
+            {
+                cardinal_b_spline_parallel_for(0, outer, threads, [&](unsigned, std::size_t first, std::size_t last) {
+                    solve_axis(in.data(), out.data(), n, inner, first, last, 0, inner);
+                });
+            }
+            else
+            {
+                cardinal_b_spline_parallel_for(0, inner, threads, [&](unsigned, std::size_t first, std::size_t last) {
+                    solve_axis(in.data(), out.data(), n, inner, 0, outer, first, last);
+                });
+            }
+            outer *= n + 2;
+            std::swap(in, out);
+        }
+        m_alpha = std::move(in);
+    }
+
+    // The value at x, and unless grad is null, the gradient.
+    Real evaluate(const Real* x, Real* grad) const
+    {
+        std::array<std::array<std::ptrdiff_t, 4>, Dimension> off;
+        std::array<std::array<Real, 4>, Dimension> w;
+        std::array<std::array<Real, 4>, Dimension> dw;
+        std::ptrdiff_t base = 0;
+        for (std::size_t a = 0; a < Dimension; ++a)
+        {
+            std::size_t k;
+            Real u;
+            tensor_locate(x[a], m_x0[a], m_xf[a], m_inv_h[a], m_extents[a] - 1, k, u);
+            // With s = (x - x0)/h = k + u, the coefficients alpha_k, ..., alpha_{k+3} multiply the B-spline B3 centered on [-2, 2]
+            // evaluated at u + 1, u, u - 1 and u - 2:
+            Real v = 1 - u;
+            Real u2 = u*u;
+            Real u3 = u2*u;
+            w[a][0] = v*v*v/6;
+            w[a][1] = (4 - 6*u2 + 3*u3)/6;
+            w[a][2] = (1 + 3*u + 3*u2 - 3*u3)/6;
+            w[a][3] = u3/6;
+            if (grad)
+            {
+                Real inv_h = m_inv_h[a];
+                dw[a][0] = -v*v*inv_h/2;
+                dw[a][1] = u*(3*u - 4)*inv_h/2;
+                dw[a][2] = (1 + 2*u - 3*u2)*inv_h/2;
+                dw[a][3] = u2*inv_h/2;
+            }
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                off[a][j] = static_cast<std::ptrdiff_t>(j)*m_strides[a];
+            }
+            base += static_cast<std::ptrdiff_t>(k)*m_strides[a];
+        }
+        const Real* p = m_alpha.data() + base;
+        if (grad)
+        {
+            Real out[Dimension + 1];
+            tensor_contract<0, true>(p, off, w, dw, out);
+            for (std::size_t a = 0; a < Dimension; ++a)
+            {
+                grad[a] = out[a + 1];
+            }
+            return out[0];
+        }
+        Real out;
+        tensor_contract<0, false>(p, off, w, dw, &out);
+        return out;
+    }
+
+    // y[i] = s(x[i*Dimension], ..., x[i*Dimension + Dimension - 1]) for 0 <= i < n,
+    // and the gradients to grad[i*Dimension], ... unless grad is null, on up to max_threads threads.
+    void evaluate(const Real* x, std::size_t n, Real* y, Real* grad, unsigned max_threads = 1) const
+    {
+        cardinal_b_spline_parallel_for(0, n, cardinal_b_spline_threads(n, max_threads), [&](unsigned, std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                y[i] = evaluate(x + i*Dimension, grad ? grad + i*Dimension : nullptr);
+            }
+        });
+    }
+
+    std::pair<Real, Real> domain(std::size_t axis) const
+    {
+        return std::make_pair(m_x0[axis], m_xf[axis]);
+    }
+
+private:
+    // Solves the almost tridiagonal systems of the one dimensional cubic B-spline along the middle axis of the samples f,
+    // of shape (outer, n, inner), into alpha, of shape (outer, n + 2, inner), for o_first <= o < o_last and i_first <= i < i_last.
+    // See cardinal_cubic_b_spline_imp for the system; here the rows of the reduction are applied to whole slabs at once.
+    static void solve_axis(const Real* f, Real* alpha, std::size_t n, std::size_t inner,
+                           std::size_t o_first, std::size_t o_last, std::size_t i_first, std::size_t i_last)
+    {
+        std::size_t last = n + 1;
+        // The reduced super diagonal, which is the same for every line:
+        std::vector<Real> sd(last, Real(0));
+        sd[1] = Real(1)/2;
+        for (std::size_t i = 2; i < last; ++i)
+        {
+            sd[i] = 1/(4 - sd[i - 1]);
+        }
+        Real final_subdiag = -sd[last - 2];
+        Real final_diag = -1/final_subdiag - sd[last - 1];
+
+        for (std::size_t o = o_first; o < o_last; ++o)
+        {
+            auto F = [&](std::size_t i) { return f + (o*n + i)*inner; };
+            auto R = [&](std::size_t i) { return alpha + (o*(n + 2) + i)*inner; };
+            for (std::size_t j = i_first; j < i_last; ++j)
+            {
+                // alpha_2 - alpha_0 = 2h s'(a), with s'(a) and s'(b) estimated to O(h^4) by one sided differences:
+                Real l = -25*F(0)[j]/12 + 4*F(1)[j] - 3*F(2)[j] + 4*F(3)[j]/3 - F(4)[j]/4;
+                Real r = 25*F(n - 1)[j]/12 - 4*F(n - 2)[j] + 3*F(n - 3)[j] - 4*F(n - 4)[j]/3 + F(n - 5)[j]/4;
+                R(0)[j] = -2*l;
+                R(last)[j] = -2*r;
+                R(1)[j] = (6*F(0)[j] - R(0)[j])/4;
+            }
+            for (std::size_t i = 2; i < last; ++i)
+            {
+                Real* ri = R(i);
+                const Real* ri1 = R(i - 1);
+                const Real* fi = F(i - 1);
+                Real s = sd[i];
+                for (std::size_t j = i_first; j < i_last; ++j)
+                {
+                    ri[j] = (6*fi[j] - ri1[j])*s;
+                }
+            }
+            for (std::size_t j = i_first; j < i_last; ++j)
+            {
+                Real z = (R(last)[j] - R(last - 2)[j])/final_subdiag;
+                R(last)[j] = (z - R(last - 1)[j])/final_diag;
+            }
+            for (std::size_t i = last - 1; i > 0; --i)
+            {
+                Real* ri = R(i);
+                const Real* ri1 = R(i + 1);
+                Real s = sd[i];
+                for (std::size_t j = i_first; j < i_last; ++j)
+                {
+                    ri[j] -= s*ri1[j];
+                }
+            }
+            for (std::size_t j = i_first; j < i_last; ++j)
+            {
+                R(0)[j] += R(2)[j];
+            }
+        }
+    }
+
+    std::vector<Real> m_alpha;
+    std::array<std::size_t, Dimension> m_extents;
+    std::array<std::ptrdiff_t, Dimension> m_strides;
+    std::array<Real, Dimension> m_x0;
+    std::array<Real, Dimension> m_xf;
+    std::array<Real, Dimension> m_inv_h;
+};
+
+}}}}
+#endif
@@ -0,0 +1,152 @@
+// Copyright agent, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_TENSOR_CARDINAL_CUBIC_HERMITE_DETAIL_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_TENSOR_CARDINAL_CUBIC_HERMITE_DETAIL_HPP
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <boost/math/interpolators/detail/cardinal_b_spline_common.hpp>
+#include <boost/math/interpolators/detail/tensor_product_detail.hpp>
+
+namespace boost{ namespace math{ namespace interpolators{ namespace detail{
+
+template<class RandomAccessContainer, std::size_t Dimension>
+class tensor_cardinal_cubic_hermite_detail {
+public:
+    using Real = typename RandomAccessContainer::value_type;
+    // The number of values at each node: the function and its mixed partials.
+    static constexpr std::size_t node_size = std::size_t(1) << Dimension;
+
+    tensor_cardinal_cubic_hermite_detail(RandomAccessContainer && data, std::array<std::size_t, Dimension> const & extents,
+                                         std::array<Real, Dimension> const & x0, std::array<Real, Dimension> const & dx)
+    : data_{std::move(data)}, extents_{extents}, x0_{x0}
+    {
+        static_assert(Dimension > 0, "The dimension must be at least 1.");
+        std::size_t nodes = 1;
+        for (std::size_t a = 0; a < Dimension; ++a)
+        {
+            if (extents[a] < 2)
+            {
+                throw std::domain_error("Must be at least two data points along each axis.");
+            }
+            if (!(dx[a] > 0))
+            {
+                throw std::domain_error("dx > 0 is required.");
+            }
+            inv_dx_[a] = 1/dx[a];
+            xf_[a] = x0[a] + static_cast<Real>(extents[a] - 1)*dx[a];
+            nodes *= extents[a];
+        }
+        if (data_.size() != nodes*node_size)
+        {
+            throw std::domain_error("There must be 2^Dimension values at each node: the function and its mixed partial derivatives.");
+        }
+        std::ptrdiff_t stride = node_size;
+        for (std::size_t a = Dimension; a-- > 0;)
+        {
+            strides_[a] = stride;
+            stride *= static_cast<std::ptrdiff_t>(extents[a]);
+        }
+
+        // As in one dimension, the derivatives are stored in units of the cell, so that the weights don't depend on dx:
+        std::array<Real, node_size> scale;
+        for (std::size_t m = 0; m < node_size; ++m)
+        {
+            scale[m] = 1;
+            for (std::size_t a = 0; a < Dimension; ++a)
+            {
+                if (m & (std::size_t(1) << a))
+                {
+                    scale[m] *= dx[a];
+                }
+            }
+        }
+        for (std::size_t i = 0; i < data_.size(); ++i)
+        {
+            data_[i] *= scale[i % node_size];
+        }
+    }
+
+    // The value at x, and unless grad is null, the gradient.
+    Real evaluate(const Real* x, Real* grad) const
+    {
+        std::array<std::array<std::ptrdiff_t, 4>, Dimension> off;
+        std::array<std::array<Real, 4>, Dimension> w;
+        std::array<std::array<Real, 4>, Dimension> dw;
+        std::ptrdiff_t base = 0;
+        for (std::size_t a = 0; a < Dimension; ++a)
+        {
+            std::size_t k;
+            Real t;
+            tensor_locate(x[a], x0_[a], xf_[a], inv_dx_[a], extents_[a] - 1, k, t);
+            // The value and derivative at node k, then at node k + 1, which are the entries m and m | 2^a of each node:
+            Real r = 1 - t;
+            w[a][0] = r*r*(1 + 2*t);
+            w[a][1] = r*r*t;
+            w[a][2] = t*t*(3 - 2*t);
+            w[a][3] = -t*t*r;
+            if (grad)
+            {
+                Real inv_dx = inv_dx_[a];
+                dw[a][0] = -6*t*r*inv_dx;
+                dw[a][1] = r*(1 - 3*t)*inv_dx;
+                dw[a][2] = 6*t*r*inv_dx;
+                dw[a][3] = t*(3*t - 2)*inv_dx;
+            }
+            std::ptrdiff_t bit = std::ptrdiff_t(1) << a;
+            off[a] = {0, bit, strides_[a], strides_[a] + bit};
+            base += static_cast<std::ptrdiff_t>(k)*strides_[a];
+        }
+        const Real* p = data_.data() + base;
+        if (grad)
+        {
+            Real out[Dimension + 1];
+            tensor_contract<0, true>(p, off, w, dw, out);
+            for (std::size_t a = 0; a < Dimension; ++a)
+            {
+                grad[a] = out[a + 1];
+            }
+            return out[0];
+        }
+        Real out;
+        tensor_contract<0, false>(p, off, w, dw, &out);
+        return out;
+    }
+
+    void evaluate(const Real* x, std::size_t n, Real* y, Real* grad, unsigned max_threads = 1) const
+    {
+        cardinal_b_spline_parallel_for(0, n, cardinal_b_spline_threads(n, max_threads), [&](unsigned, std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                y[i] = evaluate(x + i*Dimension, grad ? grad + i*Dimension : nullptr);
+            }
+        });
+    }
+
+    std::pair<Real, Real> domain(std::size_t axis) const
+    {
+        return {x0_[axis], xf_[axis]};
+    }
+
+    int64_t bytes() const
+    {
+        return data_.size()*sizeof(Real) + sizeof(*this);
+    }
+
+private:
+    RandomAccessContainer data_;
+    std::array<std::size_t, Dimension> extents_;
+    std::array<std::ptrdiff_t, Dimension> strides_;
+    std::array<Real, Dimension> x0_;
+    std::array<Real, Dimension> xf_;
+    std::array<Real, Dimension> inv_dx_;
+};
+
+}}}}
+#endif
@@ -0,0 +1,84 @@
+// Copyright agent, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Pieces shared by the tensor product interpolators on uniform grids:
+// locating a point in the grid, and contracting the 4^Dimension coefficients
+// which influence it against the one dimensional weights of each axis.
+
+#ifndef BOOST_MATH_INTERPOLATORS_DETAIL_TENSOR_PRODUCT_DETAIL_HPP
+#define BOOST_MATH_INTERPOLATORS_DETAIL_TENSOR_PRODUCT_DETAIL_HPP
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace boost{ namespace math{ namespace interpolators{ namespace detail{
+
+// Finds the cell [x0 + k*h, x0 + (k+1)*h] holding x, and the position 0 <= u <= 1 of x within it,
+// for a grid with points x0, x0 + h, ..., xf = x0 + cells*h.
+template<class Real>
+void tensor_locate(Real x, Real x0, Real xf, Real inv_h, std::size_t cells, std::size_t& k, Real& u)
+{
+    if (!(x >= x0 && x <= xf))
+    {
+        std::ostringstream oss;
+        oss.precision(std::numeric_limits<Real>::digits10+3);
+        oss << "Requested abscissa x = " << x << ", which is outside of allowed range ["
+            << x0 << ", " << xf << "]";
+        throw std::domain_error(oss.str());
+    }
+    Real s = (x - x0)*inv_h;
+    k = static_cast<std::size_t>(s);
+    // Rounding may place xf a hair beyond the last cell:
+    if (k >= cells)
+    {
+        k = cells - 1;
+    }
+    u = s - static_cast<Real>(k);
+    if (u > 1)
+    {
+        u = 1;
+    }
+}
+
+// Writes to out[0] the sum over 0 <= j_a < 4 of p[off[A][j_A] + ... + off[D-1][j_{D-1}]]*w[A][j_A]*...*w[D-1][j_{D-1}],
+// and if Gradient, to out[1 + b - A] the same sum with dw[b] in place of w[b], for A <= b < D.
+// The axes are contracted from the last, so that the innermost loop runs along the most contiguous one.
+template<std::size_t A, bool Gradient, class Real, std::size_t D>
+inline void tensor_contract(const Real* p, const std::array<std::array<std::ptrdiff_t, 4>, D>& off,
+                            const std::array<std::array<Real, 4>, D>& w, const std::array<std::array<Real, 4>, D>& dw, Real* out)
+{
+    if constexpr (A == D)
+    {
+        out[0] = *p;
+    }
+    else
+    {
+        constexpr std::size_t m = Gradient ? D - A + 1 : 1;
+        Real sub[Gradient ? D - A : 1];
+        for (std::size_t i = 0; i < m; ++i)
+        {
+            out[i] = 0;
+        }
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            tensor_contract<A + 1, Gradient>(p + off[A][j], off, w, dw, sub);
+            out[0] += w[A][j]*sub[0];
+            if constexpr (Gradient)
+            {
+                out[1] += dw[A][j]*sub[0];
+                for (std::size_t b = 1; b < D - A; ++b)
+                {
+                    out[b + 1] += w[A][j]*sub[b];
+                }
+            }
+        }
+    }
+}
+
+}}}}
+#endif
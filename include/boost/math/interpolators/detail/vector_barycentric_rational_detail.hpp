@@ -8,6 +8,8 @@
 #ifndef BOOST_MATH_INTERPOLATORS_VECTOR_BARYCENTRIC_RATIONAL_DETAIL_HPP
 #define BOOST_MATH_INTERPOLATORS_VECTOR_BARYCENTRIC_RATIONAL_DETAIL_HPP
 
+#include <algorithm>
+#include <array>
 #include <vector>
 #include <utility> // for std::move
 #include <limits>
@@ -28,6 +30,8 @@ public:
 
     void eval_with_prime(Point& x, Point& dxdt, Real t) const;
 
+    void evaluate(const Real* t, size_t m, Point* x, Point* dxdt) const;
+
     // The barycentric weights are only interesting to the unit tests:
     Real weight(size_t i) const { return w_[i]; }
 
@@ -36,7 +40,10 @@ private:
     void calculate_weights(size_t approximation_order);
 
     TimeContainer t_;
-    SpaceContainer y_;
+    // The points coordinate by coordinate, y_[j*t_.size() + i] being coordinate j of point i,
+    // so that a sweep over the nodes reads one contiguous array for each coordinate:
+    std::vector<Real> y_;
+    size_t dimension_;
     TimeContainer w_;
 };
 
@@ -45,10 +52,19 @@ vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::vector_barycentr
 {
     using std::numeric_limits;
     t_ = std::move(t);
-    y_ = std::move(y);
 
-    BOOST_MATH_ASSERT_MSG(t_.size() == y_.size(), "There must be the same number of time points as space points.");
-    BOOST_MATH_ASSERT_MSG(approximation_order < y_.size(), "Approximation order must be < data length.");
+    BOOST_MATH_ASSERT_MSG(t_.size() == y.size(), "There must be the same number of time points as space points.");
+    BOOST_MATH_ASSERT_MSG(approximation_order < y.size(), "Approximation order must be < data length.");
+    const size_t n = y.size();
+    dimension_ = y[0].size();
+    y_.resize(dimension_*n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t j = 0; j < dimension_; ++j)
+        {
+            y_[j*n + i] = y[i][j];
+        }
+    }
     for (size_t i = 1; i < t_.size(); ++i)
     {
         BOOST_MATH_ASSERT_MSG(t_[i] - t_[i-1] >  (numeric_limits<typename TimeContainer::value_type>::min)(), "The abscissas must be listed in strictly increasing order t[0] < t[1] < ... < t[n-1].");
@@ -103,23 +119,27 @@ template<class TimeContainer, class SpaceContainer>
 void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::operator()(typename SpaceContainer::value_type& p, typename TimeContainer::value_type t) const
 {
     using Real = typename TimeContainer::value_type;
+    const size_t n = t_.size();
     for (auto & x : p)
     {
         x = Real(0);
     }
     Real denominator = 0;
-    for(size_t i = 0; i < t_.size(); ++i)
+    for(size_t i = 0; i < n; ++i)
     {
         // See associated commentary in the scalar version of this function.
         if (t == t_[i])
         {
-            p = y_[i];
+            for (decltype(p.size()) j = 0; j < p.size(); ++j)
+            {
+                p[j] = y_[j*n + i];
+            }
             return;
         }
         Real x = w_[i]/(t - t_[i]);
         for (decltype(p.size()) j = 0; j < p.size(); ++j)
         {
-            p[j] += x*y_[i][j];
+            p[j] += x*y_[j*n + i];
         }
         denominator += x;
     }
@@ -135,6 +155,7 @@ void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::eval_with_p
 {
     using Point = typename SpaceContainer::value_type;
     using Real = typename TimeContainer::value_type;
+    const size_t n = t_.size();
     this->operator()(x, t);
     Point numerator;
     for (decltype(x.size()) i = 0; i < x.size(); ++i)
@@ -160,7 +181,7 @@ void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::eval_with_p
                 }
                 for (decltype(sum.size()) k = 0; k < sum.size(); ++k)
                 {
-                    sum[k] += w_[j]*(y_[i][k] - y_[j][k])/(t_[i] - t_[j]);
+                    sum[k] += w_[j]*(y_[k*n + i] - y_[k*n + j])/(t_[i] - t_[j]);
                 }
             }
             for (decltype(sum.size()) k = 0; k < sum.size(); ++k)
@@ -173,7 +194,7 @@ void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::eval_with_p
         Point diff;
         for (decltype(diff.size()) j = 0; j < diff.size(); ++j)
         {
-            diff[j] = (x[j] - y_[i][j])/(t-t_[i]);
+            diff[j] = (x[j] - y_[j*n + i])/(t-t_[i]);
         }
         for (decltype(diff.size()) j = 0; j < diff.size(); ++j)
         {
@@ -189,5 +210,130 @@ void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::eval_with_p
     return;
 }
 
+template<class TimeContainer, class SpaceContainer>
+void vector_barycentric_rational_imp<TimeContainer, SpaceContainer>::evaluate(const typename TimeContainer::value_type* t, size_t m,
+                                                                             typename SpaceContainer::value_type* x, typename SpaceContainer::value_type* dxdt) const
+{
+    using Point = typename SpaceContainer::value_type;
+    using Real = typename TimeContainer::value_type;
+    // Each pass over the nodes serves a block of parameters, whose sums are independent and so vectorize,
+    // instead of reading all the nodes again for every parameter:
+    constexpr size_t block = 16;
+    const size_t n = t_.size();
+    const size_t d = dimension_;
+    std::array<Real, block> tb;
+    std::array<Real, block> c;
+    std::array<Real, block> inv;
+    std::array<Real, block> denominator;
+    std::array<size_t, block> index;
+    std::vector<Real> numerator(d*block);
+    std::vector<Real> dnumerator(dxdt ? d*block : 0);
+    size_t q = 0;
+    while (q < m)
+    {
+        size_t b = 0;
+        for (; q < m && b < block; ++q)
+        {
+            // The formulas are singular at the nodes, where the pointwise routines take the limits:
+            if (std::binary_search(t_.begin(), t_.end(), t[q]))
+            {
+                Point p;
+                Point& xq = x ? x[q] : p;
+                if (dxdt)
+                {
+                    this->eval_with_prime(xq, dxdt[q], t[q]);
+                }
+                else
+                {
+                    this->operator()(xq, t[q]);
+                }
+                continue;
+            }
+            index[b] = q;
+            tb[b] = t[q];
+            ++b;
+        }
+        if (b == 0)
+        {
+            continue;
+        }
+        // Pad a short block with copies of its first parameter, so that the loops below have a fixed length:
+        for (size_t r = b; r < block; ++r)
+        {
+            tb[r] = tb[0];
+        }
+
+        std::fill(numerator.begin(), numerator.end(), Real(0));
+        denominator.fill(Real(0));
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t r = 0; r < block; ++r)
+            {
+                c[r] = w_[i]/(tb[r] - t_[i]);
+                denominator[r] += c[r];
+            }
+            for (size_t j = 0; j < d; ++j)
+            {
+                Real yij = y_[j*n + i];
+                Real* nj = numerator.data() + j*block;
+                for (size_t r = 0; r < block; ++r)
+                {
+                    nj[r] += c[r]*yij;
+                }
+            }
+        }
+        for (size_t j = 0; j < d; ++j)
+        {
+            for (size_t r = 0; r < block; ++r)
+            {
+                numerator[j*block + r] /= denominator[r];
+            }
+        }
+        if (x)
+        {
+            for (size_t r = 0; r < b; ++r)
+            {
+                for (size_t j = 0; j < d; ++j)
+                {
+                    x[index[r]][j] = numerator[j*block + r];
+                }
+            }
+        }
+        if (!dxdt)
+        {
+            continue;
+        }
+
+        // As in eval_with_prime, the derivative is the interpolant of the difference quotients (x - y_i)/(t - t_i),
+        // which has the same denominator:
+        std::fill(dnumerator.begin(), dnumerator.end(), Real(0));
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t r = 0; r < block; ++r)
+            {
+                inv[r] = 1/(tb[r] - t_[i]);
+                c[r] = w_[i]*inv[r]*inv[r];
+            }
+            for (size_t j = 0; j < d; ++j)
+            {
+                Real yij = y_[j*n + i];
+                const Real* xj = numerator.data() + j*block;
+                Real* dj = dnumerator.data() + j*block;
+                for (size_t r = 0; r < block; ++r)
+                {
+                    dj[r] += c[r]*(xj[r] - yij);
+                }
+            }
+        }
+        for (size_t r = 0; r < b; ++r)
+        {
+            for (size_t j = 0; j < d; ++j)
+            {
+                dxdt[index[r]][j] = dnumerator[j*block + r]/denominator[r];
+            }
+        }
+    }
+}
+
 }}}
 #endif
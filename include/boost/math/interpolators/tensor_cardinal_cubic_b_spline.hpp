@@ -0,0 +1,105 @@
+// Copyright agent, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The tensor product of the cardinal cubic B-spline interpolators of cardinal_cubic_b_spline.hpp,
+// which interpolates data sampled on a uniform grid in any number of dimensions:
+// s(x_0, ..., x_{D-1}) = sum alpha_{k_0...k_{D-1}} B3((x_0 - a_0)/h_0 + 1 - k_0)...B3((x_{D-1} - a_{D-1})/h_{D-1} + 1 - k_{D-1}).
+// Properties:
+// - s interpolates the samples
+// - Products of cubic polynomials in each variable are interpolated exactly
+// - The coefficients are found in O(N) operations for N samples, and an evaluation reads 4^D of them
+
+#ifndef BOOST_MATH_INTERPOLATORS_TENSOR_CARDINAL_CUBIC_B_SPLINE_HPP
+#define BOOST_MATH_INTERPOLATORS_TENSOR_CARDINAL_CUBIC_B_SPLINE_HPP
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <boost/math/interpolators/detail/tensor_cardinal_cubic_b_spline_detail.hpp>
+
+namespace boost{ namespace math{ namespace interpolators {
+
+template<class Real, std::size_t Dimension>
+class tensor_cardinal_cubic_b_spline
+{
+public:
+    // f[i_0*extents[1]*...*extents[D-1] + ... + i_{D-1}] = f(x0[0] + i_0*dx[0], ..., x0[D-1] + i_{D-1}*dx[D-1]),
+    // i.e., the samples are stored in row major order, with the last index varying fastest.
+    template<class RandomAccessIterator>
+    tensor_cardinal_cubic_b_spline(RandomAccessIterator f, std::array<std::size_t, Dimension> const & extents,
+                                   std::array<Real, Dimension> const & x0, std::array<Real, Dimension> const & dx)
+        : m_imp(std::make_shared<detail::tensor_cardinal_cubic_b_spline_imp<Real, Dimension>>(f, extents, x0, dx))
+    {
+    }
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    // As above, but the coefficients of large data are solved for in parallel unless exec is std::execution::seq.
+    template<class ExecutionPolicy, class RandomAccessIterator,
+             typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    tensor_cardinal_cubic_b_spline(ExecutionPolicy&& exec, RandomAccessIterator f, std::array<std::size_t, Dimension> const & extents,
+                                   std::array<Real, Dimension> const & x0, std::array<Real, Dimension> const & dx)
+        : m_imp(std::make_shared<detail::tensor_cardinal_cubic_b_spline_imp<Real, Dimension>>(f, extents, x0, dx,
+                                                                                             detail::cardinal_b_spline_max_threads(exec)))
+    {
+    }
+#endif
+
+    tensor_cardinal_cubic_b_spline() = default;
+
+    template<class... Args>
+    Real operator()(Args... x) const
+    {
+        static_assert(sizeof...(Args) == Dimension, "The number of arguments must equal the dimension.");
+        const Real p[] = {static_cast<Real>(x)...};
+        return m_imp->evaluate(p, nullptr);
+    }
+
+    template<class... Args>
+    std::array<Real, Dimension> gradient(Args... x) const
+    {
+        static_assert(sizeof...(Args) == Dimension, "The number of arguments must equal the dimension.");
+        const Real p[] = {static_cast<Real>(x)...};
+        std::array<Real, Dimension> g;
+        m_imp->evaluate(p, g.data());
+        return g;
+    }
+
+    // The value and the gradient from one pass over the coefficients.
+    std::pair<Real, std::array<Real, Dimension>> value_and_gradient(std::array<Real, Dimension> const & x) const
+    {
+        std::array<Real, Dimension> g;
+        Real y = m_imp->evaluate(x.data(), g.data());
+        return std::make_pair(y, g);
+    }
+
+    // y[i] = s(x[i*Dimension], ..., x[i*Dimension + Dimension - 1]) for 0 <= i < n,
+    // and unless grad is null, the gradient at the same point to grad[i*Dimension], ..., grad[i*Dimension + Dimension - 1].
+    void evaluate(const Real* x, std::size_t n, Real* y, Real* grad = nullptr) const
+    {
+        m_imp->evaluate(x, n, y, grad);
+    }
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    // As above, but large batches are split between threads unless exec is std::execution::seq.
+    template<class ExecutionPolicy, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    void evaluate(ExecutionPolicy&& exec, const Real* x, std::size_t n, Real* y, Real* grad = nullptr) const
+    {
+        m_imp->evaluate(x, n, y, grad, detail::cardinal_b_spline_max_threads(exec));
+    }
+#endif
+
+    std::pair<Real, Real> domain(std::size_t axis) const
+    {
+        return m_imp->domain(axis);
+    }
+
+private:
+    std::shared_ptr<detail::tensor_cardinal_cubic_b_spline_imp<Real, Dimension>> m_imp;
+};
+
+}}}
+#endif
@@ -0,0 +1,92 @@
+// Copyright agent, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_TENSOR_CARDINAL_CUBIC_HERMITE_HPP
+#define BOOST_MATH_INTERPOLATORS_TENSOR_CARDINAL_CUBIC_HERMITE_HPP
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <boost/math/interpolators/detail/tensor_cardinal_cubic_hermite_detail.hpp>
+
+namespace boost {
+namespace math {
+namespace interpolators {
+
+template<class RandomAccessContainer, std::size_t Dimension>
+class tensor_cardinal_cubic_hermite {
+public:
+    using Real = typename RandomAccessContainer::value_type;
+
+    // The 2^Dimension values at each node are contiguous, with the nodes in row major order (the last index varying fastest).
+    // Entry m of a node is the partial derivative with respect to the x_a for which bit a of m is set,
+    // so in two dimensions each node holds f, f_x, f_y and f_xy. The container must be contiguous.
+    tensor_cardinal_cubic_hermite(RandomAccessContainer && data, std::array<std::size_t, Dimension> const & extents,
+                                  std::array<Real, Dimension> const & x0, std::array<Real, Dimension> const & dx)
+    : impl_(std::make_shared<detail::tensor_cardinal_cubic_hermite_detail<RandomAccessContainer, Dimension>>(std::move(data), extents, x0, dx))
+    {}
+
+    template<class... Args>
+    inline Real operator()(Args... x) const
+    {
+        static_assert(sizeof...(Args) == Dimension, "The number of arguments must equal the dimension.");
+        const Real p[] = {static_cast<Real>(x)...};
+        return impl_->evaluate(p, nullptr);
+    }
+
+    template<class... Args>
+    inline std::array<Real, Dimension> gradient(Args... x) const
+    {
+        static_assert(sizeof...(Args) == Dimension, "The number of arguments must equal the dimension.");
+        const Real p[] = {static_cast<Real>(x)...};
+        std::array<Real, Dimension> g;
+        impl_->evaluate(p, g.data());
+        return g;
+    }
+
+    std::pair<Real, std::array<Real, Dimension>> value_and_gradient(std::array<Real, Dimension> const & x) const
+    {
+        std::array<Real, Dimension> g;
+        Real y = impl_->evaluate(x.data(), g.data());
+        return std::make_pair(y, g);
+    }
+
+    // y[i] = s(x[i*Dimension], ..., x[i*Dimension + Dimension - 1]) for 0 <= i < n,
+    // and unless grad is null, the gradient at the same point to grad[i*Dimension], ..., grad[i*Dimension + Dimension - 1].
+    void evaluate(const Real* x, std::size_t n, Real* y, Real* grad = nullptr) const
+    {
+        impl_->evaluate(x, n, y, grad);
+    }
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    // As above, but large batches are split between threads unless exec is std::execution::seq.
+    template<class ExecutionPolicy, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    void evaluate(ExecutionPolicy&& exec, const Real* x, std::size_t n, Real* y, Real* grad = nullptr) const
+    {
+        impl_->evaluate(x, n, y, grad, detail::cardinal_b_spline_max_threads(exec));
+    }
+#endif
+
+    std::pair<Real, Real> domain(std::size_t axis) const
+    {
+        return impl_->domain(axis);
+    }
+
+    int64_t bytes() const
+    {
+        return impl_->bytes() + sizeof(impl_);
+    }
+
+private:
+    std::shared_ptr<detail::tensor_cardinal_cubic_hermite_detail<RandomAccessContainer, Dimension>> impl_;
+};
+
+}
+}
+}
+#endif
@@ -59,6 +59,12 @@ public:
         return {x, dxdt};
     }
 
+    // x[i] is the interpolant at t[i] and dxdt[i] its derivative for 0 <= i < m, where either x or dxdt may be null.
+    // This sweeps the nodes once for each block of parameters rather than once for each parameter.
+    void evaluate(const Real* t, size_t m, Point* x, Point* dxdt = nullptr) const {
+        m_imp->evaluate(t, m, x, dxdt);
+    }
+
 private:
     std::shared_ptr<detail::vector_barycentric_rational_imp<TimeContainer, SpaceContainer>> m_imp;
 };
@@ -0,0 +1,299 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_OPTIMIZATION_CMA_ES_HPP
+#define BOOST_MATH_OPTIMIZATION_CMA_ES_HPP
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/optimization/detail/common.hpp>
+
+namespace boost::math::optimization {
+
+// The covariance matrix adaptation evolution strategy, in the (mu/mu_w, lambda) form described in
+// Hansen, N. (2016). The CMA evolution strategy: A tutorial. arXiv:1604.00772.
+template <typename ArgumentContainer> struct cma_es_parameters {
+    using Real = typename ArgumentContainer::value_type;
+    // Samples are clipped to this box, and the initial mean and step size are derived from it:
+    ArgumentContainer lower_bounds;
+    ArgumentContainer upper_bounds;
+    // Offspring per generation; zero means the default of 4 + floor(3 ln(n)):
+    size_t population_size = 0;
+    size_t max_generations = 1000;
+    // The initial step size, as a fraction of the average width of the box:
+    Real initial_step_fraction = Real(0.3);
+    // Stop when the step size along every principal axis falls below this, relative to the box width:
+    Real tolerance = 100 * std::numeric_limits<Real>::epsilon();
+    // The population is evaluated across this many threads:
+    size_t threads = std::thread::hardware_concurrency();
+    // If non-null, the search starts centred here rather than at the centre of the box:
+    ArgumentContainer const *initial_guess = nullptr;
+};
+
+template <typename ArgumentContainer>
+void validate_cma_es_parameters(cma_es_parameters<ArgumentContainer> const &params) {
+    using std::isfinite;
+    std::ostringstream oss;
+    detail::validate_bounds(params.lower_bounds, params.upper_bounds);
+    if (params.population_size == 1) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The population size must be at least 2.";
+        throw std::domain_error(oss.str());
+    }
+    if (!isfinite(params.initial_step_fraction) || params.initial_step_fraction <= 0) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The initial step fraction must be positive and finite, but got " << params.initial_step_fraction
+            << ".";
+        throw std::domain_error(oss.str());
+    }
+    if (params.initial_guess && params.initial_guess->size() != params.lower_bounds.size()) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The initial guess has dimension " << params.initial_guess->size()
+            << ", but the bounds have dimension " << params.lower_bounds.size() << ".";
+        throw std::domain_error(oss.str());
+    }
+}
+
+namespace detail {
+
+// Cyclic Jacobi eigenvalue algorithm for the symmetric n x n matrix A, stored row major.
+// On exit the columns of V hold the eigenvectors and d the eigenvalues. The dimensions we
+// meet here are small, so the O(n^3) per sweep cost is dwarfed by the cost function evaluations.
+template <typename Real> void symmetric_eigen(std::vector<Real> A, size_t n, std::vector<Real> &V, std::vector<Real> &d) {
+    using std::abs;
+    using std::sqrt;
+    V.assign(n * n, Real(0));
+    for (size_t i = 0; i < n; ++i) {
+        V[i * n + i] = 1;
+    }
+    for (size_t sweep = 0; sweep < 100; ++sweep) {
+        Real off = 0;
+        Real diag = 0;
+        for (size_t i = 0; i < n; ++i) {
+            diag += A[i * n + i] * A[i * n + i];
+            for (size_t j = i + 1; j < n; ++j) {
+                off += A[i * n + j] * A[i * n + j];
+            }
+        }
+        if (off <= std::numeric_limits<Real>::epsilon() * std::numeric_limits<Real>::epsilon() * diag) {
+            break;
+        }
+        for (size_t p = 0; p < n; ++p) {
+            for (size_t q = p + 1; q < n; ++q) {
+                Real apq = A[p * n + q];
+                if (apq == 0) {
+                    continue;
+                }
+                Real theta = (A[q * n + q] - A[p * n + p]) / (2 * apq);
+                Real t = (theta >= 0 ? 1 : -1) / (abs(theta) + sqrt(theta * theta + 1));
+                Real c = 1 / sqrt(t * t + 1);
+                Real s = t * c;
+                for (size_t k = 0; k < n; ++k) {
+                    Real akp = A[k * n + p];
+                    Real akq = A[k * n + q];
+                    A[k * n + p] = c * akp - s * akq;
+                    A[k * n + q] = s * akp + c * akq;
+                }
+                for (size_t k = 0; k < n; ++k) {
+                    Real apk = A[p * n + k];
+                    Real aqk = A[q * n + k];
+                    A[p * n + k] = c * apk - s * aqk;
+                    A[q * n + k] = s * apk + c * aqk;
+                }
+                for (size_t k = 0; k < n; ++k) {
+                    Real vkp = V[k * n + p];
+                    Real vkq = V[k * n + q];
+                    V[k * n + p] = c * vkp - s * vkq;
+                    V[k * n + q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+    d.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        d[i] = A[i * n + i];
+    }
+}
+
+} // namespace detail
+
+// Minimizes cost_function over the box given by the bounds.
+// Samples are drawn from gen on the calling thread, and each generation is then evaluated across params.threads
+// threads, so for a given seed the result is the same for any number of threads.
+// Optimization stops early once the cost falls to target_value, or when *cancellation becomes true.
+template <typename ArgumentContainer, class Func, class URBG>
+ArgumentContainer cma_es(const Func cost_function, cma_es_parameters<ArgumentContainer> const &params, URBG &gen,
+                         std::invoke_result_t<Func, ArgumentContainer> target_value =
+                             std::numeric_limits<std::invoke_result_t<Func, ArgumentContainer>>::quiet_NaN(),
+                         std::atomic<bool> *cancellation = nullptr) {
+    using Real = typename ArgumentContainer::value_type;
+    using ResultType = std::invoke_result_t<Func, ArgumentContainer>;
+    using std::exp;
+    using std::isnan;
+    using std::log;
+    using std::max;
+    using std::min;
+    using std::pow;
+    using std::sqrt;
+    validate_cma_es_parameters(params);
+    auto const &lower_bounds = params.lower_bounds;
+    auto const &upper_bounds = params.upper_bounds;
+    const size_t n = lower_bounds.size();
+    const Real dim = Real(n);
+
+    // Strategy parameters, all taken from Table 1 of Hansen's tutorial:
+    const size_t lambda =
+        params.population_size == 0 ? 4 + static_cast<size_t>(std::floor(3 * log(dim))) : params.population_size;
+    const size_t mu = lambda / 2;
+    std::vector<Real> weights(mu);
+    for (size_t i = 0; i < mu; ++i) {
+        weights[i] = log(Real(lambda + 1) / 2) - log(Real(i + 1));
+    }
+    Real weight_sum = std::accumulate(weights.begin(), weights.end(), Real(0));
+    for (auto &w : weights) {
+        w /= weight_sum;
+    }
+    Real mu_eff = 0;
+    for (auto w : weights) {
+        mu_eff += w * w;
+    }
+    mu_eff = 1 / mu_eff;
+    const Real c_sigma = (mu_eff + 2) / (dim + mu_eff + 5);
+    const Real d_sigma = 1 + 2 * (max)(Real(0), sqrt((mu_eff - 1) / (dim + 1)) - 1) + c_sigma;
+    const Real c_c = (4 + mu_eff / dim) / (dim + 4 + 2 * mu_eff / dim);
+    const Real c_1 = 2 / ((dim + Real(1.3)) * (dim + Real(1.3)) + mu_eff);
+    const Real c_mu = (min)(1 - c_1, 2 * (mu_eff - 2 + 1 / mu_eff) / ((dim + 2) * (dim + 2) + mu_eff));
+    const Real chi_n = sqrt(dim) * (1 - 1 / (4 * dim) + 1 / (21 * dim * dim));
+
+    ArgumentContainer mean = lower_bounds;
+    Real width = 0;
+    for (size_t i = 0; i < n; ++i) {
+        mean[i] = params.initial_guess ? (*params.initial_guess)[i] : (lower_bounds[i] + upper_bounds[i]) / 2;
+        width += (upper_bounds[i] - lower_bounds[i]) / dim;
+    }
+    detail::clip_to_bounds(mean, lower_bounds, upper_bounds);
+    Real sigma = params.initial_step_fraction * width;
+
+    std::vector<Real> C(n * n, Real(0)), B, D(n, Real(1)), eigenvalues;
+    for (size_t i = 0; i < n; ++i) {
+        C[i * n + i] = 1;
+    }
+    B = C;
+    std::vector<Real> p_sigma(n, Real(0)), p_c(n, Real(0));
+
+    std::vector<ArgumentContainer> population(lambda, mean);
+    std::vector<std::vector<Real>> steps(lambda, std::vector<Real>(n));
+    detail::cost_evaluator<Func, ArgumentContainer, ResultType> evaluate_costs(cost_function, params.threads, lambda);
+    std::vector<ResultType> cost;
+    std::vector<size_t> order(lambda);
+    ArgumentContainer best = mean;
+    ResultType best_cost = std::numeric_limits<ResultType>::infinity();
+    std::vector<Real> z(n), y_w(n), c_inv_sqrt_y(n), tmp(n);
+
+    for (size_t generation = 0; generation < params.max_generations; ++generation) {
+        if (cancellation && *cancellation) {
+            break;
+        }
+        // Sample x_k = m + sigma*B*D*z_k; clipping moves the point, so we use the step actually taken in the update:
+        for (size_t k = 0; k < lambda; ++k) {
+            for (size_t i = 0; i < n; ++i) {
+                z[i] = D[i] * detail::standard_normal<Real>(gen);
+            }
+            for (size_t i = 0; i < n; ++i) {
+                Real y = 0;
+                for (size_t j = 0; j < n; ++j) {
+                    y += B[i * n + j] * z[j];
+                }
+                population[k][i] = mean[i] + sigma * y;
+            }
+            detail::clip_to_bounds(population[k], lower_bounds, upper_bounds);
+            for (size_t i = 0; i < n; ++i) {
+                steps[k][i] = (population[k][i] - mean[i]) / sigma;
+            }
+        }
+        evaluate_costs(population, cost);
+        std::iota(order.begin(), order.end(), size_t(0));
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return cost[a] < cost[b]; });
+        if (cost[order[0]] < best_cost) {
+            best_cost = cost[order[0]];
+            best = population[order[0]];
+        }
+        if (!isnan(target_value) && best_cost <= target_value) {
+            break;
+        }
+
+        // Recombination:
+        for (size_t i = 0; i < n; ++i) {
+            y_w[i] = 0;
+            for (size_t k = 0; k < mu; ++k) {
+                y_w[i] += weights[k] * steps[order[k]][i];
+            }
+            mean[i] += sigma * y_w[i];
+        }
+
+        // Step size control, using C^{-1/2} = B D^{-1} B^T:
+        for (size_t j = 0; j < n; ++j) {
+            tmp[j] = 0;
+            for (size_t i = 0; i < n; ++i) {
+                tmp[j] += B[i * n + j] * y_w[i];
+            }
+            tmp[j] /= D[j];
+        }
+        Real p_sigma_norm = 0;
+        for (size_t i = 0; i < n; ++i) {
+            c_inv_sqrt_y[i] = 0;
+            for (size_t j = 0; j < n; ++j) {
+                c_inv_sqrt_y[i] += B[i * n + j] * tmp[j];
+            }
+            p_sigma[i] = (1 - c_sigma) * p_sigma[i] + sqrt(c_sigma * (2 - c_sigma) * mu_eff) * c_inv_sqrt_y[i];
+            p_sigma_norm += p_sigma[i] * p_sigma[i];
+        }
+        p_sigma_norm = sqrt(p_sigma_norm);
+        Real h_sigma_threshold = (Real(1.4) + 2 / (dim + 1)) * chi_n;
+        bool h_sigma = p_sigma_norm / sqrt(1 - pow(1 - c_sigma, Real(2 * (generation + 1)))) < h_sigma_threshold;
+
+        // Covariance matrix adaptation:
+        for (size_t i = 0; i < n; ++i) {
+            p_c[i] = (1 - c_c) * p_c[i] + (h_sigma ? sqrt(c_c * (2 - c_c) * mu_eff) * y_w[i] : Real(0));
+        }
+        Real delta_h = h_sigma ? Real(0) : c_c * (2 - c_c);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                Real rank_mu = 0;
+                for (size_t k = 0; k < mu; ++k) {
+                    rank_mu += weights[k] * steps[order[k]][i] * steps[order[k]][j];
+                }
+                Real c = (1 - c_1 - c_mu) * C[i * n + j] + c_1 * (p_c[i] * p_c[j] + delta_h * C[i * n + j]) +
+                         c_mu * rank_mu;
+                C[i * n + j] = c;
+                C[j * n + i] = c;
+            }
+        }
+        sigma *= exp((c_sigma / d_sigma) * (p_sigma_norm / chi_n - 1));
+
+        detail::symmetric_eigen(C, n, B, eigenvalues);
+        Real max_d = 0;
+        for (size_t i = 0; i < n; ++i) {
+            D[i] = sqrt((max)(eigenvalues[i], std::numeric_limits<Real>::min()));
+            max_d = (max)(max_d, D[i]);
+        }
+        if (sigma * max_d <= params.tolerance * width) {
+            break;
+        }
+    }
+    return best;
+}
+
+} // namespace boost::math::optimization
+#endif
@@ -0,0 +1,228 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_OPTIMIZATION_DETAIL_COMMON_HPP
+#define BOOST_MATH_OPTIMIZATION_DETAIL_COMMON_HPP
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+
+namespace boost::math::optimization::detail {
+
+// We draw from the generator ourselves rather than use the <random> distributions, whose output is
+// implementation defined; this keeps seeded runs reproducible across platforms.
+template <typename Real, class URBG> Real uniform01(URBG &gen) {
+    Real u;
+    do {
+        // Rounding can take the ratio to one when the generator has more bits than Real:
+        u = Real(gen() - (gen.min)()) / (Real((gen.max)() - (gen.min)()) + 1);
+    } while (u >= 1);
+    return u;
+}
+
+template <class URBG> size_t random_index(URBG &gen, size_t n) {
+    size_t i = static_cast<size_t>(uniform01<double>(gen) * n);
+    return i < n ? i : n - 1;
+}
+
+// Box-Muller transform:
+template <typename Real, class URBG> Real standard_normal(URBG &gen) {
+    using std::cos;
+    using std::log;
+    using std::sqrt;
+    Real u1 = uniform01<Real>(gen);
+    Real u2 = uniform01<Real>(gen);
+    return sqrt(-2 * log(1 - u1)) * cos(boost::math::constants::two_pi<Real>() * u2);
+}
+
+template <typename ArgumentContainer>
+void validate_bounds(ArgumentContainer const &lower_bounds, ArgumentContainer const &upper_bounds) {
+    using std::isfinite;
+    std::ostringstream oss;
+    if (lower_bounds.size() == 0) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The dimension of the problem cannot be zero.";
+        throw std::domain_error(oss.str());
+    }
+    if (upper_bounds.size() != lower_bounds.size()) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": There must be the same number of lower bounds as upper bounds, but given ";
+        oss << upper_bounds.size() << " upper bounds, and " << lower_bounds.size() << " lower bounds.";
+        throw std::domain_error(oss.str());
+    }
+    for (size_t i = 0; i < lower_bounds.size(); ++i) {
+        auto lb = lower_bounds[i];
+        auto ub = upper_bounds[i];
+        if (lb > ub) {
+            oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+            oss << ": The upper bound must be greater than or equal to the lower bound, but the upper bound is " << ub
+                << " and the lower is " << lb << ".";
+            throw std::domain_error(oss.str());
+        }
+        if (!isfinite(lb) || !isfinite(ub)) {
+            oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+            oss << ": The bounds must be finite, but got lower bound " << lb << " and upper bound " << ub << ".";
+            throw std::domain_error(oss.str());
+        }
+    }
+}
+
+template <typename ArgumentContainer, class URBG>
+ArgumentContainer random_point_in_box(ArgumentContainer const &lower_bounds, ArgumentContainer const &upper_bounds,
+                                      URBG &gen) {
+    using Real = typename ArgumentContainer::value_type;
+    ArgumentContainer x = lower_bounds;
+    for (size_t i = 0; i < x.size(); ++i) {
+        x[i] = lower_bounds[i] + uniform01<Real>(gen) * (upper_bounds[i] - lower_bounds[i]);
+    }
+    return x;
+}
+
+template <typename ArgumentContainer>
+void clip_to_bounds(ArgumentContainer &x, ArgumentContainer const &lower_bounds, ArgumentContainer const &upper_bounds) {
+    for (size_t i = 0; i < x.size(); ++i) {
+        x[i] = (std::clamp)(x[i], lower_bounds[i], upper_bounds[i]);
+    }
+}
+
+// NaN costs (e.g. from a likelihood evaluated outside its support) are treated as infinitely bad:
+template <typename Real> Real sanitize_cost(Real cost) {
+    using std::isnan;
+    return isnan(cost) ? std::numeric_limits<Real>::infinity() : cost;
+}
+
+// Evaluates costs[i] = cost_function(points[i]) for whole batches of points, sharing the work between the calling thread
+// and up to threads - 1 workers. The workers are started once and reused for every batch, so that the generations of
+// the evolutionary methods don't each pay for thread creation. Each cost lands in its own slot, so the results never
+// depend on the number of threads or on scheduling. If the cost function throws, the rest of the batch is abandoned
+// and the first exception is rethrown on the calling thread once every worker has let go of the batch.
+template <class Func, typename ArgumentContainer, typename Real> class cost_evaluator {
+  public:
+    cost_evaluator(Func const &cost_function, size_t threads, size_t batch_size) : cost_function_{cost_function} {
+        threads = (std::max)(size_t(1), (std::min)(threads, batch_size));
+        try {
+            for (size_t j = 0; j + 1 < threads; ++j) {
+                workers_.emplace_back([this]() { worker_loop(); });
+            }
+        } catch (...) {
+            stop_workers();
+            throw;
+        }
+    }
+
+    cost_evaluator(cost_evaluator const &) = delete;
+    cost_evaluator &operator=(cost_evaluator const &) = delete;
+
+    ~cost_evaluator() { stop_workers(); }
+
+    void operator()(std::vector<ArgumentContainer> const &points, std::vector<Real> &costs) {
+        costs.resize(points.size());
+        if (workers_.empty()) {
+            for (size_t i = 0; i < points.size(); ++i) {
+                costs[i] = sanitize_cost(cost_function_(points[i]));
+            }
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            points_ = &points;
+            costs_ = &costs;
+            next_ = 0;
+            error_ = nullptr;
+            busy_ = workers_.size();
+            ++batch_;
+        }
+        start_.notify_all();
+        evaluate_batch();
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            finished_.wait(lock, [this]() { return busy_ == 0; });
+            points_ = nullptr;
+            costs_ = nullptr;
+            error = error_;
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+  private:
+    void evaluate_batch() {
+        size_t n = points_->size();
+        try {
+            for (size_t i = next_++; i < n; i = next_++) {
+                (*costs_)[i] = sanitize_cost(cost_function_((*points_)[i]));
+            }
+        } catch (...) {
+            next_ = n;
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_) {
+                error_ = std::current_exception();
+            }
+        }
+    }
+
+    void worker_loop() {
+        size_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_.wait(lock, [&]() { return stop_ || batch_ != seen; });
+                if (stop_) {
+                    return;
+                }
+                seen = batch_;
+            }
+            evaluate_batch();
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busy_ == 0) {
+                finished_.notify_one();
+            }
+        }
+    }
+
+    void stop_workers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_.notify_all();
+        for (auto &t : workers_) {
+            t.join();
+        }
+        workers_.clear();
+    }
+
+    Func const &cost_function_;
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable finished_;
+    size_t batch_ = 0;
+    size_t busy_ = 0;
+    bool stop_ = false;
+    std::vector<ArgumentContainer> const *points_ = nullptr;
+    std::vector<Real> *costs_ = nullptr;
+    std::atomic<size_t> next_{0};
+    std::exception_ptr error_;
+};
+
+} // namespace boost::math::optimization::detail
+#endif
@@ -0,0 +1,152 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_OPTIMIZATION_DIFFERENTIAL_EVOLUTION_HPP
+#define BOOST_MATH_OPTIMIZATION_DIFFERENTIAL_EVOLUTION_HPP
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/optimization/detail/common.hpp>
+
+namespace boost::math::optimization {
+
+// Storn, R., & Price, K. (1997). Differential evolution-a simple and efficient heuristic for global optimization over
+// continuous spaces. Journal of global optimization, 11(4), 341-359.
+// See:
+// https://www.cp.eng.chula.ac.th/~prabhas//teaching/ec/ec2012/storn_price_de.pdf
+
+// We provide the parameters in a struct-there are too many of them and they are too unwieldy to pass individually:
+template <typename ArgumentContainer> struct differential_evolution_parameters {
+    using Real = typename ArgumentContainer::value_type;
+    ArgumentContainer lower_bounds;
+    ArgumentContainer upper_bounds;
+    // The mutation factor is also called the scale factor, or just F in the literature:
+    Real mutation_factor = Real(0.65);
+    Real crossover_probability = Real(0.5);
+    // Population in each generation; zero means 10 times the dimension of the problem:
+    size_t NP = 0;
+    size_t max_generations = 1000;
+    // The population is evaluated across this many threads:
+    size_t threads = std::thread::hardware_concurrency();
+    // If non-null, the initial guess is placed in the first generation:
+    ArgumentContainer const *initial_guess = nullptr;
+};
+
+template <typename ArgumentContainer>
+void validate_differential_evolution_parameters(differential_evolution_parameters<ArgumentContainer> const &de_params) {
+    using std::isfinite;
+    using std::isnan;
+    std::ostringstream oss;
+    detail::validate_bounds(de_params.lower_bounds, de_params.upper_bounds);
+    if (isnan(de_params.mutation_factor) || de_params.mutation_factor <= 0 || de_params.mutation_factor > 2) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The mutation factor must be in the interval (0, 2], but got " << de_params.mutation_factor << ".";
+        throw std::domain_error(oss.str());
+    }
+    if (isnan(de_params.crossover_probability) || de_params.crossover_probability < 0 ||
+        de_params.crossover_probability > 1) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The crossover probability must be in the interval [0, 1], but got "
+            << de_params.crossover_probability << ".";
+        throw std::domain_error(oss.str());
+    }
+    if (de_params.NP != 0 && de_params.NP < 4) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The population size must be at least 4 so that three distinct donors can be chosen, but got "
+            << de_params.NP << ".";
+        throw std::domain_error(oss.str());
+    }
+    if (de_params.initial_guess && de_params.initial_guess->size() != de_params.lower_bounds.size()) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The initial guess has dimension " << de_params.initial_guess->size()
+            << ", but the bounds have dimension " << de_params.lower_bounds.size() << ".";
+        throw std::domain_error(oss.str());
+    }
+}
+
+// Minimizes cost_function over the box given by the bounds using the DE/rand/1/bin strategy.
+// All random numbers are drawn from gen on the calling thread before the population is farmed out for evaluation,
+// so for a given seed the result is the same for any number of threads.
+// Optimization stops early once the cost falls to target_value, or when *cancellation becomes true.
+template <typename ArgumentContainer, class Func, class URBG>
+ArgumentContainer differential_evolution(
+    const Func cost_function, differential_evolution_parameters<ArgumentContainer> const &de_params, URBG &gen,
+    std::invoke_result_t<Func, ArgumentContainer> target_value =
+        std::numeric_limits<std::invoke_result_t<Func, ArgumentContainer>>::quiet_NaN(),
+    std::atomic<bool> *cancellation = nullptr) {
+    using Real = typename ArgumentContainer::value_type;
+    using ResultType = std::invoke_result_t<Func, ArgumentContainer>;
+    validate_differential_evolution_parameters(de_params);
+    const size_t dimension = de_params.lower_bounds.size();
+    const size_t NP = de_params.NP == 0 ? (std::max)(size_t(4), 10 * dimension) : de_params.NP;
+    auto const &lower_bounds = de_params.lower_bounds;
+    auto const &upper_bounds = de_params.upper_bounds;
+
+    std::vector<ArgumentContainer> population(NP);
+    for (size_t i = 0; i < NP; ++i) {
+        population[i] = detail::random_point_in_box(lower_bounds, upper_bounds, gen);
+    }
+    if (de_params.initial_guess) {
+        population[0] = *de_params.initial_guess;
+        detail::clip_to_bounds(population[0], lower_bounds, upper_bounds);
+    }
+    detail::cost_evaluator<Func, ArgumentContainer, ResultType> evaluate_costs(cost_function, de_params.threads, NP);
+    std::vector<ResultType> cost;
+    evaluate_costs(population, cost);
+
+    auto best_index = [&]() { return size_t(std::min_element(cost.begin(), cost.end()) - cost.begin()); };
+    auto done = [&]() {
+        using std::isnan;
+        if (cancellation && *cancellation) {
+            return true;
+        }
+        return !isnan(target_value) && cost[best_index()] <= target_value;
+    };
+
+    std::vector<ArgumentContainer> trial_vectors(NP);
+    std::vector<ResultType> trial_cost;
+    for (size_t generation = 0; generation < de_params.max_generations && !done(); ++generation) {
+        for (size_t i = 0; i < NP; ++i) {
+            size_t r1, r2, r3;
+            do {
+                r1 = detail::random_index(gen, NP);
+            } while (r1 == i);
+            do {
+                r2 = detail::random_index(gen, NP);
+            } while (r2 == i || r2 == r1);
+            do {
+                r3 = detail::random_index(gen, NP);
+            } while (r3 == i || r3 == r2 || r3 == r1);
+            // At least one coordinate must come from the mutant, else the trial vector is just a copy of its parent:
+            size_t guaranteed_changed_index = detail::random_index(gen, dimension);
+            trial_vectors[i] = population[i];
+            for (size_t j = 0; j < dimension; ++j) {
+                if (j == guaranteed_changed_index || detail::uniform01<Real>(gen) < de_params.crossover_probability) {
+                    trial_vectors[i][j] =
+                        population[r1][j] + de_params.mutation_factor * (population[r2][j] - population[r3][j]);
+                }
+            }
+            detail::clip_to_bounds(trial_vectors[i], lower_bounds, upper_bounds);
+        }
+        evaluate_costs(trial_vectors, trial_cost);
+        for (size_t i = 0; i < NP; ++i) {
+            if (trial_cost[i] <= cost[i]) {
+                cost[i] = trial_cost[i];
+                std::swap(population[i], trial_vectors[i]);
+            }
+        }
+    }
+    return population[best_index()];
+}
+
+} // namespace boost::math::optimization
+#endif
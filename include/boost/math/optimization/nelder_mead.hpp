@@ -0,0 +1,263 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_OPTIMIZATION_NELDER_MEAD_HPP
+#define BOOST_MATH_OPTIMIZATION_NELDER_MEAD_HPP
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/optimization/detail/common.hpp>
+
+namespace boost::math::optimization {
+
+// Nelder, J. A., & Mead, R. (1965). A simplex method for function minimization. The Computer Journal, 7(4), 308-313.
+// We use the dimension dependent coefficients of
+// Gao, F., & Han, L. (2012). Implementing the Nelder-Mead simplex algorithm with adaptive parameters.
+// Computational Optimization and Applications, 51(1), 259-277,
+// which behave much better than the classical ones in high dimensions.
+template <typename ArgumentContainer> struct nelder_mead_parameters {
+    using Real = typename ArgumentContainer::value_type;
+    ArgumentContainer initial_guess;
+    // The initial simplex steps initial_step*max(|x_i|, 1) along each coordinate axis:
+    Real initial_step = Real(0.05);
+    // Iterations per start:
+    size_t max_iterations = 5000;
+    // Stop when both the spread of costs over the simplex, and the size of the simplex, are this small in relative terms:
+    Real tolerance = 64 * std::numeric_limits<Real>::epsilon();
+    // The initial simplex, and each shrink step, evaluate all the vertices at once over this many threads;
+    // multistart_nelder_mead runs the starts in parallel instead:
+    size_t threads = std::thread::hardware_concurrency();
+};
+
+template <typename ArgumentContainer>
+void validate_nelder_mead_parameters(nelder_mead_parameters<ArgumentContainer> const &nm_params) {
+    using std::isfinite;
+    std::ostringstream oss;
+    if (nm_params.initial_guess.size() == 0) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The dimension of the problem cannot be zero.";
+        throw std::domain_error(oss.str());
+    }
+    for (size_t i = 0; i < nm_params.initial_guess.size(); ++i) {
+        if (!isfinite(nm_params.initial_guess[i])) {
+            oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+            oss << ": The initial guess must be finite, but coordinate " << i << " is " << nm_params.initial_guess[i]
+                << ".";
+            throw std::domain_error(oss.str());
+        }
+    }
+    if (!isfinite(nm_params.initial_step) || nm_params.initial_step <= 0) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The initial step must be positive and finite, but got " << nm_params.initial_step << ".";
+        throw std::domain_error(oss.str());
+    }
+    if (!(nm_params.tolerance >= 0)) {
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The tolerance must be non-negative, but got " << nm_params.tolerance << ".";
+        throw std::domain_error(oss.str());
+    }
+}
+
+namespace detail {
+
+template <typename ArgumentContainer, class Func>
+std::pair<ArgumentContainer, std::invoke_result_t<Func, ArgumentContainer>>
+nelder_mead_imp(Func const &cost_function, ArgumentContainer const &start,
+                nelder_mead_parameters<ArgumentContainer> const &nm_params, size_t threads,
+                std::atomic<bool> *cancellation) {
+    using Real = typename ArgumentContainer::value_type;
+    using ResultType = std::invoke_result_t<Func, ArgumentContainer>;
+    using std::abs;
+    using std::max;
+    const size_t n = start.size();
+    // The adaptive coefficients reduce to the classical ones in two dimensions, and are degenerate in one:
+    const Real alpha = 1;
+    const Real beta = n > 1 ? 1 + Real(2) / n : Real(2);
+    const Real gamma = n > 1 ? Real(0.75) - Real(1) / (2 * n) : Real(0.5);
+    const Real delta = n > 1 ? 1 - Real(1) / n : Real(0.5);
+
+    std::vector<ArgumentContainer> simplex(n + 1, start);
+    for (size_t i = 0; i < n; ++i) {
+        simplex[i + 1][i] += nm_params.initial_step * (max)(abs(start[i]), Real(1));
+    }
+    cost_evaluator<Func, ArgumentContainer, ResultType> evaluate_costs(cost_function, threads, n + 1);
+    std::vector<ResultType> cost;
+    evaluate_costs(simplex, cost);
+
+    std::vector<size_t> order(n + 1);
+    ArgumentContainer centroid = start;
+    ArgumentContainer reflected = start;
+    ArgumentContainer trial = start;
+    for (size_t iteration = 0; iteration < nm_params.max_iterations; ++iteration) {
+        if (cancellation && *cancellation) {
+            break;
+        }
+        std::iota(order.begin(), order.end(), size_t(0));
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return cost[a] < cost[b]; });
+        const size_t best = order[0];
+        const size_t worst = order[n];
+        const size_t second_worst = order[n - 1];
+
+        // Convergence: the vertices agree on the cost, and the simplex has collapsed.
+        Real size = 0;
+        Real scale = 0;
+        for (size_t i = 0; i <= n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                size = (max)(size, Real(abs(simplex[i][j] - simplex[best][j])));
+                scale = (max)(scale, Real(abs(simplex[best][j])));
+            }
+        }
+        if (cost[worst] - cost[best] <= nm_params.tolerance * (abs(cost[best]) + nm_params.tolerance) &&
+            size <= nm_params.tolerance * (scale + 1)) {
+            break;
+        }
+
+        for (size_t j = 0; j < n; ++j) {
+            centroid[j] = 0;
+            for (size_t i = 0; i <= n; ++i) {
+                if (i != worst) {
+                    centroid[j] += simplex[i][j];
+                }
+            }
+            centroid[j] /= n;
+        }
+        for (size_t j = 0; j < n; ++j) {
+            reflected[j] = centroid[j] + alpha * (centroid[j] - simplex[worst][j]);
+        }
+        ResultType reflected_cost = sanitize_cost(cost_function(reflected));
+        if (reflected_cost < cost[best]) {
+            for (size_t j = 0; j < n; ++j) {
+                trial[j] = centroid[j] + beta * (reflected[j] - centroid[j]);
+            }
+            ResultType expanded_cost = sanitize_cost(cost_function(trial));
+            if (expanded_cost < reflected_cost) {
+                simplex[worst] = trial;
+                cost[worst] = expanded_cost;
+            } else {
+                simplex[worst] = reflected;
+                cost[worst] = reflected_cost;
+            }
+            continue;
+        }
+        if (reflected_cost < cost[second_worst]) {
+            simplex[worst] = reflected;
+            cost[worst] = reflected_cost;
+            continue;
+        }
+        // Contract, outside if the reflected point beats the worst vertex, inside otherwise:
+        bool outside = reflected_cost < cost[worst];
+        for (size_t j = 0; j < n; ++j) {
+            trial[j] = outside ? centroid[j] + gamma * (reflected[j] - centroid[j])
+                               : centroid[j] - gamma * (centroid[j] - simplex[worst][j]);
+        }
+        ResultType contracted_cost = sanitize_cost(cost_function(trial));
+        if (contracted_cost < (outside ? reflected_cost : cost[worst])) {
+            simplex[worst] = trial;
+            cost[worst] = contracted_cost;
+            continue;
+        }
+        // Shrink towards the best vertex; the n new vertices are evaluated in parallel:
+        std::vector<ArgumentContainer> shrunk;
+        shrunk.reserve(n);
+        for (size_t i = 0; i <= n; ++i) {
+            if (i != best) {
+                for (size_t j = 0; j < n; ++j) {
+                    simplex[i][j] = simplex[best][j] + delta * (simplex[i][j] - simplex[best][j]);
+                }
+                shrunk.push_back(simplex[i]);
+            }
+        }
+        std::vector<ResultType> shrunk_cost;
+        evaluate_costs(shrunk, shrunk_cost);
+        for (size_t i = 0, k = 0; i <= n; ++i) {
+            if (i != best) {
+                cost[i] = shrunk_cost[k++];
+            }
+        }
+    }
+    size_t best = size_t(std::min_element(cost.begin(), cost.end()) - cost.begin());
+    return std::make_pair(simplex[best], cost[best]);
+}
+
+} // namespace detail
+
+// Minimizes cost_function starting from nm_params.initial_guess. Derivatives are not required.
+template <typename ArgumentContainer, class Func>
+ArgumentContainer nelder_mead(const Func cost_function, nelder_mead_parameters<ArgumentContainer> const &nm_params,
+                              std::atomic<bool> *cancellation = nullptr) {
+    validate_nelder_mead_parameters(nm_params);
+    return detail::nelder_mead_imp(cost_function, nm_params.initial_guess, nm_params, nm_params.threads, cancellation)
+        .first;
+}
+
+// Runs Nelder-Mead from nm_params.initial_guess, and from starts - 1 further points drawn uniformly from the box given
+// by the bounds, and returns the best minimum found. The starts run concurrently, but the starting points are drawn
+// from gen on the calling thread and the best result is chosen deterministically, so for a given seed the answer is
+// independent of the number of threads.
+template <typename ArgumentContainer, class Func, class URBG>
+ArgumentContainer multistart_nelder_mead(const Func cost_function,
+                                         nelder_mead_parameters<ArgumentContainer> const &nm_params,
+                                         ArgumentContainer const &lower_bounds,
+                                         ArgumentContainer const &upper_bounds, size_t starts, URBG &gen,
+                                         std::atomic<bool> *cancellation = nullptr) {
+    using ResultType = std::invoke_result_t<Func, ArgumentContainer>;
+    validate_nelder_mead_parameters(nm_params);
+    detail::validate_bounds(lower_bounds, upper_bounds);
+    if (lower_bounds.size() != nm_params.initial_guess.size()) {
+        std::ostringstream oss;
+        oss << __FILE__ << ":" << __LINE__ << ":" << __func__;
+        oss << ": The initial guess has dimension " << nm_params.initial_guess.size()
+            << ", but the bounds have dimension " << lower_bounds.size() << ".";
+        throw std::domain_error(oss.str());
+    }
+    starts = (std::max)(starts, size_t(1));
+    std::vector<ArgumentContainer> start_points(starts, nm_params.initial_guess);
+    for (size_t i = 1; i < starts; ++i) {
+        start_points[i] = detail::random_point_in_box(lower_bounds, upper_bounds, gen);
+    }
+    std::vector<std::pair<ArgumentContainer, ResultType>> results(starts);
+    size_t threads = (std::max)(size_t(1), (std::min)(nm_params.threads, starts));
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        try {
+            for (size_t i = next++; i < starts; i = next++) {
+                results[i] = detail::nelder_mead_imp(cost_function, start_points[i], nm_params, 1, cancellation);
+            }
+        } catch (...) {
+            // Abandon the remaining starts; the exception reaches the caller through the future or directly:
+            next = starts;
+            throw;
+        }
+    };
+    std::vector<std::future<void>> futures;
+    for (size_t j = 0; j + 1 < threads; ++j) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    // Should this throw, the destructors of the futures wait for the other workers to finish:
+    worker();
+    for (auto &f : futures) {
+        f.get();
+    }
+    size_t best = 0;
+    for (size_t i = 1; i < starts; ++i) {
+        if (results[i].second < results[best].second) {
+            best = i;
+        }
+    }
+    return results[best].first;
+}
+
+} // namespace boost::math::optimization
+#endif
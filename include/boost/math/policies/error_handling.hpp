@@ -803,9 +803,23 @@ inline R checked_narrowing_cast(T val, const char* function) noexcept(BOOST_MATH
    return static_cast<R>(val);
 }
 
+namespace detail{
+//
+// Hook for the record_iterations policy: the version that actually records
+// anything is defined in iteration_statistics.hpp, which must be included
+// by code that uses record_iterations<true>:
+//
+template <class Policy>
+void record_iteration_count(const char* function, std::uintmax_t iterations, bool root_finder, const Policy&, const std::true_type&) noexcept;
+template <class Policy>
+inline void record_iteration_count(const char*, std::uintmax_t, bool, const Policy&, const std::false_type&) noexcept {}
+
+} // namespace detail
+
 template <class T, class Policy>
 inline void check_series_iterations(const char* function, std::uintmax_t max_iter, const Policy& pol) noexcept(BOOST_MATH_IS_FLOAT(T) && is_noexcept_error_policy<Policy>::value)
 {
+   detail::record_iteration_count(function, max_iter, false, pol, typename Policy::record_iterations_type());
    if(max_iter >= policies::get_max_series_iterations<Policy>())
       raise_evaluation_error<T>(
          function,
@@ -815,6 +829,7 @@ inline void check_series_iterations(const char* function, std::uintmax_t max_ite
 template <class T, class Policy>
 inline void check_root_iterations(const char* function, std::uintmax_t max_iter, const Policy& pol) noexcept(BOOST_MATH_IS_FLOAT(T) && is_noexcept_error_policy<Policy>::value)
 {
+   detail::record_iteration_count(function, max_iter, true, pol, typename Policy::record_iterations_type());
    if(max_iter >= policies::get_max_root_iterations<Policy>())
       raise_evaluation_error<T>(
          function,
@@ -843,5 +858,12 @@ std::pair<T, T> pair_from_single(const T& val) BOOST_MATH_NOEXCEPT(T)
 
 }} // namespaces boost/math
 
+#if BOOST_MATH_RECORD_ITERATIONS_POLICY
+//
+// Recording is on by default, so everything needs the counters:
+//
+#include <boost/math/policies/iteration_statistics.hpp>
+#endif
+
 #endif // BOOST_MATH_POLICY_ERROR_HANDLING_HPP
 
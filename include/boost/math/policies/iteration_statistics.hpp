@@ -0,0 +1,292 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_POLICIES_ITERATION_STATISTICS_HPP
+#define BOOST_MATH_POLICIES_ITERATION_STATISTICS_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+//
+// Support for the record_iterations<true> policy: every series, continued fraction
+// and root finding loop that checks its iteration count against the policy limits
+// also records that count here, against the name of the function doing the checking.
+// Each thread accumulates into its own counters, so recording never takes a lock
+// once a thread has seen a given function; snapshots merge all the threads together.
+//
+
+#include <boost/math/policies/error_handling.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace boost{ namespace math{ namespace policies{
+
+enum iteration_kind
+{
+   series_iterations = 0,  // series and continued fractions, checked by check_series_iterations
+   root_iterations = 1,    // root finding, checked by check_root_iterations
+   timed_region = 2        // an iteration_timer scope
+};
+
+struct iteration_statistics
+{
+   static constexpr std::size_t histogram_size = 65;
+
+   std::string function;
+   iteration_kind kind;
+   std::uintmax_t evaluations;       // number of loops checked, or timer scopes entered
+   std::uintmax_t total_iterations;
+   std::uintmax_t max_iterations;
+   // histogram[0] counts loops that took no iterations, and histogram[i] those
+   // that took [2^(i-1), 2^i) iterations:
+   std::uintmax_t histogram[histogram_size];
+   double seconds;                   // time spent in iteration_timer scopes
+};
+
+namespace detail{
+
+struct iteration_site
+{
+   iteration_site(const char* f, iteration_kind k) : function(f), kind(k), evaluations(0), total_iterations(0), max_iterations(0), nanoseconds(0)
+   {
+      for(std::size_t i = 0; i < iteration_statistics::histogram_size; ++i)
+         histogram[i] = 0;
+   }
+   //
+   // Only the owning thread ever writes these, so plain loads and stores are
+   // enough: the atomics are only there so that snapshots can read them safely:
+   //
+   static void increment(std::atomic<std::uint64_t>& value, std::uint64_t n)
+   {
+      value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+   }
+   void record(std::uintmax_t iterations)
+   {
+      unsigned bucket = 0;
+      while((bucket < 64) && (iterations >> bucket))
+         ++bucket;
+      increment(evaluations, 1);
+      increment(total_iterations, iterations);
+      increment(histogram[bucket], 1);
+      if(iterations > max_iterations.load(std::memory_order_relaxed))
+         max_iterations.store(iterations, std::memory_order_relaxed);
+   }
+
+   const char* function;
+   iteration_kind kind;
+   std::atomic<std::uint64_t> evaluations;
+   std::atomic<std::uint64_t> total_iterations;
+   std::atomic<std::uint64_t> max_iterations;
+   std::atomic<std::uint64_t> nanoseconds;
+   std::atomic<std::uint64_t> histogram[iteration_statistics::histogram_size];
+};
+
+struct iteration_thread_data
+{
+   std::deque<iteration_site> sites;  // only ever appended to, with the registry locked
+};
+
+struct iteration_registry
+{
+   std::mutex mutex;
+   std::vector<std::shared_ptr<iteration_thread_data> > threads;
+
+   static iteration_registry& instance()
+   {
+      static iteration_registry registry;
+      return registry;
+   }
+};
+
+struct iteration_thread_handle
+{
+   iteration_thread_handle() : data(std::make_shared<iteration_thread_data>())
+   {
+      iteration_registry& registry = iteration_registry::instance();
+      std::lock_guard<std::mutex> l(registry.mutex);
+      registry.threads.push_back(data);
+   }
+   // The data outlives the thread, so that its counts still appear in later snapshots:
+   std::shared_ptr<iteration_thread_data> data;
+   std::unordered_map<const char*, iteration_site*> lookup[3];
+};
+
+inline iteration_site* find_iteration_site(const char* function, iteration_kind kind) noexcept
+{
+#ifndef BOOST_NO_EXCEPTIONS
+   try
+   {
+#endif
+      static thread_local iteration_thread_handle handle;
+      std::unordered_map<const char*, iteration_site*>& lookup = handle.lookup[kind];
+      std::unordered_map<const char*, iteration_site*>::iterator pos = lookup.find(function);
+      if(pos != lookup.end())
+         return pos->second;
+      iteration_registry& registry = iteration_registry::instance();
+      std::lock_guard<std::mutex> l(registry.mutex);
+      handle.data->sites.emplace_back(function, kind);
+      iteration_site* site = &handle.data->sites.back();
+      lookup[function] = site;
+      return site;
+#ifndef BOOST_NO_EXCEPTIONS
+   }
+   catch(...)
+   {
+      // Out of memory: the statistics are incomplete, but the calculation goes on.
+      return nullptr;
+   }
+#endif
+}
+
+template <class Policy>
+void record_iteration_count(const char* function, std::uintmax_t iterations, bool root_finder, const Policy&, const std::true_type&) noexcept
+{
+   if(iteration_site* site = find_iteration_site(function, root_finder ? root_iterations : series_iterations))
+      site->record(iterations);
+}
+
+} // namespace detail
+
+//
+// Attributes the wall clock time between construction and destruction to the
+// name given: use it around calls whose iteration counts are being recorded to
+// see how the time divides up.  The name must be a string literal, or otherwise
+// outlive the snapshots taken.
+//
+class iteration_timer
+{
+public:
+   explicit iteration_timer(const char* name) : m_site(detail::find_iteration_site(name, timed_region)), m_start(std::chrono::steady_clock::now()) {}
+   ~iteration_timer()
+   {
+      if(m_site)
+      {
+         std::chrono::steady_clock::duration d = std::chrono::steady_clock::now() - m_start;
+         detail::iteration_site::increment(m_site->evaluations, 1);
+         detail::iteration_site::increment(m_site->nanoseconds, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()));
+      }
+   }
+private:
+   iteration_timer(const iteration_timer&);
+   iteration_timer& operator=(const iteration_timer&);
+
+   detail::iteration_site* m_site;
+   std::chrono::steady_clock::time_point m_start;
+};
+
+//
+// Merges the counts from all threads, one entry per function name and kind,
+// sorted by name:
+//
+inline std::vector<iteration_statistics> iteration_statistics_snapshot()
+{
+   typedef std::map<std::pair<std::string, int>, iteration_statistics> map_type;
+   map_type merged;
+   detail::iteration_registry& registry = detail::iteration_registry::instance();
+   std::lock_guard<std::mutex> l(registry.mutex);
+   for(std::size_t t = 0; t < registry.threads.size(); ++t)
+   {
+      const std::deque<detail::iteration_site>& sites = registry.threads[t]->sites;
+      for(std::deque<detail::iteration_site>::const_iterator i = sites.begin(); i != sites.end(); ++i)
+      {
+         std::pair<std::string, int> key(i->function, i->kind);
+         map_type::iterator pos = merged.find(key);
+         if(pos == merged.end())
+         {
+            iteration_statistics s;
+            s.function = key.first;
+            s.kind = i->kind;
+            s.evaluations = s.total_iterations = s.max_iterations = 0;
+            std::fill(s.histogram, s.histogram + iteration_statistics::histogram_size, std::uintmax_t(0));
+            s.seconds = 0;
+            pos = merged.insert(std::make_pair(key, s)).first;
+         }
+         iteration_statistics& s = pos->second;
+         s.evaluations += i->evaluations.load(std::memory_order_relaxed);
+         s.total_iterations += i->total_iterations.load(std::memory_order_relaxed);
+         s.max_iterations = (std::max)(s.max_iterations, static_cast<std::uintmax_t>(i->max_iterations.load(std::memory_order_relaxed)));
+         for(std::size_t b = 0; b < iteration_statistics::histogram_size; ++b)
+            s.histogram[b] += i->histogram[b].load(std::memory_order_relaxed);
+         s.seconds += i->nanoseconds.load(std::memory_order_relaxed) / 1e9;
+      }
+   }
+   std::vector<iteration_statistics> result;
+   for(map_type::const_iterator i = merged.begin(); i != merged.end(); ++i)
+      result.push_back(i->second);
+   return result;
+}
+
+//
+// Zeros all the counts; counts recorded by other threads while this is running may be lost.
+//
+inline void reset_iteration_statistics()
+{
+   detail::iteration_registry& registry = detail::iteration_registry::instance();
+   std::lock_guard<std::mutex> l(registry.mutex);
+   for(std::size_t t = 0; t < registry.threads.size(); ++t)
+   {
+      std::deque<detail::iteration_site>& sites = registry.threads[t]->sites;
+      for(std::deque<detail::iteration_site>::iterator i = sites.begin(); i != sites.end(); ++i)
+      {
+         i->evaluations.store(0, std::memory_order_relaxed);
+         i->total_iterations.store(0, std::memory_order_relaxed);
+         i->max_iterations.store(0, std::memory_order_relaxed);
+         i->nanoseconds.store(0, std::memory_order_relaxed);
+         for(std::size_t b = 0; b < iteration_statistics::histogram_size; ++b)
+            i->histogram[b].store(0, std::memory_order_relaxed);
+      }
+   }
+}
+
+//
+// Writes a snapshot as JSON, the histograms are trimmed after their last non-zero bucket:
+//
+inline void write_iteration_statistics(std::ostream& os, const std::vector<iteration_statistics>& stats)
+{
+   static const char* kinds[] = { "series", "root", "timer" };
+   os << "[\n";
+   for(std::size_t i = 0; i < stats.size(); ++i)
+   {
+      const iteration_statistics& s = stats[i];
+      os << "  { \"function\": \"";
+      for(std::string::const_iterator c = s.function.begin(); c != s.function.end(); ++c)
+      {
+         if((*c == '"') || (*c == '\\'))
+            os << '\\';
+         os << *c;
+      }
+      os << "\", \"kind\": \"" << kinds[s.kind] << "\", \"evaluations\": " << s.evaluations
+         << ", \"total_iterations\": " << s.total_iterations << ", \"max_iterations\": " << s.max_iterations
+         << ", \"seconds\": " << s.seconds << ", \"histogram\": [";
+      std::size_t last = iteration_statistics::histogram_size;
+      while((last > 0) && (s.histogram[last - 1] == 0))
+         --last;
+      for(std::size_t b = 0; b < last; ++b)
+         os << (b ? ", " : "") << s.histogram[b];
+      os << "] }" << (i + 1 == stats.size() ? "\n" : ",\n");
+   }
+   os << "]\n";
+}
+
+inline void write_iteration_statistics(std::ostream& os)
+{
+   write_iteration_statistics(os, iteration_statistics_snapshot());
+}
+
+}}} // namespaces
+
+#endif // BOOST_MATH_POLICIES_ITERATION_STATISTICS_HPP
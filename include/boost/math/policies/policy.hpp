@@ -104,6 +104,9 @@ namespace policies{
 #ifndef BOOST_MATH_MAX_ROOT_ITERATION_POLICY
 #define BOOST_MATH_MAX_ROOT_ITERATION_POLICY 200
 #endif
+#ifndef BOOST_MATH_RECORD_ITERATIONS_POLICY
+#define BOOST_MATH_RECORD_ITERATIONS_POLICY false
+#endif
 
 #define BOOST_MATH_META_INT(Type, name, Default)                                                \
    template <Type N = Default>                                                                  \
@@ -214,6 +217,10 @@ BOOST_MATH_META_INT(int, digits2, 0)
 BOOST_MATH_META_INT(unsigned long, max_series_iterations, BOOST_MATH_MAX_SERIES_ITERATION_POLICY)
 BOOST_MATH_META_INT(unsigned long, max_root_iterations, BOOST_MATH_MAX_ROOT_ITERATION_POLICY)
 //
+// Recording of iteration counts, see iteration_statistics.hpp:
+//
+BOOST_MATH_META_BOOL(record_iterations, BOOST_MATH_RECORD_ITERATIONS_POLICY)
+//
 // Define the names for each possible policy:
 //
 #define BOOST_MATH_PARAMETER(name)\
@@ -434,6 +441,9 @@ public:
    // Max iterations:
    using max_series_iterations_type = typename arg_type<mp::mp_quote_trait<is_max_series_iterations>, max_series_iterations<>>::type;
    using max_root_iterations_type = typename arg_type<mp::mp_quote_trait<is_max_root_iterations>, max_root_iterations<>>::type;
+
+   // Iteration statistics:
+   using record_iterations_type = typename arg_type<mp::mp_quote_trait<is_record_iterations>, record_iterations<>>::type;
 };
 
 //
@@ -464,6 +474,7 @@ public:
    using assert_undefined_type = assert_undefined<>;
    using max_series_iterations_type = max_series_iterations<>;
    using max_root_iterations_type = max_root_iterations<>;
+   using record_iterations_type = record_iterations<>;
 };
 
 template <>
@@ -489,6 +500,7 @@ public:
    using assert_undefined_type = assert_undefined<>;
    using max_series_iterations_type = max_series_iterations<>;
    using max_root_iterations_type = max_root_iterations<>;
+   using record_iterations_type = record_iterations<>;
 };
 
 template <typename Policy, 
@@ -562,6 +574,9 @@ private:
    using max_series_iterations_type = typename arg_type<mp::mp_quote_trait<is_max_series_iterations>, typename Policy::max_series_iterations_type>::type;
    using max_root_iterations_type = typename arg_type<mp::mp_quote_trait<is_max_root_iterations>, typename Policy::max_root_iterations_type>::type;
 
+   // Iteration statistics:
+   using record_iterations_type = typename arg_type<mp::mp_quote_trait<is_record_iterations>, typename Policy::record_iterations_type>::type;
+
    // Define a typelist of the policies:
    using result_list = mp::mp_list<
       domain_error_type,
@@ -578,11 +593,15 @@ private:
       discrete_quantile_type,
       assert_undefined_type,
       max_series_iterations_type,
-      max_root_iterations_type>;
+      max_root_iterations_type,
+      record_iterations_type>;
 
    // Remove all the policies that are the same as the default:
    using fn = mp::mp_quote_trait<detail::is_default_policy>;
    using reduced_list = mp::mp_remove_if_q<result_list, fn>;
+
+   // policy<> has 13 slots, rather than one per kind of policy, so more settings than that can't be held:
+   static_assert(mp::mp_size<reduced_list>::value <= 13, "At most 13 policies may differ from their defaults.");
    
    // Pad out the list with defaults:
    using result_type = typename detail::append_N<reduced_list, default_policy, (14UL - mp::mp_size<reduced_list>::value)>::type;
@@ -978,6 +997,17 @@ struct is_noexcept_error_policy
       && (t8::value != throw_on_error) && (t8::value != user_error));
 };
 
+//
+// A policy for applications which need only about 7 significant digits
+// from float and double (graphics, machine learning features and the like).
+// Requesting 24 bits of precision selects the lower degree rational
+// approximations and truncates series and continued fractions early.
+// double is evaluated as double rather than long double, while float is
+// still evaluated as double: add promote_float<false> to evaluate float in
+// float, at the cost of a few more epsilon error in some functions:
+//
+typedef policy<digits2<24>, promote_double<false> > fast_policy;
+
 }}} // namespaces
 
 #endif // BOOST_MATH_POLICY_HPP
@@ -6,8 +6,13 @@
  */
 #ifndef BOOST_MATH_QUADRATURE_WAVELET_TRANSFORMS_HPP
 #define BOOST_MATH_QUADRATURE_WAVELET_TRANSFORMS_HPP
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
 #include <boost/math/special_functions/daubechies_wavelet.hpp>
 #include <boost/math/quadrature/trapezoidal.hpp>
+#include <boost/math/tools/detail/fft_correlate.hpp>
 
 namespace boost::math::quadrature {
 
@@ -35,6 +40,102 @@ public:
         return sqrt(abs(s))*trapezoidal(g, a, b, tol_, max_refinements_);
     }
 
+    // The transform at every scale in scales and every translation t0 + k*h, 0 <= k < n,
+    // returned as a row-major scales.size() x n array.
+    // Rather than a quadrature per point, f is sampled once on the grid t0 + j*h, and each row is the
+    // trapezoidal sum |s|^{-1/2} h sum_m f(t + m*h) psi(m*h/s), evaluated for all t at once
+    // by direct summation for short kernels and FFT correlation for long ones.
+    // The step in the wavelet's variable is h/|s|, so h should be small compared to the smallest scale.
+    template<class RandomAccessContainer>
+    std::vector<Real> scalogram(RandomAccessContainer const & scales, Real t0, Real h, std::size_t n)
+    {
+        using std::sqrt;
+        using std::abs;
+        using std::ceil;
+        using std::floor;
+        if (!(h > 0))
+        {
+            throw std::domain_error("The sampling interval h must be positive.");
+        }
+        auto [a, b] = psi_.support();
+        // Range of m for which psi(m*h/s) is nonzero:
+        auto taps = [&](Real s) {
+            long long lo = static_cast<long long>(ceil((std::min)(a*s, b*s)/h));
+            long long hi = static_cast<long long>(floor((std::max)(a*s, b*s)/h));
+            return std::pair<long long, long long>(lo, hi);
+        };
+        long long j_min = 0;
+        long long j_max = 0;
+        for (auto s : scales)
+        {
+            auto [lo, hi] = taps(Real(s));
+            j_min = (std::min)(j_min, lo);
+            j_max = (std::max)(j_max, hi);
+        }
+        std::vector<Real> samples(n + static_cast<std::size_t>(j_max - j_min));
+        for (std::size_t j = 0; j < samples.size(); ++j)
+        {
+            samples[j] = f_(t0 + (static_cast<long long>(j) + j_min)*h);
+        }
+
+        std::vector<Real> W(scales.size()*n, Real(0));
+        std::vector<Real> kernel;
+        std::vector<Real> re;
+        std::vector<Real> im;
+        for (std::size_t i = 0; i < scales.size(); ++i)
+        {
+            Real s = scales[i];
+            if (s == 0 || n == 0)
+            {
+                continue;
+            }
+            auto [lo, hi] = taps(s);
+            if (hi < lo)
+            {
+                // The grid is too coarse to resolve this scale:
+                continue;
+            }
+            std::size_t K = static_cast<std::size_t>(hi - lo + 1);
+            kernel.resize(K);
+            for (std::size_t m = 0; m < K; ++m)
+            {
+                kernel[m] = psi_((static_cast<long long>(m) + lo)*h/s);
+            }
+            const Real* x = samples.data() + (lo - j_min);
+            Real* row = W.data() + i*n;
+            // Direct summation costs n*K, the FFT roughly 10 N log2(N) with N = n + K - 1 rounded up to a power of 2:
+            std::size_t N = 1;
+            std::size_t log2N = 0;
+            while (N < n + K - 1)
+            {
+                N <<= 1;
+                ++log2N;
+            }
+            if (K <= 10*N*(log2N + 1)/n)
+            {
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    Real w = 0;
+                    for (std::size_t m = 0; m < K; ++m)
+                    {
+                        w += x[k + m]*kernel[m];
+                    }
+                    row[k] = w;
+                }
+            }
+            else
+            {
+                boost::math::tools::detail::fft_correlate(x, kernel.data(), K, n, row, re, im);
+            }
+            Real scale = h/sqrt(abs(s));
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                row[k] *= scale;
+            }
+        }
+        return W;
+    }
+
 private:
     F f_;
     boost::math::daubechies_wavelet<Real, p> psi_;
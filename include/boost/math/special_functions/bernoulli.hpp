@@ -14,6 +14,8 @@
 #include <boost/math/special_functions/math_fwd.hpp>
 #include <boost/math/special_functions/detail/unchecked_bernoulli.hpp>
 #include <boost/math/special_functions/detail/bernoulli_details.hpp>
+#include <vector>
+#include <iterator>
 
 namespace boost { namespace math { 
    
@@ -104,7 +106,7 @@ inline T tangent_t2n(const int i, const Policy &pol)
    if(i < 0)
       return policies::raise_domain_error<T>("boost::math::tangent_t2n<%1%>", "Index should be >= 0 but got %1%", T(i), pol);
 
-   T result;
+   T result = static_cast<T>(0); // The = 0 is just to silence compiler warnings :-(
    boost::math::detail::get_bernoulli_numbers_cache<T, Policy>().copy_tangent_numbers(&result, i, 1, pol);
    return result;
 }
@@ -138,6 +140,72 @@ inline OutputIterator tangent_t2n(const int start_index,
    return boost::math::tangent_t2n<T, OutputIterator>(start_index, number_of_tangent_t2n, out_it, policies::policy<>());
 }
 
+//
+// Cache management: values of B2n beyond max_bernoulli_b2n<T>::value (and all the tangent numbers)
+// are computed on demand and cached, growing the cache may be expensive for multiprecision types
+// so these let the cache be filled ahead of time, and its behaviour monitored.
+//
+struct bernoulli_cache_statistics
+{
+   std::size_t size;          // Number of B2n and T2n currently cached.
+   std::size_t capacity;      // Maximum number of values the cache can ever hold.
+   std::size_t growth_count;  // Number of times the cache has been extended.
+   std::size_t reset_count;   // Number of times the cache has been discarded due to a change in precision.
+};
+
+template <class T, class Policy>
+inline std::size_t reserve_bernoulli_b2n(const std::size_t n, const Policy&)
+{
+   detail::bernoulli_numbers_cache<T>& cache = detail::get_bernoulli_numbers_cache<T, Policy>();
+   return cache.reserve((std::min)(n, cache.capacity()));
+}
+
+template <class T>
+inline std::size_t reserve_bernoulli_b2n(const std::size_t n)
+{
+   return boost::math::reserve_bernoulli_b2n<T>(n, policies::policy<>());
+}
+
+template <class T>
+inline bernoulli_cache_statistics bernoulli_b2n_cache_statistics()
+{
+   const detail::bernoulli_numbers_cache<T>& cache = detail::get_bernoulli_numbers_cache<T, policies::policy<> >();
+   bernoulli_cache_statistics result = { cache.size(), cache.capacity(), cache.growth_count(), cache.reset_count() };
+   return result;
+}
+//
+// An immutable copy of the first few B2n and T2n: once constructed, access involves no
+// synchronisation whatever, so a thread may keep its own copy for the hot path.
+//
+template <class T, class Policy = policies::policy<> >
+class bernoulli_b2n_snapshot
+{
+public:
+   explicit bernoulli_b2n_snapshot(const std::size_t n, const Policy& pol = Policy())
+   {
+      m_b2n.reserve(n);
+      m_t2n.reserve(n);
+      if(n)
+      {
+         boost::math::bernoulli_b2n<T>(0, static_cast<unsigned>(n), std::back_inserter(m_b2n), pol);
+         boost::math::tangent_t2n<T>(0, static_cast<unsigned>(n), std::back_inserter(m_t2n), pol);
+      }
+   }
+   std::size_t size()const { return m_b2n.size(); }
+   const T& bernoulli_b2n(const std::size_t i)const
+   {
+      BOOST_MATH_ASSERT(i < m_b2n.size());
+      return m_b2n[i];
+   }
+   const T& tangent_t2n(const std::size_t i)const
+   {
+      BOOST_MATH_ASSERT(i < m_t2n.size());
+      return m_t2n[i];
+   }
+private:
+   std::vector<T> m_b2n, m_t2n;
+};
+
 } } // namespace boost::math
 
 #endif // _BOOST_BERNOULLI_B2N_2013_05_30_HPP_
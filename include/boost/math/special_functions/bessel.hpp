@@ -207,11 +207,11 @@ T cyl_bessel_i_imp(T v, T x, const Policy& pol)
    {
       if(v == 0)
       {
-         return bessel_i0(x);
+         return bessel_i0(x, pol);
       }
       if(v == 1)
       {
-         return bessel_i1(x);
+         return bessel_i1(x, pol);
       }
    }
    if((v > 0) && (x / v < 0.25))
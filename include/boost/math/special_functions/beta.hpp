@@ -61,28 +61,28 @@ T beta_imp(T a, T b, const Lanczos&, const Policy& pol)
       return result;
    }
 
-   /*
    //
-   // This code appears to be no longer necessary: it was
-   // used to offset errors introduced from the Lanczos
-   // approximation, but the current Lanczos approximations
-   // are sufficiently accurate for all z that we can ditch
-   // this.  It remains in the file for future reference...
+   // This shift was once used to offset errors introduced from the Lanczos
+   // approximation for small arguments: the current Lanczos approximations
+   // are sufficiently accurate for all z except the float precision one,
+   // which loses accuracy below 1, so we still need it there.
    //
    // If a or b are less than 1, shift to greater than 1:
-   if(a < 1)
+   if(Lanczos::value <= 24)
    {
-      prefix *= c / a;
-      c += 1;
-      a += 1;
-   }
-   if(b < 1)
-   {
-      prefix *= c / b;
-      c += 1;
-      b += 1;
+      if(a < 1)
+      {
+         prefix *= c / a;
+         c += 1;
+         a += 1;
+      }
+      if(b < 1)
+      {
+         prefix *= c / b;
+         c += 1;
+         b += 1;
+      }
    }
-   */
 
    if(a < b)
       std::swap(a, b);
@@ -0,0 +1,550 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_CONSTEXPR_KERNELS_HPP
+#define BOOST_MATH_SF_CONSTEXPR_KERNELS_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+//
+// Versions of erf, erfc, tgamma, lgamma and the Bessel functions J0, J1, Y0 and Y1
+// for float and double which can be evaluated at compile time, for example to build
+// lookup tables.  They use the same approximations as the regular functions - held
+// in constexpr std::array's selected on the precision of the type - but have no
+// policy support: like the C library functions they return NaN for domain errors
+// and infinity for poles and overflow.
+//
+
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/promotion.hpp>
+#include <boost/math/tools/rational.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/detail/constexpr_elementary.hpp>
+#include <boost/math/special_functions/detail/constexpr_kernel_coefficients.hpp>
+#include <boost/math/special_functions/detail/unchecked_factorial.hpp>
+#include <limits>
+#include <type_traits>
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR) || !defined(BOOST_MATH_HAVE_CONSTEXPR_TABLES)
+#  error "The constexpr special function kernels require C++14 constexpr support."
+#endif
+
+namespace boost{ namespace math{
+
+namespace detail{
+
+template <class T>
+struct constexpr_kernel_traits
+{
+   static_assert(std::numeric_limits<T>::is_specialized && (std::numeric_limits<T>::radix == 2)
+      && (std::numeric_limits<T>::digits <= std::numeric_limits<double>::digits),
+      "The constexpr kernels are only available for float and double.");
+   // float is evaluated in double precision, just as the default policy promotes it:
+   typedef double evaluation_type;
+};
+
+template <class T>
+BOOST_CXX14_CONSTEXPR T constexpr_erf_imp(T z, bool invert)
+{
+   using namespace constexpr_math;
+   typedef erf_kernel_coefficients<T, std::numeric_limits<T>::digits> c;
+
+   if(is_nan(z))
+      return z;
+   if(z < 0)
+   {
+      if(!invert)
+         return -constexpr_erf_imp(T(-z), invert);
+      else if(z < -0.5)
+         return 2 - constexpr_erf_imp(T(-z), invert);
+      else
+         return 1 + constexpr_erf_imp(T(-z), false);
+   }
+
+   T result = 0;
+   if(z < 0.5)
+   {
+      //
+      // We're going to calculate erf:
+      //
+      if(z < 1e-10)
+         result = z * 1.125f + z * static_cast<T>(0.003379167095512573896158903121545171688);
+      else
+      {
+         T zz = z * z;
+         result = z * (c::erf_Y + tools::constexpr_evaluate_polynomial(c::erf_P, zz) / tools::constexpr_evaluate_polynomial(c::erf_Q, zz));
+      }
+   }
+   else if(invert ? (z < 28) : (z < 5.8f))
+   {
+      //
+      // We'll be calculating erfc:
+      //
+      invert = !invert;
+      if(z < 1.5f)
+         result = c::erfc_Y1 + tools::constexpr_evaluate_polynomial(c::erfc_P1, T(z - 0.5)) / tools::constexpr_evaluate_polynomial(c::erfc_Q1, T(z - 0.5));
+      else if(z < 2.5f)
+         result = c::erfc_Y2 + tools::constexpr_evaluate_polynomial(c::erfc_P2, T(z - 1.5)) / tools::constexpr_evaluate_polynomial(c::erfc_Q2, T(z - 1.5));
+      else if(z < 4.5f)
+         result = c::erfc_Y3 + tools::constexpr_evaluate_polynomial(c::erfc_P3, T(z - 3.5)) / tools::constexpr_evaluate_polynomial(c::erfc_Q3, T(z - 3.5));
+      else
+         result = c::erfc_Y4 + tools::constexpr_evaluate_polynomial(c::erfc_P4, T(1 / z)) / tools::constexpr_evaluate_polynomial(c::erfc_Q4, T(1 / z));
+      // exp(-z*z) with z*z held exactly:
+      double_double sq = two_prod(z, z);
+      result *= constexpr_math::exp(double_double{ -sq.hi, -sq.lo }) / z;
+   }
+   else
+   {
+      //
+      // Any value of z larger than 28 will underflow to zero:
+      //
+      result = 0;
+      invert = !invert;
+   }
+
+   if(invert)
+      result = 1 - result;
+   return result;
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR T constexpr_lanczos_sum(T z)
+{
+   typedef lanczos_kernel_coefficients<T, std::numeric_limits<T>::digits> c;
+   return tools::constexpr_evaluate_rational(c::sum_num, c::sum_denom, z);
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR T constexpr_lanczos_sum_expG_scaled(T z)
+{
+   typedef lanczos_kernel_coefficients<T, std::numeric_limits<T>::digits> c;
+   return tools::constexpr_evaluate_rational(c::sum_expG_scaled_num, c::sum_expG_scaled_denom, z);
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR T constexpr_tgamma_imp(T z)
+{
+   using namespace constexpr_math;
+   typedef lanczos_kernel_coefficients<T, std::numeric_limits<T>::digits> c;
+
+   if(is_nan(z))
+      return z;
+   if(is_inf(z))
+      return z > 0 ? z : std::numeric_limits<T>::quiet_NaN();
+
+   T result = 1;
+   if(z <= 0)
+   {
+      if(floor(z) == z)
+         return z == 0 ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::quiet_NaN();
+      if(z <= -20)
+      {
+         // Reflection, sin_pi(z) * z is sinpx(z):
+         result = constexpr_tgamma_imp(T(-z)) * (sin_pi(z) * z);
+         if((fabs(result) < 1) && ((std::numeric_limits<T>::max)() * fabs(result) < constants::pi<T>()))
+            return result < 0 ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity();
+         return -constants::pi<T>() / result;
+      }
+      // shift z to > 0:
+      while(z < 0)
+      {
+         result /= z;
+         z += 1;
+      }
+   }
+   if((floor(z) == z) && (z < max_factorial<T>::value))
+   {
+      result *= unchecked_factorial<T>(static_cast<unsigned>(z) - 1);
+   }
+   else if(z < 1.4901161193847656e-08)
+   {
+      result *= 1 / z - constants::euler<T>();
+   }
+   else
+   {
+      result *= constexpr_lanczos_sum(z);
+      //
+      // pow(zgh, z - 0.5) / exp(zgh) as a single exp, with the exponent held to
+      // double-double precision, so that this is accurate (and doesn't overflow
+      // prematurely) even for large z:
+      //
+      T zgh = z + c::g - 0.5f;
+      T e = constexpr_math::exp(add(mul(log_dd(zgh), two_sum(z, -0.5)), -zgh));
+      if(e > (std::numeric_limits<T>::max)() / fabs(result))
+         return std::numeric_limits<T>::infinity();
+      result *= e;
+   }
+   return result;
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR T constexpr_lgamma_small_imp(T z, T zm1, T zm2)
+{
+   using namespace constexpr_math;
+   typedef lgamma_small_kernel_coefficients<T, (std::numeric_limits<T>::digits <= 64 ? 64 : 113)> c;
+
+   T result = 0;
+   if(z < std::numeric_limits<T>::epsilon())
+   {
+      result = -constexpr_math::log(z);
+   }
+   else if((zm1 == 0) || (zm2 == 0))
+   {
+      // nothing to do, result is zero....
+   }
+   else if(z > 2)
+   {
+      //
+      // Reduce to [2,3) then use lgamma(z) = (z-2)(z+1)(Y + R(z-2)):
+      //
+      if(z >= 3)
+      {
+         do
+         {
+            z -= 1;
+            result += constexpr_math::log(z);
+         } while(z >= 3);
+         zm2 = z - 2;
+      }
+      T r = zm2 * (z + 1);
+      T R = tools::constexpr_evaluate_polynomial(c::P1, zm2) / tools::constexpr_evaluate_polynomial(c::Q1, zm2);
+      result += r * c::Y1 + r * R;
+   }
+   else
+   {
+      //
+      // Shift z < 1 up to [1,2]:
+      //
+      if(z < 1)
+      {
+         result += -constexpr_math::log(z);
+         zm2 = zm1;
+         zm1 = z;
+         z += 1;
+      }
+      if(z <= 1.5)
+      {
+         T r = tools::constexpr_evaluate_polynomial(c::P2, zm1) / tools::constexpr_evaluate_polynomial(c::Q2, zm1);
+         T prefix = zm1 * zm2;
+         result += prefix * c::Y2 + prefix * r;
+      }
+      else
+      {
+         T r = zm2 * zm1;
+         T R = tools::constexpr_evaluate_polynomial(c::P3, T(-zm2)) / tools::constexpr_evaluate_polynomial(c::Q3, T(-zm2));
+         result += r * c::Y3 + r * R;
+      }
+   }
+   return result;
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR T constexpr_lgamma_imp(T z, int* sign)
+{
+   using namespace constexpr_math;
+   typedef lanczos_kernel_coefficients<T, std::numeric_limits<T>::digits> c;
+
+   if(is_nan(z))
+      return z;
+   if(is_inf(z))
+      return std::numeric_limits<T>::infinity();
+
+   T result = 0;
+   int sresult = 1;
+   if(z <= -1.4901161193847656e-08)
+   {
+      // reflection formula:
+      if(floor(z) == z)
+         return std::numeric_limits<T>::infinity();
+      T t = sin_pi(z) * z;
+      z = -z;
+      if(t < 0)
+         t = -t;
+      else
+         sresult = -sresult;
+      // log(pi) - lgamma(-z) - log(t):
+      result = 1.1447298858494001741434273513530587116 - constexpr_lgamma_imp(z, static_cast<int*>(nullptr)) - constexpr_math::log(t);
+   }
+   else if(z < 1.4901161193847656e-08)
+   {
+      if(0 == z)
+         return std::numeric_limits<T>::infinity();
+      if(4 * fabs(z) < std::numeric_limits<T>::epsilon())
+         result = -constexpr_math::log(fabs(z));
+      else
+         result = constexpr_math::log(fabs(1 / z - constants::euler<T>()));
+      if(z < 0)
+         sresult = -1;
+   }
+   else if(z < 15)
+   {
+      result = constexpr_lgamma_small_imp(z, T(z - 1), T(z - 2));
+   }
+   else if(z < 100)
+   {
+      // taking the log of tgamma reduces the error, no danger of overflow here:
+      result = constexpr_math::log(constexpr_tgamma_imp(z));
+   }
+   else
+   {
+      T zgh = z + c::g - 0.5f;
+      result = constexpr_math::log(zgh) - 1;
+      result *= z - 0.5f;
+      //
+      // Only add on the lanczos sum part if we're going to need it:
+      //
+      if(result * std::numeric_limits<T>::epsilon() < 20)
+         result += constexpr_math::log(constexpr_lanczos_sum_expG_scaled(z));
+   }
+
+   if(sign)
+      *sign = sresult;
+   return result;
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR T constexpr_bessel_j0_imp(T x)
+{
+   using namespace constexpr_math;
+   typedef bessel_j0_kernel_coefficients<T, (std::numeric_limits<T>::digits <= 64 ? 64 : 0)> c;
+
+   if(is_nan(x))
+      return x;
+   if(x < 0)
+      x = -x;                         // even function
+   if(x == 0)
+      return 1;
+   if(is_inf(x))
+      return 0;
+   if(x <= 4)                         // x in (0, 4]
+   {
+      T y = x * x;
+      T r = tools::constexpr_evaluate_rational(c::P1, c::Q1, y);
+      T factor = (x + c::x1) * ((x - c::x11 / 256) - c::x12);
+      return factor * r;
+   }
+   else if(x <= 8)                    // x in (4, 8]
+   {
+      T y = 1 - (x * x) / 64;
+      T r = tools::constexpr_evaluate_rational(c::P2, c::Q2, y);
+      T factor = (x + c::x2) * ((x - c::x21 / 256) - c::x22);
+      return factor * r;
+   }
+   // x in (8, \infty), see bessel_j0.hpp for the use of sin(x) and cos(x) here:
+   T y = 8 / x;
+   T y2 = y * y;
+   T rc = tools::constexpr_evaluate_rational(c::PC, c::QC, y2);
+   T rs = tools::constexpr_evaluate_rational(c::PS, c::QS, y2);
+   T factor = constants::one_div_root_pi<T>() / constexpr_math::sqrt(x);
+   T sx = constexpr_math::sin(x);
+   T cx = constexpr_math::cos(x);
+   return factor * (rc * (cx + sx) - y * rs * (sx - cx));
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR T constexpr_bessel_j1_imp(T x)
+{
+   using namespace constexpr_math;
+   typedef bessel_j1_kernel_coefficients<T, (std::numeric_limits<T>::digits <= 64 ? 64 : 0)> c;
+
+   if(is_nan(x))
+      return x;
+   T w = fabs(x);
+   if(x == 0)
+      return 0;
+   if(is_inf(x))
+      return 0;
+   T value = 0;
+   if(w <= 4)                         // w in (0, 4]
+   {
+      T y = x * x;
+      T r = tools::constexpr_evaluate_rational(c::P1, c::Q1, y);
+      T factor = w * (w + c::x1) * ((w - c::x11 / 256) - c::x12);
+      value = factor * r;
+   }
+   else if(w <= 8)                    // w in (4, 8]
+   {
+      T y = x * x;
+      T r = tools::constexpr_evaluate_rational(c::P2, c::Q2, y);
+      T factor = w * (w + c::x2) * ((w - c::x21 / 256) - c::x22);
+      value = factor * r;
+   }
+   else                               // w in (8, \infty), see bessel_j1.hpp
+   {
+      T y = 8 / w;
+      T y2 = y * y;
+      T rc = tools::constexpr_evaluate_rational(c::PC, c::QC, y2);
+      T rs = tools::constexpr_evaluate_rational(c::PS, c::QS, y2);
+      T factor = 1 / (constexpr_math::sqrt(w) * constants::root_pi<T>());
+      T sx = constexpr_math::sin(w);
+      T cx = constexpr_math::cos(w);
+      value = factor * (rc * (sx - cx) + y * rs * (sx + cx));
+   }
+   return x < 0 ? -value : value;     // odd function
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR T constexpr_bessel_y0_imp(T x)
+{
+   using namespace constexpr_math;
+   typedef bessel_y0_kernel_coefficients<T, (std::numeric_limits<T>::digits <= 64 ? 64 : 0)> c;
+
+   if(is_nan(x) || (x < 0))
+      return std::numeric_limits<T>::quiet_NaN();
+   if(x == 0)
+      return -std::numeric_limits<T>::infinity();
+   if(is_inf(x))
+      return 0;
+   if(x <= 3)                         // x in (0, 3]
+   {
+      T y = x * x;
+      T z = 2 * constexpr_math::log(x / c::x1) * constexpr_bessel_j0_imp(x) / constants::pi<T>();
+      T r = tools::constexpr_evaluate_rational(c::P1, c::Q1, y);
+      T factor = (x + c::x1) * ((x - c::x11 / 256) - c::x12);
+      return z + factor * r;
+   }
+   else if(x <= 5.5f)                 // x in (3, 5.5]
+   {
+      T y = x * x;
+      T z = 2 * constexpr_math::log(x / c::x2) * constexpr_bessel_j0_imp(x) / constants::pi<T>();
+      T r = tools::constexpr_evaluate_rational(c::P2, c::Q2, y);
+      T factor = (x + c::x2) * ((x - c::x21 / 256) - c::x22);
+      return z + factor * r;
+   }
+   else if(x <= 8)                    // x in (5.5, 8]
+   {
+      T y = x * x;
+      T z = 2 * constexpr_math::log(x / c::x3) * constexpr_bessel_j0_imp(x) / constants::pi<T>();
+      T r = tools::constexpr_evaluate_rational(c::P3, c::Q3, y);
+      T factor = (x + c::x3) * ((x - c::x31 / 256) - c::x32);
+      return z + factor * r;
+   }
+   // x in (8, \infty), see bessel_y0.hpp:
+   T y = 8 / x;
+   T y2 = y * y;
+   T rc = tools::constexpr_evaluate_rational(c::PC, c::QC, y2);
+   T rs = tools::constexpr_evaluate_rational(c::PS, c::QS, y2);
+   T factor = constants::one_div_root_pi<T>() / constexpr_math::sqrt(x);
+   T sx = constexpr_math::sin(x);
+   T cx = constexpr_math::cos(x);
+   return factor * (rc * (sx - cx) + y * rs * (cx + sx));
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR T constexpr_bessel_y1_imp(T x)
+{
+   using namespace constexpr_math;
+   typedef bessel_y1_kernel_coefficients<T, (std::numeric_limits<T>::digits <= 64 ? 64 : 0)> c;
+
+   if(is_nan(x) || (x < 0))
+      return std::numeric_limits<T>::quiet_NaN();
+   if(x == 0)
+      return -std::numeric_limits<T>::infinity();
+   if(is_inf(x))
+      return 0;
+   if(x <= 4)                         // x in (0, 4]
+   {
+      T y = x * x;
+      T z = 2 * constexpr_math::log(x / c::x1) * constexpr_bessel_j1_imp(x) / constants::pi<T>();
+      T r = tools::constexpr_evaluate_rational(c::P1, c::Q1, y);
+      T factor = (x + c::x1) * ((x - c::x11 / 256) - c::x12) / x;
+      return z + factor * r;
+   }
+   else if(x <= 8)                    // x in (4, 8]
+   {
+      T y = x * x;
+      T z = 2 * constexpr_math::log(x / c::x2) * constexpr_bessel_j1_imp(x) / constants::pi<T>();
+      T r = tools::constexpr_evaluate_rational(c::P2, c::Q2, y);
+      T factor = (x + c::x2) * ((x - c::x21 / 256) - c::x22) / x;
+      return z + factor * r;
+   }
+   // x in (8, \infty), see bessel_y1.hpp:
+   T y = 8 / x;
+   T y2 = y * y;
+   T rc = tools::constexpr_evaluate_rational(c::PC, c::QC, y2);
+   T rs = tools::constexpr_evaluate_rational(c::PS, c::QS, y2);
+   T factor = 1 / (constexpr_math::sqrt(x) * constants::root_pi<T>());
+   T sx = constexpr_math::sin(x);
+   T cx = constexpr_math::cos(x);
+   return factor * (y * rs * (sx - cx) - rc * (sx + cx));
+}
+
+} // namespace detail
+
+template <class T>
+BOOST_CXX14_CONSTEXPR typename tools::promote_args<T>::type constexpr_erf(T z)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename detail::constexpr_kernel_traits<result_type>::evaluation_type value_type;
+   return static_cast<result_type>(detail::constexpr_erf_imp(static_cast<value_type>(z), false));
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR typename tools::promote_args<T>::type constexpr_erfc(T z)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename detail::constexpr_kernel_traits<result_type>::evaluation_type value_type;
+   return static_cast<result_type>(detail::constexpr_erf_imp(static_cast<value_type>(z), true));
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR typename tools::promote_args<T>::type constexpr_tgamma(T z)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename detail::constexpr_kernel_traits<result_type>::evaluation_type value_type;
+   return static_cast<result_type>(detail::constexpr_tgamma_imp(static_cast<value_type>(z)));
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR typename tools::promote_args<T>::type constexpr_lgamma(T z, int* sign)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename detail::constexpr_kernel_traits<result_type>::evaluation_type value_type;
+   return static_cast<result_type>(detail::constexpr_lgamma_imp(static_cast<value_type>(z), sign));
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR typename tools::promote_args<T>::type constexpr_lgamma(T z)
+{
+   return constexpr_lgamma(z, static_cast<int*>(nullptr));
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR typename tools::promote_args<T>::type constexpr_bessel_j0(T x)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename detail::constexpr_kernel_traits<result_type>::evaluation_type value_type;
+   return static_cast<result_type>(detail::constexpr_bessel_j0_imp(static_cast<value_type>(x)));
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR typename tools::promote_args<T>::type constexpr_bessel_j1(T x)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename detail::constexpr_kernel_traits<result_type>::evaluation_type value_type;
+   return static_cast<result_type>(detail::constexpr_bessel_j1_imp(static_cast<value_type>(x)));
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR typename tools::promote_args<T>::type constexpr_bessel_y0(T x)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename detail::constexpr_kernel_traits<result_type>::evaluation_type value_type;
+   return static_cast<result_type>(detail::constexpr_bessel_y0_imp(static_cast<value_type>(x)));
+}
+
+template <class T>
+BOOST_CXX14_CONSTEXPR typename tools::promote_args<T>::type constexpr_bessel_y1(T x)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename detail::constexpr_kernel_traits<result_type>::evaluation_type value_type;
+   return static_cast<result_type>(detail::constexpr_bessel_y1_imp(static_cast<value_type>(x)));
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_SF_CONSTEXPR_KERNELS_HPP
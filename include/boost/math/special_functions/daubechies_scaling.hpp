@@ -13,6 +13,10 @@
 #include <thread>
 #include <future>
 #include <iostream>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <boost/math/special_functions/detail/daubechies_scaling_integer_grid.hpp>
 #include <boost/math/filters/daubechies.hpp>
 #include <boost/math/interpolators/detail/cubic_hermite_detail.hpp>
@@ -21,8 +25,37 @@
 
 namespace boost::math {
 
+namespace detail {
+
+// Calls f(first, last) on disjoint pieces of [first, last) from up to threads threads.
+// Small ranges aren't worth the cost of starting a thread, and are done on the calling thread.
+template<class F>
+void daubechies_parallel_for(int64_t first, int64_t last, unsigned threads, F f)
+{
+    int64_t n = last - first;
+    constexpr int64_t min_chunk = 1 << 14;
+    if (threads <= 1 || n < 2*min_chunk)
+    {
+        f(first, last);
+        return;
+    }
+    int64_t chunks = (std::min)(static_cast<int64_t>(threads), n/min_chunk);
+    std::vector<std::future<void>> futures;
+    for (int64_t i = 1; i < chunks; ++i)
+    {
+        futures.push_back(std::async(std::launch::async, f, first + i*n/chunks, first + (i+1)*n/chunks));
+    }
+    f(first, first + n/chunks);
+    for (auto & fut : futures)
+    {
+        fut.get();
+    }
+}
+
+} // namespace detail
+
 template<class Real, int p, int order>
-std::vector<Real> daubechies_scaling_dyadic_grid(int64_t j_max)
+std::vector<Real> daubechies_scaling_dyadic_grid(int64_t j_max, unsigned threads = 1)
 {
     using std::isnan;
     using std::sqrt;
@@ -53,35 +86,38 @@ std::vector<Real> daubechies_scaling_dyadic_grid(int64_t j_max)
     for (int64_t j = 1; j <= j_max; ++j)
     {
         int64_t k_max = v.size()/(int64_t(1) << (j_max-j));
-        for (int64_t k = 1; k < k_max;  k += 2)
-        {
-            // Where this value will go:
-            int64_t delivery_idx = k*(1uLL << (j_max-j));
-            // This is a nice check, but we've tested this exhaustively, and it's an expensive check:
-            //if (delivery_idx >= (int64_t) v.size()) {
-            //    std::cerr << "Delivery index out of range!\n";
-            //    continue;
-            //}
-            Real term = 0;
-            for (int64_t l = 0; l < (int64_t) c.size(); ++l)
+        // Each level only reads values from the previous levels, so the odd k can be shared out between threads:
+        detail::daubechies_parallel_for(0, k_max/2, threads, [&](int64_t i_first, int64_t i_last) {
+            for (int64_t k = 2*i_first + 1; k < 2*i_last + 1 && k < k_max; k += 2)
             {
-                int64_t idx = k*(int64_t(1) << (j_max - j + 1)) - l*(int64_t(1) << j_max);
-                if (idx < 0)
-                {
-                    break;
-                }
-                if (idx < (int64_t) v.size())
+                // Where this value will go:
+                int64_t delivery_idx = k*(1uLL << (j_max-j));
+                // This is a nice check, but we've tested this exhaustively, and it's an expensive check:
+                //if (delivery_idx >= (int64_t) v.size()) {
+                //    std::cerr << "Delivery index out of range!\n";
+                //    continue;
+                //}
+                Real term = 0;
+                for (int64_t l = 0; l < (int64_t) c.size(); ++l)
                 {
-                    term += c[l]*v[idx];
+                    int64_t idx = k*(int64_t(1) << (j_max - j + 1)) - l*(int64_t(1) << j_max);
+                    if (idx < 0)
+                    {
+                        break;
+                    }
+                    if (idx < (int64_t) v.size())
+                    {
+                        term += c[l]*v[idx];
+                    }
                 }
+                // Again, another nice check:
+                //if (!isnan(v[delivery_idx])) {
+                //    std::cerr << "Delivery index already populated!, = " << v[delivery_idx] << "\n";
+                //    std::cerr << "would overwrite with " << term << "\n";
+                //}
+                v[delivery_idx] = term;
             }
-            // Again, another nice check:
-            //if (!isnan(v[delivery_idx])) {
-            //    std::cerr << "Delivery index already populated!, = " << v[delivery_idx] << "\n";
-            //    std::cerr << "would overwrite with " << term << "\n";
-            //}
-            v[delivery_idx] = term;
-        }
+        });
     }
     return v;
 }
@@ -307,6 +343,56 @@ struct null_interpolator
    }
 };
 
+//
+// Process wide cache of the interpolators, so that every object of type Owner with the same
+// number of grid refinements shares one grid, and it is only built once.
+// Only weak references are held, so a grid is freed along with the last object using it.
+// If several threads ask for the same grid at once, one builds it and the others wait for it.
+//
+template <class Owner, class Interpolator, class Builder>
+std::shared_ptr<Interpolator> shared_daubechies_interpolator(int grid_refinements, Builder build)
+{
+   static std::mutex mu;
+   static std::map<int, std::weak_ptr<Interpolator>> cache;
+   static std::map<int, std::shared_future<std::shared_ptr<Interpolator>>> pending;
+
+   std::unique_lock<std::mutex> lock(mu);
+   if (auto interpolator = cache[grid_refinements].lock())
+   {
+      return interpolator;
+   }
+   auto it = pending.find(grid_refinements);
+   if (it != pending.end())
+   {
+      auto fut = it->second;
+      lock.unlock();
+      return fut.get();
+   }
+   std::promise<std::shared_ptr<Interpolator>> promise;
+   pending[grid_refinements] = promise.get_future().share();
+   lock.unlock();
+
+   std::shared_ptr<Interpolator> interpolator;
+   try
+   {
+      interpolator = build();
+   }
+   catch (...)
+   {
+      lock.lock();
+      pending.erase(grid_refinements);
+      lock.unlock();
+      promise.set_exception(std::current_exception());
+      throw;
+   }
+   lock.lock();
+   cache[grid_refinements] = interpolator;
+   pending.erase(grid_refinements);
+   lock.unlock();
+   promise.set_value(interpolator);
+   return interpolator;
+}
+
 } // namespace detail
 
 template<class Real, int p>
@@ -373,61 +459,68 @@ public:
             }
          }
 
-         // Compute the refined grid:
-         // In fact for float precision I know the grid must be computed in double precision and then cast back down, or else parts of the support are systematically inaccurate.
-         std::future<std::vector<Real>> t0 = std::async(std::launch::async, [&grid_refinements]() {
-            // Computing in higher precision and downcasting is essential for 1ULP evaluation in float precision:
-            auto v = daubechies_scaling_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 0>(grid_refinements);
-            return detail::daubechies_eval_type<Real>::vector_cast(v);
-            });
-         // Compute the derivative of the refined grid:
-         std::future<std::vector<Real>> t1 = std::async(std::launch::async, [&grid_refinements]() {
-            auto v = daubechies_scaling_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 1>(grid_refinements);
-            return detail::daubechies_eval_type<Real>::vector_cast(v);
-            });
-
-         // if necessary, compute the second and third derivative:
-         std::vector<Real> d2ydx2;
-         std::vector<Real> d3ydx3;
-         if constexpr (p >= 6) {
-            std::future<std::vector<Real>> t3 = std::async(std::launch::async, [&grid_refinements]() {
-               auto v = daubechies_scaling_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 2>(grid_refinements);
+         // Objects with the same number of refinements share one grid, which is only built once:
+         m_interpolator = detail::shared_daubechies_interpolator<daubechies_scaling, interpolator_type>(grid_refinements, [grid_refinements]() {
+            std::shared_ptr<interpolator_type> interpolator;
+            // The grids for each derivative are built concurrently, so share the remaining cores out between them:
+            unsigned threads = (std::max)(1u, std::thread::hardware_concurrency() / (p >= 10 ? 4u : p >= 6 ? 3u : 2u));
+            // Compute the refined grid:
+            // In fact for float precision I know the grid must be computed in double precision and then cast back down, or else parts of the support are systematically inaccurate.
+            std::future<std::vector<Real>> t0 = std::async(std::launch::async, [&grid_refinements, threads]() {
+               // Computing in higher precision and downcasting is essential for 1ULP evaluation in float precision:
+               auto v = daubechies_scaling_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 0>(grid_refinements, threads);
+               return detail::daubechies_eval_type<Real>::vector_cast(v);
+               });
+            // Compute the derivative of the refined grid:
+            std::future<std::vector<Real>> t1 = std::async(std::launch::async, [&grid_refinements, threads]() {
+               auto v = daubechies_scaling_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 1>(grid_refinements, threads);
                return detail::daubechies_eval_type<Real>::vector_cast(v);
                });
 
-            if constexpr (p >= 10) {
-               std::future<std::vector<Real>> t4 = std::async(std::launch::async, [&grid_refinements]() {
-                  auto v = daubechies_scaling_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 3>(grid_refinements);
+            // if necessary, compute the second and third derivative:
+            std::vector<Real> d2ydx2;
+            std::vector<Real> d3ydx3;
+            if constexpr (p >= 6) {
+               std::future<std::vector<Real>> t3 = std::async(std::launch::async, [&grid_refinements, threads]() {
+                  auto v = daubechies_scaling_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 2>(grid_refinements, threads);
                   return detail::daubechies_eval_type<Real>::vector_cast(v);
                   });
-               d3ydx3 = t4.get();
+
+               if constexpr (p >= 10) {
+                  std::future<std::vector<Real>> t4 = std::async(std::launch::async, [&grid_refinements, threads]() {
+                     auto v = daubechies_scaling_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 3>(grid_refinements, threads);
+                     return detail::daubechies_eval_type<Real>::vector_cast(v);
+                     });
+                  d3ydx3 = t4.get();
+               }
+               d2ydx2 = t3.get();
             }
-            d2ydx2 = t3.get();
-         }
 
 
-         auto y = t0.get();
-         auto dydx = t1.get();
+            auto y = t0.get();
+            auto dydx = t1.get();
 
-         if constexpr (p >= 2)
-         {
-            vector_type data(y.size());
-            for (size_t i = 0; i < y.size(); ++i)
+            if constexpr (p >= 2)
             {
-               data[i][0] = y[i];
-               data[i][1] = dydx[i];
-               if constexpr (p >= 6)
-                  data[i][2] = d2ydx2[i];
-               if constexpr (p >= 10)
-                  data[i][3] = d3ydx3[i];
+               vector_type data(y.size());
+               for (size_t i = 0; i < y.size(); ++i)
+               {
+                  data[i][0] = y[i];
+                  data[i][1] = dydx[i];
+                  if constexpr (p >= 6)
+                     data[i][2] = d2ydx2[i];
+                  if constexpr (p >= 10)
+                     data[i][3] = d3ydx3[i];
+               }
+               if constexpr (p <= 3)
+                  interpolator = std::make_shared<interpolator_type>(std::move(data), grid_refinements, Real(0));
+               else
+                  interpolator = std::make_shared<interpolator_type>(std::move(data), Real(0), Real(1) / (1 << grid_refinements));
             }
-            if constexpr (p <= 3)
-               m_interpolator = std::make_shared<interpolator_type>(std::move(data), grid_refinements, Real(0));
             else
-               m_interpolator = std::make_shared<interpolator_type>(std::move(data), Real(0), Real(1) / (1 << grid_refinements));
-         }
-         else
-            m_interpolator = std::make_shared<detail::null_interpolator>();
+               interpolator = std::make_shared<detail::null_interpolator>();
+            return interpolator;
+         });
       }
    }
 
@@ -460,6 +553,65 @@ public:
         return m_interpolator->double_prime(x);
     }
 
+    // Bulk evaluation: y[i] = phi(x[i]), and dydx[i] = phi'(x[i]) if dydx is not null, for 0 <= i < n.
+    // Much faster than calling operator() and prime() in a loop when there are many abscissas.
+    void operator()(const Real* x, std::size_t n, Real* y, Real* dydx = nullptr) const
+    {
+        if constexpr (p <= 3)
+        {
+            if constexpr (p <= 2)
+            {
+                if (dydx)
+                {
+                    throw std::domain_error("The scaling function with fewer than 3 vanishing moments is not continuously differentiable.");
+                }
+            }
+            auto [a, b] = this->support();
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                // NaN is outside the support, as in the blocked evaluation below:
+                bool inside = x[i] > a && x[i] < b;
+                y[i] = inside ? (*this)(x[i]) : Real(0);
+                if constexpr (p == 3)
+                {
+                    if (dydx)
+                    {
+                        dydx[i] = inside ? this->prime(x[i]) : Real(0);
+                    }
+                }
+            }
+        }
+        else
+        {
+            auto [a, b] = this->support();
+            constexpr std::size_t block = 256;
+            std::array<Real, block> xc;
+            for (std::size_t start = 0; start < n; start += block)
+            {
+                const std::size_t m = (std::min)(block, n - start);
+                // Clamp to the support (NaN included) so every abscissa can be evaluated without branching:
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    Real xj = x[start + j];
+                    xc[j] = xj > a ? (xj < b ? xj : b) : a;
+                }
+                m_interpolator->unchecked_evaluation(xc.data(), m, y + start, dydx ? dydx + start : nullptr);
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    Real xj = x[start + j];
+                    if (!(xj > a && xj < b))
+                    {
+                        y[start + j] = 0;
+                        if (dydx)
+                        {
+                            dydx[start + j] = 0;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     std::pair<Real, Real> support() const
     {
         return {Real(0), Real(2*p-1)};
@@ -24,13 +24,13 @@
 namespace boost::math {
 
    template<class Real, int p, int order>
-   std::vector<Real> daubechies_wavelet_dyadic_grid(int64_t j_max)
+   std::vector<Real> daubechies_wavelet_dyadic_grid(int64_t j_max, unsigned threads = 1)
    {
       if (j_max == 0)
       {
          throw std::domain_error("The wavelet dyadic grid is refined from the scaling integer grid, so its minimum amount of data is half integer widths.");
       }
-      auto phijk = daubechies_scaling_dyadic_grid<Real, p, order>(j_max - 1);
+      auto phijk = daubechies_scaling_dyadic_grid<Real, p, order>(j_max - 1, threads);
       //psi_j[l] = psi(-p+1 + l/2^j) = \sum_{k=0}^{2p-1} (-1)^k c_k \phi(1-2p+k + l/2^{j-1})
       //For derivatives just map c_k -> 2^order c_k.
       auto d = boost::math::filters::daubechies_scaling_filter<Real, p>();
@@ -48,20 +48,22 @@ namespace boost::math {
       v[0] = 0;
       v[v.size() - 1] = 0;
 
-      for (int64_t l = 1; l < static_cast<int64_t>(v.size() - 1); ++l)
-      {
-         Real term = 0;
-         for (int64_t k = 0; k < static_cast<int64_t>(d.size()); ++k)
+      detail::daubechies_parallel_for(1, static_cast<int64_t>(v.size() - 1), threads, [&](int64_t l_first, int64_t l_last) {
+         for (int64_t l = l_first; l < l_last; ++l)
          {
-            int64_t idx = (int64_t(1) << (j_max - 1)) * (1 - 2 * p + k) + l;
-            if (idx < 0 || idx >= static_cast<int64_t>(phijk.size()))
+            Real term = 0;
+            for (int64_t k = 0; k < static_cast<int64_t>(d.size()); ++k)
             {
-               continue;
+               int64_t idx = (int64_t(1) << (j_max - 1)) * (1 - 2 * p + k) + l;
+               if (idx < 0 || idx >= static_cast<int64_t>(phijk.size()))
+               {
+                  continue;
+               }
+               term += d[k] * phijk[idx];
             }
-            term += d[k] * phijk[idx];
+            v[l] = term;
          }
-         v[l] = term;
-      }
+      });
 
       return v;
    }
@@ -135,61 +137,68 @@ namespace boost::math {
                }
             }
 
-            // Compute the refined grid:
-            // In fact for float precision I know the grid must be computed in double precision and then cast back down, or else parts of the support are systematically inaccurate.
-            std::future<std::vector<Real>> t0 = std::async(std::launch::async, [&grid_refinements]() {
-               // Computing in higher precision and downcasting is essential for 1ULP evaluation in float precision:
-               auto v = daubechies_wavelet_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 0>(grid_refinements);
-               return detail::daubechies_eval_type<Real>::vector_cast(v);
-               });
-            // Compute the derivative of the refined grid:
-            std::future<std::vector<Real>> t1 = std::async(std::launch::async, [&grid_refinements]() {
-               auto v = daubechies_wavelet_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 1>(grid_refinements);
-               return detail::daubechies_eval_type<Real>::vector_cast(v);
-               });
-
-            // if necessary, compute the second and third derivative:
-            std::vector<Real> d2ydx2;
-            std::vector<Real> d3ydx3;
-            if constexpr (p >= 6) {
-               std::future<std::vector<Real>> t3 = std::async(std::launch::async, [&grid_refinements]() {
-                  auto v = daubechies_wavelet_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 2>(grid_refinements);
+            // Objects with the same number of refinements share one grid, which is only built once:
+            m_interpolator = detail::shared_daubechies_interpolator<daubechies_wavelet, interpolator_type>(grid_refinements, [grid_refinements]() {
+               std::shared_ptr<interpolator_type> interpolator;
+               // The grids for each derivative are built concurrently, so share the remaining cores out between them:
+               unsigned threads = (std::max)(1u, std::thread::hardware_concurrency() / (p >= 10 ? 4u : p >= 6 ? 3u : 2u));
+               // Compute the refined grid:
+               // In fact for float precision I know the grid must be computed in double precision and then cast back down, or else parts of the support are systematically inaccurate.
+               std::future<std::vector<Real>> t0 = std::async(std::launch::async, [&grid_refinements, threads]() {
+                  // Computing in higher precision and downcasting is essential for 1ULP evaluation in float precision:
+                  auto v = daubechies_wavelet_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 0>(grid_refinements, threads);
+                  return detail::daubechies_eval_type<Real>::vector_cast(v);
+                  });
+               // Compute the derivative of the refined grid:
+               std::future<std::vector<Real>> t1 = std::async(std::launch::async, [&grid_refinements, threads]() {
+                  auto v = daubechies_wavelet_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 1>(grid_refinements, threads);
                   return detail::daubechies_eval_type<Real>::vector_cast(v);
                   });
 
-               if constexpr (p >= 10) {
-                  std::future<std::vector<Real>> t4 = std::async(std::launch::async, [&grid_refinements]() {
-                     auto v = daubechies_wavelet_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 3>(grid_refinements);
+               // if necessary, compute the second and third derivative:
+               std::vector<Real> d2ydx2;
+               std::vector<Real> d3ydx3;
+               if constexpr (p >= 6) {
+                  std::future<std::vector<Real>> t3 = std::async(std::launch::async, [&grid_refinements, threads]() {
+                     auto v = daubechies_wavelet_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 2>(grid_refinements, threads);
                      return detail::daubechies_eval_type<Real>::vector_cast(v);
                      });
-                  d3ydx3 = t4.get();
+
+                  if constexpr (p >= 10) {
+                     std::future<std::vector<Real>> t4 = std::async(std::launch::async, [&grid_refinements, threads]() {
+                        auto v = daubechies_wavelet_dyadic_grid<typename detail::daubechies_eval_type<Real>::type, p, 3>(grid_refinements, threads);
+                        return detail::daubechies_eval_type<Real>::vector_cast(v);
+                        });
+                     d3ydx3 = t4.get();
+                  }
+                  d2ydx2 = t3.get();
                }
-               d2ydx2 = t3.get();
-            }
 
 
-            auto y = t0.get();
-            auto dydx = t1.get();
+               auto y = t0.get();
+               auto dydx = t1.get();
 
-            if constexpr (p >= 2)
-            {
-               vector_type data(y.size());
-               for (size_t i = 0; i < y.size(); ++i)
+               if constexpr (p >= 2)
                {
-                  data[i][0] = y[i];
-                  data[i][1] = dydx[i];
-                  if constexpr (p >= 6)
-                     data[i][2] = d2ydx2[i];
-                  if constexpr (p >= 10)
-                     data[i][3] = d3ydx3[i];
+                  vector_type data(y.size());
+                  for (size_t i = 0; i < y.size(); ++i)
+                  {
+                     data[i][0] = y[i];
+                     data[i][1] = dydx[i];
+                     if constexpr (p >= 6)
+                        data[i][2] = d2ydx2[i];
+                     if constexpr (p >= 10)
+                        data[i][3] = d3ydx3[i];
+                  }
+                  if constexpr (p <= 3)
+                     interpolator = std::make_shared<interpolator_type>(std::move(data), grid_refinements, Real(-p + 1));
+                  else
+                     interpolator = std::make_shared<interpolator_type>(std::move(data), Real(-p + 1), Real(1) / (1 << grid_refinements));
                }
-               if constexpr (p <= 3)
-                  m_interpolator = std::make_shared<interpolator_type>(std::move(data), grid_refinements, Real(-p + 1));
                else
-                  m_interpolator = std::make_shared<interpolator_type>(std::move(data), Real(-p + 1), Real(1) / (1 << grid_refinements));
-            }
-            else
-               m_interpolator = std::make_shared<detail::null_interpolator>();
+                  interpolator = std::make_shared<detail::null_interpolator>();
+               return interpolator;
+            });
          }
       }
 
@@ -235,6 +244,65 @@ namespace boost::math {
          return m_interpolator->double_prime(x);
       }
 
+      // Bulk evaluation: y[i] = psi(x[i]), and dydx[i] = psi'(x[i]) if dydx is not null, for 0 <= i < n.
+      // Much faster than calling operator() and prime() in a loop when there are many abscissas.
+      void operator()(const Real* x, std::size_t n, Real* y, Real* dydx = nullptr) const
+      {
+         if constexpr (p <= 3)
+         {
+            if constexpr (p <= 2)
+            {
+               if (dydx)
+               {
+                  throw std::domain_error("The wavelet with fewer than 3 vanishing moments is not continuously differentiable.");
+               }
+            }
+            auto [a, b] = this->support();
+            for (std::size_t i = 0; i < n; ++i)
+            {
+               // NaN is outside the support, as in the blocked evaluation below:
+               bool inside = x[i] > a && x[i] < b;
+               y[i] = inside ? (*this)(x[i]) : Real(0);
+               if constexpr (p == 3)
+               {
+                  if (dydx)
+                  {
+                     dydx[i] = inside ? this->prime(x[i]) : Real(0);
+                  }
+               }
+            }
+         }
+         else
+         {
+            auto [a, b] = this->support();
+            constexpr std::size_t block = 256;
+            std::array<Real, block> xc;
+            for (std::size_t start = 0; start < n; start += block)
+            {
+               const std::size_t m = (std::min)(block, n - start);
+               // Clamp to the support (NaN included) so every abscissa can be evaluated without branching:
+               for (std::size_t j = 0; j < m; ++j)
+               {
+                  Real xj = x[start + j];
+                  xc[j] = xj > a ? (xj < b ? xj : b) : a;
+               }
+               m_interpolator->unchecked_evaluation(xc.data(), m, y + start, dydx ? dydx + start : nullptr);
+               for (std::size_t j = 0; j < m; ++j)
+               {
+                  Real xj = x[start + j];
+                  if (!(xj > a && xj < b))
+                  {
+                     y[start + j] = 0;
+                     if (dydx)
+                     {
+                        dydx[start + j] = 0;
+                     }
+                  }
+               }
+            }
+         }
+      }
+
       std::pair<Real, Real> support() const
       {
          return { Real(-p + 1), Real(p) };
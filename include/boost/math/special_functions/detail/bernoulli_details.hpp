@@ -234,20 +234,28 @@ private:
    unsigned m_used, m_capacity;
 };
 
-template <class T, class Policy>
+//
+// The cache is shared by all policies: the values stored do not depend on the policy, only on
+// the type (and its current precision), so there is one table per type and warming it up via any
+// policy benefits every caller.  Policy dependent behaviour (the error handling for values which
+// overflow) is applied as values are copied out of the cache.
+//
+template <class T>
 class bernoulli_numbers_cache
 {
 public:
    bernoulli_numbers_cache() : m_overflow_limit((std::numeric_limits<std::size_t>::max)())
       , m_counter(0)
       , m_current_precision(boost::math::tools::digits<T>())
+      , m_growth_count(0)
+      , m_reset_count(0)
    {}
 
    typedef fixed_vector<T> container_type;
 
    void tangent(std::size_t m)
    {
-      static const std::size_t min_overflow_index = b2n_overflow_limit<T, Policy>() - 1;
+      static const std::size_t min_overflow_index = b2n_overflow_limit<T, policies::policy<> >() - 1;
       tn.resize(static_cast<typename container_type::size_type>(m), T(0U));
 
       BOOST_MATH_INSTRUMENT_VARIABLE(min_overflow_index);
@@ -301,7 +309,7 @@ public:
    void tangent_numbers_series(const std::size_t m)
    {
       BOOST_MATH_STD_USING
-      static const std::size_t min_overflow_index = b2n_overflow_limit<T, Policy>() - 1;
+      static const std::size_t min_overflow_index = b2n_overflow_limit<T, policies::policy<> >() - 1;
 
       typename container_type::size_type old_size = bn.size();
 
@@ -350,19 +358,61 @@ public:
          bn[static_cast<typename container_type::size_type>(i)] = ((!b_neg) ? b : T(-b));
       }
    }
-
-   template <class OutputIterator>
-   OutputIterator copy_bernoulli_numbers(OutputIterator out, std::size_t start, std::size_t n, const Policy& pol)
+   //
+   // Makes sure that at least the first "required" values are present (required must not exceed
+   // capacity()), and returns the number of values now cached.
+   //
+   // There are basically 3 thread safety options:
+   //
+   // 1) There are no threads (BOOST_HAS_THREADS is not defined).
+   // 2) There are threads, but we do not have a true atomic integer type, 
+   //    in this case we just use a mutex to guard against race conditions.
+   // 3) There are threads, and we have an atomic integer: in this case we can
+   //    use the double-checked locking pattern to avoid thread synchronisation
+   //    when accessing values already in the cache.
+   //
+   // Once the cache is large enough, the only cost of a call is two atomic loads: readers never
+   // take the mutex, which is why it pays to call reserve() at startup rather than letting
+   // the first large request grow the table.
+   //
+   std::size_t reserve(std::size_t required)
    {
+      BOOST_MATH_ASSERT(required <= bn.capacity());
       //
-      // There are basically 3 thread safety options:
+      // Get the counter and see if we need to calculate more constants:
       //
-      // 1) There are no threads (BOOST_HAS_THREADS is not defined).
-      // 2) There are threads, but we do not have a true atomic integer type, 
-      //    in this case we just use a mutex to guard against race conditions.
-      // 3) There are threads, and we have an atomic integer: in this case we can
-      //    use the double-checked locking pattern to avoid thread synchronisation
-      //    when accessing values already in the cache.
+      if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < required)
+         || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
+      {
+         std::lock_guard<std::mutex> l(m_mutex);
+
+         if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < required)
+            || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
+         {
+            if(static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>())
+            {
+               bn.clear();
+               tn.clear();
+               m_intermediates.clear();
+               m_counter.store(0, BOOST_MATH_ATOMIC_NS::memory_order_release);
+               m_current_precision = boost::math::tools::digits<T>();
+               ++m_reset_count;
+            }
+            if(required >= bn.size())
+            {
+               std::size_t new_size = (std::min)((std::max)((std::max)(required, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
+               tangent_numbers_series(new_size);
+               ++m_growth_count;
+            }
+            m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
+         }
+      }
+      return static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume));
+   }
+
+   template <class OutputIterator, class Policy>
+   OutputIterator copy_bernoulli_numbers(OutputIterator out, std::size_t start, std::size_t n, const Policy& pol)
+   {
       //
       // First off handle the common case for overflow and/or asymptotic expansion:
       //
@@ -389,36 +439,8 @@ public:
          }
          return out;
       }
-      //
-      // Double-checked locking pattern, lets us access cached already cached values
-      // without locking:
-      //
-      // Get the counter and see if we need to calculate more constants:
-      //
-      if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-         || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
-      {
-         std::lock_guard<std::mutex> l(m_mutex);
 
-         if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-            || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
-         {
-            if(static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>())
-            {
-               bn.clear();
-               tn.clear();
-               m_intermediates.clear();
-               m_counter.store(0, BOOST_MATH_ATOMIC_NS::memory_order_release);
-               m_current_precision = boost::math::tools::digits<T>();
-            }
-            if(start + n >= bn.size())
-            {
-               std::size_t new_size = (std::min)((std::max)((std::max)(std::size_t(start + n), std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-               tangent_numbers_series(new_size);
-            }
-            m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
-         }
-      }
+      reserve(start + n);
 
       for(std::size_t i = (std::max)(static_cast<std::size_t>(max_bernoulli_b2n<T>::value + 1), start); i < start + n; ++i)
       {
@@ -429,19 +451,9 @@ public:
       return out;
    }
 
-   template <class OutputIterator>
+   template <class OutputIterator, class Policy>
    OutputIterator copy_tangent_numbers(OutputIterator out, std::size_t start, std::size_t n, const Policy& pol)
    {
-      //
-      // There are basically 3 thread safety options:
-      //
-      // 1) There are no threads (BOOST_HAS_THREADS is not defined).
-      // 2) There are threads, but we do not have a true atomic integer type, 
-      //    in this case we just use a mutex to guard against race conditions.
-      // 3) There are threads, and we have an atomic integer: in this case we can
-      //    use the double-checked locking pattern to avoid thread synchronisation
-      //    when accessing values already in the cache.
-      //
       //
       // First off handle the common case for overflow and/or asymptotic expansion:
       //
@@ -468,36 +480,8 @@ public:
          }
          return out;
       }
-      //
-      // Double-checked locking pattern, lets us access cached already cached values
-      // without locking:
-      //
-      // Get the counter and see if we need to calculate more constants:
-      //
-      if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-         || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
-      {
-         std::lock_guard<std::mutex> l(m_mutex);
 
-         if((static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < start + n)
-            || (static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>()))
-         {
-            if(static_cast<int>(m_current_precision.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)) < boost::math::tools::digits<T>())
-            {
-               bn.clear();
-               tn.clear();
-               m_intermediates.clear();
-               m_counter.store(0, BOOST_MATH_ATOMIC_NS::memory_order_release);
-               m_current_precision = boost::math::tools::digits<T>();
-            }
-            if(start + n >= bn.size())
-            {
-               std::size_t new_size = (std::min)((std::max)((std::max)(start + n, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-               tangent_numbers_series(new_size);
-            }
-            m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
-         }
-      }
+      reserve(start + n);
 
       for(std::size_t i = start; i < start + n; ++i)
       {
@@ -515,6 +499,13 @@ public:
 
       return out;
    }
+   //
+   // Instrumentation, all of which may be read without locking:
+   //
+   std::size_t size()const { return static_cast<std::size_t>(m_counter.load(BOOST_MATH_ATOMIC_NS::memory_order_consume)); }
+   std::size_t capacity()const { return bn.capacity(); }
+   std::size_t growth_count()const { return m_growth_count.load(BOOST_MATH_ATOMIC_NS::memory_order_relaxed); }
+   std::size_t reset_count()const { return m_reset_count.load(BOOST_MATH_ATOMIC_NS::memory_order_relaxed); }
 
 private:
    //
@@ -528,18 +519,27 @@ private:
    std::size_t m_overflow_limit;
    std::mutex m_mutex;
    atomic_counter_type m_counter, m_current_precision;
+   // Number of times the tables have been extended, and discarded due to a change in precision:
+   atomic_unsigned_type m_growth_count, m_reset_count;
 };
 
+template <class T>
+inline bernoulli_numbers_cache<T>& get_bernoulli_numbers_cache_instance()
+{
+   // One instance per type, whatever the policy:
+   static bernoulli_numbers_cache<T> data;
+   return data;
+}
+
 template <class T, class Policy>
-inline bernoulli_numbers_cache<T, Policy>& get_bernoulli_numbers_cache()
+inline bernoulli_numbers_cache<T>& get_bernoulli_numbers_cache()
 {
    //
    // Force this function to be called at program startup so all the static variables
    // get initialized then (thread safety).
    //
    bernoulli_initializer<T, Policy>::force_instantiate();
-   static bernoulli_numbers_cache<T, Policy> data;
-   return data;
+   return get_bernoulli_numbers_cache_instance<T>();
 }
 
 }}}
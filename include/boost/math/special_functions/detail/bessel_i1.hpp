@@ -20,6 +20,7 @@
 #include <boost/math/tools/rational.hpp>
 #include <boost/math/tools/big_constant.hpp>
 #include <boost/math/tools/assert.hpp>
+#include <boost/math/policies/policy.hpp>
 
 #if defined(__GNUC__) && defined(BOOST_MATH_USE_FLOAT128)
 //
@@ -586,6 +587,32 @@ inline T bessel_i1(const T& x)
    return bessel_i1_imp(x, tag_type());
 }
 
+template <typename T, class Policy>
+inline T bessel_i1(const T& x, const Policy&)
+{
+   //
+   // As above, but selects the approximation from the precision requested
+   // by the policy, so that a policy such as digits2<24> gets the lower
+   // degree approximations even when T is double:
+   //
+   typedef typename policies::precision<T, Policy>::type precision_type;
+   typedef std::integral_constant<int,
+      ((std::numeric_limits<T>::digits == 0) || (std::numeric_limits<T>::radix != 2) || (precision_type::value <= 0)) ?
+      0 :
+      precision_type::value <= 24 ?
+      24 :
+      precision_type::value <= 53 ?
+      53 :
+      precision_type::value <= 64 ?
+      64 :
+      precision_type::value <= 113 ?
+      113 : -1
+   > tag_type;
+
+   bessel_i1_initializer<T, tag_type>::force_instantiate();
+   return bessel_i1_imp(x, tag_type());
+}
+
 }}} // namespaces
 
 #endif // BOOST_MATH_BESSEL_I1_HPP
@@ -0,0 +1,522 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_DETAIL_CONSTEXPR_ELEMENTARY_HPP
+#define BOOST_MATH_SF_DETAIL_CONSTEXPR_ELEMENTARY_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+//
+// The elementary functions needed by the constexpr special function kernels:
+// exp, log, sqrt, sin and cos for double, written so that they can be evaluated
+// by the compiler (none of the <cmath> functions are constexpr before C++23).
+//
+// Everything that feeds an error amplifying step - the argument to exp, the
+// log inside pow, the reduced argument to sin and cos - is carried as an
+// unevaluated sum of two doubles (a "double-double"), so the results are within
+// an ulp or so of the correctly rounded value.  The double-double arithmetic
+// relies on each operation being rounded to double, which is always true when
+// the compiler does the evaluation, but requires that FP_CONTRACT is off and
+// that there is no excess precision when these are called at run time.
+//
+
+#include <boost/math/tools/config.hpp>
+#include <cstdint>
+#include <limits>
+
+namespace boost{ namespace math{ namespace detail{ namespace constexpr_math{
+
+struct double_double
+{
+   double hi;
+   double lo;
+};
+
+constexpr double_double fast_two_sum(double a, double b)
+{
+   // Requires |a| >= |b|:
+   return { a + b, b - ((a + b) - a) };
+}
+
+BOOST_CXX14_CONSTEXPR double_double two_sum(double a, double b)
+{
+   double s = a + b;
+   double bb = s - a;
+   return { s, (a - (s - bb)) + (b - bb) };
+}
+
+BOOST_CXX14_CONSTEXPR double_double split(double a)
+{
+   // Veltkamp splitting, a must be less than 2^996:
+   double t = 134217729.0 * a;
+   double hi = t - (t - a);
+   return { hi, a - hi };
+}
+
+BOOST_CXX14_CONSTEXPR double_double two_prod(double a, double b)
+{
+   double p = a * b;
+   double_double sa = split(a);
+   double_double sb = split(b);
+   return { p, ((sa.hi * sb.hi - p) + sa.hi * sb.lo + sa.lo * sb.hi) + sa.lo * sb.lo };
+}
+
+BOOST_CXX14_CONSTEXPR double_double add(const double_double& a, const double_double& b)
+{
+   double_double s = two_sum(a.hi, b.hi);
+   double_double t = two_sum(a.lo, b.lo);
+   s.lo += t.hi;
+   s = fast_two_sum(s.hi, s.lo);
+   s.lo += t.lo;
+   return fast_two_sum(s.hi, s.lo);
+}
+
+BOOST_CXX14_CONSTEXPR double_double add(const double_double& a, double b)
+{
+   double_double s = two_sum(a.hi, b);
+   s.lo += a.lo;
+   return fast_two_sum(s.hi, s.lo);
+}
+
+BOOST_CXX14_CONSTEXPR double_double mul(const double_double& a, const double_double& b)
+{
+   double_double p = two_prod(a.hi, b.hi);
+   p.lo += a.hi * b.lo + a.lo * b.hi;
+   return fast_two_sum(p.hi, p.lo);
+}
+
+BOOST_CXX14_CONSTEXPR double_double mul(const double_double& a, double b)
+{
+   double_double p = two_prod(a.hi, b);
+   p.lo += a.lo * b;
+   return fast_two_sum(p.hi, p.lo);
+}
+
+BOOST_CXX14_CONSTEXPR double_double div(const double_double& a, const double_double& b)
+{
+   double q1 = a.hi / b.hi;
+   double_double r = add(a, mul(b, -q1));
+   double q2 = r.hi / b.hi;
+   r = add(r, mul(b, -q2));
+   double q3 = r.hi / b.hi;
+   return add(fast_two_sum(q1, q2), q3);
+}
+
+constexpr bool is_nan(double x)
+{
+   return x != x;
+}
+
+constexpr bool is_inf(double x)
+{
+   return (x == std::numeric_limits<double>::infinity()) || (x == -std::numeric_limits<double>::infinity());
+}
+
+constexpr double fabs(double x)
+{
+   return x < 0 ? -x : x;
+}
+
+BOOST_CXX14_CONSTEXPR double floor(double x)
+{
+   // Anything this large is already an integer:
+   if(!(fabs(x) < 4503599627370496.0))
+      return x;
+   double i = static_cast<double>(static_cast<std::int64_t>(x));
+   return i > x ? i - 1 : i;
+}
+
+BOOST_CXX14_CONSTEXPR double pow2(int n)
+{
+   // Exact for n in [-1074, 1023]:
+   double base = n < 0 ? 0.5 : 2.0;
+   unsigned m = n < 0 ? static_cast<unsigned>(-n) : static_cast<unsigned>(n);
+   double result = 1;
+   while(m)
+   {
+      if(m & 1u)
+         result *= base;
+      m >>= 1;
+      if(m)
+         base *= base;
+   }
+   return result;
+}
+
+//
+// Returns x * 2^n with a single rounding, so the result is correct even when
+// it's subnormal.  Overflow isn't allowed in a constant expression, so that
+// has to be checked for explicitly:
+//
+BOOST_CXX14_CONSTEXPR double ldexp(double x, int n)
+{
+   if(n > 1000)
+   {
+      x *= pow2(n - 100);
+      if(fabs(x) > (std::numeric_limits<double>::max)() * pow2(-100))
+         return x < 0 ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+      return x * pow2(100);
+   }
+   if(n < -1000)
+      return (x * pow2(n + 100)) * pow2(-100);
+   return x * pow2(n);
+}
+
+struct mantissa_exponent
+{
+   double mantissa;  // in [1, 2)
+   int exponent;
+};
+
+BOOST_CXX14_CONSTEXPR mantissa_exponent normalise(double x)
+{
+   // x must be finite and positive, all the scalings are exact:
+   int e = 0;
+   while(x >= 4294967296.0)
+   {
+      x *= 1.0 / 4294967296.0;
+      e += 32;
+   }
+   while(x < 1.0 / 4294967296.0)
+   {
+      x *= 4294967296.0;
+      e -= 32;
+   }
+   while(x >= 2)
+   {
+      x *= 0.5;
+      ++e;
+   }
+   while(x < 1)
+   {
+      x *= 2;
+      --e;
+   }
+   return { x, e };
+}
+
+//
+// ln(2) as a double-double, and split so that k * ln2_hi is exact for |k| < 2^20:
+//
+constexpr double_double ln2()
+{
+   return { 0.6931471805599452862, 2.3190468138462996e-17 };
+}
+constexpr double ln2_hi = 6.93147180369123816490e-01;
+constexpr double ln2_lo = 1.90821492927058770002e-10;
+
+//
+// exp(a.hi + a.lo):
+//
+BOOST_CXX14_CONSTEXPR double exp(const double_double& a)
+{
+   if(is_nan(a.hi))
+      return a.hi;
+   if(a.hi > 709.782712893383973096)
+      return std::numeric_limits<double>::infinity();
+   if(a.hi < -745.2)
+      return 0;
+   double k = floor(a.hi * 1.44269504088896338700 + 0.5);
+   // a - k * ln(2), the first subtraction is exact:
+   double_double r = two_sum(a.hi - k * ln2_hi, -k * ln2_lo);
+   r = add(r, a.lo);
+   //
+   // |r| <= ln(2)/2 so the Taylor series for expm1 converges rapidly, the
+   // low part only needs the first order term:
+   //
+   double x = r.hi;
+   double p = x * (1.0 / 6227020800.0);
+   p = x * (p + 1.0 / 479001600.0);
+   p = x * (p + 1.0 / 39916800.0);
+   p = x * (p + 1.0 / 3628800.0);
+   p = x * (p + 1.0 / 362880.0);
+   p = x * (p + 1.0 / 40320.0);
+   p = x * (p + 1.0 / 5040.0);
+   p = x * (p + 1.0 / 720.0);
+   p = x * (p + 1.0 / 120.0);
+   p = x * (p + 1.0 / 24.0);
+   p = x * (p + 1.0 / 6.0);
+   p = x * x * (p + 0.5);
+   double result = 1 + (x + (p + r.lo * (1 + x)));
+   return ldexp(result, static_cast<int>(k));
+}
+
+constexpr double exp(double x)
+{
+   return exp(double_double{ x, 0 });
+}
+
+//
+// log(x) as a double-double, for finite x > 0:
+//
+BOOST_CXX14_CONSTEXPR double_double log_dd(double x)
+{
+   mantissa_exponent me = normalise(x);
+   double m = me.mantissa;
+   int e = me.exponent;
+   if(m > 1.41421356237309504880)
+   {
+      m *= 0.5;
+      ++e;
+   }
+   //
+   // log(m) = 2 * atanh(s) = 2s + 2s^3/3 + 2s^5/5 + ..., with s = (m - 1) / (m + 1)
+   // and |s| <= 0.172; only the leading terms need double-double precision:
+   //
+   double f = m - 1;
+   double_double s = div(double_double{ f, 0 }, two_sum(2, f));
+   double_double s2 = mul(s, s);
+   double z = s2.hi;
+   double tail = 1.0 / 23;
+   tail = tail * z + 1.0 / 21;
+   tail = tail * z + 1.0 / 19;
+   tail = tail * z + 1.0 / 17;
+   tail = tail * z + 1.0 / 15;
+   tail = tail * z + 1.0 / 13;
+   tail = tail * z + 1.0 / 11;
+   tail = tail * z + 1.0 / 9;
+   tail = tail * z + 1.0 / 7;
+   tail = tail * z + 1.0 / 5;
+   double_double t = add(mul(s2, tail), double_double{ 0.33333333333333331483, 1.8503717077085942e-17 });
+   t = add(mul(s2, t), 1.0);
+   double_double result = mul(mul(s, t), 2.0);
+   return add(mul(ln2(), static_cast<double>(e)), result);
+}
+
+BOOST_CXX14_CONSTEXPR double log(double x)
+{
+   if(is_nan(x) || (x < 0))
+      return std::numeric_limits<double>::quiet_NaN();
+   if(x == 0)
+      return -std::numeric_limits<double>::infinity();
+   if(is_inf(x))
+      return x;
+   return log_dd(x).hi;
+}
+
+//
+// x^y for finite x > 0:
+//
+BOOST_CXX14_CONSTEXPR double pow(double x, double y)
+{
+   return exp(mul(log_dd(x), y));
+}
+
+BOOST_CXX14_CONSTEXPR double sqrt(double x)
+{
+   if(is_nan(x) || (x < 0))
+      return std::numeric_limits<double>::quiet_NaN();
+   if((x == 0) || is_inf(x))
+      return x;
+   mantissa_exponent me = normalise(x);
+   if(me.exponent & 1)
+   {
+      me.mantissa *= 2;
+      --me.exponent;
+   }
+   // m is in [1, 4), start from a linear approximation and polish with Newton steps:
+   double m = me.mantissa;
+   double r = 0.41731 + 0.59016 * m * 0.5;
+   for(unsigned i = 0; i < 5; ++i)
+      r = 0.5 * (r + m / r);
+   // One more step using the exact residual m - r*r gets the last bit right:
+   double_double rr = two_prod(r, r);
+   r += ((m - rr.hi) - rr.lo) / (2 * r);
+   return ldexp(r, me.exponent / 2);
+}
+
+//
+// The digits of 2/pi, 24 bits at a time, for reducing huge arguments to sin and cos:
+//
+template <class Dummy = void>
+struct two_over_pi_table
+{
+   static constexpr std::int32_t bits[56] = {
+      0xA2F983, 0x6E4E44, 0x1529FC, 0x2757D1, 0xF534DD, 0xC0DB62, 0x95993C, 0x439041,
+      0xFE5163, 0xABDEBB, 0xC561B7, 0x246E3A, 0x424DD2, 0xE00649, 0x2EEA09, 0xD1921C,
+      0xFE1DEB, 0x1CB129, 0xA73EE8, 0x8235F5, 0x2EBB44, 0x84E99C, 0x7026B4, 0x5F7E41,
+      0x3991D6, 0x398353, 0x39F49C, 0x845F8B, 0xBDF928, 0x3B1FF8, 0x97FFDE, 0x05980F,
+      0xEF2F11, 0x8B5A0A, 0x6D1F6D, 0x367ECF, 0x27CB09, 0xB74F46, 0x3F669E, 0x5FEA2D,
+      0x7527BA, 0xC7EBE5, 0xF17B3D, 0x0739F7, 0x8A5292, 0xEA6BFB, 0x5FB11F, 0x8D5D08,
+      0x560330, 0x46FC7B, 0x6BABF0, 0xCFBC20, 0x9AF436, 0x1DA9E3, 0x91615E, 0xE61B08
+   };
+};
+
+template <class Dummy>
+constexpr std::int32_t two_over_pi_table<Dummy>::bits[56];
+
+struct reduced_argument
+{
+   int quadrant;      // n mod 4
+   double_double r;   // x - n * pi/2, |r| <= pi/4
+};
+
+BOOST_CXX14_CONSTEXPR double mod4(double x)
+{
+   // Exact for integers:
+   return x - 4 * floor(x * 0.25);
+}
+
+BOOST_CXX14_CONSTEXPR double drop_multiples_of_4(double x)
+{
+   // Result has the sign of x and magnitude < 4, exact for any double:
+   double t = x * 0.25;
+   return x - 4 * (t < 0 ? -floor(-t) : floor(t));
+}
+
+//
+// Reduces finite x >= 0 modulo pi/2:
+//
+BOOST_CXX14_CONSTEXPR reduced_argument rem_pio2(double x)
+{
+   if(x <= 0.785398163397448309616)
+      return { 0, double_double{ x, 0 } };
+   if(x < 1647099.0)
+   {
+      //
+      // Cody-Waite reduction with pi/2 split into 33-bit pieces, so that
+      // k times each piece is exact for k < 2^20:
+      //
+      double k = floor(x * 0.636619772367581343076 + 0.5);
+      double_double r = two_sum(x - k * 1.57079632673412561417e+00, -k * 6.07710050630396597660e-11);
+      r = add(r, -k * 2.02226624871116645580e-21);
+      r = add(r, -k * 8.47842766036889956997e-32);
+      return { static_cast<int>(mod4(k)), r };
+   }
+   //
+   // Payne-Hanek: x = m * 2^e with m < 2^53, and x * 2/pi is the sum of the exact
+   // products of x with 24-bit chunks of 2/pi.  Chunks whose product is a multiple of 4
+   // don't change the quadrant, so we start with the first one that might, and
+   // scale x and the chunks so everything stays in range:
+   //
+   mantissa_exponent me = normalise(x);
+   int e = me.exponent - 52;
+   int first = e > 2 ? (e - 2) / 24 : 0;
+   double xs = ldexp(x, -24 * first);
+   double_double sum = { 0, 0 };
+   double scale = 1.0 / 16777216.0;
+   for(int j = first; j < first + 8; ++j)
+   {
+      double_double p = two_prod(xs, two_over_pi_table<>::bits[j] * scale);
+      sum = add(sum, drop_multiples_of_4(p.hi));
+      sum = add(sum, drop_multiples_of_4(p.lo));
+      scale *= 1.0 / 16777216.0;
+   }
+   double n = floor(sum.hi + 0.5);
+   double_double f = add(sum, -n);
+   if(f.hi > 0.5)
+   {
+      f = add(f, -1.0);
+      n += 1;
+   }
+   else if(f.hi < -0.5)
+   {
+      f = add(f, 1.0);
+      n -= 1;
+   }
+   // pi/2 as a double-double:
+   double_double r = mul(f, double_double{ 1.5707963267948965580, 6.1232339957367658e-17 });
+   return { static_cast<int>(mod4(n)), r };
+}
+
+//
+// sin and cos on [-pi/4, pi/4] of r.hi + r.lo:
+//
+BOOST_CXX14_CONSTEXPR double sin_kernel(const double_double& r)
+{
+   double x = r.hi;
+   double z = x * x;
+   double p = -1.0 / 51090942171709440000.0;
+   p = p * z + 1.0 / 121645100408832000.0;
+   p = p * z - 1.0 / 355687428096000.0;
+   p = p * z + 1.0 / 1307674368000.0;
+   p = p * z - 1.0 / 6227020800.0;
+   p = p * z + 1.0 / 39916800.0;
+   p = p * z - 1.0 / 362880.0;
+   p = p * z + 1.0 / 5040.0;
+   p = p * z - 1.0 / 120.0;
+   p = p * z + 1.0 / 6.0;
+   return x + (r.lo * (1 - 0.5 * z) - x * z * p);
+}
+
+BOOST_CXX14_CONSTEXPR double cos_kernel(const double_double& r)
+{
+   double x = r.hi;
+   double z = x * x;
+   double p = 1.0 / 2432902008176640000.0;
+   p = p * z - 1.0 / 6402373705728000.0;
+   p = p * z + 1.0 / 20922789888000.0;
+   p = p * z - 1.0 / 87178291200.0;
+   p = p * z + 1.0 / 479001600.0;
+   p = p * z - 1.0 / 3628800.0;
+   p = p * z + 1.0 / 40320.0;
+   p = p * z - 1.0 / 720.0;
+   p = p * z + 1.0 / 24.0;
+   // 1 - z/2 loses bits when z is largish, recover them as in fdlibm:
+   double hz = 0.5 * z;
+   double w = 1 - hz;
+   return w + (((1 - w) - hz) + (z * z * p - x * r.lo));
+}
+
+BOOST_CXX14_CONSTEXPR double sin(double x)
+{
+   if(is_nan(x) || is_inf(x))
+      return std::numeric_limits<double>::quiet_NaN();
+   bool negate = x < 0;
+   reduced_argument a = rem_pio2(fabs(x));
+   double result = 0;
+   switch(a.quadrant)
+   {
+   case 0: result = sin_kernel(a.r); break;
+   case 1: result = cos_kernel(a.r); break;
+   case 2: result = -sin_kernel(a.r); break;
+   default: result = -cos_kernel(a.r); break;
+   }
+   return negate ? -result : result;
+}
+
+BOOST_CXX14_CONSTEXPR double cos(double x)
+{
+   if(is_nan(x) || is_inf(x))
+      return std::numeric_limits<double>::quiet_NaN();
+   reduced_argument a = rem_pio2(fabs(x));
+   switch(a.quadrant)
+   {
+   case 0: return cos_kernel(a.r);
+   case 1: return -sin_kernel(a.r);
+   case 2: return -cos_kernel(a.r);
+   default: return sin_kernel(a.r);
+   }
+}
+
+//
+// sin(pi * x), exact at the integers and half integers:
+//
+BOOST_CXX14_CONSTEXPR double sin_pi(double x)
+{
+   bool negate = x < 0;
+   x = fabs(x);
+   // Reduce to [0, 2), this is exact:
+   x -= 2 * floor(x * 0.5);
+   if(x >= 1)
+   {
+      x -= 1;
+      negate = !negate;
+   }
+   if(x > 0.5)
+      x = 1 - x;
+   double result = 0;
+   if(x > 0.25)
+      result = cos_kernel(mul(double_double{ 3.1415926535897931160, 1.2246467991473532e-16 }, 0.5 - x));
+   else
+      result = sin_kernel(mul(double_double{ 3.1415926535897931160, 1.2246467991473532e-16 }, x));
+   return negate ? -result : result;
+}
+
+}}}} // namespaces
+
+#endif // BOOST_MATH_SF_DETAIL_CONSTEXPR_ELEMENTARY_HPP
@@ -0,0 +1,743 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_DETAIL_CONSTEXPR_KERNEL_COEFFICIENTS_HPP
+#define BOOST_MATH_SF_DETAIL_CONSTEXPR_KERNEL_COEFFICIENTS_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+//
+// Coefficients for the constexpr special function kernels, as constexpr std::array's.
+// These are the same approximations as used by the regular implementations, each set
+// being a partial specialisation on the number of bits of precision it's good for, so
+// that the kernels can pick one at compile time.  T is the type the kernel evaluates in.
+//
+
+#include <array>
+#include <cstdint>
+
+namespace boost{ namespace math{ namespace detail{
+
+template <class T, int Precision>
+struct erf_kernel_coefficients;
+template <class T, int Precision>
+struct lgamma_small_kernel_coefficients;
+template <class T, int Precision>
+struct lanczos_kernel_coefficients;
+template <class T, int Precision>
+struct bessel_j0_kernel_coefficients;
+template <class T, int Precision>
+struct bessel_j1_kernel_coefficients;
+template <class T, int Precision>
+struct bessel_y0_kernel_coefficients;
+template <class T, int Precision>
+struct bessel_y1_kernel_coefficients;
+
+//
+// The 53-bit rational approximations from erf.hpp:
+//
+template <class T>
+struct erf_kernel_coefficients<T, 53>
+{
+   static constexpr T erf_Y = static_cast<T>(1.044948577880859375);
+   static constexpr T erfc_Y1 = static_cast<T>(0.405935764312744140625);
+   static constexpr T erfc_Y2 = static_cast<T>(0.50672817230224609375);
+   static constexpr T erfc_Y3 = static_cast<T>(0.5405750274658203125);
+   static constexpr T erfc_Y4 = static_cast<T>(0.5579090118408203125);
+   // erf(z) for z in [1e-10, 0.5):
+   static constexpr std::array<T, 5> erf_P = {{
+      0.0834305892146531832907,
+      -0.338165134459360935041,
+      -0.0509990735146777432841,
+      -0.00772758345802133288487,
+      -0.000322780120964605683831
+   }};
+   static constexpr std::array<T, 5> erf_Q = {{
+      1.0,
+      0.455004033050794024546,
+      0.0875222600142252549554,
+      0.00858571925074406212772,
+      0.000370900071787748000569
+   }};
+   // erfc(z) for z in [0.5, 1.5):
+   static constexpr std::array<T, 6> erfc_P1 = {{
+      -0.098090592216281240205,
+      0.178114665841120341155,
+      0.191003695796775433986,
+      0.0888900368967884466578,
+      0.0195049001251218801359,
+      0.00180424538297014223957
+   }};
+   static constexpr std::array<T, 7> erfc_Q1 = {{
+      1.0,
+      1.84759070983002217845,
+      1.42628004845511324508,
+      0.578052804889902404909,
+      0.12385097467900864233,
+      0.0113385233577001411017,
+      0.337511472483094676155e-5
+   }};
+   // erfc(z) for z in [1.5, 2.5):
+   static constexpr std::array<T, 6> erfc_P2 = {{
+      -0.0243500476207698441272,
+      0.0386540375035707201728,
+      0.04394818964209516296,
+      0.0175679436311802092299,
+      0.00323962406290842133584,
+      0.000235839115596880717416
+   }};
+   static constexpr std::array<T, 6> erfc_Q2 = {{
+      1.0,
+      1.53991494948552447182,
+      0.982403709157920235114,
+      0.325732924782444448493,
+      0.0563921837420478160373,
+      0.00410369723978904575884
+   }};
+   // erfc(z) for z in [2.5, 4.5):
+   static constexpr std::array<T, 6> erfc_P3 = {{
+      0.00295276716530971662634,
+      0.0137384425896355332126,
+      0.00840807615555585383007,
+      0.00212825620914618649141,
+      0.000250269961544794627958,
+      0.113212406648847561139e-4
+   }};
+   static constexpr std::array<T, 6> erfc_Q3 = {{
+      1.0,
+      1.04217814166938418171,
+      0.442597659481563127003,
+      0.0958492726301061423444,
+      0.0105982906484876531489,
+      0.000479411269521714493907
+   }};
+   // erfc(z) for z >= 4.5, as a function of 1/z:
+   static constexpr std::array<T, 7> erfc_P4 = {{
+      0.00628057170626964891937,
+      0.0175389834052493308818,
+      -0.212652252872804219852,
+      -0.687717681153649930619,
+      -2.5518551727311523996,
+      -3.22729451764143718517,
+      -2.8175401114513378771
+   }};
+   static constexpr std::array<T, 7> erfc_Q4 = {{
+      1.0,
+      2.79257750980575282228,
+      11.0567237927800161565,
+      15.930646027911794143,
+      22.9367376522880577224,
+      13.5064170191802889145,
+      5.48409182238641741584
+   }};
+};
+
+template <class T> constexpr std::array<T, 5> erf_kernel_coefficients<T, 53>::erf_P;
+template <class T> constexpr std::array<T, 5> erf_kernel_coefficients<T, 53>::erf_Q;
+template <class T> constexpr std::array<T, 6> erf_kernel_coefficients<T, 53>::erfc_P1;
+template <class T> constexpr std::array<T, 7> erf_kernel_coefficients<T, 53>::erfc_Q1;
+template <class T> constexpr std::array<T, 6> erf_kernel_coefficients<T, 53>::erfc_P2;
+template <class T> constexpr std::array<T, 6> erf_kernel_coefficients<T, 53>::erfc_Q2;
+template <class T> constexpr std::array<T, 6> erf_kernel_coefficients<T, 53>::erfc_P3;
+template <class T> constexpr std::array<T, 6> erf_kernel_coefficients<T, 53>::erfc_Q3;
+template <class T> constexpr std::array<T, 7> erf_kernel_coefficients<T, 53>::erfc_P4;
+template <class T> constexpr std::array<T, 7> erf_kernel_coefficients<T, 53>::erfc_Q4;
+template <class T> constexpr T erf_kernel_coefficients<T, 53>::erf_Y;
+template <class T> constexpr T erf_kernel_coefficients<T, 53>::erfc_Y1;
+template <class T> constexpr T erf_kernel_coefficients<T, 53>::erfc_Y2;
+template <class T> constexpr T erf_kernel_coefficients<T, 53>::erfc_Y3;
+template <class T> constexpr T erf_kernel_coefficients<T, 53>::erfc_Y4;
+
+//
+// The rational approximations for small z from lgamma_small.hpp, these
+// are accurate enough for 64-bit mantissas and are used for double too:
+//
+template <class T>
+struct lgamma_small_kernel_coefficients<T, 64>
+{
+   static constexpr T Y1 = static_cast<T>(0.158963680267333984375);
+   static constexpr T Y2 = static_cast<T>(0.52815341949462890625);
+   static constexpr T Y3 = static_cast<T>(0.452017307281494140625);
+   // lgamma(z) = (z-2)(z+1)(Y1 + R1(z-2)) for z in [2, 3):
+   static constexpr std::array<T, 7> P1 = {{
+      -0.180355685678449379109e-1,
+      0.25126649619989678683e-1,
+      0.494103151567532234274e-1,
+      0.172491608709613993966e-1,
+      -0.259453563205438108893e-3,
+      -0.541009869215204396339e-3,
+      -0.324588649825948492091e-4
+   }};
+   static constexpr std::array<T, 8> Q1 = {{
+      0.1e1,
+      0.196202987197795200688e1,
+      0.148019669424231326694e1,
+      0.541391432071720958364e0,
+      0.988504251128010129477e-1,
+      0.82130967464889339326e-2,
+      0.224936291922115757597e-3,
+      -0.223352763208617092964e-6
+   }};
+   // lgamma(z) = (z-1)(z-2)(Y2 + R2(z-1)) for z in [1, 1.5]:
+   static constexpr std::array<T, 7> P2 = {{
+      0.490622454069039543534e-1,
+      -0.969117530159521214579e-1,
+      -0.414983358359495381969e0,
+      -0.406567124211938417342e0,
+      -0.158413586390692192217e0,
+      -0.240149820648571559892e-1,
+      -0.100346687696279557415e-2
+   }};
+   static constexpr std::array<T, 7> Q2 = {{
+      0.1e1,
+      0.302349829846463038743e1,
+      0.348739585360723852576e1,
+      0.191415588274426679201e1,
+      0.507137738614363510846e0,
+      0.577039722690451849648e-1,
+      0.195768102601107189171e-2
+   }};
+   // lgamma(z) = (2-z)(1-z)(Y3 + R3(2-z)) for z in (1.5, 2):
+   static constexpr std::array<T, 6> P3 = {{
+      -0.292329721830270012337e-1,
+      0.144216267757192309184e0,
+      -0.142440390738631274135e0,
+      0.542809694055053558157e-1,
+      -0.850535976868336437746e-2,
+      0.431171342679297331241e-3
+   }};
+   static constexpr std::array<T, 7> Q3 = {{
+      0.1e1,
+      -0.150169356054485044494e1,
+      0.846973248876495016101e0,
+      -0.220095151814995745555e0,
+      0.25582797155975869989e-1,
+      -0.100666795539143372762e-2,
+      -0.827193521891290553639e-6
+   }};
+};
+
+template <class T> constexpr std::array<T, 7> lgamma_small_kernel_coefficients<T, 64>::P1;
+template <class T> constexpr std::array<T, 8> lgamma_small_kernel_coefficients<T, 64>::Q1;
+template <class T> constexpr std::array<T, 7> lgamma_small_kernel_coefficients<T, 64>::P2;
+template <class T> constexpr std::array<T, 7> lgamma_small_kernel_coefficients<T, 64>::Q2;
+template <class T> constexpr std::array<T, 6> lgamma_small_kernel_coefficients<T, 64>::P3;
+template <class T> constexpr std::array<T, 7> lgamma_small_kernel_coefficients<T, 64>::Q3;
+template <class T> constexpr T lgamma_small_kernel_coefficients<T, 64>::Y1;
+template <class T> constexpr T lgamma_small_kernel_coefficients<T, 64>::Y2;
+template <class T> constexpr T lgamma_small_kernel_coefficients<T, 64>::Y3;
+
+//
+// The coefficients of lanczos13m53 from lanczos.hpp:
+//
+template <class T>
+struct lanczos_kernel_coefficients<T, 53>
+{
+   static constexpr T g = static_cast<T>(6.024680040776729583740234375);
+   // lanczos_sum:
+   static constexpr std::array<T, 13> sum_num = {{
+      23531376880.41075968857200767445163675473,
+      42919803642.64909876895789904700198885093,
+      35711959237.35566804944018545154716670596,
+      17921034426.03720969991975575445893111267,
+      6039542586.35202800506429164430729792107,
+      1439720407.311721673663223072794912393972,
+      248874557.8620541565114603864132294232163,
+      31426415.58540019438061423162831820536287,
+      2876370.628935372441225409051620849613599,
+      186056.2653952234950402949897160456992822,
+      8071.672002365816210638002902272250613822,
+      210.8242777515793458725097339207133627117,
+      2.506628274631000270164908177133837338626
+   }};
+   static constexpr std::array<std::uint32_t, 13> sum_denom = {{
+      0u,
+      39916800u,
+      120543840u,
+      150917976u,
+      105258076u,
+      45995730u,
+      13339535u,
+      2637558u,
+      357423u,
+      32670u,
+      1925u,
+      66u,
+      1u
+   }};
+   // lanczos_sum_expG_scaled:
+   static constexpr std::array<T, 13> sum_expG_scaled_num = {{
+      56906521.91347156388090791033559122686859,
+      103794043.1163445451906271053616070238554,
+      86363131.28813859145546927288977868422342,
+      43338889.32467613834773723740590533316085,
+      14605578.08768506808414169982791359218571,
+      3481712.15498064590882071018964774556468,
+      601859.6171681098786670226533699352302507,
+      75999.29304014542649875303443598909137092,
+      6955.999602515376140356310115515198987526,
+      449.9445569063168119446858607650988409623,
+      19.51992788247617482847860966235652136208,
+      0.5098416655656676188125178644804694509993,
+      0.006061842346248906525783753964555936883222
+   }};
+   static constexpr std::array<std::uint32_t, 13> sum_expG_scaled_denom = {{
+      0u,
+      39916800u,
+      120543840u,
+      150917976u,
+      105258076u,
+      45995730u,
+      13339535u,
+      2637558u,
+      357423u,
+      32670u,
+      1925u,
+      66u,
+      1u
+   }};
+};
+
+template <class T> constexpr std::array<T, 13> lanczos_kernel_coefficients<T, 53>::sum_num;
+template <class T> constexpr std::array<std::uint32_t, 13> lanczos_kernel_coefficients<T, 53>::sum_denom;
+template <class T> constexpr std::array<T, 13> lanczos_kernel_coefficients<T, 53>::sum_expG_scaled_num;
+template <class T> constexpr std::array<std::uint32_t, 13> lanczos_kernel_coefficients<T, 53>::sum_expG_scaled_denom;
+template <class T> constexpr T lanczos_kernel_coefficients<T, 53>::g;
+
+//
+// The approximations from bessel_j0.hpp:
+//
+template <class T>
+struct bessel_j0_kernel_coefficients<T, 64>
+{
+   static constexpr T x1 = static_cast<T>(2.4048255576957727686e+00);
+   static constexpr T x2 = static_cast<T>(5.5200781102863106496e+00);
+   static constexpr T x11 = static_cast<T>(6.160e+02);
+   static constexpr T x12 = static_cast<T>(-1.42444230422723137837e-03);
+   static constexpr T x21 = static_cast<T>(1.4130e+03);
+   static constexpr T x22 = static_cast<T>(5.46860286310649596604e-04);
+   static constexpr std::array<T, 7> P1 = {{
+      -4.1298668500990866786e+11,
+      2.7282507878605942706e+10,
+      -6.2140700423540120665e+08,
+      6.6302997904833794242e+06,
+      -3.6629814655107086448e+04,
+      1.0344222815443188943e+02,
+      -1.2117036164593528341e-01
+   }};
+   static constexpr std::array<T, 7> Q1 = {{
+      2.3883787996332290397e+12,
+      2.6328198300859648632e+10,
+      1.3985097372263433271e+08,
+      4.5612696224219938200e+05,
+      9.3614022392337710626e+02,
+      1.0,
+      0.0
+   }};
+   static constexpr std::array<T, 8> P2 = {{
+      -1.8319397969392084011e+03,
+      -1.2254078161378989535e+04,
+      -7.2879702464464618998e+03,
+      1.0341910641583726701e+04,
+      1.1725046279757103576e+04,
+      4.4176707025325087628e+03,
+      7.4321196680624245801e+02,
+      4.8591703355916499363e+01
+   }};
+   static constexpr std::array<T, 8> Q2 = {{
+      -3.5783478026152301072e+05,
+      2.4599102262586308984e+05,
+      -8.4055062591169562211e+04,
+      1.8680990008359188352e+04,
+      -2.9458766545509337327e+03,
+      3.3307310774649071172e+02,
+      -2.5258076240801555057e+01,
+      1.0
+   }};
+   static constexpr std::array<T, 6> PC = {{
+      2.2779090197304684302e+04,
+      4.1345386639580765797e+04,
+      2.1170523380864944322e+04,
+      3.4806486443249270347e+03,
+      1.5376201909008354296e+02,
+      8.8961548424210455236e-01
+   }};
+   static constexpr std::array<T, 6> QC = {{
+      2.2779090197304684318e+04,
+      4.1370412495510416640e+04,
+      2.1215350561880115730e+04,
+      3.5028735138235608207e+03,
+      1.5711159858080893649e+02,
+      1.0
+   }};
+   static constexpr std::array<T, 6> PS = {{
+      -8.9226600200800094098e+01,
+      -1.8591953644342993800e+02,
+      -1.1183429920482737611e+02,
+      -2.2300261666214198472e+01,
+      -1.2441026745835638459e+00,
+      -8.8033303048680751817e-03
+   }};
+   static constexpr std::array<T, 6> QS = {{
+      5.7105024128512061905e+03,
+      1.1951131543434613647e+04,
+      7.2642780169211018836e+03,
+      1.4887231232283756582e+03,
+      9.0593769594993125859e+01,
+      1.0
+   }};
+};
+
+template <class T> constexpr std::array<T, 7> bessel_j0_kernel_coefficients<T, 64>::P1;
+template <class T> constexpr std::array<T, 7> bessel_j0_kernel_coefficients<T, 64>::Q1;
+template <class T> constexpr std::array<T, 8> bessel_j0_kernel_coefficients<T, 64>::P2;
+template <class T> constexpr std::array<T, 8> bessel_j0_kernel_coefficients<T, 64>::Q2;
+template <class T> constexpr std::array<T, 6> bessel_j0_kernel_coefficients<T, 64>::PC;
+template <class T> constexpr std::array<T, 6> bessel_j0_kernel_coefficients<T, 64>::QC;
+template <class T> constexpr std::array<T, 6> bessel_j0_kernel_coefficients<T, 64>::PS;
+template <class T> constexpr std::array<T, 6> bessel_j0_kernel_coefficients<T, 64>::QS;
+template <class T> constexpr T bessel_j0_kernel_coefficients<T, 64>::x1;
+template <class T> constexpr T bessel_j0_kernel_coefficients<T, 64>::x2;
+template <class T> constexpr T bessel_j0_kernel_coefficients<T, 64>::x11;
+template <class T> constexpr T bessel_j0_kernel_coefficients<T, 64>::x12;
+template <class T> constexpr T bessel_j0_kernel_coefficients<T, 64>::x21;
+template <class T> constexpr T bessel_j0_kernel_coefficients<T, 64>::x22;
+
+//
+// The approximations from bessel_j1.hpp:
+//
+template <class T>
+struct bessel_j1_kernel_coefficients<T, 64>
+{
+   static constexpr T x1 = static_cast<T>(3.8317059702075123156e+00);
+   static constexpr T x2 = static_cast<T>(7.0155866698156187535e+00);
+   static constexpr T x11 = static_cast<T>(9.810e+02);
+   static constexpr T x12 = static_cast<T>(-3.2527979248768438556e-04);
+   static constexpr T x21 = static_cast<T>(1.7960e+03);
+   static constexpr T x22 = static_cast<T>(-3.8330184381246462950e-05);
+   static constexpr std::array<T, 7> P1 = {{
+      -1.4258509801366645672e+11,
+      6.6781041261492395835e+09,
+      -1.1548696764841276794e+08,
+      9.8062904098958257677e+05,
+      -4.4615792982775076130e+03,
+      1.0650724020080236441e+01,
+      -1.0767857011487300348e-02
+   }};
+   static constexpr std::array<T, 7> Q1 = {{
+      4.1868604460820175290e+12,
+      4.2091902282580133541e+10,
+      2.0228375140097033958e+08,
+      5.9117614494174794095e+05,
+      1.0742272239517380498e+03,
+      1.0,
+      0.0
+   }};
+   static constexpr std::array<T, 8> P2 = {{
+      -1.7527881995806511112e+16,
+      1.6608531731299018674e+15,
+      -3.6658018905416665164e+13,
+      3.5580665670910619166e+11,
+      -1.8113931269860667829e+09,
+      5.0793266148011179143e+06,
+      -7.5023342220781607561e+03,
+      4.6179191852758252278e+00
+   }};
+   static constexpr std::array<T, 8> Q2 = {{
+      1.7253905888447681194e+18,
+      1.7128800897135812012e+16,
+      8.4899346165481429307e+13,
+      2.7622777286244082666e+11,
+      6.4872502899596389593e+08,
+      1.1267125065029138050e+06,
+      1.3886978985861357615e+03,
+      1.0
+   }};
+   static constexpr std::array<T, 7> PC = {{
+      -4.4357578167941278571e+06,
+      -9.9422465050776411957e+06,
+      -6.6033732483649391093e+06,
+      -1.5235293511811373833e+06,
+      -1.0982405543459346727e+05,
+      -1.6116166443246101165e+03,
+      0.0
+   }};
+   static constexpr std::array<T, 7> QC = {{
+      -4.4357578167941278568e+06,
+      -9.9341243899345856590e+06,
+      -6.5853394797230870728e+06,
+      -1.5118095066341608816e+06,
+      -1.0726385991103820119e+05,
+      -1.4550094401904961825e+03,
+      1.0
+   }};
+   static constexpr std::array<T, 7> PS = {{
+      3.3220913409857223519e+04,
+      8.5145160675335701966e+04,
+      6.6178836581270835179e+04,
+      1.8494262873223866797e+04,
+      1.7063754290207680021e+03,
+      3.5265133846636032186e+01,
+      0.0
+   }};
+   static constexpr std::array<T, 7> QS = {{
+      7.0871281941028743574e+05,
+      1.8194580422439972989e+06,
+      1.4194606696037208929e+06,
+      4.0029443582266975117e+05,
+      3.7890229745772202641e+04,
+      8.6383677696049909675e+02,
+      1.0
+   }};
+};
+
+template <class T> constexpr std::array<T, 7> bessel_j1_kernel_coefficients<T, 64>::P1;
+template <class T> constexpr std::array<T, 7> bessel_j1_kernel_coefficients<T, 64>::Q1;
+template <class T> constexpr std::array<T, 8> bessel_j1_kernel_coefficients<T, 64>::P2;
+template <class T> constexpr std::array<T, 8> bessel_j1_kernel_coefficients<T, 64>::Q2;
+template <class T> constexpr std::array<T, 7> bessel_j1_kernel_coefficients<T, 64>::PC;
+template <class T> constexpr std::array<T, 7> bessel_j1_kernel_coefficients<T, 64>::QC;
+template <class T> constexpr std::array<T, 7> bessel_j1_kernel_coefficients<T, 64>::PS;
+template <class T> constexpr std::array<T, 7> bessel_j1_kernel_coefficients<T, 64>::QS;
+template <class T> constexpr T bessel_j1_kernel_coefficients<T, 64>::x1;
+template <class T> constexpr T bessel_j1_kernel_coefficients<T, 64>::x2;
+template <class T> constexpr T bessel_j1_kernel_coefficients<T, 64>::x11;
+template <class T> constexpr T bessel_j1_kernel_coefficients<T, 64>::x12;
+template <class T> constexpr T bessel_j1_kernel_coefficients<T, 64>::x21;
+template <class T> constexpr T bessel_j1_kernel_coefficients<T, 64>::x22;
+
+//
+// The approximations from bessel_y0.hpp:
+//
+template <class T>
+struct bessel_y0_kernel_coefficients<T, 64>
+{
+   static constexpr T x1 = static_cast<T>(8.9357696627916752158e-01);
+   static constexpr T x2 = static_cast<T>(3.9576784193148578684e+00);
+   static constexpr T x3 = static_cast<T>(7.0860510603017726976e+00);
+   static constexpr T x11 = static_cast<T>(2.280e+02);
+   static constexpr T x12 = static_cast<T>(2.9519662791675215849e-03);
+   static constexpr T x21 = static_cast<T>(1.0130e+03);
+   static constexpr T x22 = static_cast<T>(6.4716931485786837568e-04);
+   static constexpr T x31 = static_cast<T>(1.8140e+03);
+   static constexpr T x32 = static_cast<T>(1.1356030177269762362e-04);
+   static constexpr std::array<T, 6> P1 = {{
+      1.0723538782003176831e+11,
+      -8.3716255451260504098e+09,
+      2.0422274357376619816e+08,
+      -2.1287548474401797963e+06,
+      1.0102532948020907590e+04,
+      -1.8402381979244993524e+01
+   }};
+   static constexpr std::array<T, 6> Q1 = {{
+      5.8873865738997033405e+11,
+      8.1617187777290363573e+09,
+      5.5662956624278251596e+07,
+      2.3889393209447253406e+05,
+      6.6475986689240190091e+02,
+      1.0
+   }};
+   static constexpr std::array<T, 7> P2 = {{
+      -2.2213976967566192242e+13,
+      -5.5107435206722644429e+11,
+      4.3600098638603061642e+10,
+      -6.9590439394619619534e+08,
+      4.6905288611678631510e+06,
+      -1.4566865832663635920e+04,
+      1.7427031242901594547e+01
+   }};
+   static constexpr std::array<T, 7> Q2 = {{
+      4.3386146580707264428e+14,
+      5.4266824419412347550e+12,
+      3.4015103849971240096e+10,
+      1.3960202770986831075e+08,
+      4.0669982352539552018e+05,
+      8.3030857612070288823e+02,
+      1.0
+   }};
+   static constexpr std::array<T, 8> P3 = {{
+      -8.0728726905150210443e+15,
+      6.7016641869173237784e+14,
+      -1.2829912364088687306e+11,
+      -1.9363051266772083678e+11,
+      2.1958827170518100757e+09,
+      -1.0085539923498211426e+07,
+      2.1363534169313901632e+04,
+      -1.7439661319197499338e+01
+   }};
+   static constexpr std::array<T, 8> Q3 = {{
+      3.4563724628846457519e+17,
+      3.9272425569640309819e+15,
+      2.2598377924042897629e+13,
+      8.6926121104209825246e+10,
+      2.4727219475672302327e+08,
+      5.3924739209768057030e+05,
+      8.7903362168128450017e+02,
+      1.0
+   }};
+   static constexpr std::array<T, 6> PC = {{
+      2.2779090197304684302e+04,
+      4.1345386639580765797e+04,
+      2.1170523380864944322e+04,
+      3.4806486443249270347e+03,
+      1.5376201909008354296e+02,
+      8.8961548424210455236e-01
+   }};
+   static constexpr std::array<T, 6> QC = {{
+      2.2779090197304684318e+04,
+      4.1370412495510416640e+04,
+      2.1215350561880115730e+04,
+      3.5028735138235608207e+03,
+      1.5711159858080893649e+02,
+      1.0
+   }};
+   static constexpr std::array<T, 6> PS = {{
+      -8.9226600200800094098e+01,
+      -1.8591953644342993800e+02,
+      -1.1183429920482737611e+02,
+      -2.2300261666214198472e+01,
+      -1.2441026745835638459e+00,
+      -8.8033303048680751817e-03
+   }};
+   static constexpr std::array<T, 6> QS = {{
+      5.7105024128512061905e+03,
+      1.1951131543434613647e+04,
+      7.2642780169211018836e+03,
+      1.4887231232283756582e+03,
+      9.0593769594993125859e+01,
+      1.0
+   }};
+};
+
+template <class T> constexpr std::array<T, 6> bessel_y0_kernel_coefficients<T, 64>::P1;
+template <class T> constexpr std::array<T, 6> bessel_y0_kernel_coefficients<T, 64>::Q1;
+template <class T> constexpr std::array<T, 7> bessel_y0_kernel_coefficients<T, 64>::P2;
+template <class T> constexpr std::array<T, 7> bessel_y0_kernel_coefficients<T, 64>::Q2;
+template <class T> constexpr std::array<T, 8> bessel_y0_kernel_coefficients<T, 64>::P3;
+template <class T> constexpr std::array<T, 8> bessel_y0_kernel_coefficients<T, 64>::Q3;
+template <class T> constexpr std::array<T, 6> bessel_y0_kernel_coefficients<T, 64>::PC;
+template <class T> constexpr std::array<T, 6> bessel_y0_kernel_coefficients<T, 64>::QC;
+template <class T> constexpr std::array<T, 6> bessel_y0_kernel_coefficients<T, 64>::PS;
+template <class T> constexpr std::array<T, 6> bessel_y0_kernel_coefficients<T, 64>::QS;
+template <class T> constexpr T bessel_y0_kernel_coefficients<T, 64>::x1;
+template <class T> constexpr T bessel_y0_kernel_coefficients<T, 64>::x2;
+template <class T> constexpr T bessel_y0_kernel_coefficients<T, 64>::x3;
+template <class T> constexpr T bessel_y0_kernel_coefficients<T, 64>::x11;
+template <class T> constexpr T bessel_y0_kernel_coefficients<T, 64>::x12;
+template <class T> constexpr T bessel_y0_kernel_coefficients<T, 64>::x21;
+template <class T> constexpr T bessel_y0_kernel_coefficients<T, 64>::x22;
+template <class T> constexpr T bessel_y0_kernel_coefficients<T, 64>::x31;
+template <class T> constexpr T bessel_y0_kernel_coefficients<T, 64>::x32;
+
+//
+// The approximations from bessel_y1.hpp:
+//
+template <class T>
+struct bessel_y1_kernel_coefficients<T, 64>
+{
+   static constexpr T x1 = static_cast<T>(2.1971413260310170351e+00);
+   static constexpr T x2 = static_cast<T>(5.4296810407941351328e+00);
+   static constexpr T x11 = static_cast<T>(5.620e+02);
+   static constexpr T x12 = static_cast<T>(1.8288260310170351490e-03);
+   static constexpr T x21 = static_cast<T>(1.3900e+03);
+   static constexpr T x22 = static_cast<T>(-6.4592058648672279948e-06);
+   static constexpr std::array<T, 7> P1 = {{
+      4.0535726612579544093e+13,
+      5.4708611716525426053e+12,
+      -3.7595974497819597599e+11,
+      7.2144548214502560419e+09,
+      -5.9157479997408395984e+07,
+      2.2157953222280260820e+05,
+      -3.1714424660046133456e+02
+   }};
+   static constexpr std::array<T, 7> Q1 = {{
+      3.0737873921079286084e+14,
+      4.1272286200406461981e+12,
+      2.7800352738690585613e+10,
+      1.2250435122182963220e+08,
+      3.8136470753052572164e+05,
+      8.2079908168393867438e+02,
+      1.0
+   }};
+   static constexpr std::array<T, 9> P2 = {{
+      1.1514276357909013326e+19,
+      -5.6808094574724204577e+18,
+      -2.3638408497043134724e+16,
+      4.0686275289804744814e+15,
+      -5.9530713129741981618e+13,
+      3.7453673962438488783e+11,
+      -1.1957961912070617006e+09,
+      1.9153806858264202986e+06,
+      -1.2337180442012953128e+03
+   }};
+   static constexpr std::array<T, 9> Q2 = {{
+      5.3321844313316185697e+20,
+      5.6968198822857178911e+18,
+      3.0837179548112881950e+16,
+      1.1187010065856971027e+14,
+      3.0221766852960403645e+11,
+      6.3550318087088919566e+08,
+      1.0453748201934079734e+06,
+      1.2855164849321609336e+03,
+      1.0
+   }};
+   static constexpr std::array<T, 7> PC = {{
+      -4.4357578167941278571e+06,
+      -9.9422465050776411957e+06,
+      -6.6033732483649391093e+06,
+      -1.5235293511811373833e+06,
+      -1.0982405543459346727e+05,
+      -1.6116166443246101165e+03,
+      0.0
+   }};
+   static constexpr std::array<T, 7> QC = {{
+      -4.4357578167941278568e+06,
+      -9.9341243899345856590e+06,
+      -6.5853394797230870728e+06,
+      -1.5118095066341608816e+06,
+      -1.0726385991103820119e+05,
+      -1.4550094401904961825e+03,
+      1.0
+   }};
+   static constexpr std::array<T, 7> PS = {{
+      3.3220913409857223519e+04,
+      8.5145160675335701966e+04,
+      6.6178836581270835179e+04,
+      1.8494262873223866797e+04,
+      1.7063754290207680021e+03,
+      3.5265133846636032186e+01,
+      0.0
+   }};
+   static constexpr std::array<T, 7> QS = {{
+      7.0871281941028743574e+05,
+      1.8194580422439972989e+06,
+      1.4194606696037208929e+06,
+      4.0029443582266975117e+05,
+      3.7890229745772202641e+04,
+      8.6383677696049909675e+02,
+      1.0
+   }};
+};
+
+template <class T> constexpr std::array<T, 7> bessel_y1_kernel_coefficients<T, 64>::P1;
+template <class T> constexpr std::array<T, 7> bessel_y1_kernel_coefficients<T, 64>::Q1;
+template <class T> constexpr std::array<T, 9> bessel_y1_kernel_coefficients<T, 64>::P2;
+template <class T> constexpr std::array<T, 9> bessel_y1_kernel_coefficients<T, 64>::Q2;
+template <class T> constexpr std::array<T, 7> bessel_y1_kernel_coefficients<T, 64>::PC;
+template <class T> constexpr std::array<T, 7> bessel_y1_kernel_coefficients<T, 64>::QC;
+template <class T> constexpr std::array<T, 7> bessel_y1_kernel_coefficients<T, 64>::PS;
+template <class T> constexpr std::array<T, 7> bessel_y1_kernel_coefficients<T, 64>::QS;
+template <class T> constexpr T bessel_y1_kernel_coefficients<T, 64>::x1;
+template <class T> constexpr T bessel_y1_kernel_coefficients<T, 64>::x2;
+template <class T> constexpr T bessel_y1_kernel_coefficients<T, 64>::x11;
+template <class T> constexpr T bessel_y1_kernel_coefficients<T, 64>::x12;
+template <class T> constexpr T bessel_y1_kernel_coefficients<T, 64>::x21;
+template <class T> constexpr T bessel_y1_kernel_coefficients<T, 64>::x22;
+
+}}} // namespaces
+
+#endif // BOOST_MATH_SF_DETAIL_CONSTEXPR_KERNEL_COEFFICIENTS_HPP
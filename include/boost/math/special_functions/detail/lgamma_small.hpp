@@ -36,6 +36,137 @@ T gamma_imp(T z, const Policy& pol, const lanczos::undefined_lanczos& l);
 // lgamma for small arguments:
 //
 template <class T, class Policy, class Lanczos>
+T lgamma_small_imp(T z, T zm1, T zm2, const std::integral_constant<int, 24>&, const Policy& /* l */, const Lanczos&)
+{
+   //
+   // This version uses rational approximations of lower degree than
+   // the 64-bit version, accurate enough for 24-bit precision: it's used
+   // for float, and for double when the policy reduces the precision
+   // required.  The forms used are the same as the 64-bit version.
+   //
+   BOOST_MATH_STD_USING  // for ADL of std names
+   T result = 0;
+   if(z < tools::epsilon<T>())
+   {
+      result = -log(z);
+   }
+   else if((zm1 == 0) || (zm2 == 0))
+   {
+      // nothing to do, result is zero....
+   }
+   else if(z > 2)
+   {
+      //
+      // Begin by performing argument reduction until
+      // z is in [2,3):
+      //
+      if(z >= 3)
+      {
+         do
+         {
+            z -= 1;
+            zm2 -= 1;
+            result += log(z);
+         }while(z >= 3);
+         // Update zm2, we need it below:
+         zm2 = z - 2;
+      }
+      //
+      // lgamma(z) = (z-2)(z+1)(Y + R(z-2))
+      //
+      // Maximum Deviation Found (approximation error): 2.166e-10
+      //
+      static const T P[] = {
+         static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, -0.0180355685373145111421)),
+         static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 0.0495197663424524788631)),
+         static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, -0.00715859596715669827856)),
+         static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, -0.000143370451285337173061))
+      };
+      static const T Q[] = {
+         static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 0.1e1)),
+         static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 0.609529098830365564933)),
+         static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 0.0788069608439569276852))
+      };
+
+      static const float Y = 0.158963680267333984375e0f;
+
+      T r = zm2 * (z + 1);
+      T R = tools::evaluate_polynomial(P, zm2);
+      R /= tools::evaluate_polynomial(Q, zm2);
+
+      result +=  r * Y + r * R;
+   }
+   else
+   {
+      //
+      // If z is less than 1 use recurrence to shift to
+      // z in the interval [1,2]:
+      //
+      if(z < 1)
+      {
+         result += -log(z);
+         zm2 = zm1;
+         zm1 = z;
+         z += 1;
+      }
+      //
+      // Two approximations, on for z in [1,1.5] and
+      // one for z in [1.5,2]:
+      //
+      if(z <= 1.5)
+      {
+         //
+         // lgamma(z) = (z-1)(z-2)(Y + R(z-1))
+         //
+         // Maximum Deviation Found:                             1.334e-09
+         //
+         static const float Y = 0.52815341949462890625f;
+
+         static const T P[] = {
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 0.0490622446369907286503)),
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, -0.184728093647627772587)),
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, -0.131326716808453264082)),
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, -0.00226758546510212116028))
+         };
+         static const T Q[] = {
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 0.1e1)),
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 1.2335990964782294503)),
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 0.321726163443645591762))
+         };
+
+         T r = tools::evaluate_polynomial(P, zm1) / tools::evaluate_polynomial(Q, zm1);
+         T prefix = zm1 * zm2;
+
+         result += prefix * Y + prefix * r;
+      }
+      else
+      {
+         //
+         // lgamma(z) = (2-z)(1-z)(Y + R(2-z))
+         //
+         // Maximum Deviation Found:                           6.613e-09
+         //
+         static const float Y = 0.452017307281494140625f;
+
+         static const T P[] = {
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, -0.0292329693873576507946)),
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 0.118437047100026832053)),
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, -0.031563290858111674864))
+         };
+         static const T Q[] = {
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 0.1e1)),
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, -0.619847693117604294861)),
+            static_cast<T>(BOOST_MATH_BIG_CONSTANT(T, 24, 0.0803982745583398650732))
+         };
+         T r = zm2 * zm1;
+         T R = tools::evaluate_polynomial(P, T(-zm2)) / tools::evaluate_polynomial(Q, T(-zm2));
+
+         result += r * Y + r * R;
+      }
+   }
+   return result;
+}
+template <class T, class Policy, class Lanczos>
 T lgamma_small_imp(T z, T zm1, T zm2, const std::integral_constant<int, 64>&, const Policy& /* l */, const Lanczos&)
 {
    // This version uses rational approximations for small
@@ -190,6 +190,175 @@ T erf_imp(T z, bool invert, const Policy& pol, const Tag& t)
    return result;
 }
 
+template <class T, class Policy>
+T erf_imp(T z, bool invert, const Policy& pol, const std::integral_constant<int, 24>& t)
+{
+   BOOST_MATH_STD_USING
+
+   BOOST_MATH_INSTRUMENT_CODE("24-bit precision erf_imp called");
+
+   //
+   // These approximations are of lower degree than the 53-bit ones, and are
+   // used when the policy asks for no more than 24 bits of precision, for
+   // float, or for double when the policy reduces the precision required.
+   //
+   if ((boost::math::isnan)(z))
+      return policies::raise_denorm_error("boost::math::erf<%1%>(%1%)", "Expected a finite argument but got %1%", z, pol);
+
+   if(z < 0)
+   {
+      if(!invert)
+         return -erf_imp(T(-z), invert, pol, t);
+      else if(z < -0.5)
+         return 2 - erf_imp(T(-z), invert, pol, t);
+      else
+         return 1 + erf_imp(T(-z), false, pol, t);
+   }
+
+   T result;
+
+   if(z < 0.5)
+   {
+      //
+      // We're going to calculate erf:
+      //
+      if(z < 1e-10)
+      {
+         if(z == 0)
+         {
+            result = T(0);
+         }
+         else
+         {
+            static const T c = BOOST_MATH_BIG_CONSTANT(T, 24, 0.003379167095512573896158903121545171688);
+            result = static_cast<T>(z * 1.125f + z * c);
+         }
+      }
+      else
+      {
+         // Maximum Deviation Found:                     1.871e-08
+         static const T Y = 1.044948577880859375f;
+         static const T P[] = {
+            BOOST_MATH_BIG_CONSTANT(T, 24, 0.0834306103289210411268),
+            BOOST_MATH_BIG_CONSTANT(T, 24, -0.350738063206632121971),
+         };
+         static const T Q[] = {
+            BOOST_MATH_BIG_CONSTANT(T, 24, 1.0),
+            BOOST_MATH_BIG_CONSTANT(T, 24, 0.304337700474329042008),
+            BOOST_MATH_BIG_CONSTANT(T, 24, 0.0188829207151026133297),
+         };
+         T zz = z * z;
+         result = z * (Y + tools::evaluate_polynomial(P, zz) / tools::evaluate_polynomial(Q, zz));
+      }
+   }
+   else if(invert ? (z < 28) : (z < 4))
+   {
+      //
+      // We'll be calculating erfc:
+      //
+      invert = !invert;
+      if(z < 1.5f)
+      {
+         // Maximum Deviation Found:                     1.295e-08
+         static const T Y = 0.405935764312744140625f;
+         static const T P[] = {
+            BOOST_MATH_BIG_CONSTANT(T, 24, -0.0980905882290680967776),
+            BOOST_MATH_BIG_CONSTANT(T, 24, 0.254362427061603664748),
+            BOOST_MATH_BIG_CONSTANT(T, 24, 0.0200119043000153056341),
+            BOOST_MATH_BIG_CONSTANT(T, 24, 0.00751390787849229236732),
+            BOOST_MATH_BIG_CONSTANT(T, 24, -0.00093124784152813261529),
+         };
+         static const T Q[] = {
+            BOOST_MATH_BIG_CONSTANT(T, 24, 1.0),
+            BOOST_MATH_BIG_CONSTANT(T, 24, 1.07026516352955015672),
+            BOOST_MATH_BIG_CONSTANT(T, 24, 0.321947965858640960568),
+         };
+         result = Y + tools::evaluate_polynomial(P, T(z - 0.5)) / tools::evaluate_polynomial(Q, T(z - 0.5));
+         result *= exp(-z * z) / z;
+      }
+      else
+      {
+         if(z < 2.5f)
+         {
+            // Maximum Deviation Found:                     4.696e-09
+            static const T Y = 0.50672817230224609375f;
+            static const T P[] = {
+               BOOST_MATH_BIG_CONSTANT(T, 24, -0.0243500453556831554406),
+               BOOST_MATH_BIG_CONSTANT(T, 24, 0.0561372253086449803063),
+               BOOST_MATH_BIG_CONSTANT(T, 24, 0.00878715699207999283785),
+            };
+            static const T Q[] = {
+               BOOST_MATH_BIG_CONSTANT(T, 24, 1.0),
+               BOOST_MATH_BIG_CONSTANT(T, 24, 0.821912086918387031656),
+               BOOST_MATH_BIG_CONSTANT(T, 24, 0.181076328252008271879),
+               BOOST_MATH_BIG_CONSTANT(T, 24, -0.00304478939183255319581),
+            };
+            result = Y + tools::evaluate_polynomial(P, T(z - 1.5)) / tools::evaluate_polynomial(Q, T(z - 1.5));
+         }
+         else if(z < 4.5f)
+         {
+            // Maximum Deviation Found:                     5.430e-09
+            static const T Y = 0.5405750274658203125f;
+            static const T P[] = {
+               BOOST_MATH_BIG_CONSTANT(T, 24, 0.00295276612855209660378),
+               BOOST_MATH_BIG_CONSTANT(T, 24, 0.0121056672770022980507),
+               BOOST_MATH_BIG_CONSTANT(T, 24, 0.00138789814547976355354),
+            };
+            static const T Q[] = {
+               BOOST_MATH_BIG_CONSTANT(T, 24, 1.0),
+               BOOST_MATH_BIG_CONSTANT(T, 24, 0.489208372014233150359),
+               BOOST_MATH_BIG_CONSTANT(T, 24, 0.0616268823293117125288),
+               BOOST_MATH_BIG_CONSTANT(T, 24, -0.000259228412734814882811),
+            };
+            result = Y + tools::evaluate_polynomial(P, T(z - 3.5)) / tools::evaluate_polynomial(Q, T(z - 3.5));
+         }
+         else
+         {
+            // Maximum Deviation Found:                     1.421e-09
+            static const T Y = 0.5579090118408203125f;
+            static const T P[] = {
+               BOOST_MATH_BIG_CONSTANT(T, 24, 0.00628070023468030268821),
+               BOOST_MATH_BIG_CONSTANT(T, 24, -0.000209129370631480731839),
+               BOOST_MATH_BIG_CONSTANT(T, 24, -0.27150212519388758612),
+            };
+            static const T Q[] = {
+               BOOST_MATH_BIG_CONSTANT(T, 24, 1.0),
+               BOOST_MATH_BIG_CONSTANT(T, 24, -0.0317321415506012058367),
+               BOOST_MATH_BIG_CONSTANT(T, 24, 1.63934468492700107198),
+               BOOST_MATH_BIG_CONSTANT(T, 24, -0.694683687950793683728),
+            };
+            result = Y + tools::evaluate_polynomial(P, T(1 / z)) / tools::evaluate_polynomial(Q, T(1 / z));
+         }
+         //
+         // Split z so that z*z is computed exactly even when T is float:
+         //
+         T hi, lo;
+         int expon;
+         hi = floor(ldexp(frexp(z, &expon), 12));
+         hi = ldexp(hi, expon - 12);
+         lo = z - hi;
+         T sq = z * z;
+         T err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
+         result *= exp(-sq) * exp(-err_sqr) / z;
+      }
+   }
+   else
+   {
+      //
+      // Any value of z larger than 28 will underflow to zero:
+      //
+      result = 0;
+      invert = !invert;
+   }
+
+   if(invert)
+   {
+      result = 1 - result;
+   }
+
+   return result;
+} // template <class T, class Lanczos>T erf_imp(T z, bool invert, const Lanczos& l, const std::integral_constant<int, 24>& t)
+
 template <class T, class Policy>
 T erf_imp(T z, bool invert, const Policy& pol, const std::integral_constant<int, 53>& t)
 {
@@ -1130,6 +1299,15 @@ struct erf_initializer
          do_init(tag());
       }
       static void do_init(const std::integral_constant<int, 0>&){}
+      static void do_init(const std::integral_constant<int, 24>&)
+      {
+         boost::math::erf(static_cast<T>(1e-12), Policy());
+         boost::math::erf(static_cast<T>(0.25), Policy());
+         boost::math::erf(static_cast<T>(1.25), Policy());
+         boost::math::erf(static_cast<T>(2.25), Policy());
+         boost::math::erf(static_cast<T>(3.25), Policy());
+         boost::math::erf(static_cast<T>(5.25), Policy());
+      }
       static void do_init(const std::integral_constant<int, 53>&)
       {
          boost::math::erf(static_cast<T>(1e-12), Policy());
@@ -1194,6 +1372,7 @@ inline typename tools::promote_args<T>::type erf(T z, const Policy& /* pol */)
 
    typedef std::integral_constant<int,
       precision_type::value <= 0 ? 0 :
+      precision_type::value <= 24 ? 24 :
       precision_type::value <= 53 ? 53 :
       precision_type::value <= 64 ? 64 :
       precision_type::value <= 113 ? 113 : 0
@@ -1229,6 +1408,7 @@ inline typename tools::promote_args<T>::type erfc(T z, const Policy& /* pol */)
 
    typedef std::integral_constant<int,
       precision_type::value <= 0 ? 0 :
+      precision_type::value <= 24 ? 24 :
       precision_type::value <= 53 ? 53 :
       precision_type::value <= 64 ? 64 :
       precision_type::value <= 113 ? 113 : 0
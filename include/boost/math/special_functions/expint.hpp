@@ -48,6 +48,65 @@ inline T expint_1_rational(const T& z, const std::integral_constant<int, 0>&)
    return z;
 }
 
+template <class T>
+T expint_1_rational(const T& z, const std::integral_constant<int, 24>&)
+{
+   BOOST_MATH_STD_USING
+   T result;
+   //
+   // These are of lower degree than the 53-bit approximations, and are
+   // used for float, or for double when the policy reduces the precision
+   // required.  The forms used are the same as the 53-bit version.
+   //
+   if(z <= 1)
+   {
+      // Maximum Deviation Found:                     5.771e-09
+      static const T Y = 0.66373538970947265625F;
+      static const T P[4] = {    
+         BOOST_MATH_BIG_CONSTANT(T, 24, 0.0865197305794100229268),
+         BOOST_MATH_BIG_CONSTANT(T, 24, 0.0312552742386369227756),
+         BOOST_MATH_BIG_CONSTANT(T, 24, -0.246634646000458218367),
+         BOOST_MATH_BIG_CONSTANT(T, 24, -0.0347836917497946841129)
+      };
+      static const T Q[3] = {    
+         BOOST_MATH_BIG_CONSTANT(T, 24, 1.0),
+         BOOST_MATH_BIG_CONSTANT(T, 24, 0.361255369340014296551),
+         BOOST_MATH_BIG_CONSTANT(T, 24, 0.0388335452146669375572)
+      };
+      result = tools::evaluate_polynomial(P, z) 
+         / tools::evaluate_polynomial(Q, z);
+      result += z - log(z) - Y;
+   }
+   else if(z < -boost::math::tools::log_min_value<T>())
+   {
+      // Maximum Deviation Found:                     3.499e-09
+      static const T P[6] = {    
+         BOOST_MATH_BIG_CONSTANT(T, 24, -0.349944019778122749159e-8),
+         BOOST_MATH_BIG_CONSTANT(T, 24, -0.999998227403131769383),
+         BOOST_MATH_BIG_CONSTANT(T, 24, -9.25984630162709849374),
+         BOOST_MATH_BIG_CONSTANT(T, 24, -20.6002697111693891284),
+         BOOST_MATH_BIG_CONSTANT(T, 24, -9.90519277059380915147),
+         BOOST_MATH_BIG_CONSTANT(T, 24, -0.0800101432313523551447)
+      };
+      static const T Q[5] = {    
+         BOOST_MATH_BIG_CONSTANT(T, 24, 1.0),
+         BOOST_MATH_BIG_CONSTANT(T, 24, 11.2596644984868226106),
+         BOOST_MATH_BIG_CONSTANT(T, 24, 37.1272118242682320743),
+         BOOST_MATH_BIG_CONSTANT(T, 24, 40.4209483984230192619),
+         BOOST_MATH_BIG_CONSTANT(T, 24, 11.3814484564265752035)
+      };
+      T recip = 1 / z;
+      result = 1 + tools::evaluate_polynomial(P, recip)
+         / tools::evaluate_polynomial(Q, recip);
+      result *= exp(-z) * recip;
+   }
+   else
+   {
+      result = 0;
+   }
+   return result;
+}
+
 template <class T>
 T expint_1_rational(const T& z, const std::integral_constant<int, 53>&)
 {
@@ -524,6 +583,18 @@ T expint_i_imp(T z, const Policy& pol, const Tag& tag)
    return expint_i_as_series(z, pol);
 }
 
+template <class T, class Policy>
+T expint_i_imp(T z, const Policy& pol, const std::integral_constant<int, 24>& tag)
+{
+   //
+   // There are no separate 24-bit approximations for Ei, the 53-bit ones
+   // are used, but negative z still goes to the lower degree E1 above:
+   //
+   if(z < 0)
+      return -expint_imp(1, T(-z), pol, tag);
+   return expint_i_imp(z, pol, std::integral_constant<int, 53>());
+}
+
 template <class T, class Policy>
 T expint_i_imp(T z, const Policy& pol, const std::integral_constant<int, 53>& tag)
 {
@@ -1496,6 +1567,14 @@ struct expint_i_initializer
          do_init(tag());
       }
       static void do_init(const std::integral_constant<int, 0>&){}
+      static void do_init(const std::integral_constant<int, 24>&)
+      {
+         boost::math::expint(T(5), Policy());
+         boost::math::expint(T(7), Policy());
+         boost::math::expint(T(18), Policy());
+         boost::math::expint(T(38), Policy());
+         boost::math::expint(T(45), Policy());
+      }
       static void do_init(const std::integral_constant<int, 53>&)
       {
          boost::math::expint(T(5), Policy());
@@ -1546,6 +1625,11 @@ struct expint_1_initializer
          do_init(tag());
       }
       static void do_init(const std::integral_constant<int, 0>&){}
+      static void do_init(const std::integral_constant<int, 24>&)
+      {
+         boost::math::expint(1, T(0.5), Policy());
+         boost::math::expint(1, T(2), Policy());
+      }
       static void do_init(const std::integral_constant<int, 53>&)
       {
          boost::math::expint(1, T(0.5), Policy());
@@ -1589,6 +1673,7 @@ inline typename tools::promote_args<T>::type
       policies::assert_undefined<> >::type forwarding_policy;
    typedef std::integral_constant<int,
       precision_type::value <= 0 ? 0 :
+      precision_type::value <= 24 ? 24 :
       precision_type::value <= 53 ? 53 :
       precision_type::value <= 64 ? 64 :
       precision_type::value <= 113 ? 113 : 0
@@ -1626,6 +1711,7 @@ inline typename tools::promote_args<T>::type
       policies::assert_undefined<> >::type forwarding_policy;
    typedef std::integral_constant<int,
       precision_type::value <= 0 ? 0 :
+      precision_type::value <= 24 ? 24 :
       precision_type::value <= 53 ? 53 :
       precision_type::value <= 64 ? 64 :
       precision_type::value <= 113 ? 113 : 0
@@ -163,6 +163,15 @@ T gamma_imp(T z, const Policy& pol, const Lanczos& l)
    }
    else
    {
+      if((Lanczos::value <= 24) && (z < 1))
+      {
+         //
+         // The float precision approximation loses accuracy as z -> 0
+         // (over 100 epsilon), so shift into [1,2] first:
+         //
+         result /= z;
+         z += 1;
+      }
       result *= Lanczos::lanczos_sum(z);
       T zgh = (z + static_cast<T>(Lanczos::g()) - boost::math::constants::half<T>());
       T lzgh = log(zgh);
@@ -249,6 +258,7 @@ T lgamma_imp(T z, const Policy& pol, const Lanczos& l, int* sign = 0)
       typedef typename policies::precision<T, Policy>::type precision_type;
       typedef std::integral_constant<int,
          precision_type::value <= 0 ? 0 :
+         precision_type::value <= 24 ? 24 :
          precision_type::value <= 64 ? 64 :
          precision_type::value <= 113 ? 113 : 0
       > tag_type;
@@ -727,6 +737,7 @@ T tgammap1m1_imp(T dz, Policy const& pol, const Lanczos& l)
 
    typedef std::integral_constant<int,
       precision_type::value <= 0 ? 0 :
+      precision_type::value <= 24 ? 24 :
       precision_type::value <= 64 ? 64 :
       precision_type::value <= 113 ? 113 : 0
    > tag_type;
@@ -1445,6 +1456,7 @@ T gamma_incomplete_imp(T a, T x, bool normalised, bool invert,
 
          typedef std::integral_constant<int,
             precision_type::value <= 0 ? 0 :
+            precision_type::value <= 24 ? 24 :
             precision_type::value <= 53 ? 53 :
             precision_type::value <= 64 ? 64 :
             precision_type::value <= 113 ? 113 : 0
@@ -1835,6 +1847,7 @@ struct igamma_initializer
 
          typedef std::integral_constant<int,
             precision_type::value <= 0 ? 0 :
+            precision_type::value <= 24 ? 24 :
             precision_type::value <= 53 ? 53 :
             precision_type::value <= 64 ? 64 :
             precision_type::value <= 113 ? 113 : 0
@@ -1877,12 +1890,19 @@ struct lgamma_initializer
          typedef typename policies::precision<T, Policy>::type precision_type;
          typedef std::integral_constant<int,
             precision_type::value <= 0 ? 0 :
+            precision_type::value <= 24 ? 24 :
             precision_type::value <= 64 ? 64 :
             precision_type::value <= 113 ? 113 : 0
          > tag_type;
 
          do_init(tag_type());
       }
+      static void do_init(const std::integral_constant<int, 24>&)
+      {
+         boost::math::lgamma(static_cast<T>(2.5), Policy());
+         boost::math::lgamma(static_cast<T>(1.25), Policy());
+         boost::math::lgamma(static_cast<T>(1.75), Policy());
+      }
       static void do_init(const std::integral_constant<int, 64>&)
       {
          boost::math::lgamma(static_cast<T>(2.5), Policy());
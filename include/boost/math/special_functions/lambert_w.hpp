@@ -68,6 +68,9 @@ BOOST_MATH_INSTRUMENT_LAMBERT_W_SMALL_Z_SERIES_ITERATIONS  // Show evaluation of
 #include <exception>
 #include <type_traits>
 #include <cstdint>
+#include <vector>
+#include <iterator>
+#include <algorithm>
 
 // Needed for testing and diagnostics only.
 #include <iostream>
@@ -2030,6 +2033,135 @@ T lambert_wm1_imp(const T z, const Policy&  pol)
 //      } // Schroeder or Schroeder and Halley.
     }
   } // template<typename T = double> T lambert_wm1_imp(const T z)
+
+// Batched evaluation
+// ==============================================================================================
+//
+// W-1 at float and double precision is mostly computed from a lookup table followed by a number of
+// bisection steps and a Schroeder update: that can all be done without branches, so arguments in the
+// range covered by the table are separated out and evaluated a block at a time by code which the
+// compiler can vectorize.  Everything else goes through the scalar code.
+//
+// W0 is evaluated one argument at a time: sorting the arguments by the region of the approximation
+// used, so that every lane in a loop takes the same path, costs rather more than the branch
+// mispredictions it saves.
+//
+// Either way the results are identical to those returned by the scalar functions.
+//
+
+//! Lambert W-1 of z[0..n), where every z lies in the range [-0.35, wm1zs[63]) covered by the lookup table,
+//! and T has no more precision than double.  This is the scalar algorithm recast without branches:
+//! a binary search of fixed length locates the integer part of W-1 in the table,
+//! and every lane performs the same number of bisection steps, discarding those it doesn't need.
+//! Each step is a separate loop over a block of lanes, so that the compiler can vectorize it.
+template <typename T>
+void lambert_wm1_lookup_batch(const T* z, T* w, std::size_t n)
+{
+   using namespace boost::math::lambert_w_detail::lambert_w_lookup;
+   using calc_type = typename std::conditional<std::is_constructible<lookup_t, T>::value, lookup_t, T>::type;
+   static_assert(noof_wm1zs == 64, "The binary search below assumes 64 table entries.");
+   const std::size_t block_size = 64;
+   int k[block_size], bisections[block_size];
+   calc_type wk[block_size], y[block_size];
+
+   for (std::size_t first = 0; first < n; first += block_size)
+   {
+      const std::size_t m = (std::min)(block_size, n - first);
+      const T* zb = z + first;
+      // k = number of table entries <= z, this is the same bracket as the scalar search finds:
+      for (std::size_t i = 0; i < m; ++i)
+      {
+         k[i] = 0;
+      }
+      for (int h = 32; h != 0; h /= 2)
+      {
+         for (std::size_t i = 0; i < m; ++i)
+         {
+            k[i] += (wm1zs[k[i] + h - 1] <= zb[i]) ? h : 0;
+         }
+      }
+      for (std::size_t i = 0; i < m; ++i)
+      {
+         bisections[i] = (k[i] >= 8) ? 8 : (k[i] >= 3) ? 9 : (k[i] >= 2) ? 10 : 11;
+         wk[i] = -static_cast<calc_type>(k[i]);
+         y[i] = static_cast<calc_type>(zb[i] * wm1es[k[i] - 1]);
+      }
+      for (int j = 0; j < 11; ++j)
+      {
+         for (std::size_t i = 0; i < m; ++i)
+         {
+            const calc_type wj = wk[i] - halves[j];
+            const calc_type yj = y[i] * sqrtwm1s[j];
+            const bool take = (j < bisections[i]) && (wj < yj);
+            wk[i] = take ? wj : wk[i];
+            y[i] = take ? yj : y[i];
+         }
+      }
+      for (std::size_t i = 0; i < m; ++i)
+      {
+         w[first + i] = static_cast<T>(schroeder_update(wk[i], y[i]));
+      }
+   }
+}
+
+//! Lambert W-1 of z[0..n) for types with more precision than double, or which
+//! don't convert to double: the scalar code uses Halley iteration here, so there's nothing to batch.
+template <typename T, typename Policy>
+void lambert_wm1_batch_imp(const T* z, T* w, std::size_t n, const Policy& pol, const std::false_type&)
+{
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      w[i] = lambert_wm1_imp(z[i], pol);
+   }
+}
+
+//! Lambert W-1 of z[0..n) for float and double precision.
+template <typename T, typename Policy>
+void lambert_wm1_batch_imp(const T* z, T* w, std::size_t n, const Policy& pol, const std::true_type&)
+{
+   using lambert_w_lookup::wm1zs;
+   const std::size_t block_size = 1024;
+   std::vector<unsigned short> table_index((std::min)(n, block_size)), other_index(table_index.size());
+   std::vector<T> zs(table_index.size()), ws(table_index.size());
+
+   for (std::size_t first = 0; first < n; first += block_size)
+   {
+      const std::size_t m = (std::min)(block_size, n - first);
+      const T* zb = z + first;
+      T* wb = w + first;
+      // Branch free partition of the indexes into those which the table covers, and the rest:
+      std::size_t table_count = 0;
+      std::size_t other_count = 0;
+      for (std::size_t i = 0; i < m; ++i)
+      {
+         const bool table = !(zb[i] < static_cast<T>(-0.35)) && (zb[i] < wm1zs[63]);
+         table_index[table_count] = static_cast<unsigned short>(i);
+         other_index[other_count] = static_cast<unsigned short>(i);
+         table_count += table;
+         other_count += !table;
+      }
+      if (table_count == m)
+      {
+         // The usual case, no need to gather and scatter:
+         lambert_wm1_lookup_batch(zb, wb, m);
+         continue;
+      }
+      for (std::size_t j = 0; j < table_count; ++j)
+      {
+         zs[j] = zb[table_index[j]];
+      }
+      lambert_wm1_lookup_batch(zs.data(), ws.data(), table_count);
+      for (std::size_t j = 0; j < table_count; ++j)
+      {
+         wb[table_index[j]] = ws[j];
+      }
+      for (std::size_t j = 0; j < other_count; ++j)
+      {
+         wb[other_index[j]] = lambert_wm1_imp(zb[other_index[j]], pol);
+      }
+   }
+}
+
 } // namespace lambert_w_detail
 
 /////////////////////////////  User Lambert w functions. //////////////////////////////
@@ -2105,6 +2237,52 @@ T lambert_wm1_imp(const T z, const Policy&  pol)
     return lambert_w_detail::lambert_wm1_imp(result_type(z), policies::policy<>());
   } // lambert_wm1(T z)
 
+  //! Batched Lambert W0 and W-1: evaluates the function at each value in [first, last) and writes the results to out.
+  //! The results are the same as those from calling the scalar function on each value.
+  template <typename InputIterator, typename OutputIterator, typename Policy>
+  inline OutputIterator lambert_w0(InputIterator first, InputIterator last, OutputIterator out, const Policy& pol)
+  {
+    using result_type = typename tools::promote_args<typename std::iterator_traits<InputIterator>::value_type>::type;
+    using precision_type = typename policies::precision<result_type, Policy>::type;
+    using tag_type = std::integral_constant<int,
+      (precision_type::value == 0) || (precision_type::value > 53) ?
+      0  // either variable precision (0), or greater than 64-bit precision.
+      : (precision_type::value <= 24) ? 1 // 32-bit (probably float) precision.
+      : 2  // 64-bit (probably double) precision.
+    >;
+    for (; first != last; ++first, ++out)
+    {
+      *out = lambert_w_detail::lambert_w0_imp(result_type(*first), pol, tag_type());
+    }
+    return out;
+  }
+
+  template <typename InputIterator, typename OutputIterator>
+  inline OutputIterator lambert_w0(InputIterator first, InputIterator last, OutputIterator out)
+  {
+    return lambert_w0(first, last, out, policies::policy<>());
+  }
+
+  template <typename InputIterator, typename OutputIterator, typename Policy>
+  inline OutputIterator lambert_wm1(InputIterator first, InputIterator last, OutputIterator out, const Policy& pol)
+  {
+    using result_type = typename tools::promote_args<typename std::iterator_traits<InputIterator>::value_type>::type;
+    // Only float and double precision have a batched code path (see lambert_wm1_imp):
+    using tag_type = std::integral_constant<bool,
+      std::numeric_limits<result_type>::is_specialized && (std::numeric_limits<result_type>::digits <= 53)
+      && std::is_constructible<::lookup_t, result_type>::value>;
+    std::vector<result_type> z(first, last);
+    std::vector<result_type> w(z.size());
+    lambert_w_detail::lambert_wm1_batch_imp(z.data(), w.data(), z.size(), pol, tag_type());
+    return std::copy(w.begin(), w.end(), out);
+  }
+
+  template <typename InputIterator, typename OutputIterator>
+  inline OutputIterator lambert_wm1(InputIterator first, InputIterator last, OutputIterator out)
+  {
+    return lambert_wm1(first, last, out, policies::policy<>());
+  }
+
   // First derivative of Lambert W0 and W-1.
   template <typename T, typename Policy>
   inline typename tools::promote_args<T>::type
@@ -3218,7 +3218,12 @@ struct lanczos
    static constexpr auto target_precision = policies::precision<Real, Policy>::type::value <= 0 ? (std::numeric_limits<int>::max)()-2 : 
                                                                                                    policies::precision<Real, Policy>::type::value;
 
-   using type = typename std::conditional<(target_precision <= lanczos6m24::value), lanczos6m24, 
+   //
+   // lanczos6m24 loses accuracy for small arguments, which is tolerable when evaluating
+   // in float, but not when a policy asks for 24-bit precision from a wider type:
+   // in that case we use the double precision approximation instead.
+   //
+   using type = typename std::conditional<(target_precision <= lanczos6m24::value) && (std::numeric_limits<Real>::digits <= lanczos6m24::value), lanczos6m24, 
                 typename std::conditional<(target_precision <= lanczos13m53::value), lanczos13m53,
                 typename std::conditional<(target_precision <= lanczos11::value), lanczos11,
                 typename std::conditional<(target_precision <= lanczos17m64::value), lanczos17m64,
@@ -183,12 +183,13 @@ ReturnType first_four_moments_parallel_impl(ForwardIterator first, ForwardIterat
         const Real delta = M1_b - M1_a;
         
         M1_a = (range_a * M1_a + range_b * M1_b) / n_ab;
-        M2_a = M2_a + M2_b + delta * delta * (range_a * range_b / n_ab);
-        M3_a = M3_a + M3_b + (delta * delta * delta) * range_a * range_b * (range_a - range_b) / (n_ab * n_ab)    
-               + Real(3) * delta * (range_a * M2_b - range_b * M2_a) / n_ab;
+        // M4 depends on the old M2 and M3, and M3 on the old M2:
         M4_a = M4_a + M4_b + (delta * delta * delta * delta) * range_a * range_b * (range_a * range_a - range_a * range_b + range_b * range_b) / (n_ab * n_ab * n_ab)
                + Real(6) * delta * delta * (range_a * range_a * M2_b + range_b * range_b * M2_a) / (n_ab * n_ab) 
                + Real(4) * delta * (range_a * M3_b - range_b * M3_a) / n_ab;
+        M3_a = M3_a + M3_b + (delta * delta * delta) * range_a * range_b * (range_a - range_b) / (n_ab * n_ab)    
+               + Real(3) * delta * (range_a * M2_b - range_b * M2_a) / n_ab;
+        M2_a = M2_a + M2_b + delta * delta * (range_a * range_b / n_ab);
         range_a = n_ab;
     }
 
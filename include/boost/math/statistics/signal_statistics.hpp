@@ -7,190 +7,580 @@
 #define BOOST_MATH_TOOLS_SIGNAL_STATISTICS_HPP
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 #include <boost/math/tools/assert.hpp>
 #include <boost/math/tools/complex.hpp>
+#include <boost/math/tools/norms.hpp>
 #include <boost/math/tools/roots.hpp>
 #include <boost/math/statistics/univariate_statistics.hpp>
 
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+#include <execution>
+#include <future>
+#include <thread>
+#endif
 
 namespace boost::math::statistics {
 
-template<class ForwardIterator>
-auto absolute_gini_coefficient(ForwardIterator first, ForwardIterator last)
+namespace detail {
+
+// |x|, except that unsigned integers are their own magnitude:
+template<class T>
+inline auto signal_magnitude(T const & x)
 {
-    using std::abs;
-    using RealOrComplex = typename std::iterator_traits<ForwardIterator>::value_type;
-    BOOST_MATH_ASSERT_MSG(first != last && std::next(first) != last, "Computation of the Gini coefficient requires at least two samples.");
+    if constexpr (std::is_unsigned<T>::value)
+    {
+        return x;
+    }
+    else
+    {
+        using std::abs;
+        return abs(x);
+    }
+}
 
+// Below this length, the histograms of the radix sort cost more than std::sort:
+constexpr std::size_t radix_sort_min = 2048;
+
+// Sorts v[0], ..., v[n-1], which are floats or doubles, into increasing order of magnitude, using scratch for n more values.
+// With the sign bit cleared, the bit patterns of IEEE numbers read as unsigned integers are in the order of their magnitudes,
+// so they can be sorted by a least significant digit radix sort, in O(n) operations; the digits which all the values share are skipped.
+template<class Real>
+void magnitude_radix_sort(Real* v, std::size_t n, Real* scratch)
+{
+    static_assert(std::numeric_limits<Real>::is_iec559 && (sizeof(Real) == 4 || sizeof(Real) == 8), "The radix sort requires IEEE floats or doubles.");
+    using Bits = typename std::conditional<sizeof(Real) == 4, std::uint32_t, std::uint64_t>::type;
+    constexpr unsigned digit_bits = 11;
+    constexpr std::size_t radix = std::size_t(1) << digit_bits;
+    constexpr unsigned digits = (8*sizeof(Real) - 1 + digit_bits - 1)/digit_bits;
+    constexpr Bits magnitude_mask = (std::numeric_limits<Bits>::max)() >> 1;
+    auto key = [](Real const & x) {
+        Bits b;
+        std::memcpy(&b, &x, sizeof(Real));
+        return b & magnitude_mask;
+    };
+    // The histograms of all the digits are computed in one pass:
+    std::vector<std::size_t> counts(digits*radix, 0);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        Bits b = key(v[i]);
+        for (unsigned d = 0; d < digits; ++d)
+        {
+            ++counts[d*radix + ((b >> (d*digit_bits)) & (radix - 1))];
+        }
+    }
+    Real* from = v;
+    Real* to = scratch;
+    for (unsigned d = 0; d < digits; ++d)
+    {
+        std::size_t* c = counts.data() + d*radix;
+        const unsigned shift = d*digit_bits;
+        if (c[(key(from[0]) >> shift) & (radix - 1)] == n)
+        {
+            continue;
+        }
+        std::size_t offset = 0;
+        for (std::size_t k = 0; k < radix; ++k)
+        {
+            std::size_t count = c[k];
+            c[k] = offset;
+            offset += count;
+        }
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            to[c[(key(from[i]) >> shift) & (radix - 1)]++] = from[i];
+        }
+        std::swap(from, to);
+    }
+    if (from != v)
+    {
+        std::copy(from, from + n, v);
+    }
+}
+
+template<class T>
+constexpr bool is_magnitude_radix_sortable_v = std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8);
+
+// Sorts [first, last) into increasing order of magnitude.
+template<class RandomAccessIterator>
+void sort_by_magnitude(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using std::abs;
+    using RealOrComplex = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+    if constexpr (is_magnitude_radix_sortable_v<RealOrComplex>)
+    {
+        if (n >= radix_sort_min)
+        {
+            std::vector<RealOrComplex> v(first, last);
+            std::vector<RealOrComplex> scratch(n);
+            magnitude_radix_sort(v.data(), n, scratch.data());
+            std::copy(v.begin(), v.end(), first);
+            return;
+        }
+    }
     std::sort(first, last,  [](RealOrComplex a, RealOrComplex b) { return abs(b) > abs(a); });
+}
 
+// The l1 norm and the square of the l2 norm of the data, and the number of samples.
+template<class Real>
+struct hoyer_sums
+{
+    Real l1;
+    Real l2;
+    std::size_t n;
+};
 
-    decltype(abs(*first)) i = 1;
-    decltype(abs(*first)) num = 0;
-    decltype(abs(*first)) denom = 0;
+template<class Real>
+inline void hoyer_add(hoyer_sums<Real> & a, hoyer_sums<Real> const & b)
+{
+    a.l1 += b.l1;
+    a.l2 += b.l2;
+    a.n += b.n;
+}
+
+// The sums of f(i) and f(i)^2 for 0 <= i < n, where f(i) >= 0, in blocks of independent partial sums as in tools/norms.hpp.
+template<class Real, class F>
+hoyer_sums<Real> hoyer_accumulate(std::size_t n, F f)
+{
+    using boost::math::tools::detail::norms_block;
+    using boost::math::tools::detail::norms_lanes;
+    hoyer_sums<Real> total{0, 0, n};
+    for (std::size_t start = 0; start < n; start += norms_block)
+    {
+        const std::size_t end = (std::min)(n, start + norms_block);
+        std::array<Real, norms_lanes> l1{};
+        std::array<Real, norms_lanes> l2{};
+        std::size_t i = start;
+        for (; i + norms_lanes <= end; i += norms_lanes)
+        {
+            for (std::size_t l = 0; l < norms_lanes; ++l)
+            {
+                Real tmp = f(i + l);
+                l1[l] += tmp;
+                l2[l] += tmp*tmp;
+            }
+        }
+        Real sum1 = 0;
+        Real sum2 = 0;
+        for (; i < end; ++i)
+        {
+            Real tmp = f(i);
+            sum1 += tmp;
+            sum2 += tmp*tmp;
+        }
+        for (std::size_t l = 0; l < norms_lanes; ++l)
+        {
+            sum1 += l1[l];
+            sum2 += l2[l];
+        }
+        total.l1 += sum1;
+        total.l2 += sum2;
+    }
+    return total;
+}
+
+template<class ForwardIterator>
+auto hoyer_sums_of(ForwardIterator first, ForwardIterator last)
+{
+    using T = typename std::iterator_traits<ForwardIterator>::value_type;
+    using Real = decltype(signal_magnitude(*first));
+    if constexpr (boost::math::tools::detail::is_native_real_or_complex<T>::value && boost::math::tools::detail::is_random_access_v<ForwardIterator>)
+    {
+        using std::abs;
+        return hoyer_accumulate<Real>(static_cast<std::size_t>(std::distance(first, last)), [first](std::size_t i) { return abs(first[i]); });
+    }
+    else
+    {
+        hoyer_sums<Real> sums{0, 0, 0};
+        for (auto it = first; it != last; ++it)
+        {
+            Real tmp = signal_magnitude(*it);
+            sums.l1 += tmp;
+            sums.l2 += tmp*tmp;
+            sums.n += 1;
+        }
+        return sums;
+    }
+}
+
+// The Hoyer sparsity measure is defined in:
+// https://arxiv.org/pdf/0811.4706.pdf
+template<class T, class Real>
+auto hoyer_sparsity_from_sums(hoyer_sums<Real> const & sums)
+{
+    using std::sqrt;
+    if constexpr (std::is_integral<T>::value)
+    {
+        double rootn = sqrt(static_cast<double>(sums.n));
+        return (rootn - sums.l1/sqrt(sums.l2))/(rootn - 1);
+    }
+    else
+    {
+        Real rootn = sqrt(static_cast<Real>(sums.n));
+        return (rootn - sums.l1/sqrt(sums.l2))/(rootn - 1);
+    }
+}
+
+// For data sorted by magnitude, the sum of i|x_i| for 1 <= i <= n, the sum of |x_i|, and n.
+template<class Real>
+struct gini_sums
+{
+    Real num;
+    Real denom;
+    Real n;
+};
+
+template<class Real, class ForwardIterator, class F>
+gini_sums<Real> gini_accumulate(ForwardIterator first, ForwardIterator last, F magnitude)
+{
+    Real i = 1;
+    Real num = 0;
+    Real denom = 0;
     for (auto it = first; it != last; ++it)
     {
-        decltype(abs(*first)) tmp = abs(*it);
+        Real tmp = magnitude(*it);
         num += tmp*i;
         denom += tmp;
         ++i;
     }
+    return {num, denom, i - 1};
+}
 
-    // If the l1 norm is zero, all elements are zero, so every element is the same.
-    if (denom == 0)
+// The sums of the pieces of a sorted range, in order:
+template<class Real>
+gini_sums<Real> gini_combine(std::vector<gini_sums<Real>> const & pieces)
+{
+    gini_sums<Real> total = pieces[0];
+    for (std::size_t k = 1; k < pieces.size(); ++k)
     {
-        decltype(abs(*first)) zero = 0;
-        return zero;
+        // The ranks within the piece are offset by the number of samples before it:
+        total.num += pieces[k].num + total.n*pieces[k].denom;
+        total.denom += pieces[k].denom;
+        total.n += pieces[k].n;
     }
-    return ((2*num)/denom - i)/(i-1);
+    return total;
 }
 
-template<class RandomAccessContainer>
-inline auto absolute_gini_coefficient(RandomAccessContainer & v)
+template<class Real>
+Real gini_from_sums(gini_sums<Real> const & sums)
 {
-    return boost::math::statistics::absolute_gini_coefficient(v.begin(), v.end());
+    // If the l1 norm is zero, all elements are zero, so every element is the same.
+    if (sums.denom == 0)
+    {
+        Real zero = 0;
+        return zero;
+    }
+    Real i = sums.n + 1;
+    return ((2*sums.num)/sums.denom - i)/(i-1);
 }
 
-template<class ForwardIterator>
-auto sample_absolute_gini_coefficient(ForwardIterator first, ForwardIterator last)
+// The mean M1, and the sums M2, M3 and M4 of the powers of the deviations from the mean, of n samples.
+template<class Real>
+struct central_moments
 {
-    size_t n = std::distance(first, last);
-    return n*boost::math::statistics::absolute_gini_coefficient(first, last)/(n-1);
-}
+    Real n;
+    Real M1;
+    Real M2;
+    Real M3;
+    Real M4;
+};
 
-template<class RandomAccessContainer>
-inline auto sample_absolute_gini_coefficient(RandomAccessContainer & v)
+// The moments of the union of two sets of samples, EQN 3.1 of https://www.osti.gov/servlets/purl/1426900
+template<class Real>
+void moments_add(central_moments<Real> & a, central_moments<Real> const & b)
 {
-    return boost::math::statistics::sample_absolute_gini_coefficient(v.begin(), v.end());
+    if (b.n == 0)
+    {
+        return;
+    }
+    if (a.n == 0)
+    {
+        a = b;
+        return;
+    }
+    const Real n = a.n + b.n;
+    const Real delta = b.M1 - a.M1;
+    const Real delta2 = delta*delta;
+    // M4 depends on the old M2 and M3, and M3 on the old M2:
+    a.M4 = a.M4 + b.M4 + delta2*delta2*a.n*b.n*(a.n*a.n - a.n*b.n + b.n*b.n)/(n*n*n)
+           + 6*delta2*(a.n*a.n*b.M2 + b.n*b.n*a.M2)/(n*n) + 4*delta*(a.n*b.M3 - b.n*a.M3)/n;
+    a.M3 = a.M3 + b.M3 + delta2*delta*a.n*b.n*(a.n - b.n)/(n*n) + 3*delta*(a.n*b.M2 - b.n*a.M2)/n;
+    a.M2 = a.M2 + b.M2 + delta2*a.n*b.n/n;
+    a.M1 = a.M1 + delta*b.n/n;
+    a.n = n;
 }
 
-
-// The Hoyer sparsity measure is defined in:
-// https://arxiv.org/pdf/0811.4706.pdf
-template<class ForwardIterator>
-auto hoyer_sparsity(const ForwardIterator first, const ForwardIterator last)
+// The central moments of f(i) for 0 <= i < n.
+// Each block is read twice while it is in cache: once for its mean, and once for the powers of the deviations from it,
+// and then the blocks are merged; so unlike the updates of first_four_moments, there is no division per sample.
+template<class Real, class F>
+central_moments<Real> moments_accumulate(std::size_t n, F f)
 {
-    using T = typename std::iterator_traits<ForwardIterator>::value_type;
-    using std::abs;
-    using std::sqrt;
-    BOOST_MATH_ASSERT_MSG(first != last && std::next(first) != last, "Computation of the Hoyer sparsity requires at least two samples.");
-
-    if constexpr (std::is_unsigned<T>::value)
+    using boost::math::tools::detail::norms_block;
+    using boost::math::tools::detail::norms_lanes;
+    central_moments<Real> total{0, 0, 0, 0, 0};
+    for (std::size_t start = 0; start < n; start += norms_block)
     {
-        T l1 = 0;
-        T l2 = 0;
-        size_t n = 0;
-        for (auto it = first; it != last; ++it)
+        const std::size_t end = (std::min)(n, start + norms_block);
+        const Real m = static_cast<Real>(end - start);
+        std::array<Real, norms_lanes> sums{};
+        std::size_t i = start;
+        for (; i + norms_lanes <= end; i += norms_lanes)
+        {
+            for (std::size_t l = 0; l < norms_lanes; ++l)
+            {
+                sums[l] += f(i + l);
+            }
+        }
+        Real mu = 0;
+        for (; i < end; ++i)
         {
-            l1 += *it;
-            l2 += (*it)*(*it);
-            n += 1;
+            mu += f(i);
         }
+        for (std::size_t l = 0; l < norms_lanes; ++l)
+        {
+            mu += sums[l];
+        }
+        mu /= m;
 
-        double rootn = sqrt(n);
-        return (rootn - l1/sqrt(l2) )/ (rootn - 1);
-    }
-    else {
-        decltype(abs(*first)) l1 = 0;
-        decltype(abs(*first)) l2 = 0;
-        // We wouldn't need to count the elements if it was a random access iterator,
-        // but our only constraint is that it's a forward iterator.
-        size_t n = 0;
-        for (auto it = first; it != last; ++it)
+        std::array<Real, norms_lanes> s1{};
+        std::array<Real, norms_lanes> s2{};
+        std::array<Real, norms_lanes> s3{};
+        std::array<Real, norms_lanes> s4{};
+        i = start;
+        for (; i + norms_lanes <= end; i += norms_lanes)
         {
-            decltype(abs(*first)) tmp = abs(*it);
-            l1 += tmp;
-            l2 += tmp*tmp;
-            n += 1;
+            for (std::size_t l = 0; l < norms_lanes; ++l)
+            {
+                Real d = f(i + l) - mu;
+                Real d2 = d*d;
+                s1[l] += d;
+                s2[l] += d2;
+                s3[l] += d2*d;
+                s4[l] += d2*d2;
+            }
         }
-        if constexpr (std::is_integral<T>::value)
+        Real S1 = 0;
+        Real S2 = 0;
+        Real S3 = 0;
+        Real S4 = 0;
+        for (; i < end; ++i)
         {
-            double rootn = sqrt(n);
-            return (rootn - l1/sqrt(l2) )/ (rootn - 1);
+            Real d = f(i) - mu;
+            Real d2 = d*d;
+            S1 += d;
+            S2 += d2;
+            S3 += d2*d;
+            S4 += d2*d2;
         }
-        else
+        for (std::size_t l = 0; l < norms_lanes; ++l)
         {
-            decltype(abs(*first)) rootn = sqrt(static_cast<decltype(abs(*first))>(n));
-            return (rootn - l1/sqrt(l2) )/ (rootn - 1);
+            S1 += s1[l];
+            S2 += s2[l];
+            S3 += s3[l];
+            S4 += s4[l];
         }
+        // The deviations don't quite sum to zero, since mu is rounded; move the moments to the corrected mean mu + c:
+        const Real c = S1/m;
+        const Real c2 = c*c;
+        central_moments<Real> block{m, mu + c, S2 - m*c2, S3 - 3*c*S2 + 2*m*c2*c, S4 - 4*c*S3 + 6*c2*S2 - 3*m*c2*c2};
+        moments_add(total, block);
     }
+    return total;
 }
 
-template<class Container>
-inline auto hoyer_sparsity(Container const & v)
+// The moments M2 and M4 about the mean, as returned by first_four_moments, of a signal to the ratio of signal power to noise power.
+template<class Real>
+Real m2m4_snr_from_moments(Real M2, Real M4, Real estimated_signal_kurtosis, Real estimated_noise_kurtosis)
 {
-    return boost::math::statistics::hoyer_sparsity(v.cbegin(), v.cend());
+    // If we first eliminate N, we obtain the quadratic equation:
+    // (ka+kw-6)S^2 + 2M2(3-kw)S + kw*M2^2 - M4 = 0 =: a*S^2 + bs*N + cs = 0
+    // If we first eliminate S, we obtain the quadratic equation:
+    // (ka+kw-6)N^2 + 2M2(3-ka)N + ka*M2^2 - M4 = 0 =: a*N^2 + bn*N + cn = 0
+    // I believe these equations are totally independent quadratics;
+    // if one has a complex solution it is not necessarily the case that the other must also.
+    // However, I can't prove that, so there is a chance that this does unnecessary work.
+    // Future improvements: There are algorithms which can solve quadratics much more effectively than the naive implementation found here.
+    // See: https://stackoverflow.com/questions/48979861/numerically-stable-method-for-solving-quadratic-equations/50065711#50065711
+    if (M4 == 0)
+    {
+        // The signal is constant. There is no noise:
+        return std::numeric_limits<Real>::infinity();
+    }
+    // Change to notation in Pauluzzi, equation 41:
+    auto kw = estimated_noise_kurtosis;
+    auto ka = estimated_signal_kurtosis;
+    // A common case, since it's the default:
+    Real a = (ka+kw-6);
+    Real bs = 2*M2*(3-kw);
+    Real cs = kw*M2*M2 - M4;
+    Real bn = 2*M2*(3-ka);
+    Real cn = ka*M2*M2 - M4;
+    auto [S0, S1] = boost::math::tools::quadratic_roots(a, bs, cs);
+    if (S1 > 0)
+    {
+        auto N = M2 - S1;
+        if (N > 0)
+        {
+            return S1/N;
+        }
+        if (S0 > 0)
+        {
+            N = M2 - S0;
+            if (N > 0)
+            {
+                return S0/N;
+            }
+        }
+    }
+    auto [N0, N1] = boost::math::tools::quadratic_roots(a, bn, cn);
+    if (N1 > 0)
+    {
+        auto S = M2 - N1;
+        if (S > 0)
+        {
+            return S/N1;
+        }
+        if (N0 > 0)
+        {
+            S = M2 - N0;
+            if (S > 0)
+            {
+                return S/N0;
+            }
+        }
+    }
+    // This happens distressingly often. It's a limitation of the method.
+    return std::numeric_limits<Real>::quiet_NaN();
 }
 
-
+// The numerator and denominator of the oracle SNR over the samples [first, last) of the signals.
 template<class Container>
-auto oracle_snr(Container const & signal, Container const & noisy_signal)
+auto oracle_snr_sums(Container const & signal, Container const & noisy_signal, std::size_t first, std::size_t last)
 {
     using Real = typename Container::value_type;
-    BOOST_MATH_ASSERT_MSG(signal.size() == noisy_signal.size(),
-                     "Signal and noisy_signal must be have the same number of elements.");
     if constexpr (std::is_integral<Real>::value)
     {
         double numerator = 0;
         double denominator = 0;
-        for (size_t i = 0; i < signal.size(); ++i)
+        for (std::size_t i = first; i < last; ++i)
         {
             numerator += signal[i]*signal[i];
             denominator += (noisy_signal[i] - signal[i])*(noisy_signal[i] - signal[i]);
         }
-        if (numerator == 0 && denominator == 0)
-        {
-            return std::numeric_limits<double>::quiet_NaN();
-        }
-        if (denominator == 0)
-        {
-            return std::numeric_limits<double>::infinity();
-        }
-        return numerator/denominator;
+        return std::make_pair(numerator, denominator);
     }
     else if constexpr (boost::math::tools::is_complex_type<Real>::value)
-
     {
         using std::norm;
         typename Real::value_type numerator = 0;
         typename Real::value_type denominator = 0;
-        for (size_t i = 0; i < signal.size(); ++i)
+        for (std::size_t i = first; i < last; ++i)
         {
             numerator += norm(signal[i]);
             denominator += norm(noisy_signal[i] - signal[i]);
         }
-        if (numerator == 0 && denominator == 0)
-        {
-            return std::numeric_limits<typename Real::value_type>::quiet_NaN();
-        }
-        if (denominator == 0)
-        {
-            return std::numeric_limits<typename Real::value_type>::infinity();
-        }
-
-        return numerator/denominator;
+        return std::make_pair(numerator, denominator);
     }
     else
     {
         Real numerator = 0;
         Real denominator = 0;
-        for (size_t i = 0; i < signal.size(); ++i)
+        for (std::size_t i = first; i < last; ++i)
         {
             numerator += signal[i]*signal[i];
             denominator += (signal[i] - noisy_signal[i])*(signal[i] - noisy_signal[i]);
         }
-        if (numerator == 0 && denominator == 0)
-        {
-            return std::numeric_limits<Real>::quiet_NaN();
-        }
-        if (denominator == 0)
-        {
-            return std::numeric_limits<Real>::infinity();
-        }
+        return std::make_pair(numerator, denominator);
+    }
+}
 
-        return numerator/denominator;
+template<class Real>
+Real oracle_snr_from_sums(Real numerator, Real denominator)
+{
+    if (numerator == 0 && denominator == 0)
+    {
+        return std::numeric_limits<Real>::quiet_NaN();
     }
+    if (denominator == 0)
+    {
+        return std::numeric_limits<Real>::infinity();
+    }
+    return numerator/denominator;
+}
+
+} // namespace detail
+
+template<class ForwardIterator>
+auto absolute_gini_coefficient(ForwardIterator first, ForwardIterator last)
+{
+    using std::abs;
+    using RealOrComplex = typename std::iterator_traits<ForwardIterator>::value_type;
+    BOOST_MATH_ASSERT_MSG(first != last && std::next(first) != last, "Computation of the Gini coefficient requires at least two samples.");
+
+    detail::sort_by_magnitude(first, last);
+
+    using Real = decltype(abs(*first));
+    return detail::gini_from_sums(detail::gini_accumulate<Real>(first, last, [](RealOrComplex const & x) { return abs(x); }));
+}
+
+template<class RandomAccessContainer>
+inline auto absolute_gini_coefficient(RandomAccessContainer & v)
+{
+    return boost::math::statistics::absolute_gini_coefficient(v.begin(), v.end());
+}
+
+template<class ForwardIterator>
+auto sample_absolute_gini_coefficient(ForwardIterator first, ForwardIterator last)
+{
+    size_t n = std::distance(first, last);
+    return n*boost::math::statistics::absolute_gini_coefficient(first, last)/(n-1);
+}
+
+template<class RandomAccessContainer>
+inline auto sample_absolute_gini_coefficient(RandomAccessContainer & v)
+{
+    return boost::math::statistics::sample_absolute_gini_coefficient(v.begin(), v.end());
+}
+
+
+// The Hoyer sparsity measure is defined in:
+// https://arxiv.org/pdf/0811.4706.pdf
+template<class ForwardIterator>
+auto hoyer_sparsity(const ForwardIterator first, const ForwardIterator last)
+{
+    using T = typename std::iterator_traits<ForwardIterator>::value_type;
+    BOOST_MATH_ASSERT_MSG(first != last && std::next(first) != last, "Computation of the Hoyer sparsity requires at least two samples.");
+
+    // The l1 and l2 norms are computed in the same pass:
+    return detail::hoyer_sparsity_from_sums<T>(detail::hoyer_sums_of(first, last));
+}
+
+template<class Container>
+inline auto hoyer_sparsity(Container const & v)
+{
+    return boost::math::statistics::hoyer_sparsity(v.cbegin(), v.cend());
+}
+
+
+template<class Container>
+auto oracle_snr(Container const & signal, Container const & noisy_signal)
+{
+    BOOST_MATH_ASSERT_MSG(signal.size() == noisy_signal.size(),
+                     "Signal and noisy_signal must be have the same number of elements.");
+    auto [numerator, denominator] = detail::oracle_snr_sums(signal, noisy_signal, 0, signal.size());
+    return detail::oracle_snr_from_sums(numerator, denominator);
 }
 
 template<class Container>
@@ -247,69 +637,15 @@ auto m2m4_snr_estimator(ForwardIterator first, ForwardIterator last, decltype(*f
     BOOST_MATH_ASSERT_MSG(estimated_signal_kurtosis > 0, "The estimated signal kurtosis must be positive");
     BOOST_MATH_ASSERT_MSG(estimated_noise_kurtosis > 0, "The estimated noise kurtosis must be positive.");
     using Real = typename std::iterator_traits<ForwardIterator>::value_type;
-    using std::sqrt;
-    if constexpr (std::is_floating_point<Real>::value || std::numeric_limits<Real>::max_exponent)
-    {
-        // If we first eliminate N, we obtain the quadratic equation:
-        // (ka+kw-6)S^2 + 2M2(3-kw)S + kw*M2^2 - M4 = 0 =: a*S^2 + bs*N + cs = 0
-        // If we first eliminate S, we obtain the quadratic equation:
-        // (ka+kw-6)N^2 + 2M2(3-ka)N + ka*M2^2 - M4 = 0 =: a*N^2 + bn*N + cn = 0
-        // I believe these equations are totally independent quadratics;
-        // if one has a complex solution it is not necessarily the case that the other must also.
-        // However, I can't prove that, so there is a chance that this does unnecessary work.
-        // Future improvements: There are algorithms which can solve quadratics much more effectively than the naive implementation found here.
-        // See: https://stackoverflow.com/questions/48979861/numerically-stable-method-for-solving-quadratic-equations/50065711#50065711
+    if constexpr (std::is_floating_point<Real>::value && boost::math::tools::detail::is_random_access_v<ForwardIterator>)
+    {
+        auto moments = detail::moments_accumulate<Real>(static_cast<std::size_t>(std::distance(first, last)), [first](std::size_t i) { return first[i]; });
+        return detail::m2m4_snr_from_moments<Real>(moments.M2/moments.n, moments.M4/moments.n, estimated_signal_kurtosis, estimated_noise_kurtosis);
+    }
+    else if constexpr (std::is_floating_point<Real>::value || std::numeric_limits<Real>::max_exponent)
+    {
         auto [M1, M2, M3, M4] = boost::math::statistics::first_four_moments(first, last);
-        if (M4 == 0)
-        {
-            // The signal is constant. There is no noise:
-            return std::numeric_limits<Real>::infinity();
-        }
-        // Change to notation in Pauluzzi, equation 41:
-        auto kw = estimated_noise_kurtosis;
-        auto ka = estimated_signal_kurtosis;
-        // A common case, since it's the default:
-        Real a = (ka+kw-6);
-        Real bs = 2*M2*(3-kw);
-        Real cs = kw*M2*M2 - M4;
-        Real bn = 2*M2*(3-ka);
-        Real cn = ka*M2*M2 - M4;
-        auto [S0, S1] = boost::math::tools::quadratic_roots(a, bs, cs);
-        if (S1 > 0)
-        {
-            auto N = M2 - S1;
-            if (N > 0)
-            {
-                return S1/N;
-            }
-            if (S0 > 0)
-            {
-                N = M2 - S0;
-                if (N > 0)
-                {
-                    return S0/N;
-                }
-            }
-        }
-        auto [N0, N1] = boost::math::tools::quadratic_roots(a, bn, cn);
-        if (N1 > 0)
-        {
-            auto S = M2 - N1;
-            if (S > 0)
-            {
-                return S/N1;
-            }
-            if (N0 > 0)
-            {
-                S = M2 - N0;
-                if (S > 0)
-                {
-                    return S/N0;
-                }
-            }
-        }
-        // This happens distressingly often. It's a limitation of the method.
-        return std::numeric_limits<Real>::quiet_NaN();
+        return detail::m2m4_snr_from_moments<Real>(M2, M4, estimated_signal_kurtosis, estimated_noise_kurtosis);
     }
     else
     {
@@ -339,5 +675,425 @@ inline auto m2m4_snr_estimator_db(Container const & noisy_signal,  typename Cont
     return 10*log10(m2m4_snr_estimator(noisy_signal, estimated_signal_kurtosis, estimated_noise_kurtosis));
 }
 
+namespace detail {
+
+template<class T, class = void>
+struct signal_frame_real
+{
+    using type = T;
+};
+
+template<class T>
+struct signal_frame_real<T, typename std::enable_if<std::is_integral<T>::value>::type>
+{
+    using type = double;
+};
+
+template<class T>
+struct signal_frame_real<T, typename std::enable_if<boost::math::tools::is_complex_type<T>::value>::type>
+{
+    using type = typename T::value_type;
+};
+
+template<class Real>
+struct frame_sums
+{
+    hoyer_sums<Real> hoyer;
+    central_moments<Real> moments;
+};
+
+// A single pass over the samples [first, last), which writes their magnitudes to out.
+// Each block of samples is copied to the stack, so that the moments can be computed from it while it is in cache.
+template<class Real, class ForwardIterator>
+frame_sums<Real> frame_accumulate(ForwardIterator first, ForwardIterator last, Real* out)
+{
+    using T = typename std::iterator_traits<ForwardIterator>::value_type;
+    using boost::math::tools::detail::norms_block;
+    using std::abs;
+    frame_sums<Real> sums{{0, 0, 0}, {0, 0, 0, 0, 0}};
+    std::array<Real, norms_block> x;
+    auto it = first;
+    while (it != last)
+    {
+        std::size_t m = 0;
+        for (; m < norms_block && it != last; ++m, ++it)
+        {
+            if constexpr (boost::math::tools::is_complex_type<T>::value)
+            {
+                out[m] = abs(*it);
+            }
+            else
+            {
+                x[m] = static_cast<Real>(*it);
+                out[m] = abs(x[m]);
+            }
+        }
+        hoyer_add(sums.hoyer, hoyer_accumulate<Real>(m, [out](std::size_t i) { return out[i]; }));
+        if constexpr (!boost::math::tools::is_complex_type<T>::value)
+        {
+            moments_add(sums.moments, moments_accumulate<Real>(m, [&x](std::size_t i) { return x[i]; }));
+        }
+        out += m;
+    }
+    return sums;
+}
+
+} // namespace detail
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+
+namespace detail {
+
+inline std::size_t signal_statistics_threads()
+{
+    return std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
+}
+
+// Sorts [first, last) by partitioning it about its median with std::nth_element, and sorting the halves on separate threads
+// by leaf_sort(piece_first, piece_last). Each partition is a selection, so once the pieces are sorted, so is the range.
+template<class RandomAccessIterator, class Compare, class LeafSort>
+void selection_parallel_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp, LeafSort leaf_sort, std::size_t threads)
+{
+    const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+    if (threads < 2 || n < 2*boost::math::tools::detail::norms_min_piece)
+    {
+        leaf_sort(first, last);
+        return;
+    }
+    auto middle = std::next(first, n/2);
+    std::nth_element(first, middle, last, comp);
+    auto left = std::async(std::launch::async, [=]() { selection_parallel_sort(first, middle, comp, leaf_sort, threads/2); });
+    selection_parallel_sort(middle, last, comp, leaf_sort, threads - threads/2);
+    left.get();
+}
+
+} // namespace detail
+
+template<class ExecutionPolicy, class RandomAccessIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto absolute_gini_coefficient(ExecutionPolicy&&, RandomAccessIterator first, RandomAccessIterator last)
+{
+    if constexpr (boost::math::tools::detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return absolute_gini_coefficient(first, last);
+    }
+    else
+    {
+        using std::abs;
+        using RealOrComplex = typename std::iterator_traits<RandomAccessIterator>::value_type;
+        using Real = decltype(abs(*first));
+        BOOST_MATH_ASSERT_MSG(first != last && std::next(first) != last, "Computation of the Gini coefficient requires at least two samples.");
+
+        detail::selection_parallel_sort(first, last, [](RealOrComplex a, RealOrComplex b) { return abs(b) > abs(a); },
+                                        [](RandomAccessIterator a, RandomAccessIterator b) { detail::sort_by_magnitude(a, b); }, detail::signal_statistics_threads());
+        auto pieces = boost::math::tools::detail::norms_parallel_pieces(first, last, [](RandomAccessIterator a, RandomAccessIterator b)
+        {
+            return detail::gini_accumulate<Real>(a, b, [](RealOrComplex const & x) { return abs(x); });
+        });
+        return detail::gini_from_sums(detail::gini_combine(pieces));
+    }
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto absolute_gini_coefficient(ExecutionPolicy&& exec, RandomAccessContainer & v)
+{
+    return boost::math::statistics::absolute_gini_coefficient(exec, v.begin(), v.end());
+}
+
+template<class ExecutionPolicy, class RandomAccessIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto sample_absolute_gini_coefficient(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+    size_t n = std::distance(first, last);
+    return n*boost::math::statistics::absolute_gini_coefficient(exec, first, last)/(n-1);
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto sample_absolute_gini_coefficient(ExecutionPolicy&& exec, RandomAccessContainer & v)
+{
+    return boost::math::statistics::sample_absolute_gini_coefficient(exec, v.begin(), v.end());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto hoyer_sparsity(ExecutionPolicy&&, const ForwardIterator first, const ForwardIterator last)
+{
+    if constexpr (boost::math::tools::detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return hoyer_sparsity(first, last);
+    }
+    else
+    {
+        using T = typename std::iterator_traits<ForwardIterator>::value_type;
+        BOOST_MATH_ASSERT_MSG(first != last && std::next(first) != last, "Computation of the Hoyer sparsity requires at least two samples.");
+        auto pieces = boost::math::tools::detail::norms_parallel_pieces(first, last, [](ForwardIterator a, ForwardIterator b) { return detail::hoyer_sums_of(a, b); });
+        auto sums = pieces[0];
+        for (std::size_t k = 1; k < pieces.size(); ++k)
+        {
+            detail::hoyer_add(sums, pieces[k]);
+        }
+        return detail::hoyer_sparsity_from_sums<T>(sums);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto hoyer_sparsity(ExecutionPolicy&& exec, Container const & v)
+{
+    return boost::math::statistics::hoyer_sparsity(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto oracle_snr(ExecutionPolicy&&, Container const & signal, Container const & noisy_signal)
+{
+    if constexpr (boost::math::tools::detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return oracle_snr(signal, noisy_signal);
+    }
+    else
+    {
+        using Iterator = typename Container::const_iterator;
+        BOOST_MATH_ASSERT_MSG(signal.size() == noisy_signal.size(),
+                         "Signal and noisy_signal must be have the same number of elements.");
+        const Iterator begin = signal.cbegin();
+        auto pieces = boost::math::tools::detail::norms_parallel_pieces(begin, signal.cend(), [&signal, &noisy_signal, begin](Iterator a, Iterator b)
+        {
+            return detail::oracle_snr_sums(signal, noisy_signal, std::distance(begin, a), std::distance(begin, b));
+        });
+        auto [numerator, denominator] = pieces[0];
+        for (std::size_t k = 1; k < pieces.size(); ++k)
+        {
+            numerator += pieces[k].first;
+            denominator += pieces[k].second;
+        }
+        return detail::oracle_snr_from_sums(numerator, denominator);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto oracle_snr_db(ExecutionPolicy&& exec, Container const & signal, Container const & noisy_signal)
+{
+    using std::log10;
+    return 10*log10(boost::math::statistics::oracle_snr(exec, signal, noisy_signal));
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto m2m4_snr_estimator(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, decltype(*first) estimated_signal_kurtosis=1, decltype(*first) estimated_noise_kurtosis=3)
+{
+    using Real = typename std::iterator_traits<ForwardIterator>::value_type;
+    if constexpr (boost::math::tools::detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return m2m4_snr_estimator(first, last, estimated_signal_kurtosis, estimated_noise_kurtosis);
+    }
+    else if constexpr (std::is_floating_point<Real>::value && boost::math::tools::detail::is_random_access_v<ForwardIterator>)
+    {
+        BOOST_MATH_ASSERT_MSG(estimated_signal_kurtosis > 0, "The estimated signal kurtosis must be positive");
+        BOOST_MATH_ASSERT_MSG(estimated_noise_kurtosis > 0, "The estimated noise kurtosis must be positive.");
+        auto pieces = boost::math::tools::detail::norms_parallel_pieces(first, last, [](ForwardIterator a, ForwardIterator b)
+        {
+            return detail::moments_accumulate<Real>(static_cast<std::size_t>(std::distance(a, b)), [a](std::size_t i) { return a[i]; });
+        });
+        auto moments = pieces[0];
+        for (std::size_t k = 1; k < pieces.size(); ++k)
+        {
+            detail::moments_add(moments, pieces[k]);
+        }
+        return detail::m2m4_snr_from_moments<Real>(moments.M2/moments.n, moments.M4/moments.n, estimated_signal_kurtosis, estimated_noise_kurtosis);
+    }
+    else if constexpr (std::is_floating_point<Real>::value || std::numeric_limits<Real>::max_exponent)
+    {
+        BOOST_MATH_ASSERT_MSG(estimated_signal_kurtosis > 0, "The estimated signal kurtosis must be positive");
+        BOOST_MATH_ASSERT_MSG(estimated_noise_kurtosis > 0, "The estimated noise kurtosis must be positive.");
+        auto [M1, M2, M3, M4] = boost::math::statistics::first_four_moments(exec, first, last);
+        return detail::m2m4_snr_from_moments<Real>(M2, M4, estimated_signal_kurtosis, estimated_noise_kurtosis);
+    }
+    else
+    {
+        BOOST_MATH_ASSERT_MSG(false, "The M2M4 estimator has not been implemented for this type.");
+        return std::numeric_limits<Real>::quiet_NaN();
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto m2m4_snr_estimator(ExecutionPolicy&& exec, Container const & noisy_signal, typename Container::value_type estimated_signal_kurtosis=1, typename Container::value_type estimated_noise_kurtosis=3)
+{
+    return m2m4_snr_estimator(exec, noisy_signal.cbegin(), noisy_signal.cend(), estimated_signal_kurtosis, estimated_noise_kurtosis);
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto m2m4_snr_estimator_db(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, decltype(*first) estimated_signal_kurtosis=1, decltype(*first) estimated_noise_kurtosis=3)
+{
+    using std::log10;
+    return 10*log10(m2m4_snr_estimator(exec, first, last, estimated_signal_kurtosis, estimated_noise_kurtosis));
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto m2m4_snr_estimator_db(ExecutionPolicy&& exec, Container const & noisy_signal, typename Container::value_type estimated_signal_kurtosis=1, typename Container::value_type estimated_noise_kurtosis=3)
+{
+    using std::log10;
+    return 10*log10(m2m4_snr_estimator(exec, noisy_signal, estimated_signal_kurtosis, estimated_noise_kurtosis));
+}
+
+#endif
+
+// The Hoyer sparsity, the absolute Gini coefficient and the M2M4 SNR estimate of each of a sequence of frames,
+// such as the blocks of samples from a receiver.
+// A frame is read once, and the magnitudes of its samples are kept for the Gini coefficient;
+// they are sorted by a radix sort, and all the storage is reused by the next frame.
+template<class T>
+class signal_frame_statistics
+{
+public:
+    using Real = typename detail::signal_frame_real<T>::type;
+
+    signal_frame_statistics() = default;
+
+    explicit signal_frame_statistics(std::size_t frame_size)
+    {
+        magnitudes_.reserve(frame_size);
+    }
+
+    template<class ForwardIterator>
+    void compute(ForwardIterator first, ForwardIterator last)
+    {
+        BOOST_MATH_ASSERT_MSG(first != last && std::next(first) != last, "The statistics of a frame require at least two samples.");
+        magnitudes_.resize(static_cast<std::size_t>(std::distance(first, last)));
+        auto sums = detail::frame_accumulate<Real>(first, last, magnitudes_.data());
+        hoyer_ = sums.hoyer;
+        moments_ = sums.moments;
+        sorted_ = false;
+        parallel_ = false;
+    }
+
+    template<class Container>
+    void compute(Container const & frame)
+    {
+        compute(frame.cbegin(), frame.cend());
+    }
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    void compute(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last)
+    {
+        if constexpr (boost::math::tools::detail::is_sequenced_policy_v<ExecutionPolicy>)
+        {
+            compute(first, last);
+        }
+        else
+        {
+            BOOST_MATH_ASSERT_MSG(first != last && std::next(first) != last, "The statistics of a frame require at least two samples.");
+            magnitudes_.resize(static_cast<std::size_t>(std::distance(first, last)));
+            Real* out = magnitudes_.data();
+            auto pieces = boost::math::tools::detail::norms_parallel_pieces(first, last, [first, out](ForwardIterator a, ForwardIterator b)
+            {
+                return detail::frame_accumulate<Real>(a, b, out + std::distance(first, a));
+            });
+            hoyer_ = pieces[0].hoyer;
+            moments_ = pieces[0].moments;
+            for (std::size_t k = 1; k < pieces.size(); ++k)
+            {
+                detail::hoyer_add(hoyer_, pieces[k].hoyer);
+                detail::moments_add(moments_, pieces[k].moments);
+            }
+            sorted_ = false;
+            parallel_ = true;
+        }
+    }
+
+    template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    void compute(ExecutionPolicy&& exec, Container const & frame)
+    {
+        compute(exec, frame.cbegin(), frame.cend());
+    }
+#endif
+
+    std::size_t size() const
+    {
+        return magnitudes_.size();
+    }
+
+    Real hoyer_sparsity() const
+    {
+        return detail::hoyer_sparsity_from_sums<Real>(hoyer_);
+    }
+
+    // Sorts the magnitudes the first time it is called for a frame.
+    Real absolute_gini_coefficient()
+    {
+        if (!sorted_)
+        {
+            auto magnitude = [](Real const & x) { return x; };
+            using Iterator = typename std::vector<Real>::iterator;
+            // Sorts a piece of the magnitudes, using the same piece of the scratch space:
+            auto leaf_sort = [this](Iterator a, Iterator b) {
+                if constexpr (detail::is_magnitude_radix_sortable_v<Real>)
+                {
+                    const std::size_t n = static_cast<std::size_t>(b - a);
+                    if (n >= detail::radix_sort_min)
+                    {
+                        detail::magnitude_radix_sort(&*a, n, scratch_.data() + (a - magnitudes_.begin()));
+                        return;
+                    }
+                }
+                std::sort(a, b);
+            };
+            if constexpr (detail::is_magnitude_radix_sortable_v<Real>)
+            {
+                scratch_.resize(magnitudes_.size());
+            }
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+            if (parallel_)
+            {
+                detail::selection_parallel_sort(magnitudes_.begin(), magnitudes_.end(), std::less<Real>(), leaf_sort, detail::signal_statistics_threads());
+                using ConstIterator = typename std::vector<Real>::const_iterator;
+                auto pieces = boost::math::tools::detail::norms_parallel_pieces(magnitudes_.cbegin(), magnitudes_.cend(), [magnitude](ConstIterator a, ConstIterator b)
+                {
+                    return detail::gini_accumulate<Real>(a, b, magnitude);
+                });
+                gini_ = detail::gini_from_sums(detail::gini_combine(pieces));
+                sorted_ = true;
+                return gini_;
+            }
+#endif
+            leaf_sort(magnitudes_.begin(), magnitudes_.end());
+            gini_ = detail::gini_from_sums(detail::gini_accumulate<Real>(magnitudes_.cbegin(), magnitudes_.cend(), magnitude));
+            sorted_ = true;
+        }
+        return gini_;
+    }
+
+    Real sample_absolute_gini_coefficient()
+    {
+        Real n = static_cast<Real>(magnitudes_.size());
+        return n*absolute_gini_coefficient()/(n-1);
+    }
+
+    // The mean, and the second, third and fourth central moments, as returned by first_four_moments.
+    std::tuple<Real, Real, Real, Real> first_four_moments() const
+    {
+        static_assert(!boost::math::tools::is_complex_type<T>::value, "The moments of complex frames are not computed.");
+        return std::make_tuple(moments_.M1, moments_.M2/moments_.n, moments_.M3/moments_.n, moments_.M4/moments_.n);
+    }
+
+    Real m2m4_snr_estimator(Real estimated_signal_kurtosis=1, Real estimated_noise_kurtosis=3) const
+    {
+        static_assert(!boost::math::tools::is_complex_type<T>::value, "The M2M4 estimator has not been implemented for complex frames.");
+        BOOST_MATH_ASSERT_MSG(estimated_signal_kurtosis > 0, "The estimated signal kurtosis must be positive");
+        BOOST_MATH_ASSERT_MSG(estimated_noise_kurtosis > 0, "The estimated noise kurtosis must be positive.");
+        return detail::m2m4_snr_from_moments<Real>(moments_.M2/moments_.n, moments_.M4/moments_.n, estimated_signal_kurtosis, estimated_noise_kurtosis);
+    }
+
+    Real m2m4_snr_estimator_db(Real estimated_signal_kurtosis=1, Real estimated_noise_kurtosis=3) const
+    {
+        using std::log10;
+        return 10*log10(m2m4_snr_estimator(estimated_signal_kurtosis, estimated_noise_kurtosis));
+    }
+
+private:
+    std::vector<Real> magnitudes_;
+    std::vector<Real> scratch_;
+    detail::hoyer_sums<Real> hoyer_{0, 0, 0};
+    detail::central_moments<Real> moments_{0, 0, 0, 0, 0};
+    Real gini_ = 0;
+    bool sorted_ = false;
+    bool parallel_ = false;
+};
+
 }
 #endif
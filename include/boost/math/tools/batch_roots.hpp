@@ -0,0 +1,655 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_BATCH_ROOTS_HPP
+#define BOOST_MATH_TOOLS_BATCH_ROOTS_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/roots.hpp>
+#include <boost/math/tools/toms748_solve.hpp>
+#include <boost/math/policies/error_handling.hpp>
+
+//
+// Batched versions of the root finders in roots.hpp and toms748_solve.hpp: these solve
+// many independent equations at once, advancing every unconverged "lane" by one function
+// evaluation per sweep.  Lanes which have converged are dropped from the active list, so
+// the work per sweep shrinks as the batch converges.
+//
+// The functor may be called in either of two ways:
+//
+// f(lane, x) evaluates one problem at a time, where lane is the index of the problem
+// being solved, so that per-problem parameters can be looked up by the caller.  It returns
+// the same value, pair or tuple as the functor passed to the scalar root finder.
+//
+// f(n, lanes, x, f0 [, f1 [, f2]]) evaluates a whole sweep at once: lanes[k] is the index of
+// the problem whose function value and derivatives at x[k] are to be written to f0[k], f1[k]
+// and f2[k], for 0 <= k < n.  All the arguments are contiguous arrays, so the functor can
+// be vectorised.
+//
+// Unlike the scalar versions, the batched Newton/Halley/Schroder iterations require
+// each lane to be bracketed: any step which leaves the bracket, or which fails to
+// at least halve the step before last, is replaced by a bisection step for that lane only.
+//
+namespace boost {
+namespace math {
+namespace tools {
+
+namespace detail {
+
+   template <class F, class T, class = void>
+   struct is_per_lane_function : public std::false_type {};
+
+   template <class F, class T>
+   struct is_per_lane_function<F, T, decltype(void(std::declval<F&>()(std::size_t(0), std::declval<const T&>())))> : public std::true_type {};
+
+   //
+   // Presents a functor called as f(lane, x) as one which evaluates a whole sweep:
+   //
+   template <class F>
+   struct batch_per_lane_function
+   {
+      F& f;
+
+      template <class T>
+      void operator()(std::size_t n, const std::size_t* lanes, const T* x, T* f0) const
+      {
+         for (std::size_t k = 0; k < n; ++k)
+            f0[k] = f(lanes[k], x[k]);
+      }
+      template <class T>
+      void operator()(std::size_t n, const std::size_t* lanes, const T* x, T* f0, T* f1) const
+      {
+         for (std::size_t k = 0; k < n; ++k)
+            unpack_tuple(f(lanes[k], x[k]), f0[k], f1[k]);
+      }
+      template <class T>
+      void operator()(std::size_t n, const std::size_t* lanes, const T* x, T* f0, T* f1, T* f2) const
+      {
+         for (std::size_t k = 0; k < n; ++k)
+            unpack_tuple(f(lanes[k], x[k]), f0[k], f1[k], f2[k]);
+      }
+   };
+
+   template <class F>
+   inline batch_per_lane_function<F> make_batch_function(F& f, const std::true_type&)
+   {
+      return batch_per_lane_function<F>{ f };
+   }
+
+   template <class F>
+   inline F& make_batch_function(F& f, const std::false_type&)
+   {
+      return f;
+   }
+
+   struct batch_newton_stepper
+   {
+      template <class F, class T>
+      static void evaluate(F& f, std::size_t n, const std::size_t* lanes, const T* x, T* f0, T* f1, T*)
+      {
+         f(n, lanes, x, f0, f1);
+      }
+      template <class T>
+      static bool step(const T&, const T& f0, const T& f1, const T&, T& delta)
+      {
+         if (f1 == 0)
+            return false;
+         delta = f0 / f1;
+         return true;
+      }
+   };
+
+   template <class Stepper>
+   struct batch_second_order_stepper
+   {
+      template <class F, class T>
+      static void evaluate(F& f, std::size_t n, const std::size_t* lanes, const T* x, T* f0, T* f1, T* f2)
+      {
+         f(n, lanes, x, f0, f1, f2);
+      }
+      template <class T>
+      static bool step(const T& x, const T& f0, const T& f1, const T& f2, T& delta)
+      {
+         if (f1 == 0)
+            return false;
+         if (f2 != 0)
+         {
+            delta = Stepper::step(x, f0, f1, f2);
+            // If the Newton and higher order steps disagree on direction, trust Newton,
+            // the bracketing below will stop us from jumping too far:
+            if (delta * f1 / f0 < 0)
+               delta = f0 / f1;
+         }
+         else
+            delta = f0 / f1;
+         return true;
+      }
+   };
+
+   template <class Stepper, class F, class RandomAccessContainer, class Policy>
+   void batch_bracketed_root_finder(F f, RandomAccessContainer& guess, const RandomAccessContainer& min, const RandomAccessContainer& max, int digits, std::uintmax_t& max_iter, const char* function, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      typedef typename RandomAccessContainer::value_type T;
+
+      std::size_t n = guess.size();
+      if ((min.size() != n) || (max.size() != n))
+      {
+         policies::raise_domain_error(function, "The guess, min and max containers must all be the same size, but got %1% brackets.", static_cast<T>(min.size()), pol);
+         return;
+      }
+      auto&& g = make_batch_function(f, typename is_per_lane_function<F, T>::type());
+
+      T factor = static_cast<T>(ldexp(1.0, 1 - digits));
+      //
+      // Per lane state, held as a structure of arrays, and the arguments and results
+      // of the current sweep, which are packed into the first active.size() elements:
+      //
+      std::vector<T> lo(n), hi(n), f_lo(n), step_before_last(n), last_step(n);
+      std::vector<T> x(n), f0(n), f1(n), f2(n);
+      std::vector<std::size_t> active;
+      active.reserve(n);
+
+      for (std::size_t lane = 0; lane < n; ++lane)
+      {
+         lo[lane] = min[lane];
+         hi[lane] = max[lane];
+         if (!(lo[lane] < hi[lane]))
+         {
+            guess[lane] = policies::raise_evaluation_error(function, "Range arguments in wrong order (first arg=%1%)", lo[lane], pol);
+            continue;
+         }
+         x[active.size()] = lo[lane];
+         active.push_back(lane);
+      }
+      if (!active.empty())
+         Stepper::evaluate(g, active.size(), active.data(), x.data(), f0.data(), f1.data(), f2.data());
+      std::size_t still_active = 0;
+      for (std::size_t k = 0; k < active.size(); ++k)
+      {
+         std::size_t lane = active[k];
+         if (f0[k] == 0)
+         {
+            guess[lane] = lo[lane];
+            continue;
+         }
+         f_lo[lane] = f0[k];
+         x[still_active] = hi[lane];
+         active[still_active++] = lane;
+      }
+      active.resize(still_active);
+      if (!active.empty())
+         Stepper::evaluate(g, active.size(), active.data(), x.data(), f0.data(), f1.data(), f2.data());
+      still_active = 0;
+      for (std::size_t k = 0; k < active.size(); ++k)
+      {
+         std::size_t lane = active[k];
+         if (f0[k] == 0)
+         {
+            guess[lane] = hi[lane];
+            continue;
+         }
+         if (sign(f_lo[lane]) == sign(f0[k]))
+         {
+            guess[lane] = policies::raise_evaluation_error(function, "No change of sign in the bracket surrounding the initial guess of %1%, either there is no root to find, or there are multiple roots in the interval.", guess[lane], pol);
+            continue;
+         }
+         if ((guess[lane] <= lo[lane]) || (guess[lane] >= hi[lane]) || (boost::math::isnan)(guess[lane]))
+            guess[lane] = lo[lane] + (hi[lane] - lo[lane]) / 2;
+         step_before_last[lane] = last_step[lane] = hi[lane] - lo[lane];
+         active[still_active++] = lane;
+      }
+      active.resize(still_active);
+
+      std::uintmax_t count = 0;
+      while (!active.empty() && (count < max_iter))
+      {
+         ++count;
+         for (std::size_t k = 0; k < active.size(); ++k)
+            x[k] = guess[active[k]];
+         Stepper::evaluate(g, active.size(), active.data(), x.data(), f0.data(), f1.data(), f2.data());
+         still_active = 0;
+         for (std::size_t k = 0; k < active.size(); ++k)
+         {
+            std::size_t lane = active[k];
+            if (f0[k] == 0)
+               continue;
+            T delta;
+            bool have_step = Stepper::step(x[k], f0[k], f1[k], f2[k], delta);
+            //
+            // Shrink the bracket:
+            //
+            if (sign(f0[k]) == sign(f_lo[lane]))
+            {
+               lo[lane] = x[k];
+               f_lo[lane] = f0[k];
+            }
+            else
+               hi[lane] = x[k];
+            T next = x[k] - delta;
+            if (!have_step || !(next > lo[lane]) || !(next < hi[lane]) || (fabs(2 * delta) > fabs(step_before_last[lane])))
+            {
+               // Fall back to bisection for this lane:
+               next = lo[lane] + (hi[lane] - lo[lane]) / 2;
+               if ((next == lo[lane]) || (next == hi[lane]))
+               {
+                  guess[lane] = next;
+                  continue;
+               }
+               delta = x[k] - next;
+            }
+            step_before_last[lane] = last_step[lane];
+            last_step[lane] = delta;
+            guess[lane] = next;
+            if (fabs(delta) <= fabs(next * factor))
+               continue;
+            active[still_active++] = lane;
+         }
+         active.resize(still_active);
+      }
+      max_iter = count;
+   }
+
+   //
+   // The state of one lane of batch_toms748_solve.  Each sweep evaluates f once
+   // per lane, so the steps of toms748_solve which each need one evaluation are
+   // taken in turn, and phase records which of them comes next:
+   //
+   template <class T>
+   struct batch_toms748_lane
+   {
+      enum phase_type { secant, quadratic, first_interpolation, second_interpolation, double_secant, bisection };
+
+      T a, b, fa, fb, d, fd, e, fe, a0, b0;
+      phase_type phase;
+
+      // The point at which to evaluate f next:
+      T next_point()
+      {
+         BOOST_MATH_STD_USING
+         T c;
+         T min_diff = tools::min_value<T>() * 32;
+         switch (phase)
+         {
+         case secant:
+            c = secant_interpolate(a, b, fa, fb);
+            break;
+         case quadratic:
+            c = quadratic_interpolate(a, b, d, fa, fb, fd, 2);
+            e = d;
+            fe = fd;
+            break;
+         case first_interpolation:
+         case second_interpolation:
+            if (phase == first_interpolation)
+            {
+               a0 = a;
+               b0 = b;
+            }
+            //
+            // Cubic interpolation requires that all four function values
+            // fa, fb, fd, and fe are distinct, otherwise take a quadratic step:
+            //
+            if ((fabs(fa - fb) < min_diff) || (fabs(fa - fd) < min_diff) || (fabs(fa - fe) < min_diff) || (fabs(fb - fd) < min_diff) || (fabs(fb - fe) < min_diff) || (fabs(fd - fe) < min_diff))
+               c = quadratic_interpolate(a, b, d, fa, fb, fd, phase == first_interpolation ? 2 : 3);
+            else
+               c = cubic_interpolate(a, b, d, e, fa, fb, fd, fe);
+            if (phase == first_interpolation)
+            {
+               e = d;
+               fe = fd;
+            }
+            break;
+         case double_secant:
+            {
+               T u = fabs(fa) < fabs(fb) ? a : b;
+               T fu = fabs(fa) < fabs(fb) ? fa : fb;
+               c = u - 2 * (fu / (fb - fa)) * (b - a);
+               if (fabs(c - u) > (b - a) / 2)
+                  c = a + (b - a) / 2;
+               e = d;
+               fe = fd;
+            }
+            break;
+         default:
+            c = a + (b - a) / 2;
+            e = d;
+            fe = fd;
+            break;
+         }
+         return bracket_point(a, b, c);
+      }
+
+      // Takes f(c) into account, and moves on to the next step:
+      void update(const T& c, const T& fc)
+      {
+         update_bracket(a, b, c, fc, fa, fb, d, fd);
+         switch (phase)
+         {
+         case secant:
+            phase = quadratic;
+            break;
+         case quadratic:
+            phase = first_interpolation;
+            break;
+         case first_interpolation:
+            phase = second_interpolation;
+            break;
+         case second_interpolation:
+            phase = double_secant;
+            break;
+         case double_secant:
+            // Bisect as well if we're not converging fast enough:
+            phase = (b - a) < (b0 - a0) / 2 ? first_interpolation : bisection;
+            break;
+         default:
+            phase = first_interpolation;
+            break;
+         }
+      }
+   };
+
+} // namespace detail
+
+template <class F, class RandomAccessContainer, class Tol, class Policy>
+void batch_bisect(F f, RandomAccessContainer& min, RandomAccessContainer& max, Tol tol, std::uintmax_t& max_iter, const Policy& pol)
+{
+   typedef typename RandomAccessContainer::value_type T;
+   static const char* function = "boost::math::tools::batch_bisect<%1%>";
+
+   std::size_t n = min.size();
+   if (max.size() != n)
+   {
+      policies::raise_domain_error(function, "The min and max containers must be the same size, but got %1% upper bounds.", static_cast<T>(max.size()), pol);
+      return;
+   }
+   auto&& g = detail::make_batch_function(f, typename detail::is_per_lane_function<F, T>::type());
+   std::vector<T> f_min(n), x(n), fx(n);
+   std::vector<std::size_t> active;
+   active.reserve(n);
+   for (std::size_t lane = 0; lane < n; ++lane)
+   {
+      if (!(min[lane] < max[lane]))
+      {
+         min[lane] = max[lane] = policies::raise_evaluation_error(function, "Arguments in wrong order in boost::math::tools::batch_bisect (first arg=%1%)", min[lane], pol);
+         continue;
+      }
+      x[active.size()] = min[lane];
+      active.push_back(lane);
+   }
+   if (!active.empty())
+      g(active.size(), active.data(), x.data(), fx.data());
+   std::size_t still_active = 0;
+   for (std::size_t k = 0; k < active.size(); ++k)
+   {
+      std::size_t lane = active[k];
+      if (fx[k] == 0)
+      {
+         max[lane] = min[lane];
+         continue;
+      }
+      f_min[lane] = fx[k];
+      x[still_active] = max[lane];
+      active[still_active++] = lane;
+   }
+   active.resize(still_active);
+   if (!active.empty())
+      g(active.size(), active.data(), x.data(), fx.data());
+   still_active = 0;
+   for (std::size_t k = 0; k < active.size(); ++k)
+   {
+      std::size_t lane = active[k];
+      if (fx[k] == 0)
+      {
+         min[lane] = max[lane];
+         continue;
+      }
+      if (f_min[lane] * fx[k] >= 0)
+      {
+         min[lane] = max[lane] = policies::raise_evaluation_error(function, "No change of sign in boost::math::tools::batch_bisect, either there is no root to find, or there are multiple roots in the interval (f(min) = %1%).", f_min[lane], pol);
+         continue;
+      }
+      active[still_active++] = lane;
+   }
+   active.resize(still_active);
+
+   std::uintmax_t count = 0;
+   while (!active.empty() && (count < max_iter))
+   {
+      ++count;
+      still_active = 0;
+      for (std::size_t k = 0; k < active.size(); ++k)
+      {
+         std::size_t lane = active[k];
+         if (tol(min[lane], max[lane]))
+            continue;
+         T mid = (min[lane] + max[lane]) / 2;
+         if ((mid == min[lane]) || (mid == max[lane]))
+            continue;
+         x[still_active] = mid;
+         active[still_active++] = lane;
+      }
+      active.resize(still_active);
+      if (active.empty())
+         break;
+      g(active.size(), active.data(), x.data(), fx.data());
+      still_active = 0;
+      for (std::size_t k = 0; k < active.size(); ++k)
+      {
+         std::size_t lane = active[k];
+         if (fx[k] == 0)
+         {
+            min[lane] = max[lane] = x[k];
+            continue;
+         }
+         if (sign(fx[k]) * sign(f_min[lane]) < 0)
+            max[lane] = x[k];
+         else
+         {
+            min[lane] = x[k];
+            f_min[lane] = fx[k];
+         }
+         active[still_active++] = lane;
+      }
+      active.resize(still_active);
+   }
+   max_iter = count;
+}
+
+template <class F, class RandomAccessContainer, class Tol>
+inline void batch_bisect(F f, RandomAccessContainer& min, RandomAccessContainer& max, Tol tol, std::uintmax_t& max_iter)
+{
+   batch_bisect(f, min, max, tol, max_iter, policies::policy<>());
+}
+
+template <class F, class RandomAccessContainer, class Tol>
+inline void batch_bisect(F f, RandomAccessContainer& min, RandomAccessContainer& max, Tol tol)
+{
+   std::uintmax_t m = (std::numeric_limits<std::uintmax_t>::max)();
+   batch_bisect(f, min, max, tol, m, policies::policy<>());
+}
+
+template <class F, class RandomAccessContainer, class Tol, class Policy>
+void batch_toms748_solve(F f, RandomAccessContainer& min, RandomAccessContainer& max, Tol tol, std::uintmax_t& max_iter, const Policy& pol)
+{
+   typedef typename RandomAccessContainer::value_type T;
+   static const char* function = "boost::math::tools::batch_toms748_solve<%1%>";
+
+   std::size_t n = min.size();
+   if (max.size() != n)
+   {
+      policies::raise_domain_error(function, "The min and max containers must be the same size, but got %1% upper bounds.", static_cast<T>(max.size()), pol);
+      return;
+   }
+   // As for toms748_solve, max_iter includes the evaluations at the ends of the brackets:
+   if (max_iter <= 2)
+      return;
+   std::uintmax_t max_sweeps = max_iter - 2;
+   auto&& g = detail::make_batch_function(f, typename detail::is_per_lane_function<F, T>::type());
+   std::vector<detail::batch_toms748_lane<T> > state(n);
+   std::vector<T> x(n), fx(n);
+   std::vector<std::size_t> active;
+   active.reserve(n);
+   for (std::size_t lane = 0; lane < n; ++lane)
+   {
+      if (min[lane] >= max[lane])
+      {
+         min[lane] = max[lane] = policies::raise_domain_error(function, "Parameters a and b out of order: a=%1%", min[lane], pol);
+         continue;
+      }
+      state[lane].a = min[lane];
+      state[lane].b = max[lane];
+      x[active.size()] = min[lane];
+      active.push_back(lane);
+   }
+   if (!active.empty())
+      g(active.size(), active.data(), x.data(), fx.data());
+   for (std::size_t k = 0; k < active.size(); ++k)
+   {
+      state[active[k]].fa = fx[k];
+      x[k] = state[active[k]].b;
+   }
+   if (!active.empty())
+      g(active.size(), active.data(), x.data(), fx.data());
+   std::size_t still_active = 0;
+   for (std::size_t k = 0; k < active.size(); ++k)
+   {
+      std::size_t lane = active[k];
+      detail::batch_toms748_lane<T>& s = state[lane];
+      s.fb = fx[k];
+      if (tol(s.a, s.b) || (s.fa == 0) || (s.fb == 0))
+      {
+         if (s.fa == 0)
+            max[lane] = min[lane];
+         else if (s.fb == 0)
+            min[lane] = max[lane];
+         continue;
+      }
+      if (boost::math::sign(s.fa) * boost::math::sign(s.fb) > 0)
+      {
+         min[lane] = max[lane] = policies::raise_domain_error(function, "Parameters a and b do not bracket the root: a=%1%", s.a, pol);
+         continue;
+      }
+      // dummy values for fd, e and fe:
+      s.fe = s.e = s.fd = 1e5F;
+      s.phase = detail::batch_toms748_lane<T>::secant;
+      active[still_active++] = lane;
+   }
+   active.resize(still_active);
+
+   std::uintmax_t count = 0;
+   while (!active.empty() && (count < max_sweeps))
+   {
+      ++count;
+      for (std::size_t k = 0; k < active.size(); ++k)
+         x[k] = state[active[k]].next_point();
+      g(active.size(), active.data(), x.data(), fx.data());
+      still_active = 0;
+      for (std::size_t k = 0; k < active.size(); ++k)
+      {
+         std::size_t lane = active[k];
+         detail::batch_toms748_lane<T>& s = state[lane];
+         s.update(x[k], fx[k]);
+         if ((s.fa == 0) || tol(s.a, s.b) || (count == max_sweeps))
+         {
+            // f(b) is never zero here, that would have been found before the first sweep:
+            if (s.fa == 0)
+               s.b = s.a;
+            min[lane] = s.a;
+            max[lane] = s.b;
+            continue;
+         }
+         active[still_active++] = lane;
+      }
+      active.resize(still_active);
+   }
+   max_iter = count + 2;
+}
+
+template <class F, class RandomAccessContainer, class Tol>
+inline void batch_toms748_solve(F f, RandomAccessContainer& min, RandomAccessContainer& max, Tol tol, std::uintmax_t& max_iter)
+{
+   batch_toms748_solve(f, min, max, tol, max_iter, policies::policy<>());
+}
+
+template <class F, class RandomAccessContainer, class Tol>
+inline void batch_toms748_solve(F f, RandomAccessContainer& min, RandomAccessContainer& max, Tol tol)
+{
+   std::uintmax_t m = (std::numeric_limits<std::uintmax_t>::max)();
+   batch_toms748_solve(f, min, max, tol, m, policies::policy<>());
+}
+
+template <class F, class RandomAccessContainer, class Policy>
+inline void batch_newton_raphson_iterate(F f, RandomAccessContainer& guess, const RandomAccessContainer& min, const RandomAccessContainer& max, int digits, std::uintmax_t& max_iter, const Policy& pol)
+{
+   detail::batch_bracketed_root_finder<detail::batch_newton_stepper>(f, guess, min, max, digits, max_iter, "boost::math::tools::batch_newton_raphson_iterate<%1%>", pol);
+}
+
+template <class F, class RandomAccessContainer>
+inline void batch_newton_raphson_iterate(F f, RandomAccessContainer& guess, const RandomAccessContainer& min, const RandomAccessContainer& max, int digits, std::uintmax_t& max_iter)
+{
+   batch_newton_raphson_iterate(f, guess, min, max, digits, max_iter, policies::policy<>());
+}
+
+template <class F, class RandomAccessContainer>
+inline void batch_newton_raphson_iterate(F f, RandomAccessContainer& guess, const RandomAccessContainer& min, const RandomAccessContainer& max, int digits)
+{
+   std::uintmax_t m = (std::numeric_limits<std::uintmax_t>::max)();
+   batch_newton_raphson_iterate(f, guess, min, max, digits, m, policies::policy<>());
+}
+
+template <class F, class RandomAccessContainer, class Policy>
+inline void batch_halley_iterate(F f, RandomAccessContainer& guess, const RandomAccessContainer& min, const RandomAccessContainer& max, int digits, std::uintmax_t& max_iter, const Policy& pol)
+{
+   detail::batch_bracketed_root_finder<detail::batch_second_order_stepper<detail::halley_step> >(f, guess, min, max, digits, max_iter, "boost::math::tools::batch_halley_iterate<%1%>", pol);
+}
+
+template <class F, class RandomAccessContainer>
+inline void batch_halley_iterate(F f, RandomAccessContainer& guess, const RandomAccessContainer& min, const RandomAccessContainer& max, int digits, std::uintmax_t& max_iter)
+{
+   batch_halley_iterate(f, guess, min, max, digits, max_iter, policies::policy<>());
+}
+
+template <class F, class RandomAccessContainer>
+inline void batch_halley_iterate(F f, RandomAccessContainer& guess, const RandomAccessContainer& min, const RandomAccessContainer& max, int digits)
+{
+   std::uintmax_t m = (std::numeric_limits<std::uintmax_t>::max)();
+   batch_halley_iterate(f, guess, min, max, digits, m, policies::policy<>());
+}
+
+template <class F, class RandomAccessContainer, class Policy>
+inline void batch_schroder_iterate(F f, RandomAccessContainer& guess, const RandomAccessContainer& min, const RandomAccessContainer& max, int digits, std::uintmax_t& max_iter, const Policy& pol)
+{
+   detail::batch_bracketed_root_finder<detail::batch_second_order_stepper<detail::schroder_stepper> >(f, guess, min, max, digits, max_iter, "boost::math::tools::batch_schroder_iterate<%1%>", pol);
+}
+
+template <class F, class RandomAccessContainer>
+inline void batch_schroder_iterate(F f, RandomAccessContainer& guess, const RandomAccessContainer& min, const RandomAccessContainer& max, int digits, std::uintmax_t& max_iter)
+{
+   batch_schroder_iterate(f, guess, min, max, digits, max_iter, policies::policy<>());
+}
+
+template <class F, class RandomAccessContainer>
+inline void batch_schroder_iterate(F f, RandomAccessContainer& guess, const RandomAccessContainer& min, const RandomAccessContainer& max, int digits)
+{
+   std::uintmax_t m = (std::numeric_limits<std::uintmax_t>::max)();
+   batch_schroder_iterate(f, guess, min, max, digits, m, policies::policy<>());
+}
+
+} // namespace tools
+} // namespace math
+} // namespace boost
+
+#endif // BOOST_MATH_TOOLS_BATCH_ROOTS_HPP
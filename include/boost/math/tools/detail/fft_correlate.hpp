@@ -0,0 +1,234 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef BOOST_MATH_TOOLS_DETAIL_FFT_CORRELATE_HPP
+#define BOOST_MATH_TOOLS_DETAIL_FFT_CORRELATE_HPP
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/math/constants/constants.hpp>
+
+namespace boost::math::tools::detail {
+
+// c[k] = cos(2 pi k/N), s[k] = sin(2 pi k/N) for 0 <= k < N/2.
+// Computing each twiddle directly rather than by recurrence keeps the error of the transform O(eps log N).
+template<class Real>
+void fft_twiddles(std::size_t N, std::vector<Real>& c, std::vector<Real>& s)
+{
+    using std::cos;
+    using std::sin;
+    c.resize(N/2);
+    s.resize(N/2);
+    for (std::size_t k = 0; k < N/2; ++k)
+    {
+        Real theta = boost::math::constants::two_pi<Real>()*k/N;
+        c[k] = cos(theta);
+        s[k] = sin(theta);
+    }
+}
+
+// In place iterative radix 2 FFT of the complex sequence re + i*im, whose length N must be a power of 2,
+// with the twiddles of length N from fft_twiddles.
+// The sign of the exponent is -1 for the forward transform and +1 for the (unnormalized) inverse.
+// Written in terms of Real rather than std::complex<Real> so that multiprecision types work too.
+template<class Real>
+void radix2_fft(std::vector<Real>& re, std::vector<Real>& im, std::vector<Real> const & c, std::vector<Real> const & s, int sign)
+{
+    using std::swap;
+    std::size_t n = re.size();
+    for (std::size_t i = 1, j = 0; i < n; ++i)
+    {
+        std::size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j)
+        {
+            swap(re[i], re[j]);
+            swap(im[i], im[j]);
+        }
+    }
+    for (std::size_t len = 2; len <= n; len <<= 1)
+    {
+        std::size_t half = len/2;
+        std::size_t stride = n/len;
+        // Sweeping each block contiguously is much more cache friendly than sweeping each twiddle across the blocks:
+        for (std::size_t i0 = 0; i0 < n; i0 += len)
+        {
+            for (std::size_t k = 0; k < half; ++k)
+            {
+                std::size_t i = i0 + k;
+                Real wr = c[k*stride];
+                Real wi = sign*s[k*stride];
+                Real xr = re[i + half]*wr - im[i + half]*wi;
+                Real xi = re[i + half]*wi + im[i + half]*wr;
+                re[i + half] = re[i] - xr;
+                im[i + half] = im[i] - xi;
+                re[i] += xr;
+                im[i] += xi;
+            }
+        }
+    }
+}
+
+template<class Real>
+void radix2_fft(std::vector<Real>& re, std::vector<Real>& im, int sign)
+{
+    std::vector<Real> c;
+    std::vector<Real> s;
+    fft_twiddles(re.size(), c, s);
+    radix2_fft(re, im, c, s, sign);
+}
+
+// c[k] = sum_{m=0}^{K-1} x[k + m]*y[m] for 0 <= k < n, where x has n + K - 1 elements and y has K.
+// re and im are workspace.
+template<class Real>
+void fft_correlate(const Real* x, const Real* y, std::size_t K, std::size_t n, Real* c, std::vector<Real>& re, std::vector<Real>& im)
+{
+    std::size_t N = 1;
+    while (N < n + K - 1)
+    {
+        N <<= 1;
+    }
+    re.assign(N, Real(0));
+    im.assign(N, Real(0));
+    // Both sequences are real, so transform them together as x + iy:
+    for (std::size_t i = 0; i < n + K - 1; ++i)
+    {
+        re[i] = x[i];
+    }
+    for (std::size_t i = 0; i < K; ++i)
+    {
+        im[i] = y[i];
+    }
+    std::vector<Real> cs;
+    std::vector<Real> sn;
+    fft_twiddles(N, cs, sn);
+    radix2_fft(re, im, cs, sn, -1);
+    // X[j] = (Z[j] + conj(Z[N-j]))/2, Y[j] = (Z[j] - conj(Z[N-j]))/2i, and the correlation is X[j]*conj(Y[j]).
+    // Entries j and N-j are updated together:
+    for (std::size_t j = 0; j <= N/2; ++j)
+    {
+        std::size_t l = (N - j) % N;
+        Real xr = (re[j] + re[l])/2;
+        Real xi = (im[j] - im[l])/2;
+        Real yr = (im[j] + im[l])/2;
+        Real yi = (re[l] - re[j])/2;
+        // X[j]conj(Y[j]), and its conjugate at N - j since the result is real:
+        Real pr = xr*yr + xi*yi;
+        Real pi = xi*yr - xr*yi;
+        re[j] = pr;
+        im[j] = pi;
+        re[l] = pr;
+        im[l] = -pi;
+    }
+    radix2_fft(re, im, cs, sn, 1);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        c[k] = re[k]/N;
+    }
+}
+
+// Correlation of many blocks of a signal with one fixed kernel of length K, by overlap-save with transforms of length N.
+// The twiddles and the transform of the kernel are computed once, in the constructor.
+template<class Real>
+class fft_correlator {
+public:
+    fft_correlator(const Real* y, std::size_t K, std::size_t N) : m_K{K}, m_N{N}
+    {
+        if (N < K || (N & (N - 1)) != 0)
+        {
+            throw std::domain_error("The transform length must be a power of 2 which is at least the kernel length.");
+        }
+        fft_twiddles(N, m_c, m_s);
+        m_yr.assign(N, Real(0));
+        m_yi.assign(N, Real(0));
+        for (std::size_t i = 0; i < K; ++i)
+        {
+            m_yr[i] = y[i];
+        }
+        radix2_fft(m_yr, m_yi, m_c, m_s, -1);
+        // Store conj(Y)/N, so that applying the kernel is a single complex multiplication:
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            m_yr[j] /= N;
+            m_yi[j] = -m_yi[j]/N;
+        }
+    }
+
+    // Number of outputs produced by each call.
+    std::size_t block_size() const
+    {
+        return m_N - m_K + 1;
+    }
+
+    std::size_t transform_size() const
+    {
+        return m_N;
+    }
+
+    // c1[k] = sum_{m=0}^{K-1} x1[k + m]*y[m] for 0 <= k < block_size(), where x1 has transform_size() elements,
+    // and likewise c2 from x2 unless x2 is null.
+    // Since the kernel is real, two real blocks share one complex transform as x1 + i*x2.
+    // re and im are workspace, so that const objects can be shared between threads.
+    void operator()(const Real* x1, const Real* x2, Real* c1, Real* c2, std::vector<Real>& re, std::vector<Real>& im) const
+    {
+        re.resize(m_N);
+        im.resize(m_N);
+        for (std::size_t i = 0; i < m_N; ++i)
+        {
+            re[i] = x1[i];
+        }
+        if (x2)
+        {
+            for (std::size_t i = 0; i < m_N; ++i)
+            {
+                im[i] = x2[i];
+            }
+        }
+        else
+        {
+            std::fill(im.begin(), im.end(), Real(0));
+        }
+        radix2_fft(re, im, m_c, m_s, -1);
+        for (std::size_t j = 0; j < m_N; ++j)
+        {
+            Real pr = re[j]*m_yr[j] - im[j]*m_yi[j];
+            Real pi = re[j]*m_yi[j] + im[j]*m_yr[j];
+            re[j] = pr;
+            im[j] = pi;
+        }
+        radix2_fft(re, im, m_c, m_s, 1);
+        std::size_t n = block_size();
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            c1[k] = re[k];
+        }
+        if (x2)
+        {
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                c2[k] = im[k];
+            }
+        }
+    }
+
+private:
+    std::size_t m_K;
+    std::size_t m_N;
+    std::vector<Real> m_c;
+    std::vector<Real> m_s;
+    std::vector<Real> m_yr;
+    std::vector<Real> m_yi;
+};
+
+} // namespace boost::math::tools::detail
+#endif
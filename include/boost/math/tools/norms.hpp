@@ -6,14 +6,248 @@
 #ifndef BOOST_MATH_TOOLS_NORMS_HPP
 #define BOOST_MATH_TOOLS_NORMS_HPP
 #include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
 #include <iterator>
 #include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <boost/math/tools/config.hpp>
 #include <boost/math/tools/assert.hpp>
 #include <boost/math/tools/complex.hpp>
 
+// Support compilers with P0024R2 implemented without linking TBB
+// https://en.cppreference.com/w/cpp/compiler_support
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+#include <execution>
+#include <future>
+#include <thread>
+#endif
 
 namespace boost::math::tools {
 
+namespace detail {
+
+// The kernels below are used for float, double and long double, and complex numbers made of them.
+template<class T>
+struct is_native_real_or_complex : std::is_floating_point<T> {};
+
+template<class T>
+struct is_native_real_or_complex<std::complex<T>> : std::is_floating_point<T> {};
+
+template<class ForwardIterator>
+constexpr bool is_random_access_v = std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<ForwardIterator>::iterator_category>::value;
+
+// The kernels keep this many independent partial sums, which the compiler can map onto vector registers
+// without being allowed to reassociate floating point additions.
+constexpr std::size_t norms_lanes = 8;
+
+// Each block is summed on its own before it is added to the total,
+// so that the rounding error grows like block + n/block rather than like n.
+constexpr std::size_t norms_block = 1024;
+
+// Blue's algorithm for the Euclidean norm, as used by the reference BLAS since LAPACK 3.10:
+// see Anderson, Algorithm 978: Safe Scaling in the Level 1 BLAS, ACM TOMS 44 (2017).
+// The squares of values below tsml would underflow and the squares of values above tbig would overflow,
+// so they are scaled by ssml and sbig before they are summed, and the three sums are combined at the end.
+// Unlike rescaling by the largest value, this needs only one pass over the data.
+template<class Real>
+struct l2_scaling
+{
+    static_assert(std::numeric_limits<Real>::radix == 2, "Blue's scaling constants are powers of two.");
+    static constexpr int digits = std::numeric_limits<Real>::digits;
+    static constexpr int min_exponent = std::numeric_limits<Real>::min_exponent;
+    static constexpr int max_exponent = std::numeric_limits<Real>::max_exponent;
+
+    Real tsml = std::ldexp(Real(1), -((1 - min_exponent)/2));
+    Real tbig = std::ldexp(Real(1), (max_exponent - digits + 1)/2);
+    Real ssml = std::ldexp(Real(1), (digits - min_exponent + 1)/2);
+    Real sbig = std::ldexp(Real(1), -((max_exponent + digits)/2));
+};
+
+template<class Real>
+struct l2_accumulator
+{
+    Real small = 0;
+    Real medium = 0;
+    Real big = 0;
+};
+
+template<class Real>
+inline void l2_add(Real x, l2_accumulator<Real>& acc, l2_scaling<Real> const & c)
+{
+    using std::abs;
+    Real ax = abs(x);
+    if (ax > c.tbig)
+    {
+        Real t = ax*c.sbig;
+        acc.big += t*t;
+    }
+    else if (ax < c.tsml)
+    {
+        Real t = ax*c.ssml;
+        acc.small += t*t;
+    }
+    else
+    {
+        // NaNs also end up here:
+        acc.medium += ax*ax;
+    }
+}
+
+template<class Real>
+inline void l2_add(std::complex<Real> const & z, l2_accumulator<Real>& acc, l2_scaling<Real> const & c)
+{
+    l2_add(z.real(), acc, c);
+    l2_add(z.imag(), acc, c);
+}
+
+template<class Real>
+inline void add_square(Real x, Real& sum, Real& max)
+{
+    using std::abs;
+    sum += x*x;
+    Real ax = abs(x);
+    max = (max < ax) ? ax : max;
+}
+
+template<class Real>
+inline void add_square(std::complex<Real> const & z, Real& sum, Real& max)
+{
+    add_square(z.real(), sum, max);
+    add_square(z.imag(), sum, max);
+}
+
+template<class Real>
+Real l2_finish(l2_accumulator<Real> const & acc, l2_scaling<Real> const & c)
+{
+    using std::sqrt;
+    if (acc.big > 0)
+    {
+        // The medium values are scaled like the big ones; the small ones are negligible:
+        Real big = acc.big;
+        if (acc.medium > 0 || acc.medium != acc.medium)
+        {
+            big += (acc.medium*c.sbig)*c.sbig;
+        }
+        return sqrt(big)/c.sbig;
+    }
+    if (acc.small > 0)
+    {
+        if (acc.medium > 0 || acc.medium != acc.medium)
+        {
+            Real ymed = sqrt(acc.medium);
+            Real ysml = sqrt(acc.small)/c.ssml;
+            Real ymin = (std::min)(ymed, ysml);
+            Real ymax = (std::max)(ymed, ysml);
+            Real r = ymin/ymax;
+            return ymax*sqrt(1 + r*r);
+        }
+        return sqrt(acc.small)/c.ssml;
+    }
+    return sqrt(acc.medium);
+}
+
+// Accumulates the squares of f(i) for 0 <= i < n, where f(i) is real or complex.
+// Blocks in which nothing overflows and not everything underflows are summed without scaling, in norms_lanes independent sums;
+// the others are summed again, by Blue's algorithm, while they are still in the cache.
+template<class Real, class F>
+void l2_accumulate(std::size_t n, F f, l2_accumulator<Real>& acc, l2_scaling<Real> const & c)
+{
+    for (std::size_t start = 0; start < n; start += norms_block)
+    {
+        const std::size_t end = (std::min)(n, start + norms_block);
+        std::array<Real, norms_lanes> sums{};
+        std::array<Real, norms_lanes> maxes{};
+        std::size_t i = start;
+        for (; i + norms_lanes <= end; i += norms_lanes)
+        {
+            for (std::size_t l = 0; l < norms_lanes; ++l)
+            {
+                add_square(f(i + l), sums[l], maxes[l]);
+            }
+        }
+        Real sum = 0;
+        Real max = 0;
+        for (; i < end; ++i)
+        {
+            add_square(f(i), sum, max);
+        }
+        for (std::size_t l = 0; l < norms_lanes; ++l)
+        {
+            sum += sums[l];
+            max = (max < maxes[l]) ? maxes[l] : max;
+        }
+        if (max <= c.tbig && (max >= c.tsml || max == 0))
+        {
+            acc.medium += sum;
+        }
+        else
+        {
+            for (i = start; i < end; ++i)
+            {
+                l2_add(f(i), acc, c);
+            }
+        }
+    }
+}
+
+// The Euclidean norm of the f(i), or of *it for it in [first, last) for iterators which are not random access.
+template<class Real, class ForwardIterator, class F>
+Real l2_norm_imp(ForwardIterator first, ForwardIterator last, F f)
+{
+    l2_scaling<Real> c;
+    l2_accumulator<Real> acc;
+    if constexpr (is_random_access_v<ForwardIterator>)
+    {
+        l2_accumulate(static_cast<std::size_t>(std::distance(first, last)), f, acc, c);
+    }
+    else
+    {
+        for (auto it = first; it != last; ++it)
+        {
+            l2_add(*it, acc, c);
+        }
+    }
+    return l2_finish(acc, c);
+}
+
+// The sum of |f(i)| for 0 <= i < n, in blocks of norms_lanes independent sums.
+template<class Real, class F>
+Real l1_accumulate(std::size_t n, F f)
+{
+    using std::abs;
+    Real total = 0;
+    for (std::size_t start = 0; start < n; start += norms_block)
+    {
+        const std::size_t end = (std::min)(n, start + norms_block);
+        std::array<Real, norms_lanes> sums{};
+        std::size_t i = start;
+        for (; i + norms_lanes <= end; i += norms_lanes)
+        {
+            for (std::size_t l = 0; l < norms_lanes; ++l)
+            {
+                sums[l] += abs(f(i + l));
+            }
+        }
+        Real sum = 0;
+        for (; i < end; ++i)
+        {
+            sum += abs(f(i));
+        }
+        for (std::size_t l = 0; l < norms_lanes; ++l)
+        {
+            sum += sums[l];
+        }
+        total += sum;
+    }
+    return total;
+}
+
+} // namespace detail
+
 // Mallat, "A Wavelet Tour of Signal Processing", equation 2.60:
 template<class ForwardIterator>
 auto total_variation(ForwardIterator first, ForwardIterator last)
@@ -131,6 +365,11 @@ auto l1_norm(ForwardIterator first, ForwardIterator last)
         }
         return l1;
     }
+    else if constexpr (detail::is_native_real_or_complex<T>::value && detail::is_random_access_v<ForwardIterator>)
+    {
+        using Real = decltype(abs(*first));
+        return detail::l1_accumulate<Real>(static_cast<std::size_t>(std::distance(first, last)), [first](std::size_t i) { return first[i]; });
+    }
     else
     {
         decltype(abs(*first)) l1 = 0;
@@ -159,7 +398,12 @@ auto l2_norm(ForwardIterator first, ForwardIterator last)
     using std::sqrt;
     using std::is_floating_point;
     using std::isfinite;
-    if constexpr (boost::math::tools::is_complex_type<T>::value)
+    if constexpr (detail::is_native_real_or_complex<T>::value)
+    {
+        using Real = decltype(abs(*first));
+        return detail::l2_norm_imp<Real>(first, last, [first](auto i) { return first[i]; });
+    }
+    else if constexpr (boost::math::tools::is_complex_type<T>::value)
     {
         typedef typename T::value_type Real;
         Real l2 = 0;
@@ -419,7 +663,12 @@ auto l1_distance(ForwardIterator first1, ForwardIterator last1, ForwardIterator
     using T = typename std::iterator_traits<ForwardIterator>::value_type;
     auto it1 = first1;
     auto it2 = first2;
-    if constexpr (boost::math::tools::is_complex_type<T>::value)
+    if constexpr (detail::is_native_real_or_complex<T>::value && detail::is_random_access_v<ForwardIterator>)
+    {
+        using Real = decltype(abs(*first1));
+        return detail::l1_accumulate<Real>(static_cast<std::size_t>(std::distance(first1, last1)), [first1, first2](std::size_t i) { return first1[i] - first2[i]; });
+    }
+    else if constexpr (boost::math::tools::is_complex_type<T>::value)
     {
         using Real = typename T::value_type;
         Real sum = 0;
@@ -493,7 +742,12 @@ auto l2_distance(ForwardIterator first1, ForwardIterator last1, ForwardIterator
     using T = typename std::iterator_traits<ForwardIterator>::value_type;
     auto it1 = first1;
     auto it2 = first2;
-    if constexpr (boost::math::tools::is_complex_type<T>::value)
+    if constexpr (detail::is_native_real_or_complex<T>::value && detail::is_random_access_v<ForwardIterator>)
+    {
+        using Real = decltype(abs(*first1));
+        return detail::l2_norm_imp<Real>(first1, last1, [first1, first2](std::size_t i) { return first1[i] - first2[i]; });
+    }
+    else if constexpr (boost::math::tools::is_complex_type<T>::value)
     {
         using Real = typename T::value_type;
         Real sum = 0;
@@ -624,6 +878,337 @@ auto sup_distance(Container const & v, Container const & w)
     return sup_distance(v.cbegin(), v.cend(), w.begin());
 }
 
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+
+// Overloads taking a standard execution policy. With std::execution::seq they are the functions above;
+// otherwise the range is split into contiguous pieces which are reduced on separate threads by the functions above, and the results combined.
+
+namespace detail {
+
+template<class ExecutionPolicy>
+constexpr bool is_sequenced_policy_v = std::is_same<typename std::decay<ExecutionPolicy>::type, std::execution::sequenced_policy>::value;
+
+// Starting a thread costs about as much as reading 10^5 values, so each piece must be at least this long:
+// https://lemire.me/blog/2020/01/30/cost-of-a-thread-in-c-under-linux/
+constexpr std::size_t norms_min_piece = 65536;
+
+// f(piece_first, piece_last) for each of a number of contiguous pieces of [first, last), in order.
+template<class ForwardIterator, class F>
+auto norms_parallel_pieces(ForwardIterator first, ForwardIterator last, F f)
+{
+    using Result = decltype(f(first, last));
+    const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+    const std::size_t max_concurrency = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
+    const std::size_t pieces = (std::max)(std::size_t(1), (std::min)(max_concurrency, n/norms_min_piece));
+    std::vector<std::future<Result>> future_manager;
+    auto it = first;
+    for (std::size_t i = 0; i + 1 < pieces; ++i)
+    {
+        auto next = std::next(it, n/pieces);
+        future_manager.emplace_back(std::async(std::launch::async, f, it, next));
+        it = next;
+    }
+    // The last piece is done on this thread:
+    Result last_result = f(it, last);
+    std::vector<Result> results;
+    results.reserve(pieces);
+    for (auto & future : future_manager)
+    {
+        results.push_back(future.get());
+    }
+    results.push_back(last_result);
+    return results;
+}
+
+template<class T>
+T norms_sum(std::vector<T> const & v)
+{
+    T sum = v[0];
+    for (std::size_t i = 1; i < v.size(); ++i)
+    {
+        sum += v[i];
+    }
+    return sum;
+}
+
+template<class T>
+T norms_max(std::vector<T> const & v)
+{
+    T max = v[0];
+    for (std::size_t i = 1; i < v.size(); ++i)
+    {
+        if (max < v[i])
+        {
+            max = v[i];
+        }
+    }
+    return max;
+}
+
+// The lp norm of a vector whose pieces have the lp norms given, scaled by the largest so that it can't overflow:
+template<class Real>
+Real norms_combine_lp(std::vector<Real> const & norms, unsigned p)
+{
+    using std::isinf;
+    using std::pow;
+    Real a = 0;
+    for (auto const & r : norms)
+    {
+        if (r != r || isinf(r))
+        {
+            return r;
+        }
+        if (a < r)
+        {
+            a = r;
+        }
+    }
+    if (a == 0)
+    {
+        return a;
+    }
+    Real sum = 0;
+    for (auto const & r : norms)
+    {
+        sum += pow(r/a, p);
+    }
+    return a*pow(sum, Real(1)/Real(p));
+}
+
+} // namespace detail
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto total_variation(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return total_variation(first, last);
+    }
+    else
+    {
+        // The pieces overlap by one value, so that the jumps between them are counted:
+        auto results = detail::norms_parallel_pieces(first, last, [last](ForwardIterator a, ForwardIterator b) { return total_variation(a, b == last ? last : std::next(b)); });
+        return detail::norms_sum(results);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto total_variation(ExecutionPolicy&& exec, Container const & v)
+{
+    return total_variation(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto sup_norm(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return sup_norm(first, last);
+    }
+    else
+    {
+        auto results = detail::norms_parallel_pieces(first, last, [](ForwardIterator a, ForwardIterator b) { return sup_norm(a, b); });
+        return detail::norms_max(results);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto sup_norm(ExecutionPolicy&& exec, Container const & v)
+{
+    return sup_norm(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto l1_norm(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return l1_norm(first, last);
+    }
+    else
+    {
+        auto results = detail::norms_parallel_pieces(first, last, [](ForwardIterator a, ForwardIterator b) { return l1_norm(a, b); });
+        return detail::norms_sum(results);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto l1_norm(ExecutionPolicy&& exec, Container const & v)
+{
+    return l1_norm(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto l2_norm(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return l2_norm(first, last);
+    }
+    else
+    {
+        auto results = detail::norms_parallel_pieces(first, last, [](ForwardIterator a, ForwardIterator b) { return l2_norm(a, b); });
+        return detail::norms_combine_lp(results, 2);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto l2_norm(ExecutionPolicy&& exec, Container const & v)
+{
+    return l2_norm(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto l0_pseudo_norm(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return l0_pseudo_norm(first, last);
+    }
+    else
+    {
+        auto results = detail::norms_parallel_pieces(first, last, [](ForwardIterator a, ForwardIterator b) { return l0_pseudo_norm(a, b); });
+        return detail::norms_sum(results);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto l0_pseudo_norm(ExecutionPolicy&& exec, Container const & v)
+{
+    return l0_pseudo_norm(exec, v.cbegin(), v.cend());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto lp_norm(ExecutionPolicy&&, ForwardIterator first, ForwardIterator last, unsigned p)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return lp_norm(first, last, p);
+    }
+    else
+    {
+        auto results = detail::norms_parallel_pieces(first, last, [p](ForwardIterator a, ForwardIterator b) { return lp_norm(a, b, p); });
+        return detail::norms_combine_lp(results, p);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto lp_norm(ExecutionPolicy&& exec, Container const & v, unsigned p)
+{
+    return lp_norm(exec, v.cbegin(), v.cend(), p);
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto hamming_distance(ExecutionPolicy&&, ForwardIterator first1, ForwardIterator last1, ForwardIterator first2)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return hamming_distance(first1, last1, first2);
+    }
+    else
+    {
+        auto results = detail::norms_parallel_pieces(first1, last1, [first1, first2](ForwardIterator a, ForwardIterator b) { return hamming_distance(a, b, std::next(first2, std::distance(first1, a))); });
+        return detail::norms_sum(results);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto hamming_distance(ExecutionPolicy&& exec, Container const & v, Container const & w)
+{
+    return hamming_distance(exec, v.cbegin(), v.cend(), w.cbegin());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto lp_distance(ExecutionPolicy&&, ForwardIterator first1, ForwardIterator last1, ForwardIterator first2, unsigned p)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return lp_distance(first1, last1, first2, p);
+    }
+    else
+    {
+        auto results = detail::norms_parallel_pieces(first1, last1, [first1, first2, p](ForwardIterator a, ForwardIterator b) { return lp_distance(a, b, std::next(first2, std::distance(first1, a)), p); });
+        return detail::norms_combine_lp(results, p);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto lp_distance(ExecutionPolicy&& exec, Container const & v, Container const & w, unsigned p)
+{
+    return lp_distance(exec, v.cbegin(), v.cend(), w.cbegin(), p);
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto l1_distance(ExecutionPolicy&&, ForwardIterator first1, ForwardIterator last1, ForwardIterator first2)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return l1_distance(first1, last1, first2);
+    }
+    else
+    {
+        auto results = detail::norms_parallel_pieces(first1, last1, [first1, first2](ForwardIterator a, ForwardIterator b) { return l1_distance(a, b, std::next(first2, std::distance(first1, a))); });
+        return detail::norms_sum(results);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto l1_distance(ExecutionPolicy&& exec, Container const & v, Container const & w)
+{
+    using std::size;
+    BOOST_MATH_ASSERT_MSG(size(v) == size(w),
+                     "L1 distance requires both containers to have the same number of elements");
+    return l1_distance(exec, v.cbegin(), v.cend(), w.cbegin());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto l2_distance(ExecutionPolicy&&, ForwardIterator first1, ForwardIterator last1, ForwardIterator first2)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return l2_distance(first1, last1, first2);
+    }
+    else
+    {
+        auto results = detail::norms_parallel_pieces(first1, last1, [first1, first2](ForwardIterator a, ForwardIterator b) { return l2_distance(a, b, std::next(first2, std::distance(first1, a))); });
+        return detail::norms_combine_lp(results, 2);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto l2_distance(ExecutionPolicy&& exec, Container const & v, Container const & w)
+{
+    using std::size;
+    BOOST_MATH_ASSERT_MSG(size(v) == size(w),
+                     "L2 distance requires both containers to have the same number of elements");
+    return l2_distance(exec, v.cbegin(), v.cend(), w.cbegin());
+}
+
+template<class ExecutionPolicy, class ForwardIterator, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+auto sup_distance(ExecutionPolicy&&, ForwardIterator first1, ForwardIterator last1, ForwardIterator first2)
+{
+    if constexpr (detail::is_sequenced_policy_v<ExecutionPolicy>)
+    {
+        return sup_distance(first1, last1, first2);
+    }
+    else
+    {
+        auto results = detail::norms_parallel_pieces(first1, last1, [first1, first2](ForwardIterator a, ForwardIterator b) { return sup_distance(a, b, std::next(first2, std::distance(first1, a))); });
+        return detail::norms_max(results);
+    }
+}
+
+template<class ExecutionPolicy, class Container, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline auto sup_distance(ExecutionPolicy&& exec, Container const & v, Container const & w)
+{
+    using std::size;
+    BOOST_MATH_ASSERT_MSG(size(v) == size(w),
+                     "sup distance requires both containers to have the same number of elements");
+    return sup_distance(exec, v.cbegin(), v.cend(), w.cbegin());
+}
+
+#endif
+
 
 }
 #endif
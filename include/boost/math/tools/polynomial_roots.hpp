@@ -0,0 +1,335 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_POLYNOMIAL_ROOTS_HPP
+#define BOOST_MATH_TOOLS_POLYNOMIAL_ROOTS_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/complex.hpp>
+#include <boost/math/tools/polynomial.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/tools/throw_exception.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/policies/error_handling.hpp>
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+#include <execution>
+#endif
+
+//
+// Finds all the roots of a polynomial simultaneously using the Aberth-Ehrlich method,
+// see for example:
+//
+// D. A. Bini, "Numerical computation of polynomial zeros by means of Aberth's method",
+// Numerical Algorithms 13 (1996), 179-200.
+//
+// Each sweep updates every root from the previous approximations to all the others
+// (Jacobi style), so the O(N^2) work per sweep can be split across threads and the
+// result does not depend on the order in which the roots are updated.
+//
+namespace boost { namespace math { namespace tools {
+
+namespace detail {
+
+   template <class T, bool = is_complex_type<T>::value>
+   struct polynomial_root_type
+   {
+      typedef std::complex<T> type;
+   };
+   template <class T>
+   struct polynomial_root_type<T, true>
+   {
+      typedef T type;
+   };
+
+   //
+   // Computes p'(z)/p(z) and compares |p(z)| with the rounding error incurred in evaluating it.
+   // Returns 2 if z is a root to full working precision, 1 if |p(z)| is within the a priori
+   // error bound for Horner's method (so further progress may be impossible), and 0 otherwise.
+   // a[k] is the coefficient of z^k.  Outside the unit disk we evaluate the reversed
+   // polynomial at 1/z instead, so that high degree polynomials don't overflow.
+   //
+   template <class Complex>
+   int aberth_log_derivative(const std::vector<Complex>& a, const Complex& z, Complex& result)
+   {
+      typedef typename Complex::value_type Real;
+      using std::abs;
+      std::size_t n = a.size() - 1;
+      Real eps = std::numeric_limits<Real>::epsilon();
+      if (abs(z) <= 1)
+      {
+         Complex p = a[n];
+         Complex dp = 0;
+         Real s = abs(a[n]);
+         Real az = abs(z);
+         for (std::size_t k = n; k-- > 0;)
+         {
+            dp = dp * z + p;
+            p = p * z + a[k];
+            s = s * az + abs(a[k]);
+         }
+         if (abs(p) <= 2 * eps * s)
+            return 2;
+         result = dp / p;
+         return abs(p) <= 4 * n * eps * s ? 1 : 0;
+      }
+      Complex w = Real(1) / z;
+      Complex q = a[0];
+      Complex dq = 0;
+      Real s = abs(a[0]);
+      Real aw = abs(w);
+      for (std::size_t k = 1; k <= n; ++k)
+      {
+         dq = dq * w + q;
+         q = q * w + a[k];
+         s = s * aw + abs(a[k]);
+      }
+      if (abs(q) <= 2 * eps * s)
+         return 2;
+      // With q(w) = w^n p(1/w) we have p'(z)/p(z) = (n - w q'(w)/q(w)) / z:
+      result = (Real(n) - w * dq / q) * w;
+      return abs(q) <= 4 * n * eps * s ? 1 : 0;
+   }
+
+   template <class Complex, class ForEach, class Policy>
+   void aberth_ehrlich(const std::vector<Complex>& a, std::vector<Complex>& roots, std::uintmax_t max_iter, ForEach for_each, const char* function, const Policy& pol)
+   {
+      typedef typename Complex::value_type Real;
+      using std::abs;
+      std::size_t n = roots.size();
+      Real eps = std::numeric_limits<Real>::epsilon();
+      std::vector<Complex> corrections(n);
+      std::vector<std::size_t> active(n);
+      std::iota(active.begin(), active.end(), std::size_t(0));
+      std::vector<unsigned char> converged(n);
+      std::vector<Real> last_correction(n, tools::max_value<Real>());
+
+      std::uintmax_t count = 0;
+      while (!active.empty())
+      {
+         if (count++ >= max_iter)
+         {
+            policies::raise_evaluation_error(function, "Aberth-Ehrlich iteration failed to converge after %1% sweeps.", static_cast<Real>(max_iter), pol);
+            return;
+         }
+         for_each(active.begin(), active.end(), [&](std::size_t i)
+         {
+            Complex g;
+            int status = aberth_log_derivative(a, roots[i], g);
+            if (status == 2)
+            {
+               corrections[i] = 0;
+               converged[i] = 1;
+               return;
+            }
+            Complex sum = 0;
+            for (std::size_t j = 0; j < n; ++j)
+            {
+               if (j != i)
+                  sum += Real(1) / (roots[i] - roots[j]);
+            }
+            corrections[i] = Real(1) / (g - sum);
+            Real size = abs(corrections[i]);
+            if ((status == 1) && (size >= last_correction[i]))
+            {
+               // We're in the rounding noise and no longer making progress,
+               // typically this is a multiple or tightly clustered root:
+               corrections[i] = 0;
+               converged[i] = 1;
+               return;
+            }
+            last_correction[i] = size;
+            converged[i] = size <= eps * abs(roots[i]);
+         });
+         std::size_t still_active = 0;
+         for (std::size_t k = 0; k < active.size(); ++k)
+         {
+            std::size_t i = active[k];
+            roots[i] -= corrections[i];
+            if (!converged[i])
+               active[still_active++] = i;
+         }
+         active.resize(still_active);
+      }
+   }
+
+   template <class Complex, class T>
+   std::vector<Complex> aberth_coefficients(const polynomial<T>& p, std::size_t& zero_roots, const char* function)
+   {
+      const std::vector<T>& data = p.data();
+      if (std::find_if(data.begin(), data.end(), [](const T& x) { return x != T(0); }) == data.end())
+      {
+         BOOST_MATH_THROW_EXCEPTION(std::domain_error(std::string(function) + ": the zero polynomial has no well-defined roots."));
+      }
+      std::size_t last = data.size();
+      while (data[last - 1] == T(0))
+         --last;
+      std::size_t first = 0;
+      while (data[first] == T(0))
+         ++first;
+      zero_roots = first;
+      return std::vector<Complex>(data.begin() + first, data.begin() + last);
+   }
+
+   template <class Complex>
+   std::vector<Complex> aberth_initial_guesses(const std::vector<Complex>& a)
+   {
+      typedef typename Complex::value_type Real;
+      using std::abs;
+      using std::pow;
+      using std::cos;
+      using std::sin;
+      std::size_t n = a.size() - 1;
+      std::vector<Complex> roots(n);
+      //
+      // Equally spaced points on the circle whose radius is the geometric mean of the root
+      // moduli, rotated slightly so that no point lies on the real axis:
+      //
+      Real r = pow(abs(a[0]) / abs(a[n]), Real(1) / Real(n));
+      for (std::size_t k = 0; k < n; ++k)
+      {
+         Real theta = (constants::two_pi<Real>() * k + Real(0.7)) / n;
+         roots[k] = Complex(r * cos(theta), r * sin(theta));
+      }
+      return roots;
+   }
+
+   struct sequential_for_each
+   {
+      template <class I, class F>
+      void operator()(I first, I last, F f) const
+      {
+         std::for_each(first, last, f);
+      }
+   };
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+   template <class ExecutionPolicy>
+   struct execution_for_each
+   {
+      ExecutionPolicy& exec;
+      template <class I, class F>
+      void operator()(I first, I last, F f) const
+      {
+         std::for_each(exec, first, last, f);
+      }
+   };
+#endif
+
+   template <class T, class ForEach, class Policy>
+   std::vector<typename polynomial_root_type<T>::type> polynomial_roots_imp(const polynomial<T>& p, ForEach for_each, const Policy& pol)
+   {
+      typedef typename polynomial_root_type<T>::type Complex;
+      static const char* function = "boost::math::tools::polynomial_roots<%1%>";
+      std::size_t zero_roots;
+      std::vector<Complex> a = aberth_coefficients<Complex>(p, zero_roots, function);
+      std::vector<Complex> roots;
+      if (a.size() > 1)
+      {
+         roots = aberth_initial_guesses(a);
+         aberth_ehrlich(a, roots, policies::get_max_root_iterations<Policy>(), for_each, function, pol);
+      }
+      roots.insert(roots.end(), zero_roots, Complex(0));
+      return roots;
+   }
+
+} // namespace detail
+
+template <class T, class Policy>
+inline std::vector<typename detail::polynomial_root_type<T>::type> polynomial_roots(const polynomial<T>& p, const Policy& pol)
+{
+   return detail::polynomial_roots_imp(p, detail::sequential_for_each(), pol);
+}
+
+template <class T>
+inline std::vector<typename detail::polynomial_root_type<T>::type> polynomial_roots(const polynomial<T>& p)
+{
+   return polynomial_roots(p, policies::policy<>());
+}
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+template <class ExecutionPolicy, class T, class Policy, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline std::vector<typename detail::polynomial_root_type<T>::type> polynomial_roots(ExecutionPolicy&& exec, const polynomial<T>& p, const Policy& pol)
+{
+   return detail::polynomial_roots_imp(p, detail::execution_for_each<ExecutionPolicy>{exec}, pol);
+}
+
+template <class ExecutionPolicy, class T, typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+inline std::vector<typename detail::polynomial_root_type<T>::type> polynomial_roots(ExecutionPolicy&& exec, const polynomial<T>& p)
+{
+   return polynomial_roots(exec, p, policies::policy<>());
+}
+#endif
+
+//
+// Refines roots previously found by polynomial_roots, by running further Aberth-Ehrlich
+// sweeps in the higher precision complex type PreciseComplex, before rounding back to
+// the working precision.
+//
+template <class PreciseComplex, class T, class Complex, class Policy>
+void polish_polynomial_roots(const polynomial<T>& p, std::vector<Complex>& roots, const Policy& pol)
+{
+   typedef typename PreciseComplex::value_type PreciseReal;
+   typedef typename Complex::value_type Real;
+   static const char* function = "boost::math::tools::polish_polynomial_roots<%1%>";
+   std::size_t zero_roots;
+   //
+   // The coefficients go straight to the higher precision: rounding them to Complex first
+   // would polish towards the roots of a different polynomial whenever T is the wider type.
+   //
+   std::vector<PreciseComplex> precise_a = detail::aberth_coefficients<PreciseComplex>(p, zero_roots, function);
+   if (roots.size() + 1 != precise_a.size() + zero_roots)
+   {
+      BOOST_MATH_THROW_EXCEPTION(std::domain_error("boost::math::tools::polish_polynomial_roots: the number of roots does not match the degree of the polynomial."));
+   }
+   //
+   // Exact zero roots are already known, polish the others:
+   //
+   std::vector<PreciseComplex> precise_roots;
+   std::vector<std::size_t> index;
+   std::size_t zeros_seen = 0;
+   for (std::size_t k = 0; k < roots.size(); ++k)
+   {
+      if ((roots[k] == Complex(0)) && (zeros_seen < zero_roots))
+      {
+         ++zeros_seen;
+         continue;
+      }
+      precise_roots.push_back(PreciseComplex(PreciseReal(roots[k].real()), PreciseReal(roots[k].imag())));
+      index.push_back(k);
+   }
+   if (precise_roots.size() + 1 != precise_a.size())
+   {
+      BOOST_MATH_THROW_EXCEPTION(std::domain_error("boost::math::tools::polish_polynomial_roots: the roots do not include all the zero roots of the polynomial."));
+   }
+   if (precise_roots.empty())
+      return;
+   detail::aberth_ehrlich(precise_a, precise_roots, policies::get_max_root_iterations<Policy>(), detail::sequential_for_each(), function, pol);
+   for (std::size_t k = 0; k < index.size(); ++k)
+      roots[index[k]] = Complex(static_cast<Real>(precise_roots[k].real()), static_cast<Real>(precise_roots[k].imag()));
+}
+
+template <class PreciseComplex, class T, class Complex>
+inline void polish_polynomial_roots(const polynomial<T>& p, std::vector<Complex>& roots)
+{
+   polish_polynomial_roots<PreciseComplex>(p, roots, policies::policy<>());
+}
+
+}}} // namespaces
+
+#endif // BOOST_MATH_TOOLS_POLYNOMIAL_ROOTS_HPP
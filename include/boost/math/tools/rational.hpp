@@ -322,6 +322,60 @@ inline V evaluate_rational(const std::array<T,N>& a, const std::array<U,N>& b, c
    return detail::evaluate_rational_c_imp(a.data(), b.data(), z, static_cast<std::integral_constant<int, N>*>(0));
 }
 
+//
+// Versions of the above which can be evaluated at compile time, for coefficients
+// held in constexpr std::array's.  The recursion unrolls the whole Horner scheme,
+// so these are just as efficient at run time as the loop expanded versions:
+//
+namespace detail{
+
+template <std::size_t I, std::size_t N, class T, class V>
+BOOST_CXX14_CONSTEXPR V constexpr_polynomial_imp(const std::array<T, N>& a, const V&, const std::true_type&)
+{
+   return static_cast<V>(a[I]);
+}
+
+template <std::size_t I, std::size_t N, class T, class V>
+BOOST_CXX14_CONSTEXPR V constexpr_polynomial_imp(const std::array<T, N>& a, const V& z, const std::false_type&)
+{
+   return static_cast<V>(a[I]) + z * constexpr_polynomial_imp<I + 1>(a, z, std::integral_constant<bool, I + 2 == N>());
+}
+//
+// Evaluates the polynomial with the coefficients in reverse order, starting from a[I]:
+//
+template <std::size_t I, std::size_t N, class T, class V>
+BOOST_CXX14_CONSTEXPR V constexpr_reversed_polynomial_imp(const std::array<T, N>& a, const V&, const std::true_type&)
+{
+   return static_cast<V>(a[I]);
+}
+
+template <std::size_t I, std::size_t N, class T, class V>
+BOOST_CXX14_CONSTEXPR V constexpr_reversed_polynomial_imp(const std::array<T, N>& a, const V& z, const std::false_type&)
+{
+   return static_cast<V>(a[I]) + z * constexpr_reversed_polynomial_imp<I - 1>(a, z, std::integral_constant<bool, I == 1>());
+}
+
+} // namespace detail
+
+template <std::size_t N, class T, class V>
+BOOST_CXX14_CONSTEXPR V constexpr_evaluate_polynomial(const std::array<T, N>& a, const V& z)
+{
+   static_assert(N > 0, "A polynomial must have at least one coefficient.");
+   return detail::constexpr_polynomial_imp<0>(a, z, std::integral_constant<bool, N == 1>());
+}
+
+template <std::size_t N, class T, class U, class V>
+BOOST_CXX14_CONSTEXPR V constexpr_evaluate_rational(const std::array<T, N>& num, const std::array<U, N>& denom, const V& z)
+{
+   static_assert(N > 0, "A rational function must have at least one coefficient.");
+   // As evaluate_rational above: when z > 1 evaluate in 1/z to avoid overflow:
+   return z <= 1 ?
+      detail::constexpr_polynomial_imp<0>(num, z, std::integral_constant<bool, N == 1>())
+         / detail::constexpr_polynomial_imp<0>(denom, z, std::integral_constant<bool, N == 1>())
+      : detail::constexpr_reversed_polynomial_imp<N - 1>(num, V(1 / z), std::integral_constant<bool, N == 1>())
+         / detail::constexpr_reversed_polynomial_imp<N - 1>(denom, V(1 / z), std::integral_constant<bool, N == 1>());
+}
+
 } // namespace tools
 } // namespace math
 } // namespace boost
@@ -85,24 +85,16 @@ struct equal_nearest_integer
 
 namespace detail{
 
-template <class F, class T>
-void bracket(F f, T& a, T& b, T c, T& fa, T& fb, T& d, T& fd)
+template <class T>
+T bracket_point(const T& a, const T& b, T c)
 {
    //
-   // Given a point c inside the existing enclosing interval
-   // [a, b] sets a = c if f(c) == 0, otherwise finds the new 
-   // enclosing interval: either [a, c] or [c, b] and sets
-   // d and fd to the point that has just been removed from
-   // the interval.  In other words d is the third best guess
-   // to the root.
+   // Moves the point c, at which bracket is about to evaluate f, away
+   // from the ends of [a, b] when it is too close to one of them, or
+   // to the middle when the interval itself is tiny.
    //
    BOOST_MATH_STD_USING  // For ADL of std math functions
    T tol = tools::epsilon<T>() * 2;
-   //
-   // If the interval [a,b] is very small, or if c is too close 
-   // to one end of the interval then we need to adjust the
-   // location of c accordingly:
-   //
    if((b - a) < 2 * tol * a)
    {
       c = a + (b - a) / 2;
@@ -115,12 +107,17 @@ void bracket(F f, T& a, T& b, T c, T& fa, T& fb, T& d, T& fd)
    {
       c = b - fabs(b) * tol;
    }
+   return c;
+}
+
+template <class T>
+void update_bracket(T& a, T& b, const T& c, const T& fc, T& fa, T& fb, T& d, T& fd)
+{
    //
-   // OK, lets invoke f(c):
-   //
-   T fc = f(c);
-   //
-   // if we have a zero then we have an exact solution to the root:
+   // Given f(c) at a point c returned by bracket_point, sets a = c if
+   // f(c) == 0, otherwise finds the new enclosing interval: either [a, c]
+   // or [c, b] and sets d and fd to the point that has just been removed
+   // from the interval.  In other words d is the third best guess to the root.
    //
    if(fc == 0)
    {
@@ -149,6 +146,22 @@ void bracket(F f, T& a, T& b, T c, T& fa, T& fb, T& d, T& fd)
    }
 }
 
+template <class F, class T>
+void bracket(F f, T& a, T& b, T c, T& fa, T& fb, T& d, T& fd)
+{
+   //
+   // Given a point c inside the existing enclosing interval
+   // [a, b] sets a = c if f(c) == 0, otherwise finds the new 
+   // enclosing interval: either [a, c] or [c, b] and sets
+   // d and fd to the point that has just been removed from
+   // the interval.  In other words d is the third best guess
+   // to the root.
+   //
+   c = bracket_point(a, b, c);
+   T fc = f(c);
+   update_bracket(a, b, c, fc, fa, fb, d, fd);
+}
+
 template <class T>
 inline T safe_div(T num, T denom, T r)
 {
@@ -34,10 +34,22 @@ namespace random_ns = boost::random;
 #endif
 #include <boost/math/tools/tuple.hpp>
 #include <boost/math/tools/real_cast.hpp>
+#include <boost/math/tools/precision.hpp>
 
 #include <set>
 #include <vector>
+#include <array>
+#include <string>
+#include <sstream>
+#include <fstream>
 #include <iostream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdint>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>
 
 #ifdef _MSC_VER
 #  pragma warning(push)
@@ -178,8 +190,53 @@ inline void unpack_and_append(Seq& s, const Item& data)
    unpack_and_append(s, data, ::std::is_convertible<Item, value_type>());
 }
 
+template <class F, class T>
+inline auto call_with_arguments(F& func, const std::array<T, 1>& a) -> decltype(func(a[0]))
+{
+   return func(a[0]);
+}
+template <class F, class T>
+inline auto call_with_arguments(F& func, const std::array<T, 2>& a) -> decltype(func(a[0], a[1]))
+{
+   return func(a[0], a[1]);
+}
+template <class F, class T>
+inline auto call_with_arguments(F& func, const std::array<T, 3>& a) -> decltype(func(a[0], a[1], a[2]))
+{
+   return func(a[0], a[1], a[2]);
+}
+template <class F, class T>
+inline auto call_with_arguments(F& func, const std::array<T, 4>& a) -> decltype(func(a[0], a[1], a[2], a[3]))
+{
+   return func(a[0], a[1], a[2], a[3]);
+}
+template <class F, class T>
+inline auto call_with_arguments(F& func, const std::array<T, 5>& a) -> decltype(func(a[0], a[1], a[2], a[3], a[4]))
+{
+   return func(a[0], a[1], a[2], a[3], a[4]);
+}
+
 } // detail
 
+//
+// Controls how test_data::insert_parallel shares out the work:
+//
+// threads is the number of worker threads, zero for one per core.
+// chunk_size is the number of points handed to a thread at a time, and the unit
+// of checkpointing.
+// If checkpoint_file is not empty, each completed chunk is appended to that file,
+// and a later run over the same points picks up the completed chunks from it rather
+// than recalculating them.  The file is removed once all the points are done.
+//
+struct parallel_generation_options
+{
+   parallel_generation_options(unsigned t = 0, std::size_t c = 8, const std::string& f = std::string())
+      : threads(t), chunk_size(c), checkpoint_file(f) {}
+   unsigned threads;
+   std::size_t chunk_size;
+   std::string checkpoint_file;
+};
+
 template <class T>
 class test_data
 {
@@ -460,6 +517,53 @@ public:
       return *this;
    }
 
+   //
+   // Parallel insertion: as above, but the points are evaluated on several threads, so
+   // func must be safe to call concurrently (each thread gets its own copy).
+   // Generators which draw random numbers from shared state must use insert instead.
+   //
+   template <class F>
+   test_data& insert_parallel(F func, const parameter_info<T>& arg1, const parallel_generation_options& opts = parallel_generation_options())
+   {
+      std::array<parameter_info<T>, 1> args = {{ arg1 }};
+      return insert_parallel(func, std::vector<std::array<parameter_info<T>, 1> >(1, args), opts);
+   }
+
+   template <class F>
+   test_data& insert_parallel(F func, const parameter_info<T>& arg1, const parameter_info<T>& arg2, const parallel_generation_options& opts = parallel_generation_options())
+   {
+      std::array<parameter_info<T>, 2> args = {{ arg1, arg2 }};
+      return insert_parallel(func, std::vector<std::array<parameter_info<T>, 2> >(1, args), opts);
+   }
+
+   template <class F>
+   test_data& insert_parallel(F func, const parameter_info<T>& arg1, const parameter_info<T>& arg2, const parameter_info<T>& arg3, const parallel_generation_options& opts = parallel_generation_options())
+   {
+      std::array<parameter_info<T>, 3> args = {{ arg1, arg2, arg3 }};
+      return insert_parallel(func, std::vector<std::array<parameter_info<T>, 3> >(1, args), opts);
+   }
+
+   template <class F>
+   test_data& insert_parallel(F func, const parameter_info<T>& arg1, const parameter_info<T>& arg2, const parameter_info<T>& arg3, const parameter_info<T>& arg4, const parallel_generation_options& opts = parallel_generation_options())
+   {
+      std::array<parameter_info<T>, 4> args = {{ arg1, arg2, arg3, arg4 }};
+      return insert_parallel(func, std::vector<std::array<parameter_info<T>, 4> >(1, args), opts);
+   }
+
+   template <class F>
+   test_data& insert_parallel(F func, const parameter_info<T>& arg1, const parameter_info<T>& arg2, const parameter_info<T>& arg3, const parameter_info<T>& arg4, const parameter_info<T>& arg5, const parallel_generation_options& opts = parallel_generation_options())
+   {
+      std::array<parameter_info<T>, 5> args = {{ arg1, arg2, arg3, arg4, arg5 }};
+      return insert_parallel(func, std::vector<std::array<parameter_info<T>, 5> >(1, args), opts);
+   }
+
+   //
+   // Each entry in grids is the set of parameters for one of the calls above:
+   // they're all evaluated together so that the threads are kept busy throughout:
+   //
+   template <class F, std::size_t N>
+   test_data& insert_parallel(F func, const std::vector<std::array<parameter_info<T>, N> >& grids, const parallel_generation_options& opts = parallel_generation_options());
+
    void clear(){ m_data.clear(); }
 
    // access:
@@ -481,6 +585,11 @@ public:
 
 private:
    void create_test_points(std::set<T>& points, const parameter_info<T>& arg1);
+   template <std::size_t N>
+   static std::uint64_t checkpoint_key(const std::vector<std::array<T, N> >& points, std::size_t chunk_size);
+   static void load_checkpoint(const std::string& file, std::uint64_t key, std::vector<std::vector<row_type> >& chunks, std::vector<char>& done);
+   static void write_checkpoint_chunk(std::ostream& os, std::size_t chunk, const std::vector<row_type>& rows);
+   static int checkpoint_precision(){ return static_cast<int>(boost::math::tools::digits<T>() * 301L / 1000L + 3); }
    std::set<row_type> m_data;
 
    static float extern_val;
@@ -587,6 +696,233 @@ void test_data<T>::create_test_points(std::set<T>& points, const parameter_info<
    }
 }
 
+template <class T>
+template <class F, std::size_t N>
+test_data<T>& test_data<T>::insert_parallel(F func, const std::vector<std::array<parameter_info<T>, N> >& grids, const parallel_generation_options& opts)
+{
+   //
+   // Expand every grid into its points, along with the leading values of
+   // each output row (the arguments which are not dummy parameters):
+   //
+   std::vector<std::array<T, N> > points;
+   std::vector<row_type> prefixes;
+   for(std::size_t g = 0; g < grids.size(); ++g)
+   {
+      std::array<std::vector<T>, N> values;
+      bool empty_grid = false;
+      for(std::size_t i = 0; i < N; ++i)
+      {
+         std::set<T> p;
+         create_test_points(p, grids[g][i]);
+         values[i].assign(p.begin(), p.end());
+         empty_grid = empty_grid || values[i].empty();
+      }
+      if(empty_grid)
+         continue;
+      std::array<std::size_t, N> index = {};
+      bool more = true;
+      while(more)
+      {
+         std::array<T, N> point;
+         row_type prefix;
+         for(std::size_t i = 0; i < N; ++i)
+         {
+            point[i] = values[i][index[i]];
+            if((grids[g][i].type & dummy_param) == 0)
+               prefix.push_back(point[i]);
+         }
+         points.push_back(point);
+         prefixes.push_back(prefix);
+         //
+         // Next point, the last argument varies fastest as in insert:
+         //
+         more = false;
+         for(std::size_t i = N; i > 0; --i)
+         {
+            if(++index[i - 1] < values[i - 1].size())
+            {
+               more = true;
+               break;
+            }
+            index[i - 1] = 0;
+         }
+      }
+   }
+   if(points.empty())
+      return *this;
+
+   std::size_t chunk_size = opts.chunk_size ? opts.chunk_size : 1;
+   std::size_t n_chunks = (points.size() + chunk_size - 1) / chunk_size;
+   std::vector<std::vector<row_type> > results(n_chunks);
+   std::vector<char> done(n_chunks, 0);
+
+   std::ofstream checkpoint;
+   if(!opts.checkpoint_file.empty())
+   {
+      std::uint64_t key = checkpoint_key(points, chunk_size);
+      load_checkpoint(opts.checkpoint_file, key, results, done);
+      //
+      // Rewrite the file with just the complete chunks, so that anything
+      // left half written by an interrupted run is discarded:
+      //
+      checkpoint.open(opts.checkpoint_file.c_str(), std::ios_base::out | std::ios_base::trunc);
+      checkpoint << "test_data_checkpoint " << key << "\n";
+      for(std::size_t c = 0; c < n_chunks; ++c)
+         if(done[c])
+            write_checkpoint_chunk(checkpoint, c, results[c]);
+      checkpoint.flush();
+   }
+
+   unsigned n_threads = opts.threads ? opts.threads : std::thread::hardware_concurrency();
+   if(n_threads == 0)
+      n_threads = 1;
+   if(n_threads > n_chunks)
+      n_threads = static_cast<unsigned>(n_chunks);
+
+   std::atomic<std::size_t> next_chunk(0);
+   std::atomic<bool> failed(false);
+   std::exception_ptr error;
+   std::mutex mu;
+
+   auto worker = [&]()
+   {
+      F f(func);
+      std::vector<row_type> rows;
+      while(!failed)
+      {
+         std::size_t c = next_chunk++;
+         if(c >= n_chunks)
+            break;
+         if(done[c])
+            continue;
+         rows.clear();
+         std::size_t last = (std::min)(points.size(), (c + 1) * chunk_size);
+         for(std::size_t i = c * chunk_size; i < last; ++i)
+         {
+            row_type row(prefixes[i]);
+#ifndef BOOST_NO_EXCEPTIONS
+            try{
+#endif
+               // domain_error exceptions from func are swallowed
+               // and this data point is ignored:
+               detail::unpack_and_append(row, detail::call_with_arguments(f, points[i]));
+               rows.push_back(row);
+#ifndef BOOST_NO_EXCEPTIONS
+            }
+            catch(const std::domain_error&){}
+            catch(...)
+            {
+               // anything else stops all the threads, and is rethrown below:
+               std::lock_guard<std::mutex> l(mu);
+               if(!error)
+                  error = std::current_exception();
+               failed = true;
+               return;
+            }
+#endif
+         }
+         std::lock_guard<std::mutex> l(mu);
+         results[c].swap(rows);
+         done[c] = 1;
+         if(checkpoint.is_open())
+         {
+            write_checkpoint_chunk(checkpoint, c, results[c]);
+            checkpoint.flush();
+         }
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for(unsigned i = 1; i < n_threads; ++i)
+      threads.push_back(std::thread(worker));
+   worker();
+   for(std::size_t i = 0; i < threads.size(); ++i)
+      threads[i].join();
+
+   if(error)
+      std::rethrow_exception(error);
+
+   for(std::size_t c = 0; c < n_chunks; ++c)
+      m_data.insert(results[c].begin(), results[c].end());
+
+   if(checkpoint.is_open())
+   {
+      checkpoint.close();
+      std::remove(opts.checkpoint_file.c_str());
+   }
+   return *this;
+}
+
+//
+// The checkpoint file starts with a hash of the points and the chunk size, so
+// that results for some other set of points are never picked up, followed by
+// one record per completed chunk:
+//
+// chunk <index> <rows>
+// <columns> <value>...
+//
+template <class T>
+template <std::size_t N>
+std::uint64_t test_data<T>::checkpoint_key(const std::vector<std::array<T, N> >& points, std::size_t chunk_size)
+{
+   // FNV-1a over the printed values:
+   std::stringstream ss;
+   ss << std::setprecision(checkpoint_precision()) << chunk_size;
+   for(std::size_t i = 0; i < points.size(); ++i)
+      for(std::size_t j = 0; j < N; ++j)
+         ss << ' ' << points[i][j];
+   std::string str = ss.str();
+   std::uint64_t h = 14695981039346656037uLL;
+   for(std::size_t i = 0; i < str.size(); ++i)
+   {
+      h ^= static_cast<unsigned char>(str[i]);
+      h *= 1099511628211uLL;
+   }
+   return h;
+}
+
+template <class T>
+void test_data<T>::load_checkpoint(const std::string& file, std::uint64_t key, std::vector<std::vector<row_type> >& chunks, std::vector<char>& done)
+{
+   std::ifstream is(file.c_str());
+   std::string tag;
+   std::uint64_t file_key;
+   if(!(is >> tag >> file_key) || (tag != "test_data_checkpoint") || (file_key != key))
+      return;
+   std::size_t c, n_rows, n_cols;
+   while(is >> tag >> c >> n_rows)
+   {
+      if((tag != "chunk") || (c >= chunks.size()))
+         return;
+      std::vector<row_type> rows(n_rows);
+      for(std::size_t i = 0; i < n_rows; ++i)
+      {
+         if(!(is >> n_cols))
+            return;
+         rows[i].resize(n_cols);
+         for(std::size_t j = 0; j < n_cols; ++j)
+            if(!(is >> rows[i][j]))
+               return;
+      }
+      chunks[c].swap(rows);
+      done[c] = 1;
+   }
+}
+
+template <class T>
+void test_data<T>::write_checkpoint_chunk(std::ostream& os, std::size_t chunk, const std::vector<row_type>& rows)
+{
+   os << std::scientific << std::setprecision(checkpoint_precision());
+   os << "chunk " << chunk << " " << rows.size() << "\n";
+   for(std::size_t i = 0; i < rows.size(); ++i)
+   {
+      os << rows[i].size();
+      for(std::size_t j = 0; j < rows[i].size(); ++j)
+         os << ' ' << rows[i][j];
+      os << '\n';
+   }
+}
+
 //
 // Prompt a user for information on a parameter range:
 //
@@ -0,0 +1,199 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Times pdf, cdf, cdf complement, quantile and quantile complement for every
+// distribution in boost/math/distributions, for float, double and long double.
+//
+// Each benchmark is run over a family of distributions indexed by an integer
+// "size" N; the parameter that N controls (degrees of freedom, non-centrality,
+// number of trials, etc) is given in each *_family below.  The reported time is
+// per call, cycling over points spread across the body and tails of the
+// distribution.  The complexity fit shows how the cost grows with N.
+//
+// Build with, for example:
+//
+//    g++ -std=c++17 -O3 -I../../include distributions_performance.cpp -lbenchmark -lpthread
+//
+// and then use --benchmark_filter to select distributions, for example
+// --benchmark_filter='non_central_t.*<double>' times all the non-central t functions at double precision.
+// --benchmark_format=json --benchmark_out=results.json writes the results out for regression tracking.
+//
+
+#include <array>
+#include <cmath>
+#include <exception>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions.hpp>
+
+namespace bm = boost::math;
+
+template<class Real> struct arcsine_family { static bm::arcsine_distribution<Real> make(Real N) { return bm::arcsine_distribution<Real>(0, N); } };
+template<class Real> struct bernoulli_family { static bm::bernoulli_distribution<Real> make(Real N) { return bm::bernoulli_distribution<Real>(1 / (N + 1)); } };
+template<class Real> struct beta_family { static bm::beta_distribution<Real> make(Real N) { return bm::beta_distribution<Real>(N / 4 + Real(0.5), N / 2 + 1); } };
+template<class Real> struct binomial_family { static bm::binomial_distribution<Real> make(Real N) { return bm::binomial_distribution<Real>(8 * N, Real(0.3)); } };
+template<class Real> struct cauchy_family { static bm::cauchy_distribution<Real> make(Real N) { return bm::cauchy_distribution<Real>(0, N); } };
+template<class Real> struct chi_squared_family { static bm::chi_squared_distribution<Real> make(Real N) { return bm::chi_squared_distribution<Real>(N); } };
+template<class Real> struct exponential_family { static bm::exponential_distribution<Real> make(Real N) { return bm::exponential_distribution<Real>(1 / N); } };
+template<class Real> struct extreme_value_family { static bm::extreme_value_distribution<Real> make(Real N) { return bm::extreme_value_distribution<Real>(0, N); } };
+template<class Real> struct fisher_f_family { static bm::fisher_f_distribution<Real> make(Real N) { return bm::fisher_f_distribution<Real>(N, N + 2); } };
+template<class Real> struct gamma_family { static bm::gamma_distribution<Real> make(Real N) { return bm::gamma_distribution<Real>(N, 1); } };
+template<class Real> struct geometric_family { static bm::geometric_distribution<Real> make(Real N) { return bm::geometric_distribution<Real>(1 / (N + 1)); } };
+template<class Real> struct hyperexponential_family
+{
+    static bm::hyperexponential_distribution<Real> make(Real N)
+    {
+        const std::array<Real, 3> probabilities = { Real(0.2), Real(0.3), Real(0.5) };
+        const std::array<Real, 3> rates = { 1, N, N * N };
+        return bm::hyperexponential_distribution<Real>(probabilities, rates);
+    }
+};
+template<class Real> struct hypergeometric_family
+{
+    static bm::hypergeometric_distribution<Real> make(Real N)
+    {
+        unsigned n = static_cast<unsigned>(N);
+        return bm::hypergeometric_distribution<Real>(4 * n, 8 * n, 32 * n);
+    }
+};
+template<class Real> struct inverse_chi_squared_family { static bm::inverse_chi_squared_distribution<Real> make(Real N) { return bm::inverse_chi_squared_distribution<Real>(N); } };
+template<class Real> struct inverse_gamma_family { static bm::inverse_gamma_distribution<Real> make(Real N) { return bm::inverse_gamma_distribution<Real>(N, 1); } };
+template<class Real> struct inverse_gaussian_family { static bm::inverse_gaussian_distribution<Real> make(Real N) { return bm::inverse_gaussian_distribution<Real>(N, 1); } };
+template<class Real> struct kolmogorov_smirnov_family { static bm::kolmogorov_smirnov_distribution<Real> make(Real N) { return bm::kolmogorov_smirnov_distribution<Real>(N); } };
+template<class Real> struct laplace_family { static bm::laplace_distribution<Real> make(Real N) { return bm::laplace_distribution<Real>(0, N); } };
+template<class Real> struct logistic_family { static bm::logistic_distribution<Real> make(Real N) { return bm::logistic_distribution<Real>(0, N); } };
+template<class Real> struct lognormal_family { static bm::lognormal_distribution<Real> make(Real N) { return bm::lognormal_distribution<Real>(std::log(N), 1); } };
+template<class Real> struct negative_binomial_family { static bm::negative_binomial_distribution<Real> make(Real N) { return bm::negative_binomial_distribution<Real>(N, Real(0.4)); } };
+template<class Real> struct non_central_beta_family { static bm::non_central_beta_distribution<Real> make(Real N) { return bm::non_central_beta_distribution<Real>(4, 6, N); } };
+template<class Real> struct non_central_chi_squared_family { static bm::non_central_chi_squared_distribution<Real> make(Real N) { return bm::non_central_chi_squared_distribution<Real>(4, N); } };
+template<class Real> struct non_central_f_family { static bm::non_central_f_distribution<Real> make(Real N) { return bm::non_central_f_distribution<Real>(4, 8, N); } };
+template<class Real> struct non_central_t_family { static bm::non_central_t_distribution<Real> make(Real N) { return bm::non_central_t_distribution<Real>(8, std::sqrt(N)); } };
+template<class Real> struct normal_family { static bm::normal_distribution<Real> make(Real N) { return bm::normal_distribution<Real>(0, N); } };
+template<class Real> struct pareto_family { static bm::pareto_distribution<Real> make(Real N) { return bm::pareto_distribution<Real>(N, 3); } };
+template<class Real> struct poisson_family { static bm::poisson_distribution<Real> make(Real N) { return bm::poisson_distribution<Real>(N); } };
+template<class Real> struct rayleigh_family { static bm::rayleigh_distribution<Real> make(Real N) { return bm::rayleigh_distribution<Real>(N); } };
+template<class Real> struct skew_normal_family { static bm::skew_normal_distribution<Real> make(Real N) { return bm::skew_normal_distribution<Real>(0, 1, std::log2(N)); } };
+template<class Real> struct students_t_family { static bm::students_t_distribution<Real> make(Real N) { return bm::students_t_distribution<Real>(N); } };
+template<class Real> struct triangular_family { static bm::triangular_distribution<Real> make(Real N) { return bm::triangular_distribution<Real>(0, N / 4, N); } };
+template<class Real> struct uniform_family { static bm::uniform_distribution<Real> make(Real N) { return bm::uniform_distribution<Real>(0, N); } };
+template<class Real> struct weibull_family { static bm::weibull_distribution<Real> make(Real N) { return bm::weibull_distribution<Real>(Real(1.5), N); } };
+
+// The functions being timed, and the argument each one takes at probability p:
+struct pdf_op
+{
+    template<class Dist, class Real> static Real argument(const Dist& d, Real p) { return quantile(d, p); }
+    template<class Dist, class Real> static Real eval(const Dist& d, Real x) { return pdf(d, x); }
+};
+struct cdf_op
+{
+    template<class Dist, class Real> static Real argument(const Dist& d, Real p) { return quantile(d, p); }
+    template<class Dist, class Real> static Real eval(const Dist& d, Real x) { return cdf(d, x); }
+};
+struct cdf_complement_op
+{
+    template<class Dist, class Real> static Real argument(const Dist& d, Real p) { return quantile(d, p); }
+    template<class Dist, class Real> static Real eval(const Dist& d, Real x) { return cdf(complement(d, x)); }
+};
+struct quantile_op
+{
+    template<class Dist, class Real> static Real argument(const Dist&, Real p) { return p; }
+    template<class Dist, class Real> static Real eval(const Dist& d, Real p) { return quantile(d, p); }
+};
+struct quantile_complement_op
+{
+    template<class Dist, class Real> static Real argument(const Dist&, Real p) { return p; }
+    template<class Dist, class Real> static Real eval(const Dist& d, Real q) { return quantile(complement(d, q)); }
+};
+
+template<template<class> class Family, class Real, class Op>
+void distribution_benchmark(benchmark::State& state)
+{
+    auto dist = Family<Real>::make(static_cast<Real>(state.range(0)));
+    const Real probabilities[] = { Real(1e-6), Real(0.001), Real(0.01), Real(0.05), Real(0.1), Real(0.25), Real(0.4), Real(0.5),
+                                   Real(0.6), Real(0.75), Real(0.9), Real(0.95), Real(0.99), Real(0.999), Real(0.999999) };
+    std::vector<Real> args;
+    for (Real p : probabilities)
+    {
+        // Points where the distribution can't be evaluated (an overflowing tail say) are dropped
+        // rather than letting an exception escape from the timing loop:
+        try
+        {
+            Real x = Op::argument(dist, p);
+            benchmark::DoNotOptimize(Op::eval(dist, x));
+            args.push_back(x);
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+    if (args.empty())
+    {
+        state.SkipWithError("No evaluation points");
+        return;
+    }
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Op::eval(dist, args[i]));
+        if (++i == args.size())
+        {
+            i = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetComplexityN(state.range(0));
+}
+
+#define BOOST_MATH_DISTRIBUTION_BENCHMARK(family, Real, op) \
+    BENCHMARK_TEMPLATE(distribution_benchmark, family, Real, op)->RangeMultiplier(4)->Range(1, 1 << 10)->Complexity();
+
+#define BOOST_MATH_DISTRIBUTION_BENCHMARKS_FOR_TYPE(family, Real) \
+    BOOST_MATH_DISTRIBUTION_BENCHMARK(family, Real, pdf_op) \
+    BOOST_MATH_DISTRIBUTION_BENCHMARK(family, Real, cdf_op) \
+    BOOST_MATH_DISTRIBUTION_BENCHMARK(family, Real, cdf_complement_op) \
+    BOOST_MATH_DISTRIBUTION_BENCHMARK(family, Real, quantile_op) \
+    BOOST_MATH_DISTRIBUTION_BENCHMARK(family, Real, quantile_complement_op)
+
+#define BOOST_MATH_DISTRIBUTION_BENCHMARKS(family) \
+    BOOST_MATH_DISTRIBUTION_BENCHMARKS_FOR_TYPE(family, float) \
+    BOOST_MATH_DISTRIBUTION_BENCHMARKS_FOR_TYPE(family, double) \
+    BOOST_MATH_DISTRIBUTION_BENCHMARKS_FOR_TYPE(family, long double)
+
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(arcsine_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(bernoulli_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(beta_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(binomial_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(cauchy_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(chi_squared_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(exponential_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(extreme_value_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(fisher_f_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(gamma_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(geometric_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(hyperexponential_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(hypergeometric_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(inverse_chi_squared_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(inverse_gamma_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(inverse_gaussian_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(kolmogorov_smirnov_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(laplace_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(logistic_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(lognormal_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(negative_binomial_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(non_central_beta_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(non_central_chi_squared_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(non_central_f_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(non_central_t_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(normal_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(pareto_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(poisson_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(rayleigh_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(skew_normal_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(students_t_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(triangular_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(uniform_family)
+BOOST_MATH_DISTRIBUTION_BENCHMARKS(weibull_family)
+
+BENCHMARK_MAIN();
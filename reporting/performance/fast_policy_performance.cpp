@@ -0,0 +1,132 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Compares the special functions evaluated with policies::fast_policy against
+// the same functions at full precision, both with the default policy (double
+// evaluated in long double where that is wider) and with double evaluated as
+// double - the latter is the fair comparison for the speedup from the lower
+// degree approximations and shorter series alone.
+//
+// Build with, for example:
+//
+//    g++ -std=c++17 -O3 -I../../include fast_policy_performance.cpp -lbenchmark -lpthread
+//
+// and compare, for example, erf<double, fast> with erf<double, double_precision>.
+//
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+
+namespace bm = boost::math;
+
+typedef bm::policies::policy<> full_precision;
+typedef bm::policies::policy<bm::policies::promote_double<false> > double_precision;
+typedef bm::policies::fast_policy fast;
+
+// The functions being timed, each with the range of arguments it's called over:
+struct erf_op
+{
+    static double lower() { return -4; }
+    static double upper() { return 4; }
+    template<class Real, class Policy> static Real eval(Real x, const Policy& pol) { return bm::erf(x, pol); }
+};
+struct erfc_op
+{
+    static double lower() { return -2; }
+    static double upper() { return 20; }
+    template<class Real, class Policy> static Real eval(Real x, const Policy& pol) { return bm::erfc(x, pol); }
+};
+struct tgamma_op
+{
+    static double lower() { return 0.01; }
+    static double upper() { return 30; }
+    template<class Real, class Policy> static Real eval(Real x, const Policy& pol) { return bm::tgamma(x, pol); }
+};
+struct lgamma_op
+{
+    static double lower() { return 0.01; }
+    static double upper() { return 100; }
+    template<class Real, class Policy> static Real eval(Real x, const Policy& pol) { return bm::lgamma(x, pol); }
+};
+struct gamma_p_op
+{
+    static double lower() { return 0.5; }
+    static double upper() { return 40; }
+    template<class Real, class Policy> static Real eval(Real x, const Policy& pol) { return bm::gamma_p(Real(10), x, pol); }
+};
+struct ibeta_op
+{
+    static double lower() { return 0.01; }
+    static double upper() { return 0.99; }
+    template<class Real, class Policy> static Real eval(Real x, const Policy& pol) { return bm::ibeta(Real(3.5), Real(12.25), x, pol); }
+};
+struct beta_op
+{
+    static double lower() { return 0.1; }
+    static double upper() { return 50; }
+    template<class Real, class Policy> static Real eval(Real x, const Policy& pol) { return bm::beta(x, Real(2.5), pol); }
+};
+struct bessel_i0_op
+{
+    static double lower() { return 0; }
+    static double upper() { return 50; }
+    template<class Real, class Policy> static Real eval(Real x, const Policy& pol) { return bm::cyl_bessel_i(0, x, pol); }
+};
+struct bessel_k1_op
+{
+    static double lower() { return 0.01; }
+    static double upper() { return 50; }
+    template<class Real, class Policy> static Real eval(Real x, const Policy& pol) { return bm::cyl_bessel_k(1, x, pol); }
+};
+struct bessel_j_op
+{
+    static double lower() { return 0.5; }
+    static double upper() { return 30; }
+    template<class Real, class Policy> static Real eval(Real x, const Policy& pol) { return bm::cyl_bessel_j(Real(2.5), x, pol); }
+};
+
+template<class Op, class Real, class Policy>
+void fast_policy_benchmark(benchmark::State& state)
+{
+    std::vector<Real> args;
+    for (int i = 0; i < 64; ++i)
+    {
+        args.push_back(static_cast<Real>(Op::lower() + (Op::upper() - Op::lower()) * (i + 0.5) / 64));
+    }
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Op::eval(args[i], Policy()));
+        if (++i == args.size())
+        {
+            i = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+#define BOOST_MATH_FAST_POLICY_BENCHMARKS(op) \
+    BENCHMARK_TEMPLATE(fast_policy_benchmark, op, float, full_precision); \
+    BENCHMARK_TEMPLATE(fast_policy_benchmark, op, float, fast); \
+    BENCHMARK_TEMPLATE(fast_policy_benchmark, op, double, full_precision); \
+    BENCHMARK_TEMPLATE(fast_policy_benchmark, op, double, double_precision); \
+    BENCHMARK_TEMPLATE(fast_policy_benchmark, op, double, fast);
+
+BOOST_MATH_FAST_POLICY_BENCHMARKS(erf_op)
+BOOST_MATH_FAST_POLICY_BENCHMARKS(erfc_op)
+BOOST_MATH_FAST_POLICY_BENCHMARKS(tgamma_op)
+BOOST_MATH_FAST_POLICY_BENCHMARKS(lgamma_op)
+BOOST_MATH_FAST_POLICY_BENCHMARKS(gamma_p_op)
+BOOST_MATH_FAST_POLICY_BENCHMARKS(ibeta_op)
+BOOST_MATH_FAST_POLICY_BENCHMARKS(beta_op)
+BOOST_MATH_FAST_POLICY_BENCHMARKS(bessel_i0_op)
+BOOST_MATH_FAST_POLICY_BENCHMARKS(bessel_k1_op)
+BOOST_MATH_FAST_POLICY_BENCHMARKS(bessel_j_op)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,126 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef PERFORMANCE_COUNTERS_HPP
+#define PERFORMANCE_COUNTERS_HPP
+
+//
+// Minimal access to the hardware performance counters: CPU cycles, retired
+// instructions and last level cache misses.  On Linux these come from
+// perf_event_open, elsewhere - or when the kernel doesn't let us open them,
+// as is common inside containers - available() returns false and all the
+// counts read as zero, so callers can fall back to wall clock timings alone.
+//
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__) && !defined(PERFORMANCE_COUNTERS_DISABLE)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define PERFORMANCE_COUNTERS_HAS_PERF_EVENT
+#endif
+
+struct counter_values
+{
+   std::uint64_t cycles;
+   std::uint64_t instructions;
+   std::uint64_t cache_misses;
+};
+
+class performance_counters
+{
+public:
+   performance_counters() : m_leader(-1), m_instructions(-1), m_cache_misses(-1)
+   {
+#ifdef PERFORMANCE_COUNTERS_HAS_PERF_EVENT
+      m_leader = open_counter(PERF_COUNT_HW_CPU_CYCLES, -1);
+      if(m_leader >= 0)
+      {
+         m_instructions = open_counter(PERF_COUNT_HW_INSTRUCTIONS, m_leader);
+         m_cache_misses = open_counter(PERF_COUNT_HW_CACHE_MISSES, m_leader);
+         if((m_instructions < 0) || (m_cache_misses < 0))
+            close_all();
+      }
+#endif
+   }
+   ~performance_counters()
+   {
+      close_all();
+   }
+
+   bool available()const
+   {
+      return m_leader >= 0;
+   }
+
+   void start()
+   {
+#ifdef PERFORMANCE_COUNTERS_HAS_PERF_EVENT
+      if(available())
+      {
+         ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+         ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+      }
+#endif
+   }
+   counter_values stop()
+   {
+      counter_values result = { 0, 0, 0 };
+#ifdef PERFORMANCE_COUNTERS_HAS_PERF_EVENT
+      if(available())
+      {
+         ioctl(m_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+         // Layout for PERF_FORMAT_GROUP: the number of counters followed by each value in the order opened:
+         std::uint64_t buffer[4] = { 0, 0, 0, 0 };
+         if(read(m_leader, buffer, sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer)))
+         {
+            result.cycles = buffer[1];
+            result.instructions = buffer[2];
+            result.cache_misses = buffer[3];
+         }
+      }
+#endif
+      return result;
+   }
+
+private:
+   performance_counters(const performance_counters&);
+   performance_counters& operator=(const performance_counters&);
+
+#ifdef PERFORMANCE_COUNTERS_HAS_PERF_EVENT
+   static int open_counter(std::uint64_t config, int group)
+   {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof(attr);
+      attr.config = config;
+      attr.disabled = group < 0 ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+      return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+   }
+#endif
+   void close_all()
+   {
+#ifdef PERFORMANCE_COUNTERS_HAS_PERF_EVENT
+      if(m_cache_misses >= 0)
+         close(m_cache_misses);
+      if(m_instructions >= 0)
+         close(m_instructions);
+      if(m_leader >= 0)
+         close(m_leader);
+#endif
+      m_leader = m_instructions = m_cache_misses = -1;
+   }
+
+   int m_leader, m_instructions, m_cache_misses;
+};
+
+#endif // PERFORMANCE_COUNTERS_HPP
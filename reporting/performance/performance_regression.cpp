@@ -0,0 +1,398 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Performance regression check: times a fixed set of representative special
+// functions and distributions, records the time per call along with the CPU
+// cycles, instructions and cache misses per call where the hardware counters
+// are available, and optionally compares the results against a JSON baseline.
+//
+// Usage:
+//
+//    performance_regression [--baseline=file [--update-baseline]] [--output=file]
+//                           [--threshold=percent] [--metric=ns|cycles|instructions]
+//                           [--filter=substring] [--repeats=N] [--min-time=seconds]
+//
+// Without --baseline the results are only reported.  Timings depend on the machine and
+// compiler, so no baseline is kept in the source tree: record one locally with
+// --baseline=file --update-baseline, then run again with --baseline=file to compare.
+// The program then returns non-zero if any function has got slower by more than the
+// threshold (10% by default) in the chosen metric, or if the baseline can't be read or
+// has no value of that metric for one of the functions run.  The current results are
+// always written to --output, which defaults to performance_results.json next to the
+// executable, so that a run from the build system leaves the source tree alone.
+// Since wall clock times are noisy, each measurement is the minimum over several repeats,
+// and on machines with hardware counters --metric=instructions gives the most reproducible
+// check.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/math/special_functions.hpp>
+#include <boost/math/distributions.hpp>
+#include "performance_counters.hpp"
+
+struct kernel
+{
+   std::string name;
+   std::function<double()> pass;  // evaluates the function once at each test point, returns the sum of the results
+   std::size_t calls_per_pass;
+};
+
+struct measurement
+{
+   double ns;
+   double cycles;
+   double instructions;
+   double cache_misses;
+   bool has_counters;
+};
+
+template <class Func>
+kernel make_kernel(const std::string& name, const std::vector<double>& points, Func f)
+{
+   kernel k;
+   k.name = name;
+   k.calls_per_pass = points.size();
+   k.pass = [points, f]()
+   {
+      double sum = 0;
+      for(std::size_t i = 0; i < points.size(); ++i)
+         sum += f(points[i]);
+      return sum;
+   };
+   return k;
+}
+
+std::vector<double> linspace(double a, double b, unsigned n)
+{
+   std::vector<double> result(n);
+   for(unsigned i = 0; i < n; ++i)
+      result[i] = a + (b - a) * i / (n - 1);
+   return result;
+}
+
+std::vector<kernel> all_kernels()
+{
+   using namespace boost::math;
+   std::vector<kernel> result;
+   std::vector<double> positive = linspace(0.125, 40, 200);
+   std::vector<double> unit = linspace(0.001, 0.999, 200);
+   std::vector<double> symmetric = linspace(-5, 5, 200);
+
+   result.push_back(make_kernel("tgamma", positive, [](double x) { return boost::math::tgamma(x); }));
+   result.push_back(make_kernel("lgamma", positive, [](double x) { return boost::math::lgamma(x); }));
+   result.push_back(make_kernel("digamma", positive, [](double x) { return boost::math::digamma(x); }));
+   result.push_back(make_kernel("erf", symmetric, [](double x) { return boost::math::erf(x); }));
+   result.push_back(make_kernel("erfc", symmetric, [](double x) { return boost::math::erfc(x); }));
+   result.push_back(make_kernel("erf_inv", linspace(-0.999, 0.999, 200), [](double x) { return boost::math::erf_inv(x); }));
+   result.push_back(make_kernel("gamma_p", positive, [](double x) { return boost::math::gamma_p(x, x * 1.1); }));
+   result.push_back(make_kernel("gamma_p_inv", unit, [](double p) { return boost::math::gamma_p_inv(5.5, p); }));
+   result.push_back(make_kernel("ibeta", unit, [](double x) { return boost::math::ibeta(3.5, 12.25, x); }));
+   result.push_back(make_kernel("ibeta_inv", unit, [](double p) { return boost::math::ibeta_inv(3.5, 12.25, p); }));
+   result.push_back(make_kernel("cyl_bessel_j", positive, [](double x) { return boost::math::cyl_bessel_j(2.5, x); }));
+   result.push_back(make_kernel("cyl_bessel_k", positive, [](double x) { return boost::math::cyl_bessel_k(2.5, x); }));
+   result.push_back(make_kernel("cyl_neumann", positive, [](double x) { return boost::math::cyl_neumann(1, x); }));
+   result.push_back(make_kernel("ellint_1", unit, [](double k) { return boost::math::ellint_1(k); }));
+   result.push_back(make_kernel("ellint_2", unit, [](double k) { return boost::math::ellint_2(k); }));
+   result.push_back(make_kernel("expint", positive, [](double x) { return boost::math::expint(x); }));
+   result.push_back(make_kernel("zeta", linspace(1.5, 40, 200), [](double x) { return boost::math::zeta(x); }));
+   result.push_back(make_kernel("lambert_w0", positive, [](double x) { return boost::math::lambert_w0(x); }));
+
+   result.push_back(make_kernel("normal_cdf", symmetric, [](double x) { return cdf(normal_distribution<double>(), x); }));
+   result.push_back(make_kernel("normal_quantile", unit, [](double p) { return quantile(normal_distribution<double>(), p); }));
+   result.push_back(make_kernel("students_t_cdf", symmetric, [](double x) { return cdf(students_t_distribution<double>(7.5), x); }));
+   result.push_back(make_kernel("students_t_quantile", unit, [](double p) { return quantile(students_t_distribution<double>(7.5), p); }));
+   result.push_back(make_kernel("gamma_dist_quantile", unit, [](double p) { return quantile(gamma_distribution<double>(4.5, 2), p); }));
+   result.push_back(make_kernel("beta_dist_quantile", unit, [](double p) { return quantile(beta_distribution<double>(2.5, 7), p); }));
+   result.push_back(make_kernel("binomial_cdf", linspace(0, 100, 101), [](double k) { return cdf(binomial_distribution<double>(100, 0.3), k); }));
+   result.push_back(make_kernel("poisson_quantile", unit, [](double p) { return quantile(poisson_distribution<double>(25), p); }));
+   result.push_back(make_kernel("hypergeometric_cdf", linspace(0, 50, 51), [](double k) { return cdf(hypergeometric_distribution<double>(50, 100, 400), k); }));
+   result.push_back(make_kernel("non_central_chi_squared_cdf", positive, [](double x) { return cdf(non_central_chi_squared_distribution<double>(4, 12.5), x); }));
+   result.push_back(make_kernel("non_central_t_cdf", symmetric, [](double x) { return cdf(non_central_t_distribution<double>(8, 1.5), x); }));
+   result.push_back(make_kernel("non_central_beta_cdf", unit, [](double x) { return cdf(non_central_beta_distribution<double>(2.5, 4, 10), x); }));
+   return result;
+}
+
+volatile double sink = 0;
+
+measurement measure(const kernel& k, performance_counters& counters, unsigned repeats, double min_time)
+{
+   typedef std::chrono::steady_clock clock_type;
+   //
+   // Find how many passes we need for one timing to last at least min_time:
+   //
+   unsigned passes = 1;
+   for(;;)
+   {
+      clock_type::time_point start = clock_type::now();
+      for(unsigned i = 0; i < passes; ++i)
+         sink = sink + k.pass();
+      double t = std::chrono::duration<double>(clock_type::now() - start).count();
+      if((t >= min_time) || (passes >= (1u << 24)))
+         break;
+      passes *= 2;
+   }
+   //
+   // Then keep the smallest value of each metric over several repeats, since
+   // interference from the rest of the system only ever makes things slower:
+   //
+   measurement result;
+   result.ns = result.cycles = result.instructions = result.cache_misses = (std::numeric_limits<double>::max)();
+   result.has_counters = counters.available();
+   double calls = static_cast<double>(passes) * k.calls_per_pass;
+   for(unsigned r = 0; r < repeats; ++r)
+   {
+      clock_type::time_point start = clock_type::now();
+      counters.start();
+      for(unsigned i = 0; i < passes; ++i)
+         sink = sink + k.pass();
+      counter_values v = counters.stop();
+      double t = std::chrono::duration<double, std::nano>(clock_type::now() - start).count();
+      result.ns = (std::min)(result.ns, t / calls);
+      result.cycles = (std::min)(result.cycles, v.cycles / calls);
+      result.instructions = (std::min)(result.instructions, v.instructions / calls);
+      result.cache_misses = (std::min)(result.cache_misses, v.cache_misses / calls);
+   }
+   return result;
+}
+
+std::string compiler_name()
+{
+#if defined(__clang__)
+   return "clang " __clang_version__;
+#elif defined(__GNUC__)
+   return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+   std::ostringstream ss;
+   ss << "msvc " << _MSC_VER;
+   return ss.str();
+#else
+   return "unknown";
+#endif
+}
+
+void write_json(std::ostream& os, const std::vector<std::pair<std::string, measurement> >& results)
+{
+   os << "{\n  \"compiler\": \"" << compiler_name() << "\",\n  \"results\": [\n";
+   os << std::setprecision(6);
+   for(std::size_t i = 0; i < results.size(); ++i)
+   {
+      const measurement& m = results[i].second;
+      os << "    { \"name\": \"" << results[i].first << "\", \"ns\": " << m.ns;
+      if(m.has_counters)
+         os << ", \"cycles\": " << m.cycles << ", \"instructions\": " << m.instructions << ", \"cache_misses\": " << m.cache_misses;
+      os << " }" << (i + 1 == results.size() ? "\n" : ",\n");
+   }
+   os << "  ]\n}\n";
+}
+
+//
+// Reads back what write_json produces: a map from function name to its metrics.
+//
+std::map<std::string, std::map<std::string, double> > read_json(std::istream& is)
+{
+   std::map<std::string, std::map<std::string, double> > result;
+   std::string text((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+   std::string::size_type pos = text.find("\"results\"");
+   while((pos = text.find('{', pos)) != std::string::npos)
+   {
+      std::string::size_type end = text.find('}', pos);
+      if(end == std::string::npos)
+         break;
+      std::string object = text.substr(pos + 1, end - pos - 1);
+      std::string name;
+      std::map<std::string, double> values;
+      std::string::size_type key_start = 0;
+      while((key_start = object.find('"', key_start)) != std::string::npos)
+      {
+         std::string::size_type key_end = object.find('"', key_start + 1);
+         std::string key = object.substr(key_start + 1, key_end - key_start - 1);
+         std::string::size_type value_start = object.find_first_not_of(" :", key_end + 1);
+         if(object[value_start] == '"')
+         {
+            std::string::size_type value_end = object.find('"', value_start + 1);
+            if(key == "name")
+               name = object.substr(value_start + 1, value_end - value_start - 1);
+            key_start = value_end + 1;
+         }
+         else
+         {
+            values[key] = std::strtod(object.c_str() + value_start, 0);
+            key_start = object.find_first_of(",", value_start);
+            if(key_start == std::string::npos)
+               break;
+         }
+      }
+      if(!name.empty())
+         result[name] = values;
+      pos = end + 1;
+   }
+   return result;
+}
+
+double metric_value(const measurement& m, const std::string& metric)
+{
+   if(metric == "cycles")
+      return m.cycles;
+   if(metric == "instructions")
+      return m.instructions;
+   return m.ns;
+}
+
+int main(int argc, const char* argv[])
+{
+   std::string baseline_file, output_file, filter, metric = "ns";
+   double threshold = 10;
+   double min_time = 0.02;
+   unsigned repeats = 5;
+   bool update = false;
+
+   for(int i = 1; i < argc; ++i)
+   {
+      std::string arg = argv[i];
+      std::string::size_type eq = arg.find('=');
+      std::string key = arg.substr(0, eq);
+      std::string value = eq == std::string::npos ? std::string() : arg.substr(eq + 1);
+      if(key == "--baseline")
+         baseline_file = value;
+      else if(key == "--output")
+         output_file = value;
+      else if(key == "--update-baseline")
+         update = true;
+      else if(key == "--threshold")
+         threshold = std::atof(value.c_str());
+      else if(key == "--metric")
+         metric = value;
+      else if(key == "--filter")
+         filter = value;
+      else if(key == "--repeats")
+         repeats = (std::max)(1, std::atoi(value.c_str()));
+      else if(key == "--min-time")
+         min_time = std::atof(value.c_str());
+      else
+      {
+         std::cerr << "Unknown argument " << arg << std::endl;
+         return 2;
+      }
+   }
+   if((metric != "ns") && (metric != "cycles") && (metric != "instructions"))
+   {
+      std::cerr << "Unknown metric " << metric << ", must be one of ns, cycles or instructions." << std::endl;
+      return 2;
+   }
+   if(update && baseline_file.empty())
+   {
+      std::cerr << "--update-baseline needs a --baseline file to write." << std::endl;
+      return 2;
+   }
+
+   performance_counters counters;
+   if(!counters.available())
+   {
+      std::cout << "Hardware performance counters are not available, recording wall clock times only." << std::endl;
+      if(metric != "ns")
+      {
+         std::cerr << "Can't compare " << metric << " without hardware counters." << std::endl;
+         return 2;
+      }
+   }
+
+   std::vector<std::pair<std::string, measurement> > results;
+   std::vector<kernel> kernels = all_kernels();
+   for(std::size_t i = 0; i < kernels.size(); ++i)
+   {
+      if(!filter.empty() && (kernels[i].name.find(filter) == std::string::npos))
+         continue;
+      results.push_back(std::make_pair(kernels[i].name, measure(kernels[i], counters, repeats, min_time)));
+   }
+
+   if(output_file.empty())
+   {
+      std::string program = argv[0];
+      std::string::size_type slash = program.find_last_of("/\\");
+      output_file = (slash == std::string::npos ? std::string() : program.substr(0, slash + 1)) + "performance_results.json";
+   }
+   {
+      std::ofstream os(output_file.c_str());
+      write_json(os, results);
+      if(!os)
+      {
+         std::cerr << "Could not write the results to " << output_file << std::endl;
+         return 2;
+      }
+      std::cout << "Results written to " << output_file << std::endl;
+   }
+
+   if(update)
+   {
+      std::ofstream os(baseline_file.c_str());
+      write_json(os, results);
+      std::cout << "Baseline written to " << baseline_file << std::endl;
+      return os ? 0 : 1;
+   }
+   if(baseline_file.empty())
+   {
+      std::cout << std::left << std::setw(32) << "function" << std::right << std::setw(14) << "current" << "   (" << metric << " per call)\n";
+      for(std::size_t i = 0; i < results.size(); ++i)
+         std::cout << std::left << std::setw(32) << results[i].first << std::right << std::fixed << std::setprecision(1) << std::setw(14) << metric_value(results[i].second, metric) << "\n";
+      std::cout << "No baseline given, so nothing was compared." << std::endl;
+      return 0;
+   }
+   std::ifstream baseline_stream(baseline_file.c_str());
+   std::map<std::string, std::map<std::string, double> > baseline;
+   if(baseline_stream)
+      baseline = read_json(baseline_stream);
+   if(baseline.empty())
+   {
+      std::cerr << "No baseline could be read from " << baseline_file << ", rerun with --update-baseline to record one." << std::endl;
+      return 2;
+   }
+
+   int regressions = 0;
+   int missing = 0;
+   std::cout << std::left << std::setw(32) << "function" << std::right << std::setw(14) << "baseline" << std::setw(14) << "current" << std::setw(10) << "change" << "   (" << metric << " per call)\n";
+   for(std::size_t i = 0; i < results.size(); ++i)
+   {
+      double current = metric_value(results[i].second, metric);
+      std::cout << std::left << std::setw(32) << results[i].first << std::right << std::fixed << std::setprecision(1);
+      std::map<std::string, std::map<std::string, double> >::const_iterator pos = baseline.find(results[i].first);
+      if((pos == baseline.end()) || (pos->second.find(metric) == pos->second.end()))
+      {
+         std::cout << std::setw(14) << "-" << std::setw(14) << current << "   NOT IN BASELINE\n";
+         ++missing;
+         continue;
+      }
+      double previous = pos->second.find(metric)->second;
+      double change = 100 * (current - previous) / previous;
+      std::cout << std::setw(14) << previous << std::setw(14) << current << std::setw(9) << std::showpos << change << "%" << std::noshowpos;
+      if(change > threshold)
+      {
+         std::cout << "   REGRESSION";
+         ++regressions;
+      }
+      std::cout << "\n";
+   }
+   if(missing)
+   {
+      std::cerr << missing << " function(s) have no " << metric << " in " << baseline_file << ", rerun with --update-baseline to record them." << std::endl;
+      return 2;
+   }
+   if(regressions)
+      std::cout << regressions << " function(s) slower than the baseline by more than " << threshold << "%." << std::endl;
+   else
+      std::cout << "No regressions greater than " << threshold << "% found." << std::endl;
+   return regressions ? 1 : 0;
+}
@@ -15,6 +15,9 @@
 #include <boost/math/interpolators/cardinal_cubic_b_spline.hpp>
 #include <boost/math/interpolators/detail/cardinal_cubic_b_spline_detail.hpp>
 #include <boost/multiprecision/cpp_bin_float.hpp>
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+#include <execution>
+#endif
 
 using boost::multiprecision::cpp_bin_float_50;
 using boost::math::constants::third;
@@ -314,6 +317,145 @@ void test_outside_interval()
     cnull << spline(2000);
 }
 
+template<class Real>
+void test_batch_evaluation()
+{
+    using std::sin;
+    using std::abs;
+    std::cout << "Testing batch evaluation of cubic b splines on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    std::vector<Real> v(1000);
+    Real x0 = 1;
+    Real step = 0.0625;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = sin(x0 + step * i);
+    }
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> spline(v.data(), v.size(), x0, step);
+
+    // Points a little outside the interval, the endpoints and the grid points are included, since they take different paths:
+    std::mt19937 gen(12345);
+    boost::random::uniform_real_distribution<Real> dis(x0 - 3*step, x0 + (v.size() + 2)*step);
+    std::vector<Real> x(2000);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = dis(gen);
+    }
+    x[0] = x0;
+    x[1] = x0 + (v.size() - 1)*step;
+    for (size_t i = 2; i < 100; ++i)
+    {
+        x[i] = x0 + i*step;
+    }
+    std::vector<Real> y(x.size());
+    std::vector<Real> dydx(x.size());
+    std::vector<Real> d2ydx2(x.size());
+    spline.evaluate(x.data(), x.size(), y.data(), dydx.data(), d2ydx2.data());
+    Real tol = 100*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        BOOST_CHECK_SMALL(Real(y[i] - spline(x[i])), tol);
+        BOOST_CHECK_SMALL(Real(dydx[i] - spline.prime(x[i])), tol/step);
+        BOOST_CHECK_SMALL(Real(d2ydx2[i] - spline.double_prime(x[i])), tol/(step*step));
+    }
+
+    // The derivatives are optional:
+    std::vector<Real> z(x.size());
+    spline.evaluate(x.data(), x.size(), z.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(y[i], z[i]);
+    }
+}
+
+template<class Real>
+void test_parallel_recurrence()
+{
+    using boost::math::interpolators::detail::solve_linear_recurrence;
+    using std::abs;
+    using std::sqrt;
+    std::cout << "Testing the parallel solution of linear recurrences on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    std::mt19937 gen(12345);
+    boost::random::uniform_real_distribution<Real> dis(-1, 1);
+    std::vector<Real> b(300000);
+    for (auto & r : b)
+    {
+        r = dis(gen);
+    }
+
+    // The forward reduction of the cubic b spline system, and a second order recurrence with roots 0.3 and -0.2:
+    Real d = 2 + sqrt(Real(3));
+    auto first_order = [d](Real r, Real r1, Real) { return (r - r1)/d; };
+    auto second_order = [](Real r, Real r1, Real r2) { return r + Real(1)/10*r1 + Real(6)/100*r2; };
+    for (bool backward : {false, true})
+    {
+        for (unsigned threads : {2u, 3u, 8u})
+        {
+            auto x = b;
+            auto y = b;
+            solve_linear_recurrence(x.data(), 3, b.size() - 2, backward, Real(0.5), Real(0), -1/d, Real(0), first_order, 1u);
+            solve_linear_recurrence(y.data(), 3, b.size() - 2, backward, Real(0.5), Real(0), -1/d, Real(0), first_order, threads);
+            for (size_t i = 0; i < b.size(); ++i)
+            {
+                BOOST_CHECK_SMALL(Real(x[i] - y[i]), 4*std::numeric_limits<Real>::epsilon());
+            }
+
+            x = b;
+            y = b;
+            solve_linear_recurrence(x.data(), 3, b.size() - 2, backward, Real(0.5), Real(-2), Real(1)/10, Real(6)/100, second_order, 1u);
+            solve_linear_recurrence(y.data(), 3, b.size() - 2, backward, Real(0.5), Real(-2), Real(1)/10, Real(6)/100, second_order, threads);
+            for (size_t i = 0; i < b.size(); ++i)
+            {
+                BOOST_CHECK_SMALL(Real(x[i] - y[i]), 4*std::numeric_limits<Real>::epsilon());
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_threaded_construction()
+{
+    using boost::math::interpolators::detail::cardinal_cubic_b_spline_imp;
+    using std::sin;
+    std::cout << "Testing threaded construction of cubic b splines on type " << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    // Enough points that four threads are used however many cores there are:
+    std::vector<Real> v(1 << 19);
+    Real x0 = 1;
+    Real step = Real(1)/64;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = sin(x0 + step * i);
+    }
+    Real nan = std::numeric_limits<Real>::quiet_NaN();
+    cardinal_cubic_b_spline_imp<Real> serial(v.begin(), v.end(), x0, step, nan, nan, 1);
+    cardinal_cubic_b_spline_imp<Real> threaded(v.begin(), v.end(), x0, step, nan, nan, 4);
+    std::mt19937 gen(12345);
+    boost::random::uniform_real_distribution<Real> dis(x0, x0 + (v.size() - 1)*step);
+    Real tol = 10*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < 5000; ++i)
+    {
+        Real x = i < 1000 ? x0 + (i*v.size()/1000)*step : dis(gen);
+        BOOST_CHECK_SMALL(Real(serial(x) - threaded(x)), tol);
+        BOOST_CHECK_SMALL(Real(serial.prime(x) - threaded.prime(x)), tol/step);
+        BOOST_CHECK_SMALL(Real(serial.double_prime(x) - threaded.double_prime(x)), tol/(step*step));
+    }
+
+    // The constructors without an execution policy are sequential, as is std::execution::seq:
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> spline(v.data(), v.size(), x0, step);
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> seq(std::execution::seq, v.data(), v.size(), x0, step);
+    boost::math::interpolators::cardinal_cubic_b_spline<Real> par(std::execution::par, v.data(), v.size(), x0, step);
+#endif
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        Real x = dis(gen);
+        BOOST_CHECK_EQUAL(serial(x), spline(x));
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+        BOOST_CHECK_EQUAL(serial(x), seq(x));
+        BOOST_CHECK_SMALL(Real(serial(x) - par(x)), tol);
+#endif
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
 {
     test_b3_spline<float>();
@@ -360,4 +502,20 @@ BOOST_AUTO_TEST_CASE(test_cubic_b_spline)
 
     test_copy_move<double>();
     test_outside_interval<double>();
+
+    test_batch_evaluation<float>();
+    test_batch_evaluation<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_batch_evaluation<long double>();
+#endif
+
+    test_parallel_recurrence<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_parallel_recurrence<long double>();
+#endif
+
+    test_threaded_construction<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_threaded_construction<long double>();
+#endif
 }
@@ -8,7 +8,11 @@
 #include "math_unit_test.hpp"
 #include <numeric>
 #include <utility>
+#include <random>
 #include <boost/math/interpolators/cardinal_quadratic_b_spline.hpp>
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+#include <execution>
+#endif
 using boost::math::interpolators::cardinal_quadratic_b_spline;
 
 template<class Real>
@@ -113,6 +117,94 @@ void test_quadratic()
     }
 }
 
+template<class Real>
+void test_batch()
+{
+    using std::sin;
+    Real t0 = 1;
+    Real h = Real(1)/Real(16);
+    size_t n = 700;
+    std::vector<Real> v(n);
+    for (size_t i = 0; i < n; ++i) {
+      v[i] = sin(t0 + i*h);
+    }
+    auto qbs = cardinal_quadratic_b_spline<Real>(v.data(), v.size(), t0, h);
+
+    // Random points, the grid points, and both endpoints, which take different paths:
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<Real> dis(t0, qbs.t_max());
+    std::vector<Real> t(2*n + 500);
+    for (size_t i = 0; i < t.size(); ++i) {
+      t[i] = i < n ? t0 + i*h : dis(gen);
+    }
+    t.back() = qbs.t_max();
+    std::vector<Real> y(t.size());
+    std::vector<Real> dydt(t.size());
+    qbs.evaluate(t.data(), t.size(), y.data(), dydt.data());
+    for (size_t i = 0; i < t.size(); ++i) {
+      CHECK_MOLLIFIED_CLOSE(qbs(t[i]), y[i], 10*std::numeric_limits<Real>::epsilon());
+      CHECK_MOLLIFIED_CLOSE(qbs.prime(t[i]), dydt[i], 100*std::numeric_limits<Real>::epsilon());
+    }
+
+    // Values alone share the coefficients read for the derivatives, so they are identical:
+    std::vector<Real> z(t.size());
+    qbs.evaluate(t.data(), t.size(), z.data());
+    for (size_t i = 0; i < t.size(); ++i) {
+      CHECK_EQUAL(y[i], z[i]);
+    }
+
+    bool caught = false;
+    try {
+      Real outside = t0 - h;
+      qbs.evaluate(&outside, 1, z.data());
+    }
+    catch (const std::domain_error&) {
+      caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+}
+
+template<class Real>
+void test_threaded_construction()
+{
+    using std::sin;
+    using boost::math::interpolators::detail::cardinal_quadratic_b_spline_detail;
+    // Enough points that four threads are used however many cores there are:
+    Real t0 = 1;
+    Real h = Real(1)/Real(64);
+    size_t n = 1 << 19;
+    std::vector<Real> v(n);
+    for (size_t i = 0; i < n; ++i) {
+      v[i] = sin(t0 + i*h);
+    }
+    cardinal_quadratic_b_spline_detail<Real> serial(v.data(), n, t0, h, Real(1), Real(2), 1);
+    cardinal_quadratic_b_spline_detail<Real> threaded(v.data(), n, t0, h, Real(1), Real(2), 4);
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<Real> dis(t0, serial.t_max());
+    // The splitting of the solve perturbs the coefficients by a few ulps, which the derivatives scale by 1/h:
+    Real tol = 10*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < 5000; ++i) {
+      Real t = i < 1000 ? t0 + (i*n/1000)*h : dis(gen);
+      CHECK_MOLLIFIED_CLOSE(serial(t), threaded(t), tol);
+      CHECK_MOLLIFIED_CLOSE(serial.prime(t), threaded.prime(t), tol/h);
+    }
+
+    // The constructors without an execution policy are sequential, as is std::execution::seq:
+    auto qbs = cardinal_quadratic_b_spline<Real>(v, t0, h, Real(1), Real(2));
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    auto seq = cardinal_quadratic_b_spline<Real>(std::execution::seq, v, t0, h, Real(1), Real(2));
+    auto par = cardinal_quadratic_b_spline<Real>(std::execution::par, v.data(), v.size(), t0, h, Real(1), Real(2));
+#endif
+    for (size_t i = 0; i < 1000; ++i) {
+      Real t = dis(gen);
+      CHECK_EQUAL(serial(t), qbs(t));
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+      CHECK_EQUAL(serial(t), seq(t));
+      CHECK_MOLLIFIED_CLOSE(serial(t), par(t), tol);
+#endif
+    }
+}
+
 int main()
 {
     test_constant<float>();
@@ -131,5 +223,16 @@ int main()
 #ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
     test_quadratic<long double>();
 #endif
+    test_batch<float>();
+    test_batch<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_batch<long double>();
+#endif
+
+    test_threaded_construction<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_threaded_construction<long double>();
+#endif
+
     return boost::math::test::report_errors();
 }
@@ -399,6 +399,227 @@ void test_random_access_container()
     BOOST_CHECK_CLOSE_FRACTION(p[2], p1[2], tol);
 }
 
+template<class Real>
+void test_prime_nonuniform()
+{
+    using std::abs;
+    using std::cbrt;
+    std::cout << "Testing the tangent of a Catmull-Rom curve with unevenly spaced knots on type "
+              << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    // Points at random distances, so that the knots of the centripetal parametrization are far from uniform:
+    std::mt19937 gen(9);
+    std::uniform_real_distribution<Real> dis(-3, 3);
+    std::vector<std::array<Real, 3>> v(12);
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = {Real(i*i)/4 + dis(gen), dis(gen), dis(gen)};
+    }
+    catmull_rom<std::array<Real, 3>> cr(std::move(v));
+
+    // Central differences away from the knots, where the curve is a cubic:
+    Real h = cbrt(std::numeric_limits<Real>::epsilon());
+    for (size_t i = 0; cr.parameter_at_point(i + 1) < cr.max_parameter(); ++i)
+    {
+        Real a = cr.parameter_at_point(i);
+        Real b = cr.parameter_at_point(i + 1);
+        for (Real f : {Real(0.1), Real(0.37), Real(0.5), Real(0.81)})
+        {
+            Real s = a + f*(b - a);
+            auto dxds = cr.prime(s);
+            auto x1 = cr(s + h);
+            auto x0 = cr(s - h);
+            for (size_t j = 0; j < 3; ++j)
+            {
+                Real fd = (x1[j] - x0[j])/(2*h);
+                BOOST_CHECK_SMALL(Real(dxds[j] - fd), 1000*h*h*(1 + abs(fd)));
+            }
+        }
+    }
+}
+
+// Throws on indices past the end, which the curve must never read:
+template<class Point>
+class checked_vector : public std::vector<Point>
+{
+public:
+    using std::vector<Point>::vector;
+
+    Point& operator[](size_t i)
+    {
+        return this->at(i);
+    }
+
+    const Point& operator[](size_t i) const
+    {
+        return this->at(i);
+    }
+};
+
+template<class Real>
+void test_closed_curve_end()
+{
+    std::cout << "Testing a closed Catmull-Rom curve at its maximum parameter on type "
+              << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    checked_vector<std::array<Real, 2>> v(9);
+    for (auto & p : v)
+    {
+        p = {dis(gen), dis(gen)};
+    }
+    auto u = v;
+    catmull_rom<std::array<Real, 2>, checked_vector<std::array<Real, 2>>> loop(std::move(v), true);
+
+    // The curve returns to its first point, with the tangent it started with:
+    Real tol = 100*std::numeric_limits<Real>::epsilon();
+    Real max_s = loop.max_parameter();
+    std::array<Real, 2> x{};
+    std::array<Real, 2> dxds{};
+    BOOST_CHECK_NO_THROW(x = loop(max_s));
+    BOOST_CHECK_NO_THROW(dxds = loop.prime(max_s));
+    auto dxds0 = loop.prime(Real(0));
+    for (size_t j = 0; j < 2; ++j)
+    {
+        BOOST_CHECK_SMALL(Real(x[j] - u[0][j]), tol);
+        BOOST_CHECK_SMALL(Real(dxds[j] - dxds0[j]), tol*(1 + abs(dxds0[j])));
+    }
+}
+
+template<class Real>
+void test_batch()
+{
+    std::cout << "Testing batched evaluation of the Catmull-Rom spline on type "
+              << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    std::vector<std::array<Real, 3>> v(50);
+    for (auto & p : v)
+    {
+        p = {dis(gen), dis(gen), dis(gen)};
+    }
+    for (bool closed : {false, true})
+    {
+        auto w = v;
+        catmull_rom<std::array<Real, 3>> cr(std::move(w), closed);
+        Real max_s = cr.max_parameter();
+        // Sorted, with repeats, control points and both ends, then shuffled:
+        std::vector<Real> s(2000);
+        for (size_t i = 0; i < s.size(); ++i)
+        {
+            s[i] = max_s*i/(s.size() - 1);
+        }
+        s[7] = s[6];
+        s[100] = cr.parameter_at_point(3);
+        s[500] = cr.parameter_at_point(17);
+        std::sort(s.begin(), s.end());
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            std::vector<std::array<Real, 3>> x(s.size());
+            std::vector<std::array<Real, 3>> dx(s.size());
+            cr.evaluate(s.data(), s.size(), x.data(), dx.data());
+            Real tol = 100*std::numeric_limits<Real>::epsilon();
+            for (size_t i = 0; i < s.size(); ++i)
+            {
+                auto p = cr(s[i]);
+                auto dp = cr.prime(s[i]);
+                for (size_t j = 0; j < 3; ++j)
+                {
+                    BOOST_CHECK_SMALL(x[i][j] - p[j], tol);
+                    BOOST_CHECK_SMALL(dx[i][j] - dp[j], 100*tol);
+                }
+            }
+            std::shuffle(s.begin(), s.end(), gen);
+        }
+        // The ends are the first point, and the last or first point:
+        std::array<Real, 3> p;
+        cr.evaluate(&max_s, 1, &p);
+        auto q = closed ? v.front() : v.back();
+        for (size_t j = 0; j < 3; ++j)
+        {
+            BOOST_CHECK_SMALL(p[j] - q[j], 100*std::numeric_limits<Real>::epsilon());
+        }
+        Real outside = max_s*2;
+        BOOST_CHECK_THROW(cr.evaluate(&outside, 1, &p), std::domain_error);
+    }
+}
+
+template<class Real>
+void test_arc_length()
+{
+    using boost::math::catmull_rom_arc_length;
+    using boost::math::constants::pi;
+    std::cout << "Testing the arc length parametrization of the Catmull-Rom spline on type "
+              << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    // Collinear control points, unevenly spaced, give a straight line.
+    // The curve stops at both ends, where the parameter is only a square root of the arc length, so this is a hard case:
+    std::vector<std::array<Real, 2>> v{{0, 0}, {0.1, 0.2}, {0.5, 1}, {0.6, 1.2}, {1.5, 3}, {2, 4}};
+    catmull_rom<std::array<Real, 2>> line(std::move(v));
+    catmull_rom_arc_length<std::array<Real, 2>> arc(line, 32);
+    BOOST_CHECK_CLOSE_FRACTION(arc.length(), sqrt(Real(20)), 100*std::numeric_limits<Real>::epsilon());
+    Real tol = 1e-4;
+    size_t n = 101;
+    std::vector<Real> s(n);
+    arc.parameters(n, s.data());
+    std::vector<std::array<Real, 2>> x(n);
+    line.evaluate(s.data(), n, x.data());
+    for (size_t i = 0; i < n; ++i)
+    {
+        Real expected = sqrt(Real(20))*i/(n - 1);
+        BOOST_CHECK_SMALL(sqrt(x[i][0]*x[i][0] + x[i][1]*x[i][1]) - expected, tol);
+        BOOST_CHECK_EQUAL(s[i], arc.parameter(arc.length()*i/(n - 1)));
+    }
+    BOOST_CHECK_EQUAL(s[0], Real(0));
+    BOOST_CHECK_EQUAL(s[n - 1], line.max_parameter());
+
+    // A closed curve through points on a circle; its length is measured independently by a fine polyline:
+    std::vector<std::array<Real, 2>> c(40);
+    for (size_t i = 0; i < c.size(); ++i)
+    {
+        Real theta = 2*pi<Real>()*i/c.size() + Real(0.05)*sin(Real(i));
+        c[i] = {cos(theta), sin(theta)};
+    }
+    catmull_rom<std::array<Real, 2>> loop(std::move(c), true);
+    catmull_rom_arc_length<std::array<Real, 2>> loop_arc(loop, 8);
+    size_t m = 200000;
+    std::vector<Real> t(m);
+    for (size_t i = 0; i < m; ++i)
+    {
+        t[i] = loop.max_parameter()*i/(m - 1);
+    }
+    std::vector<std::array<Real, 2>> y(m);
+    loop.evaluate(t.data(), m, y.data());
+    Real polyline = 0;
+    for (size_t i = 1; i < m; ++i)
+    {
+        polyline += sqrt((y[i][0] - y[i-1][0])*(y[i][0] - y[i-1][0]) + (y[i][1] - y[i-1][1])*(y[i][1] - y[i-1][1]));
+    }
+    BOOST_CHECK_CLOSE_FRACTION(loop_arc.length(), polyline, Real(1e-7));
+    // Evenly spaced points are evenly spaced along the curve:
+    n = 64;
+    s.resize(n);
+    loop_arc.parameters(n, s.data());
+    for (size_t i = 1; i < n; ++i)
+    {
+        Real a = s[i-1];
+        Real b = s[i];
+        size_t k = 1000;
+        std::vector<Real> u(k + 1);
+        for (size_t j = 0; j <= k; ++j)
+        {
+            u[j] = a + (b - a)*j/k;
+        }
+        std::vector<std::array<Real, 2>> z(k + 1);
+        loop.evaluate(u.data(), k + 1, z.data());
+        Real piece = 0;
+        for (size_t j = 1; j <= k; ++j)
+        {
+            piece += sqrt((z[j][0] - z[j-1][0])*(z[j][0] - z[j-1][0]) + (z[j][1] - z[j-1][1])*(z[j][1] - z[j-1][1]));
+        }
+        BOOST_CHECK_CLOSE_FRACTION(piece, loop_arc.length()/(n - 1), Real(1e-4));
+    }
+    BOOST_CHECK_THROW(loop_arc.parameter(-1), std::domain_error);
+}
+
 BOOST_AUTO_TEST_CASE(catmull_rom_test)
 {
 #if !defined(TEST) || (TEST == 1)
@@ -422,6 +643,13 @@ BOOST_AUTO_TEST_CASE(catmull_rom_test)
     test_affine_invariance<double, 4>();
 
     test_random_access_container<double>();
+
+    test_prime_nonuniform<double>();
+    test_closed_curve_end<double>();
+
+    test_batch<float>();
+    test_batch<double>();
+    test_arc_length<double>();
 #endif
 #if !defined(TEST) || (TEST == 3)
     test_affine_invariance<cpp_bin_float_50, 4>();
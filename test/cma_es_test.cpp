@@ -0,0 +1,134 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <atomic>
+#include <utility>
+#include <array>
+#include <vector>
+#include <random>
+#include <stdexcept>
+#include "math_unit_test.hpp"
+#include "test_functions_for_optimization.hpp"
+#include <boost/math/optimization/cma_es.hpp>
+
+using boost::math::optimization::cma_es;
+using boost::math::optimization::cma_es_parameters;
+
+template<class Real>
+void test_rosenbrock()
+{
+    using ArgType = std::vector<Real>;
+    cma_es_parameters<ArgType> params;
+    params.lower_bounds.resize(5, Real(-3));
+    params.upper_bounds.resize(5, Real(3));
+    params.max_generations = 5000;
+    std::mt19937_64 gen(4321);
+    auto x = cma_es(rosenbrock<Real, ArgType>, params, gen);
+    for (auto xi : x)
+    {
+        CHECK_ABSOLUTE_ERROR(Real(1), xi, Real(1e-5));
+    }
+
+    // The same seed gives the same answer, however many threads are used:
+    std::mt19937_64 gen1(4321);
+    params.threads = 1;
+    auto x1 = cma_es(rosenbrock<Real, ArgType>, params, gen1);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_EQUAL(x[i], x1[i]);
+    }
+}
+
+template<class Real>
+void test_rastrigin()
+{
+    using ArgType = std::array<Real, 2>;
+    cma_es_parameters<ArgType> params;
+    params.lower_bounds = {-5.12, -5.12};
+    params.upper_bounds = {5.12, 5.12};
+    // A large population lets CMA-ES see the global structure of the Rastrigin function:
+    params.population_size = 100;
+    std::mt19937_64 gen(12);
+    auto x = cma_es(rastrigin<Real, ArgType>, params, gen, Real(1e-4));
+    CHECK_LE(rastrigin<Real>(x), Real(1e-4));
+}
+
+void test_ill_conditioned()
+{
+    // An ellipsoid with condition number 10^6, which requires the covariance to adapt:
+    using ArgType = std::vector<double>;
+    auto ellipsoid = [](ArgType const & x) {
+        double r = 0;
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            r += std::pow(1e6, double(i)/(x.size() - 1))*(x[i] - 0.5)*(x[i] - 0.5);
+        }
+        return r;
+    };
+    cma_es_parameters<ArgType> params;
+    params.lower_bounds.resize(6, -4.0);
+    params.upper_bounds.resize(6, 4.0);
+    params.max_generations = 5000;
+    std::mt19937_64 gen(99);
+    auto x = cma_es(ellipsoid, params, gen);
+    CHECK_LE(ellipsoid(x), 1e-14);
+
+    bool thrown = false;
+    params.population_size = 1;
+    try
+    {
+        cma_es(ellipsoid, params, gen);
+    }
+    catch (std::domain_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+// An exception thrown by the cost function, on a worker or on the calling thread, reaches the caller:
+void test_throwing_cost()
+{
+    using ArgType = std::vector<double>;
+    cma_es_parameters<ArgType> params;
+    params.lower_bounds.resize(4, -3.0);
+    params.upper_bounds.resize(4, 3.0);
+    params.threads = 4;
+    std::mt19937_64 gen(9);
+    // The first failure lands in the first generation, the later ones in later generations:
+    for (size_t fail_at : {0, 1, 7, 100, 1000})
+    {
+        std::atomic<size_t> calls{0};
+        auto cost = [&](ArgType const & v) {
+            if (calls++ >= fail_at)
+            {
+                throw std::runtime_error("Cost function failed.");
+            }
+            return rosenbrock<double>(v);
+        };
+        bool thrown = false;
+        try
+        {
+            cma_es(cost, params, gen);
+        }
+        catch (std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        CHECK_EQUAL(thrown, true);
+    }
+}
+
+int main()
+{
+    test_rosenbrock<double>();
+    test_rastrigin<float>();
+    test_rastrigin<double>();
+    test_ill_conditioned();
+    test_throwing_cost();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,25 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header <boost/math/optimization/cma_es.hpp>
+// #includes all the files that it needs to.
+//
+#include <boost/math/optimization/cma_es.hpp>
+//
+// Note this header includes no other headers, this is
+// important if this test is to be meaningful:
+//
+#include "test_compile_result.hpp"
+
+void compile_and_link_test()
+{
+    using namespace boost::math::optimization;
+    auto cost = [](std::vector<double> const & x) { return x[0]*x[0] + x[1]*x[1]; };
+    cma_es_parameters<std::vector<double>> params;
+    params.lower_bounds = {-1.0, -1.0};
+    params.upper_bounds = {1.0, 1.0};
+    std::mt19937_64 gen(1);
+    check_result<std::vector<double>>(cma_es(cost, params, gen));
+}
@@ -0,0 +1,22 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header <boost/math/filters/daubechies_transform.hpp>
+// #includes all the files that it needs to.
+//
+#include <boost/math/filters/daubechies_transform.hpp>
+
+void compile_and_link_test()
+{
+   using namespace boost::math::filters;
+
+   double x[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+   double w[8];
+   daubechies_dwt<2>(x, x + 8, w, 3);
+   daubechies_idwt<2>(x, x + 8, w, 3);
+   daubechies_lifting_dwt<2>(x, x + 8, 3);
+   daubechies_lifting_idwt<2>(x, x + 8, 3);
+   static_assert(daubechies_dwt_symmetric_size<2>(8, 1) == 10);
+}
@@ -17,6 +17,8 @@
 void compile_and_link_test()
 {
    TEST_DIST_FUNC(hyperexponential)
+   check_result<double>(boost::math::cdf(boost::math::fixed_hyperexponential_distribution<double, 2>(), d));
+   check_result<double>(boost::math::quantile(boost::math::fixed_hyperexponential_distribution<double, 2>(), d));
 }
 
 template class boost::math::hyperexponential_distribution<float, boost::math::policies::policy<> >;
@@ -24,3 +26,5 @@ template class boost::math::hyperexponential_distribution<double, boost::math::p
 #ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
 template class boost::math::hyperexponential_distribution<long double, boost::math::policies::policy<> >;
 #endif
+
+template class boost::math::fixed_hyperexponential_distribution<double, 3, boost::math::policies::policy<> >;
@@ -16,6 +16,8 @@
 void compile_and_link_test()
 {
    TEST_DIST_FUNC(hypergeometric)
+   check_result<double>(boost::math::hypergeometric_table<double>(boost::math::hypergeometric_distribution<double>(2, 3, 5)).cdf(2u));
+   check_result<double>(boost::math::hypergeometric_table<double>(boost::math::hypergeometric_distribution<double>(2, 3, 5)).quantile(d));
 }
 
 template class boost::math::hypergeometric_distribution<float, boost::math::policies::policy<> >;
@@ -23,3 +25,4 @@ template class boost::math::hypergeometric_distribution<double, boost::math::pol
 #ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
 template class boost::math::hypergeometric_distribution<long double, boost::math::policies::policy<> >;
 #endif
+template class boost::math::hypergeometric_table<double, boost::math::policies::policy<> >;
@@ -20,6 +20,8 @@
 void compile_and_link_test()
 {
    TEST_DIST_FUNC(non_central_beta)
+   check_result<double>(boost::math::non_central_beta_cdf_evaluator<double>(boost::math::non_central_beta_distribution<double>(2, 3, 1)).cdf(d));
+   check_result<double>(boost::math::non_central_beta_cdf_evaluator<double>(boost::math::non_central_beta_distribution<double>(2, 3, 1)).cdf_complement(d));
 }
 
 template class boost::math::non_central_beta_distribution<float, boost::math::policies::policy<> >;
@@ -16,6 +16,8 @@
 void compile_and_link_test()
 {
    TEST_DIST_FUNC(non_central_chi_squared)
+   check_result<double>(boost::math::non_central_chi_squared_cdf_evaluator<double>(boost::math::non_central_chi_squared_distribution<double>(2, 3)).cdf(d));
+   check_result<double>(boost::math::non_central_chi_squared_cdf_evaluator<double>(boost::math::non_central_chi_squared_distribution<double>(2, 3)).cdf_complement(d));
 }
 
 template class boost::math::non_central_chi_squared_distribution<float, boost::math::policies::policy<> >;
@@ -340,6 +340,8 @@ void instantiate(RealType)
    boost::math::cyl_neumann_zero(v1, i, i, oi);
    boost::math::lambert_w0(v1);
    boost::math::lambert_wm1(v1);
+   boost::math::lambert_w0(&v1, &v1 + 1, oi);
+   boost::math::lambert_wm1(&v1, &v1 + 1, oi);
    boost::math::lambert_w0_prime(v1);
 #ifdef TEST_COMPLEX
    boost::math::cyl_hankel_1(v1, v2);
@@ -766,6 +768,8 @@ void instantiate(RealType)
    boost::math::cyl_neumann_zero(v1, i, i, oi, pol);
    boost::math::lambert_w0(v1, pol);
    boost::math::lambert_wm1(v1, pol);
+   boost::math::lambert_w0(&v1, &v1 + 1, oi, pol);
+   boost::math::lambert_wm1(&v1, &v1 + 1, oi, pol);
    boost::math::lambert_w0_prime(v1, pol);
 #ifdef TEST_COMPLEX
    boost::math::cyl_hankel_1(v1, v2, pol);
@@ -0,0 +1,23 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header <boost/math/optimization/nelder_mead.hpp>
+// #includes all the files that it needs to.
+//
+#include <boost/math/optimization/nelder_mead.hpp>
+//
+// Note this header includes no other headers, this is
+// important if this test is to be meaningful:
+//
+#include "test_compile_result.hpp"
+
+void compile_and_link_test()
+{
+    using namespace boost::math::optimization;
+    auto cost = [](std::vector<double> const & x) { return x[0]*x[0] + x[1]*x[1]; };
+    nelder_mead_parameters<std::vector<double>> params;
+    params.initial_guess = {1.0, 2.0};
+    check_result<std::vector<double>>(nelder_mead(cost, params));
+}
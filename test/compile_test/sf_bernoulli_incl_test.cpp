@@ -27,6 +27,10 @@ void compile_and_link_test()
 #ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
    check_result<long double>(boost::math::tangent_t2n<long double>(i));
 #endif
+
+   check_result<std::size_t>(boost::math::reserve_bernoulli_b2n<double>(i));
+   check_result<std::size_t>(boost::math::bernoulli_b2n_cache_statistics<double>().growth_count);
+   check_result<double>(boost::math::bernoulli_b2n_snapshot<double>(i).tangent_t2n(0));
 #ifdef BOOST_MATH_HAVE_CONSTEXPR_TABLES
    constexpr float ce_f = boost::math::unchecked_bernoulli_b2n<float>(2);
    constexpr float ce_d = boost::math::unchecked_bernoulli_b2n<double>(2);
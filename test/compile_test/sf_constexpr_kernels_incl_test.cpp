@@ -0,0 +1,32 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header <boost/math/special_functions/constexpr_kernels.hpp>
+// #includes all the files that it needs to.
+//
+#include <boost/math/special_functions/constexpr_kernels.hpp>
+//
+// Note this header includes no other headers, this is
+// important if this test is to be meaningful:
+//
+#include "test_compile_result.hpp"
+
+void compile_and_link_test()
+{
+   int sign;
+   check_result<float>(boost::math::constexpr_erf(f));
+   check_result<double>(boost::math::constexpr_erf(d));
+   check_result<float>(boost::math::constexpr_erfc(f));
+   check_result<double>(boost::math::constexpr_erfc(d));
+   check_result<float>(boost::math::constexpr_tgamma(f));
+   check_result<double>(boost::math::constexpr_tgamma(d));
+   check_result<float>(boost::math::constexpr_lgamma(f));
+   check_result<double>(boost::math::constexpr_lgamma(d));
+   check_result<double>(boost::math::constexpr_lgamma(d, &sign));
+   check_result<double>(boost::math::constexpr_bessel_j0(d));
+   check_result<double>(boost::math::constexpr_bessel_j1(d));
+   check_result<double>(boost::math::constexpr_bessel_y0(d));
+   check_result<double>(boost::math::constexpr_bessel_y1(d));
+}
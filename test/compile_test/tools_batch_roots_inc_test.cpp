@@ -0,0 +1,30 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header <boost/math/tools/batch_roots.hpp>
+// #includes all the files that it needs to.
+//
+#include <boost/math/tools/batch_roots.hpp>
+#include <boost/math/tools/tuple.hpp>
+
+void compile_and_link_test()
+{
+   typedef boost::math::tools::eps_tolerance<double> Tol;
+   std::vector<double> guess(2, 1.5), lo(2, 1.0), hi(2, 2.0);
+   std::uintmax_t max_iter = 50;
+
+   auto f = [](std::size_t, double x) { return x * x - 2; };
+   auto f2 = [](std::size_t, double x) { return std::make_pair(x * x - 2, 2 * x); };
+   auto f3 = [](std::size_t, double x) { return boost::math::make_tuple(x * x - 2, 2 * x, 2.0); };
+   auto g = [](std::size_t n, const std::size_t*, const double* x, double* f0) { for (std::size_t k = 0; k < n; ++k) f0[k] = x[k] * x[k] - 2; };
+
+   boost::math::tools::batch_newton_raphson_iterate(f2, guess, lo, hi, 53, max_iter);
+   boost::math::tools::batch_halley_iterate(f3, guess, lo, hi, 53, max_iter);
+   boost::math::tools::batch_schroder_iterate(f3, guess, lo, hi, 53, max_iter);
+   boost::math::tools::batch_bisect(f, lo, hi, Tol(50), max_iter);
+   boost::math::tools::batch_bisect(g, lo, hi, Tol(50), max_iter);
+   boost::math::tools::batch_toms748_solve(f, lo, hi, Tol(50), max_iter);
+   boost::math::tools::batch_toms748_solve(g, lo, hi, Tol(50), max_iter);
+}
@@ -0,0 +1,19 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header <boost/math/tools/polynomial_roots.hpp>
+// #includes all the files that it needs to.
+//
+#include <boost/math/tools/polynomial_roots.hpp>
+
+void compile_and_link_test()
+{
+   boost::math::tools::polynomial<double> p{ -2.0, 0.0, 1.0 };
+   std::vector<std::complex<double> > roots = boost::math::tools::polynomial_roots(p);
+   boost::math::tools::polish_polynomial_roots<std::complex<long double> >(p, roots);
+
+   boost::math::tools::polynomial<std::complex<float> > q{ std::complex<float>(1), std::complex<float>(0, 1) };
+   std::vector<std::complex<float> > croots = boost::math::tools::polynomial_roots(q);
+}
@@ -16,6 +16,7 @@
 #include <boost/hana/ext/std/integer_sequence.hpp>
 #include <boost/math/tools/condition_numbers.hpp>
 #include <boost/math/special_functions/daubechies_scaling.hpp>
+#include <boost/math/special_functions/daubechies_wavelet.hpp>
 #include <boost/math/filters/daubechies.hpp>
 #include <boost/math/special_functions/detail/daubechies_scaling_integer_grid.hpp>
 #include <boost/math/quadrature/trapezoidal.hpp>
@@ -284,6 +285,41 @@ void test_dyadic_grid()
 
 // Taken from Lin, 2005, doi:10.1016/j.amc.2004.12.038,
 // "Direct algorithm for computation of derivatives of the Daubechies basis functions"
+void test_threaded_grids()
+{
+    std::cout << "Testing dyadic grids built by several threads\n";
+    // Large enough that the refinement is shared out:
+    auto v1 = boost::math::daubechies_scaling_dyadic_grid<double, 4, 0>(16);
+    auto v4 = boost::math::daubechies_scaling_dyadic_grid<double, 4, 0>(16, 4);
+    CHECK_EQUAL(v1.size(), v4.size());
+    for (size_t i = 0; i < v1.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(v1[i], v4[i], 0);
+    }
+    v1 = boost::math::daubechies_wavelet_dyadic_grid<double, 5, 1>(16);
+    v4 = boost::math::daubechies_wavelet_dyadic_grid<double, 5, 1>(16, 3);
+    CHECK_EQUAL(v1.size(), v4.size());
+    for (size_t i = 0; i < v1.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(v1[i], v4[i], 0);
+    }
+
+    // Objects constructed concurrently share one grid:
+    std::vector<std::future<double>> results;
+    for (int i = 0; i < 6; ++i)
+    {
+        results.push_back(std::async(std::launch::async, []() {
+            auto phi = boost::math::daubechies_scaling<double, 6>(12);
+            return phi(1.2345);
+        }));
+    }
+    auto phi = boost::math::daubechies_scaling<double, 6>(12);
+    for (auto & r : results)
+    {
+        CHECK_ULP_CLOSE(phi(1.2345), r.get(), 0);
+    }
+}
+
 void test_first_derivative()
 {
     auto phi1_3 = boost::math::detail::daubechies_scaling_integer_grid<long double, 3, 1>();
@@ -510,6 +546,8 @@ int main()
         #endif
     });
 
+    test_threaded_grids();
+
     test_dyadic_grid<float>();
     test_dyadic_grid<double>();
     test_dyadic_grid<long double>();
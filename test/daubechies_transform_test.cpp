@@ -0,0 +1,275 @@
+/*
+ * Copyright agent 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <numeric>
+#include <utility>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <boost/core/demangle.hpp>
+#include <boost/hana/for_each.hpp>
+#include <boost/hana/ext/std/integer_sequence.hpp>
+#include <boost/math/filters/daubechies_transform.hpp>
+
+using boost::math::filters::daubechies_scaling_filter;
+using boost::math::filters::daubechies_wavelet_filter;
+using boost::math::filters::daubechies_dwt;
+using boost::math::filters::daubechies_idwt;
+using boost::math::filters::daubechies_dwt_2d;
+using boost::math::filters::daubechies_idwt_2d;
+using boost::math::filters::daubechies_lifting_dwt;
+using boost::math::filters::daubechies_lifting_idwt;
+using boost::math::filters::daubechies_dwt_symmetric;
+using boost::math::filters::daubechies_idwt_symmetric;
+using boost::math::filters::daubechies_dwt_symmetric_size;
+using boost::math::filters::daubechies_dwt_symmetric_workspace_size;
+
+template<class Real>
+std::vector<Real> random_signal(size_t n)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    std::vector<Real> v(n);
+    for (auto& x : v)
+    {
+        x = dis(gen);
+    }
+    return v;
+}
+
+template<class Real, unsigned p>
+void test_periodic()
+{
+    std::cout << "Testing periodic transform with " << p << " vanishing moments on type " << boost::core::demangle(typeid(Real).name()) << "\n";
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    auto h = daubechies_scaling_filter<Real, p>();
+    auto g = daubechies_wavelet_filter<Real, p>();
+    for (size_t n : {2, 8, 64, 256})
+    {
+        auto x = random_signal<Real>(n);
+        auto y = x;
+        std::vector<Real> workspace(n);
+        daubechies_dwt<p>(y.begin(), y.end(), workspace.begin());
+        // Against the definition a[k] = sum h[m] x[2k+m], d[k] = sum g[m] x[2k+m], indices mod n:
+        for (size_t k = 0; k < n/2; ++k)
+        {
+            Real a = 0;
+            Real d = 0;
+            for (size_t m = 0; m < h.size(); ++m)
+            {
+                a += h[m]*x[(2*k + m) % n];
+                d += g[m]*x[(2*k + m) % n];
+            }
+            CHECK_ABSOLUTE_ERROR(a, y[k], tol);
+            CHECK_ABSOLUTE_ERROR(d, y[n/2 + k], tol);
+        }
+
+        size_t levels = 0;
+        while ((n >> levels) % 2 == 0)
+        {
+            ++levels;
+        }
+        y = x;
+        daubechies_dwt<p>(y.begin(), y.end(), workspace.begin(), levels);
+        // The transform is orthogonal:
+        Real x_energy = std::inner_product(x.begin(), x.end(), x.begin(), Real(0));
+        Real y_energy = std::inner_product(y.begin(), y.end(), y.begin(), Real(0));
+        CHECK_MOLLIFIED_CLOSE(x_energy, y_energy, tol*n);
+        daubechies_idwt<p>(y.begin(), y.end(), workspace.begin(), levels);
+        for (size_t i = 0; i < n; ++i)
+        {
+            CHECK_ABSOLUTE_ERROR(x[i], y[i], tol*(std::max)(levels, size_t(1)));
+        }
+    }
+
+    // A polynomial of degree < p has no detail away from the wraparound:
+    size_t n = 128;
+    std::vector<Real> x(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        Real t = Real(i)/n;
+        x[i] = 0;
+        for (unsigned j = 0; j < p; ++j)
+        {
+            x[i] = x[i]*t + 1;
+        }
+    }
+    std::vector<Real> workspace(n);
+    daubechies_dwt<p>(x.begin(), x.end(), workspace.begin());
+    for (size_t k = 0; 2*k + 2*p <= n; ++k)
+    {
+        CHECK_ABSOLUTE_ERROR(Real(0), x[n/2 + k], 2*p*tol);
+    }
+
+    bool caught = false;
+    try
+    {
+        std::vector<Real> v(12);
+        daubechies_dwt<p>(v.begin(), v.end(), workspace.begin(), 3);
+    }
+    catch (const std::domain_error&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+}
+
+template<class Real, unsigned p>
+void test_2d()
+{
+    std::cout << "Testing 2D transform with " << p << " vanishing moments on type " << boost::core::demangle(typeid(Real).name()) << "\n";
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    size_t rows = 32;
+    size_t cols = 16;
+    auto x = random_signal<Real>(rows*cols);
+    std::vector<Real> workspace(2*rows);
+
+    // One level is a 1D transform of each row followed by one of each column:
+    auto y = x;
+    daubechies_dwt_2d<p>(y.begin(), rows, cols, workspace.begin());
+    auto z = x;
+    std::vector<Real> column(rows);
+    for (size_t i = 0; i < rows; ++i)
+    {
+        daubechies_dwt<p>(z.begin() + i*cols, z.begin() + (i+1)*cols, workspace.begin());
+    }
+    for (size_t j = 0; j < cols; ++j)
+    {
+        for (size_t i = 0; i < rows; ++i)
+        {
+            column[i] = z[i*cols + j];
+        }
+        daubechies_dwt<p>(column.begin(), column.end(), workspace.begin());
+        for (size_t i = 0; i < rows; ++i)
+        {
+            CHECK_ABSOLUTE_ERROR(column[i], y[i*cols + j], tol);
+        }
+    }
+
+    y = x;
+    daubechies_dwt_2d<p>(y.begin(), rows, cols, workspace.begin(), 3);
+    daubechies_idwt_2d<p>(y.begin(), rows, cols, workspace.begin(), 3);
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(x[i], y[i], 3*tol);
+    }
+}
+
+template<class Real, unsigned p>
+void test_lifting()
+{
+    std::cout << "Testing lifting scheme with " << p << " vanishing moments on type " << boost::core::demangle(typeid(Real).name()) << "\n";
+    Real tol = 32*std::numeric_limits<Real>::epsilon();
+    for (size_t n : {2, 4, 64, 512})
+    {
+        size_t levels = 0;
+        while ((n >> levels) % 2 == 0)
+        {
+            ++levels;
+        }
+        auto x = random_signal<Real>(n);
+        auto y = x;
+        auto z = x;
+        std::vector<Real> workspace(n);
+        daubechies_dwt<p>(y.begin(), y.end(), workspace.begin(), levels);
+        daubechies_lifting_dwt<p>(z.begin(), z.end(), levels);
+        // Same coefficients, but interleaved:
+        CHECK_ABSOLUTE_ERROR(y[0], z[0], tol);
+        for (size_t j = 1; j <= levels; ++j)
+        {
+            size_t len = n >> j;
+            for (size_t k = 0; k < len; ++k)
+            {
+                CHECK_ABSOLUTE_ERROR(y[len + k], z[(k << j) + (size_t(1) << (j-1))], tol*levels);
+            }
+        }
+        daubechies_lifting_idwt<p>(z.begin(), z.end(), levels);
+        for (size_t i = 0; i < n; ++i)
+        {
+            CHECK_ABSOLUTE_ERROR(x[i], z[i], tol*levels);
+        }
+    }
+}
+
+template<class Real, unsigned p>
+void test_symmetric()
+{
+    std::cout << "Testing symmetric extension with " << p << " vanishing moments on type " << boost::core::demangle(typeid(Real).name()) << "\n";
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (size_t n : {1, 3, 17, 100, 1000})
+    {
+        for (size_t levels : {0, 1, 2, 5})
+        {
+            auto x = random_signal<Real>(n);
+            std::vector<Real> coefficients(daubechies_dwt_symmetric_size<p>(n, levels));
+            std::vector<Real> workspace(daubechies_dwt_symmetric_workspace_size<p>(n));
+            daubechies_dwt_symmetric<p>(x.begin(), x.end(), coefficients.begin(), workspace.begin(), levels);
+            if (levels == 0)
+            {
+                // No levels leaves the signal as it was:
+                CHECK_EQUAL(n, coefficients.size());
+                for (size_t i = 0; i < n; ++i)
+                {
+                    CHECK_EQUAL(x[i], coefficients[i]);
+                }
+            }
+            std::vector<Real> y(n);
+            daubechies_idwt_symmetric<p>(coefficients.begin(), n, y.begin(), workspace.begin(), levels);
+            for (size_t i = 0; i < n; ++i)
+            {
+                CHECK_ABSOLUTE_ERROR(x[i], y[i], tol*(std::max)(levels, size_t(1)));
+            }
+        }
+    }
+
+    // Polynomials of degree < p are reproduced across the boundary by the symmetric extension
+    // only for p = 1; for all p the interior details vanish:
+    size_t n = 200;
+    std::vector<Real> x(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        Real t = Real(i)/n;
+        x[i] = 0;
+        for (unsigned j = 0; j < p; ++j)
+        {
+            x[i] = x[i]*t + 1;
+        }
+    }
+    std::vector<Real> coefficients(daubechies_dwt_symmetric_size<p>(n));
+    std::vector<Real> workspace(daubechies_dwt_symmetric_workspace_size<p>(n));
+    daubechies_dwt_symmetric<p>(x.begin(), x.end(), coefficients.begin(), workspace.begin());
+    size_t len = coefficients.size()/2;
+    for (size_t k = p; k + p < len; ++k)
+    {
+        CHECK_ABSOLUTE_ERROR(Real(0), coefficients[len + k], 2*p*tol);
+    }
+}
+
+int main()
+{
+    boost::hana::for_each(std::make_index_sequence<10>(), [&](auto i){
+        test_periodic<float, i+1>();
+        test_periodic<double, i+1>();
+        test_periodic<long double, i+1>();
+        test_symmetric<double, i+1>();
+    });
+
+    test_2d<float, 2>();
+    test_2d<double, 1>();
+    test_2d<double, 4>();
+    test_2d<long double, 8>();
+
+    test_lifting<float, 1>();
+    test_lifting<double, 1>();
+    test_lifting<long double, 1>();
+    test_lifting<float, 2>();
+    test_lifting<double, 2>();
+    test_lifting<long double, 2>();
+
+    return boost::math::test::report_errors();
+}
@@ -117,6 +117,52 @@ void test_quadratures()
     }
 }
 
+template<typename Real, int p>
+void test_bulk_evaluation()
+{
+    std::cout << "Testing bulk evaluation of " << p << " vanishing moment Daubechies wavelet on type " << boost::core::demangle(typeid(Real).name()) << "\n";
+    auto psi = boost::math::daubechies_wavelet<Real, p>(8);
+    auto [a, b] = psi.support();
+    // Includes points outside the support, the endpoints, and grid points:
+    std::vector<Real> x;
+    for (Real t = a - 1; t <= b + 1; t += Real(1)/Real(1024))
+    {
+        x.push_back(t);
+    }
+    std::mt19937 gen(323723);
+    std::uniform_real_distribution<Real> dis(a, b);
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        x.push_back(dis(gen));
+    }
+    x.push_back(std::numeric_limits<Real>::quiet_NaN());
+    std::vector<Real> y(x.size());
+    std::vector<Real> dydx(x.size());
+    psi(x.data(), x.size(), y.data(), dydx.data());
+    Real tol = 8*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i + 1 < x.size(); ++i)
+    {
+        CHECK_MOLLIFIED_CLOSE(psi(x[i]), y[i], tol);
+        CHECK_MOLLIFIED_CLOSE(psi.prime(x[i]), dydx[i], 32*tol);
+    }
+    CHECK_EQUAL(Real(0), y.back());
+    // The derivative is optional:
+    std::vector<Real> z(x.size());
+    psi(x.data(), x.size(), z.data());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_EQUAL(y[i], z[i]);
+    }
+
+    auto phi = boost::math::daubechies_scaling<Real, p>(8);
+    phi(x.data(), x.size(), y.data(), dydx.data());
+    for (size_t i = 0; i + 1 < x.size(); ++i)
+    {
+        CHECK_MOLLIFIED_CLOSE(phi(x[i]), y[i], tol);
+        CHECK_MOLLIFIED_CLOSE(phi.prime(x[i]), dydx[i], 32*tol);
+    }
+}
+
 int main()
 {
     #ifndef __MINGW32__
@@ -124,6 +170,13 @@ int main()
     {
       test_exact_value<double>();
 
+      test_bulk_evaluation<double, 3>();
+      test_bulk_evaluation<double, 4>();
+      test_bulk_evaluation<float, 7>();
+      test_bulk_evaluation<double, 8>();
+      test_bulk_evaluation<double, 12>();
+      test_bulk_evaluation<long double, 15>();
+
       boost::hana::for_each(std::make_index_sequence<17>(), [&](auto i) {
          test_quadratures<float, i + 3>();
          test_quadratures<double, i + 3>();
@@ -0,0 +1,134 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <atomic>
+#include <utility>
+#include <array>
+#include <vector>
+#include <random>
+#include <stdexcept>
+#include "math_unit_test.hpp"
+#include "test_functions_for_optimization.hpp"
+#include <boost/math/optimization/differential_evolution.hpp>
+
+using boost::math::optimization::differential_evolution;
+using boost::math::optimization::differential_evolution_parameters;
+
+template<class Real>
+void test_rastrigin()
+{
+    using ArgType = std::vector<Real>;
+    differential_evolution_parameters<ArgType> de_params;
+    de_params.lower_bounds.resize(4, Real(-5.12));
+    de_params.upper_bounds.resize(4, Real(5.12));
+    de_params.max_generations = 2000;
+    std::mt19937_64 gen(34567);
+    auto x = differential_evolution(rastrigin<Real, ArgType>, de_params, gen, Real(1e-5));
+    CHECK_LE(rastrigin<Real>(x), Real(1e-5));
+
+    // The same seed gives the same answer, however many threads are used:
+    std::mt19937_64 gen1(34567);
+    de_params.threads = 1;
+    auto x1 = differential_evolution(rastrigin<Real, ArgType>, de_params, gen1, Real(1e-5));
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_EQUAL(x[i], x1[i]);
+    }
+}
+
+template<class Real>
+void test_rosenbrock_with_std_array()
+{
+    using ArgType = std::array<Real, 3>;
+    differential_evolution_parameters<ArgType> de_params;
+    de_params.lower_bounds = {-2, -2, -2};
+    de_params.upper_bounds = {2, 2, 2};
+    de_params.NP = 60;
+    de_params.crossover_probability = Real(0.9);
+    de_params.max_generations = 3000;
+    ArgType guess{Real(0.5), Real(0.5), Real(0.5)};
+    de_params.initial_guess = &guess;
+    std::mt19937_64 gen(8765);
+    auto x = differential_evolution(rosenbrock<Real, ArgType>, de_params, gen);
+    for (auto xi : x)
+    {
+        CHECK_ABSOLUTE_ERROR(Real(1), xi, Real(1e-4));
+    }
+}
+
+void test_cancellation_and_bounds()
+{
+    using ArgType = std::vector<double>;
+    differential_evolution_parameters<ArgType> de_params;
+    de_params.lower_bounds = {1, 1};
+    de_params.upper_bounds = {3, 3};
+    std::mt19937_64 gen(1);
+    // The unconstrained minimum is outside the box, so the result must be on the boundary:
+    auto x = differential_evolution([](ArgType const & v) { return v[0] + v[1]; }, de_params, gen);
+    CHECK_ABSOLUTE_ERROR(1.0, x[0], 1e-10);
+    CHECK_ABSOLUTE_ERROR(1.0, x[1], 1e-10);
+
+    std::atomic<bool> cancel{true};
+    x = differential_evolution([](ArgType const & v) { return v[0] + v[1]; }, de_params, gen, std::numeric_limits<double>::quiet_NaN(), &cancel);
+    CHECK_LE(de_params.lower_bounds[0], x[0]);
+    CHECK_LE(x[0], de_params.upper_bounds[0]);
+
+    bool thrown = false;
+    de_params.upper_bounds = {0, 3};
+    try
+    {
+        differential_evolution([](ArgType const & v) { return v[0] + v[1]; }, de_params, gen);
+    }
+    catch (std::domain_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+// An exception thrown by the cost function, on a worker or on the calling thread, reaches the caller:
+void test_throwing_cost()
+{
+    using ArgType = std::vector<double>;
+    differential_evolution_parameters<ArgType> de_params;
+    de_params.lower_bounds.resize(3, -2.0);
+    de_params.upper_bounds.resize(3, 2.0);
+    de_params.threads = 4;
+    std::mt19937_64 gen(5);
+    // The first failure lands in the initial population, the later ones in later generations:
+    for (size_t fail_at : {0, 1, 29, 100, 1000})
+    {
+        std::atomic<size_t> calls{0};
+        auto cost = [&](ArgType const & v) {
+            if (calls++ >= fail_at)
+            {
+                throw std::runtime_error("Cost function failed.");
+            }
+            return rosenbrock<double>(v);
+        };
+        bool thrown = false;
+        try
+        {
+            differential_evolution(cost, de_params, gen);
+        }
+        catch (std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        CHECK_EQUAL(thrown, true);
+    }
+}
+
+int main()
+{
+    test_rastrigin<float>();
+    test_rastrigin<double>();
+    test_rosenbrock_with_std_array<double>();
+    test_cancellation_and_bounds();
+    test_throwing_cost();
+    return boost::math::test::report_errors();
+}
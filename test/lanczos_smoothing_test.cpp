@@ -26,6 +26,7 @@ using boost::math::constants::two_pi;
 using boost::multiprecision::cpp_bin_float_50;
 using boost::multiprecision::cpp_bin_float_100;
 using boost::math::differentiation::discrete_lanczos_derivative;
+using boost::math::differentiation::discrete_lanczos_derivative_stream;
 using boost::math::differentiation::detail::discrete_legendre;
 using boost::math::differentiation::detail::interior_velocity_filter;
 using boost::math::differentiation::detail::boundary_velocity_filter;
@@ -675,6 +676,71 @@ void test_data_representations()
 
 }
 
+template<class Real, size_t order>
+void test_in_place_and_streaming(size_t n, size_t p)
+{
+    std::cout << "Test in place and streaming derivatives of order " << order << " with n = " << n << " on type " << typeid(Real).name() << "\n";
+    Real tol = 10*std::numeric_limits<Real>::epsilon();
+    std::mt19937 gen(4823);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    // Long enough that for large n the FFT is applied to pairs of blocks and to a single block:
+    std::vector<Real> v(20000);
+    for (auto & x : v)
+    {
+        x = dis(gen);
+    }
+    auto lanczos = discrete_lanczos_derivative<Real, order>(Real(1)/Real(64), n, p);
+    std::vector<Real> w = lanczos(v);
+    // Against the pointwise evaluation:
+    Real scale = 0;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        scale = (std::max)(scale, abs(w[i]));
+    }
+    for (size_t i = 0; i < v.size(); i += 7)
+    {
+        BOOST_CHECK_SMALL(abs(w[i] - lanczos(v, i)), 4*scale*tol);
+    }
+
+    std::vector<Real> u = v;
+    lanczos(u, u);
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(w[i], u[i]);
+    }
+
+    auto stream = discrete_lanczos_derivative_stream<Real, order>(Real(1)/Real(64), n, p);
+    BOOST_CHECK_EQUAL(stream.delay(), n);
+    std::vector<Real> z;
+    size_t i = 0;
+    std::uniform_int_distribution<size_t> chunk(0, 3*n);
+    while (i < v.size())
+    {
+        size_t m = (std::min)(chunk(gen), v.size() - i);
+        stream(v.begin() + i, v.begin() + i + m, std::back_inserter(z));
+        i += m;
+        // Each derivative is written as soon as the samples it depends on have arrived:
+        if (i >= 2*n + 1)
+        {
+            BOOST_CHECK_EQUAL(z.size(), i - n);
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL(z.size(), size_t(0));
+        }
+    }
+    stream.flush(std::back_inserter(z));
+    BOOST_REQUIRE_EQUAL(z.size(), v.size());
+    for (size_t k = 0; k < v.size(); ++k)
+    {
+        BOOST_CHECK_SMALL(abs(w[k] - z[k]), 4*scale*tol);
+    }
+
+    // The stream is reset by flush, and a short signal is an error:
+    stream(v.begin(), v.begin() + 2*n, std::back_inserter(z));
+    BOOST_CHECK_THROW(stream.flush(std::back_inserter(z)), std::length_error);
+}
+
 BOOST_AUTO_TEST_CASE(lanczos_smoothing_test)
 {
     test_dlp_second_derivative<double>();
@@ -705,4 +771,12 @@ BOOST_AUTO_TEST_CASE(lanczos_smoothing_test)
 
     test_rescaling<double>();
     test_data_representations<double>();
+
+    test_in_place_and_streaming<float, 1>(18, 3);
+    test_in_place_and_streaming<double, 1>(18, 3);
+    test_in_place_and_streaming<double, 2>(18, 4);
+    test_in_place_and_streaming<long double, 1>(7, 5);
+    // Long enough to be applied by FFT:
+    test_in_place_and_streaming<double, 1>(300, 3);
+    test_in_place_and_streaming<double, 2>(300, 4);
 }
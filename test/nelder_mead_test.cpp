@@ -0,0 +1,158 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <atomic>
+#include <utility>
+#include <array>
+#include <vector>
+#include <random>
+#include <stdexcept>
+#include "math_unit_test.hpp"
+#include "test_functions_for_optimization.hpp"
+#include <boost/math/optimization/nelder_mead.hpp>
+
+using boost::math::optimization::nelder_mead;
+using boost::math::optimization::nelder_mead_parameters;
+using boost::math::optimization::multistart_nelder_mead;
+
+template<class Real>
+void test_rosenbrock()
+{
+    nelder_mead_parameters<std::vector<Real>> params;
+    params.initial_guess = {-1.2, 1, 0.5, -0.5};
+    auto x = nelder_mead(rosenbrock<Real, std::vector<Real>>, params);
+    for (auto xi : x)
+    {
+        CHECK_ABSOLUTE_ERROR(Real(1), xi, Real(1e-5));
+    }
+}
+
+template<class Real>
+void test_beale_with_std_array()
+{
+    nelder_mead_parameters<std::array<Real, 2>> params;
+    params.initial_guess = {1, 1};
+    params.threads = 1;
+    auto x = nelder_mead(beale<Real, std::array<Real, 2>>, params);
+    // Near a minimum the cost is quadratic, so we can't expect more than about half the digits of Real:
+    Real tol = 100*std::sqrt(std::numeric_limits<Real>::epsilon());
+    CHECK_ABSOLUTE_ERROR(Real(3), x[0], tol);
+    CHECK_ABSOLUTE_ERROR(Real(0.5), x[1], tol);
+
+    // One dimensional problems use the classical coefficients:
+    nelder_mead_parameters<std::array<Real, 1>> params1;
+    params1.initial_guess = {5};
+    auto x1 = nelder_mead([](std::array<Real, 1> const & v) { return (v[0] - 2)*(v[0] - 2); }, params1);
+    CHECK_ABSOLUTE_ERROR(Real(2), x1[0], tol);
+}
+
+void test_multistart()
+{
+    using Real = double;
+    nelder_mead_parameters<std::vector<Real>> params;
+    // A local minimum of the Rastrigin function:
+    params.initial_guess = {2, -3};
+    std::vector<Real> lower{-5.12, -5.12};
+    std::vector<Real> upper{5.12, 5.12};
+    std::mt19937_64 gen(34567);
+    params.threads = 4;
+    auto x = multistart_nelder_mead(rastrigin<Real, std::vector<Real>>, params, lower, upper, 200, gen);
+    CHECK_LE(rastrigin<Real>(x), Real(1e-8));
+
+    // The same seed gives the same answer, however many threads are used:
+    std::mt19937_64 gen1(34567);
+    params.threads = 1;
+    auto x1 = multistart_nelder_mead(rastrigin<Real, std::vector<Real>>, params, lower, upper, 200, gen1);
+    CHECK_EQUAL(x[0], x1[0]);
+    CHECK_EQUAL(x[1], x1[1]);
+}
+
+void test_exceptions()
+{
+    nelder_mead_parameters<std::vector<double>> params;
+    bool thrown = false;
+    try
+    {
+        nelder_mead(rosenbrock<double, std::vector<double>>, params);
+    }
+    catch (std::domain_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    params.initial_guess = {1, 1};
+    params.initial_step = -1;
+    thrown = false;
+    try
+    {
+        nelder_mead(rosenbrock<double, std::vector<double>>, params);
+    }
+    catch (std::domain_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+// An exception thrown by the cost function, on a worker or on the calling thread, reaches the caller:
+void test_throwing_cost()
+{
+    using ArgType = std::vector<double>;
+    nelder_mead_parameters<ArgType> params;
+    params.initial_guess = ArgType(7, 0.5);
+    params.threads = 4;
+    std::mt19937_64 gen(12);
+    ArgType lower(7, -2);
+    ArgType upper(7, 2);
+    // The first failure lands in the initial simplex, the later ones in the iterations and the independent starts:
+    for (size_t fail_at : {0, 1, 5, 50, 500})
+    {
+        std::atomic<size_t> calls{0};
+        auto cost = [&](ArgType const & v) {
+            if (calls++ >= fail_at)
+            {
+                throw std::runtime_error("Cost function failed.");
+            }
+            return rosenbrock<double>(v);
+        };
+        bool thrown = false;
+        try
+        {
+            nelder_mead(cost, params);
+        }
+        catch (std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        CHECK_EQUAL(thrown, true);
+
+        calls = 0;
+        thrown = false;
+        try
+        {
+            multistart_nelder_mead(cost, params, lower, upper, 8, gen);
+        }
+        catch (std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        CHECK_EQUAL(thrown, true);
+    }
+}
+
+int main()
+{
+    test_rosenbrock<double>();
+    test_rosenbrock<long double>();
+    test_beale_with_std_array<float>();
+    test_beale_with_std_array<double>();
+    test_multistart();
+    test_exceptions();
+    test_throwing_cost();
+    return boost::math::test::report_errors();
+}
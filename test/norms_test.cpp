@@ -17,6 +17,9 @@
 #include <boost/math/tools/norms.hpp>
 #include <boost/multiprecision/cpp_bin_float.hpp>
 #include <boost/multiprecision/cpp_complex.hpp>
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+#include <execution>
+#endif
 
 using std::abs;
 using std::pow;
@@ -795,6 +798,121 @@ void test_complex_sup_distance()
     BOOST_TEST(abs(dist1 - dist2) < tol*dist1);
 }
 
+// The single pass algorithm must agree with rescaling by the largest value when the squares overflow or underflow:
+template<class Real>
+void test_l2_norm_scaling()
+{
+    using std::sqrt;
+    using std::isnan;
+    using std::isinf;
+    auto rescaled = [](std::vector<Real> const & v) {
+        Real a = sup_norm(v);
+        Real sum = 0;
+        for (auto x : v)
+        {
+            sum += (x/a)*(x/a);
+        }
+        return a*sqrt(sum);
+    };
+    Real tiny = 4*std::numeric_limits<Real>::min();
+    // Sizes around the multiples of the lanes and the blocks of the kernel:
+    for (size_t n : {1, 7, 9, 1023, 1024, 1025, 3000})
+    {
+        // Small enough that the norm doesn't overflow:
+        Real huge = (std::numeric_limits<Real>::max)()/(64*n);
+        Real tol = 4*n*std::numeric_limits<Real>::epsilon();
+        auto v = generate_random_vector<Real>(n, global_seed + n);
+        auto scaled = v;
+        for (auto & x : scaled)
+        {
+            x *= tiny;
+        }
+        Real l2 = l2_norm(scaled);
+        Real expected = rescaled(scaled);
+        BOOST_TEST(l2 > 0);
+        BOOST_TEST(abs(l2 - expected) <= tol*expected);
+
+        scaled = v;
+        for (auto & x : scaled)
+        {
+            x *= huge;
+        }
+        l2 = l2_norm(scaled);
+        expected = rescaled(scaled);
+        BOOST_TEST(abs(l2 - expected) <= tol*expected);
+
+        // Mixtures, with the extreme values in the last block:
+        scaled = v;
+        scaled[n - 1] = huge;
+        l2 = l2_norm(scaled);
+        expected = rescaled(scaled);
+        BOOST_TEST(abs(l2 - expected) <= tol*expected);
+        scaled[n - 1] = tiny;
+        scaled[0] = tiny;
+        l2 = l2_norm(scaled);
+        expected = rescaled(scaled);
+        BOOST_TEST(abs(l2 - expected) <= tol*expected);
+
+        auto w = generate_random_vector<Real>(n, global_seed + n + 1);
+        for (size_t i = 0; i < n; ++i)
+        {
+            v[i] *= huge/2;
+            w[i] *= huge/2;
+            scaled[i] = v[i] - w[i];
+        }
+        Real dist = l2_distance(v, w);
+        expected = rescaled(scaled);
+        BOOST_TEST(abs(dist - expected) <= tol*expected);
+
+        scaled[n/2] = std::numeric_limits<Real>::quiet_NaN();
+        BOOST_TEST(isnan(l2_norm(scaled)));
+        scaled[n/2] = std::numeric_limits<Real>::infinity();
+        BOOST_TEST(isinf(l2_norm(scaled)));
+    }
+    std::vector<Real> zeros(100, Real(0));
+    BOOST_TEST_EQ(l2_norm(zeros), Real(0));
+
+    std::vector<std::complex<Real>> z{{tiny, tiny}, {0, -tiny}, {tiny, 0}};
+    Real l2 = l2_norm(z);
+    BOOST_TEST(abs(l2 - 2*tiny) <= 4*std::numeric_limits<Real>::epsilon()*2*tiny);
+    Real huge = (std::numeric_limits<Real>::max)()/4;
+    z = {{huge, huge}, {0, -huge}, {huge, 0}};
+    l2 = l2_norm(z);
+    BOOST_TEST(abs(l2/huge - 2) <= 4*std::numeric_limits<Real>::epsilon()*2);
+}
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+// Long enough to be split between threads where there are several:
+// Real is the type whose precision the results have:
+template<class T, class Real, class ExecutionPolicy>
+void test_execution_policy(ExecutionPolicy&& exec)
+{
+    size_t n = 300001;
+    auto v = generate_random_vector<T>(n, global_seed);
+    auto w = generate_random_vector<T>(n, global_seed + 1);
+    w[17] = v[17];
+    // The sequential lp_norm and lp_distance sum in order, so their rounding errors grow with n:
+    double tol = 10*std::sqrt(double(n))*std::numeric_limits<Real>::epsilon();
+    auto close = [tol](auto a, auto b) { return abs(double(a) - double(b)) <= tol*abs(double(b)); };
+    BOOST_TEST(close(l1_norm(exec, v), l1_norm(v)));
+    BOOST_TEST(close(l1_norm(exec, v.begin(), v.end()), l1_norm(v)));
+    BOOST_TEST(close(l2_norm(exec, v), l2_norm(v)));
+    BOOST_TEST(close(lp_norm(exec, v, 3), lp_norm(v, 3)));
+    BOOST_TEST(close(sup_norm(exec, v), sup_norm(v)));
+    BOOST_TEST_EQ(boost::math::tools::l0_pseudo_norm(exec, v), boost::math::tools::l0_pseudo_norm(v));
+    BOOST_TEST(close(l1_distance(exec, v, w), l1_distance(v, w)));
+    BOOST_TEST(close(l2_distance(exec, v, w), l2_distance(v, w)));
+    BOOST_TEST(close(lp_distance(exec, v, w, 3), lp_distance(v, w, 3)));
+    BOOST_TEST(close(sup_distance(exec, v, w), sup_distance(v, w)));
+    BOOST_TEST_EQ(boost::math::tools::hamming_distance(exec, v, w), boost::math::tools::hamming_distance(v, w));
+    if constexpr (!boost::math::tools::is_complex_type<T>::value)
+    {
+        BOOST_TEST(close(total_variation(exec, v), total_variation(v)));
+        BOOST_TEST(close(total_variation(exec, v.cbegin(), v.cend()), total_variation(v)));
+    }
+}
+#endif
+
 int main()
 {
     test_l0_pseudo_norm<unsigned>();
@@ -908,5 +1026,19 @@ int main()
     test_integer_total_variation<uint32_t>();
     test_integer_total_variation<int>();
 
+    test_l2_norm_scaling<float>();
+    test_l2_norm_scaling<double>();
+    test_l2_norm_scaling<long double>();
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    test_execution_policy<float, float>(std::execution::seq);
+    test_execution_policy<float, float>(std::execution::par);
+    test_execution_policy<double, double>(std::execution::par);
+    test_execution_policy<double, double>(std::execution::par_unseq);
+    test_execution_policy<std::complex<double>, double>(std::execution::par);
+    test_execution_policy<int, double>(std::execution::par);
+    test_execution_policy<unsigned, double>(std::execution::par);
+#endif
+
     return boost::report_errors();
 }
@@ -0,0 +1,248 @@
+/*
+ * Copyright agent 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <utility>
+#include <vector>
+#include <complex>
+#include <algorithm>
+#include <random>
+#include "math_unit_test.hpp"
+#include <boost/math/tools/polynomial_roots.hpp>
+#include <boost/math/constants/constants.hpp>
+
+using boost::math::tools::polynomial;
+using boost::math::tools::polynomial_roots;
+using boost::math::tools::polish_polynomial_roots;
+
+template<class Complex>
+void sort_roots(std::vector<Complex>& roots)
+{
+    std::sort(roots.begin(), roots.end(), [](Complex const & a, Complex const & b) {
+        return a.real() < b.real() || (a.real() == b.real() && a.imag() < b.imag()); });
+}
+
+template<class Complex>
+typename Complex::value_type distance_to_nearest(std::vector<Complex> const & roots, Complex const & z)
+{
+    using std::abs;
+    typename Complex::value_type d = abs(roots[0] - z);
+    for (auto const & r : roots)
+    {
+        d = (std::min)(d, abs(r - z));
+    }
+    return d;
+}
+
+template<class Real>
+polynomial<Real> from_roots(std::vector<Real> const & roots)
+{
+    polynomial<Real> p{Real(1)};
+    for (auto r : roots)
+    {
+        p *= polynomial<Real>{-r, Real(1)};
+    }
+    return p;
+}
+
+template<class Real>
+void test_integer_roots()
+{
+    std::vector<Real> expected{1, 2, 3, 4, 5, 6, 7, 8};
+    auto p = from_roots(expected);
+    auto roots = polynomial_roots(p);
+    CHECK_EQUAL(roots.size(), expected.size());
+    sort_roots(roots);
+    // These roots are ill-conditioned: the attainable accuracy is eps*sum|a_k||r|^k/|p'(r)|,
+    // which is around 4e5*eps for the worst of them.
+    Real tol = 2000000*std::numeric_limits<Real>::epsilon();
+    for (std::size_t i = 0; i < roots.size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(expected[i], roots[i].real(), tol);
+        CHECK_ABSOLUTE_ERROR(Real(0), roots[i].imag(), tol);
+    }
+}
+
+template<class Real>
+void test_roots_of_unity(std::size_t n)
+{
+    using std::abs;
+    using std::pow;
+    std::vector<Real> c(n + 1, Real(0));
+    c[0] = -1;
+    c[n] = 1;
+    polynomial<Real> p(std::move(c));
+    auto roots = polynomial_roots(p);
+    CHECK_EQUAL(roots.size(), n);
+    Real tol = 16*std::numeric_limits<Real>::epsilon();
+    for (auto const & z : roots)
+    {
+        CHECK_ABSOLUTE_ERROR(Real(1), abs(z), tol);
+    }
+    // The roots must be distinct, the minimum separation is 2 sin(pi/n):
+    sort_roots(roots);
+    Real separation = 2*sin(boost::math::constants::pi<Real>()/n);
+    for (std::size_t i = 0; i < roots.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < roots.size(); ++j)
+        {
+            CHECK_LE(separation/2, abs(roots[i] - roots[j]));
+        }
+    }
+}
+
+template<class Real>
+void test_random_high_degree(std::size_t n)
+{
+    using std::abs;
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    std::vector<Real> c(n + 1);
+    for (auto& x : c)
+    {
+        x = dis(gen);
+    }
+    polynomial<Real> p(c);
+    auto roots = polynomial_roots(p);
+    CHECK_EQUAL(roots.size(), n);
+    // Each root must have a residual at the level of the rounding error in evaluating p:
+    for (auto const & z : roots)
+    {
+        std::complex<Real> w = abs(z) > 1 ? Real(1)/z : z;
+        std::complex<Real> q = 0;
+        Real s = 0;
+        for (std::size_t k = 0; k <= n; ++k)
+        {
+            Real coef = abs(z) > 1 ? c[k] : c[n - k];
+            q = q*w + coef;
+            s = s*abs(w) + abs(coef);
+        }
+        CHECK_LE(abs(q), 8*n*std::numeric_limits<Real>::epsilon()*s);
+    }
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    // Jacobi-style sweeps are deterministic, so the parallel version gives identical results:
+    auto par_roots = polynomial_roots(std::execution::par, p);
+    CHECK_EQUAL(par_roots.size(), roots.size());
+    for (std::size_t i = 0; i < roots.size(); ++i)
+    {
+        CHECK_EQUAL(roots[i].real(), par_roots[i].real());
+        CHECK_EQUAL(roots[i].imag(), par_roots[i].imag());
+    }
+#endif
+}
+
+template<class Real>
+void test_special_cases()
+{
+    // x^3(x - 2): zero roots are found exactly.
+    polynomial<Real> p{0, 0, 0, -2, 1};
+    auto roots = polynomial_roots(p);
+    CHECK_EQUAL(roots.size(), std::size_t(4));
+    sort_roots(roots);
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        CHECK_EQUAL(roots[i], std::complex<Real>(0));
+    }
+    CHECK_ULP_CLOSE(Real(2), roots[3].real(), 2);
+
+    // Constant polynomial: no roots.
+    polynomial<Real> one{Real(1)};
+    CHECK_EQUAL(polynomial_roots(one).size(), std::size_t(0));
+
+    bool thrown = false;
+    try
+    {
+        polynomial_roots(polynomial<Real>{Real(0)});
+    }
+    catch (std::domain_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+
+    // Complex coefficients, (z - i)(z + 2i)(z - 3):
+    typedef std::complex<Real> C;
+    polynomial<C> q = polynomial<C>{C(0, -1), C(1)} * polynomial<C>{C(0, 2), C(1)} * polynomial<C>{C(-3), C(1)};
+    auto croots = polynomial_roots(q);
+    CHECK_EQUAL(croots.size(), std::size_t(3));
+    Real tol = 10*std::numeric_limits<Real>::epsilon();
+    CHECK_ABSOLUTE_ERROR(Real(0), distance_to_nearest(croots, C(0, -2)), 2*tol);
+    CHECK_ABSOLUTE_ERROR(Real(0), distance_to_nearest(croots, C(0, 1)), tol);
+    CHECK_ABSOLUTE_ERROR(Real(0), distance_to_nearest(croots, C(3)), 3*tol);
+}
+
+void test_polish()
+{
+    // Polishing in long double is only a gain where long double is wider than double:
+    if (std::numeric_limits<long double>::digits <= std::numeric_limits<double>::digits)
+    {
+        return;
+    }
+    double tol = 100*std::numeric_limits<double>::epsilon();
+    std::vector<double> expected{1, 2, 3, 4, 5, 6, 7, 8};
+    auto p = from_roots(expected);
+    auto roots = polynomial_roots(p);
+    sort_roots(roots);
+    // Unpolished, the ill-conditioning costs several decimal digits (see test_integer_roots):
+    double unpolished = 0;
+    for (std::size_t i = 0; i < roots.size(); ++i)
+    {
+        unpolished = (std::max)(unpolished, std::abs(expected[i] - roots[i].real()));
+    }
+    CHECK_LE(tol, unpolished);
+    // The coefficients are exact, so the extra precision goes straight into the roots:
+    polish_polynomial_roots<std::complex<long double>>(p, roots);
+    sort_roots(roots);
+    for (std::size_t i = 0; i < roots.size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(expected[i], roots[i].real(), tol);
+    }
+
+    // The coefficients are wider than the roots: polishing must use them at full precision,
+    // not the rounded double coefficients the roots were found from.
+    std::vector<long double> wide_roots;
+    for (int k = 1; k <= 8; ++k)
+    {
+        wide_roots.push_back(k + 1.0L/3);
+    }
+    auto wide = from_roots(wide_roots);
+    std::vector<double> narrow_coefficients(wide.data().begin(), wide.data().end());
+    polynomial<double> narrow(narrow_coefficients.begin(), narrow_coefficients.end());
+    roots = polynomial_roots(narrow);
+    sort_roots(roots);
+    unpolished = 0;
+    for (std::size_t i = 0; i < roots.size(); ++i)
+    {
+        unpolished = (std::max)(unpolished, static_cast<double>(std::abs(wide_roots[i] - roots[i].real())));
+    }
+    CHECK_LE(tol, unpolished);
+    polish_polynomial_roots<std::complex<long double>>(wide, roots);
+    sort_roots(roots);
+    for (std::size_t i = 0; i < roots.size(); ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(static_cast<double>(wide_roots[i]), roots[i].real(), tol);
+    }
+}
+
+int main()
+{
+    test_integer_roots<double>();
+    test_integer_roots<long double>();
+
+    test_roots_of_unity<float>(20);
+    test_roots_of_unity<double>(64);
+    test_roots_of_unity<double>(500);
+
+    test_random_high_degree<double>(50);
+    test_random_high_degree<double>(300);
+
+    test_special_cases<float>();
+    test_special_cases<double>();
+
+    test_polish();
+
+    return boost::math::test::report_errors();
+}
@@ -521,6 +521,41 @@ void test_cardinal_quartic()
 }
 
 
+template<typename Real>
+void test_cardinal_quartic_scaled()
+{
+    // With dx != 1 the derivatives must pick up powers of 1/dx:
+    Real x0 = -1;
+    Real dx = Real(1)/Real(8);
+    size_t n = 25;
+    std::vector<Real> y(n);
+    std::vector<Real> dydx(n);
+    std::vector<Real> d2ydx2(n);
+    std::vector<std::array<Real, 3>> data(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        Real x = x0 + i*dx;
+        y[i] = x*x*x*x;
+        dydx[i] = 4*x*x*x;
+        d2ydx2[i] = 12*x*x;
+        data[i] = {y[i], dydx[i], d2ydx2[i]};
+    }
+
+    auto qh = cardinal_quintic_hermite(std::move(y), std::move(dydx), std::move(d2ydx2), x0, dx);
+    auto qh_aos = cardinal_quintic_hermite_aos(std::move(data), x0, dx);
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (Real t = x0; t <= 2; t += Real(1)/Real(256))
+    {
+        CHECK_MOLLIFIED_CLOSE(t*t*t*t, qh(t), tol);
+        CHECK_MOLLIFIED_CLOSE(4*t*t*t, qh.prime(t), tol);
+        CHECK_MOLLIFIED_CLOSE(12*t*t, qh.double_prime(t), 4*tol);
+        CHECK_MOLLIFIED_CLOSE(t*t*t*t, qh_aos(t), tol);
+        CHECK_MOLLIFIED_CLOSE(4*t*t*t, qh_aos.prime(t), tol);
+        CHECK_MOLLIFIED_CLOSE(12*t*t, qh_aos.double_prime(t), 4*tol);
+    }
+}
+
+
 int main()
 {
     test_constant<float>();
@@ -535,6 +570,7 @@ int main()
     test_cardinal_quadratic<float>();
     test_cardinal_cubic<float>();
     test_cardinal_quartic<float>();
+    test_cardinal_quartic_scaled<float>();
 
     test_constant<double>();
     test_linear<double>();
@@ -548,6 +584,7 @@ int main()
     test_cardinal_quadratic<double>();
     test_cardinal_cubic<double>();
     test_cardinal_quartic<double>();
+    test_cardinal_quartic_scaled<double>();
 
     test_constant<long double>();
     test_linear<long double>();
@@ -561,6 +598,7 @@ int main()
     test_cardinal_quadratic<long double>();
     test_cardinal_cubic<long double>();
     test_cardinal_quartic<long double>();
+    test_cardinal_quartic_scaled<long double>();
 
 #ifdef BOOST_HAS_FLOAT128
     test_constant<float128>();
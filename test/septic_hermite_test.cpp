@@ -494,6 +494,43 @@ void test_interpolation_condition()
 }
 
 
+template<typename Real>
+void test_cardinal_quintic_scaled()
+{
+    // With dx != 1 the derivatives must pick up powers of 1/dx:
+    Real x0 = -1;
+    Real dx = Real(1)/Real(8);
+    size_t n = 25;
+    std::vector<Real> y(n);
+    std::vector<Real> dydx(n);
+    std::vector<Real> d2ydx2(n);
+    std::vector<Real> d3ydx3(n);
+    std::vector<std::array<Real, 4>> data(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        Real x = x0 + i*dx;
+        y[i] = x*x*x*x*x;
+        dydx[i] = 5*x*x*x*x;
+        d2ydx2[i] = 20*x*x*x;
+        d3ydx3[i] = 60*x*x;
+        data[i] = {y[i], dydx[i], d2ydx2[i], d3ydx3[i]};
+    }
+
+    auto csh = cardinal_septic_hermite(std::move(y), std::move(dydx), std::move(d2ydx2), std::move(d3ydx3), x0, dx);
+    auto csh_aos = cardinal_septic_hermite_aos(std::move(data), x0, dx);
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (Real t = x0; t <= 2; t += Real(1)/Real(256))
+    {
+        CHECK_MOLLIFIED_CLOSE(t*t*t*t*t, csh(t), tol);
+        CHECK_MOLLIFIED_CLOSE(5*t*t*t*t, csh.prime(t), tol);
+        CHECK_MOLLIFIED_CLOSE(20*t*t*t, csh.double_prime(t), 4*tol);
+        CHECK_MOLLIFIED_CLOSE(t*t*t*t*t, csh_aos(t), tol);
+        CHECK_MOLLIFIED_CLOSE(5*t*t*t*t, csh_aos.prime(t), tol);
+        CHECK_MOLLIFIED_CLOSE(20*t*t*t, csh_aos.double_prime(t), 4*tol);
+    }
+}
+
+
 int main()
 {
     test_constant<float>();
@@ -501,6 +538,7 @@ int main()
     test_quadratic<float>();
     test_cubic<float>();
     test_quartic<float>();
+    test_cardinal_quintic_scaled<float>();
     test_interpolation_condition<float>();
 
     test_constant<double>();
@@ -508,6 +546,7 @@ int main()
     test_quadratic<double>();
     test_cubic<double>();
     test_quartic<double>();
+    test_cardinal_quintic_scaled<double>();
     test_interpolation_condition<double>();
 
     test_constant<long double>();
@@ -515,6 +554,7 @@ int main()
     test_quadratic<long double>();
     test_cubic<long double>();
     test_quartic<long double>();
+    test_cardinal_quintic_scaled<long double>();
     test_interpolation_condition<long double>();
 
 #ifdef BOOST_HAS_FLOAT128
@@ -18,6 +18,10 @@
 #include <boost/multiprecision/cpp_bin_float.hpp>
 #include <boost/multiprecision/cpp_complex.hpp>
 
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+#include <execution>
+#endif
+
 using std::abs;
 using boost::multiprecision::cpp_bin_float_50;
 using boost::multiprecision::cpp_complex_50;
@@ -197,6 +201,53 @@ void test_absolute_gini_coefficient()
 }
 
 
+// Long enough to be sorted by magnitude with a radix sort, and spread over the whole exponent range:
+template<class Real>
+void test_absolute_gini_coefficient_exponents()
+{
+    using std::ldexp;
+    using boost::math::statistics::absolute_gini_coefficient;
+    Real tol = 10*std::numeric_limits<Real>::epsilon();
+    std::mt19937 gen(19);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    std::uniform_int_distribution<int> exponent(std::numeric_limits<Real>::min_exponent - std::numeric_limits<Real>::digits + 1, std::numeric_limits<Real>::max_exponent - 32);
+    std::vector<Real> v(5000);
+    for (auto & x : v)
+    {
+        x = ldexp(dis(gen), exponent(gen));
+    }
+    v[0] = 0;
+    v[1] = -Real(0);
+    v[2] = -v[3];
+    v[4] = std::numeric_limits<Real>::denorm_min();
+    v[5] = -ldexp((std::numeric_limits<Real>::max)(), -32);
+    // The Gini coefficient of the data sorted by magnitude, as in the definition, which does not overflow since 2n < 2^32:
+    std::vector<Real> w = v;
+    std::sort(w.begin(), w.end(), [](Real a, Real b) { return abs(a) < abs(b); });
+    Real num = 0;
+    Real denom = 0;
+    for (size_t i = 0; i < w.size(); ++i)
+    {
+        num += abs(w[i])*(i + 1);
+        denom += abs(w[i]);
+    }
+    Real n = static_cast<Real>(w.size());
+    Real expected = ((2*num)/denom - (n + 1))/n;
+
+    std::vector<Real> u = v;
+    Real gini = absolute_gini_coefficient(u);
+    BOOST_TEST(abs(gini - expected) <= tol);
+    // Every element is kept, with its sign:
+    BOOST_TEST(std::is_sorted(u.begin(), u.end(), [](Real a, Real b) { return abs(a) < abs(b); }));
+    std::sort(u.begin(), u.end());
+    std::sort(w.begin(), w.end());
+    BOOST_TEST(u == w);
+
+    boost::math::statistics::signal_frame_statistics<Real> frame;
+    frame.compute(v);
+    BOOST_TEST(abs(frame.absolute_gini_coefficient() - gini) <= tol);
+}
+
 template<class Real>
 void test_oracle_snr()
 {
@@ -291,12 +342,139 @@ void test_m2m4_snr_estimator()
     BOOST_TEST(abs(m2m4 - m2m4_2) < tol);
 }
 
+// Frames of different lengths, reusing the same object, agree with the functions which take the whole frame:
+template<class Real>
+void test_signal_frame_statistics()
+{
+    using boost::math::statistics::signal_frame_statistics;
+    Real tol = 100*std::numeric_limits<Real>::epsilon();
+    std::mt19937 gen(7);
+    std::normal_distribution<Real> dis(0, 1);
+    signal_frame_statistics<Real> frame(5000);
+    for (size_t n : {2, 3, 17, 1023, 1024, 1025, 5000})
+    {
+        std::vector<Real> x(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            // An offset, so that the moments about the mean must be computed accurately:
+            x[i] = 100 + 5*sin(Real(i)) + dis(gen);
+        }
+        frame.compute(x);
+        BOOST_TEST_EQ(frame.size(), n);
+        Real hs = boost::math::statistics::hoyer_sparsity(x);
+        BOOST_TEST(abs(frame.hoyer_sparsity() - hs) <= tol*(1 + abs(hs)));
+
+        auto [M1, M2, M3, M4] = boost::math::statistics::first_four_moments(x);
+        auto [N1, N2, N3, N4] = frame.first_four_moments();
+        BOOST_TEST(abs(N1 - M1) <= tol*abs(M1));
+        BOOST_TEST(abs(N2 - M2) <= 100*tol*abs(M2));
+        BOOST_TEST(abs(N3 - M3) <= 100*tol*(abs(M3) + M2*sqrt(M2)));
+        BOOST_TEST(abs(N4 - M4) <= 100*tol*abs(M4));
+        if (n > 1000)
+        {
+            Real m2m4 = boost::math::statistics::m2m4_snr_estimator(x, Real(1.5));
+            BOOST_TEST(abs(frame.m2m4_snr_estimator(Real(1.5)) - m2m4) <= 1000*tol*abs(m2m4));
+        }
+
+        // The frame is not modified:
+        std::vector<Real> y = x;
+        Real gini = boost::math::statistics::absolute_gini_coefficient(y);
+        BOOST_TEST(abs(frame.absolute_gini_coefficient() - gini) <= tol*(1 + gini));
+        BOOST_TEST(abs(frame.absolute_gini_coefficient() - gini) <= tol*(1 + gini));
+        Real sample_gini = boost::math::statistics::sample_absolute_gini_coefficient(y);
+        BOOST_TEST(abs(frame.sample_absolute_gini_coefficient() - sample_gini) <= tol*(1 + sample_gini));
+    }
+
+    // A forward list, with a sign change:
+    std::forward_list<Real> u{-1, 0, 0};
+    frame.compute(u.begin(), u.end());
+    BOOST_TEST(abs(frame.hoyer_sparsity() - 1) < tol);
+    BOOST_TEST(abs(frame.sample_absolute_gini_coefficient() - 1) < tol);
+    BOOST_TEST_EQ(*u.begin(), Real(-1));
+
+    signal_frame_statistics<std::complex<Real>> complex_frame;
+    std::vector<std::complex<Real>> w{{0, 1}, {1, 0}, {0, -1}};
+    complex_frame.compute(w);
+    BOOST_TEST(abs(complex_frame.hoyer_sparsity()) < tol);
+    BOOST_TEST(abs(complex_frame.absolute_gini_coefficient()) < tol);
+
+    signal_frame_statistics<int> integer_frame;
+    std::vector<int> z{-3, 0, 0, 0};
+    integer_frame.compute(z);
+    BOOST_TEST(abs(integer_frame.hoyer_sparsity() - 1) < tol);
+    BOOST_TEST(abs(integer_frame.sample_absolute_gini_coefficient() - 1) < tol);
+}
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+// Large enough to be split between threads, if there are several:
+template<class Real, class ExecutionPolicy>
+void test_execution_policy(ExecutionPolicy&& exec)
+{
+    using std::sqrt;
+    size_t n = 300001;
+    // The sequential functions sum in a different order:
+    Real tol = 10*sqrt(Real(n))*std::numeric_limits<Real>::epsilon();
+    std::mt19937 gen(11);
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<Real> signal(n);
+    std::vector<Real> x(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        signal[i] = 5*sin(100*6.28*i/n);
+        x[i] = signal[i] + dis(gen);
+    }
+    Real hs = boost::math::statistics::hoyer_sparsity(x);
+    BOOST_TEST(abs(boost::math::statistics::hoyer_sparsity(exec, x) - hs) <= tol*abs(hs));
+    BOOST_TEST(abs(boost::math::statistics::hoyer_sparsity(exec, x.cbegin(), x.cend()) - hs) <= tol*abs(hs));
+
+    Real snr = boost::math::statistics::oracle_snr(signal, x);
+    BOOST_TEST(abs(boost::math::statistics::oracle_snr(exec, signal, x) - snr) <= tol*snr);
+    Real snr_db = boost::math::statistics::oracle_snr_db(signal, x);
+    BOOST_TEST(abs(boost::math::statistics::oracle_snr_db(exec, signal, x) - snr_db) <= tol*abs(snr_db));
+
+    Real m2m4 = boost::math::statistics::m2m4_snr_estimator(x, Real(1.5));
+    BOOST_TEST(abs(boost::math::statistics::m2m4_snr_estimator(exec, x, Real(1.5)) - m2m4) <= tol*m2m4);
+    Real m2m4_db = boost::math::statistics::m2m4_snr_estimator_db(x.cbegin(), x.cend(), Real(1.5));
+    BOOST_TEST(abs(boost::math::statistics::m2m4_snr_estimator_db(exec, x.cbegin(), x.cend(), Real(1.5)) - m2m4_db) <= tol*abs(m2m4_db));
+
+    boost::math::statistics::signal_frame_statistics<Real> frame;
+    frame.compute(exec, x);
+    BOOST_TEST(abs(frame.hoyer_sparsity() - hs) <= tol*abs(hs));
+    BOOST_TEST(abs(frame.m2m4_snr_estimator(Real(1.5)) - m2m4) <= tol*m2m4);
+
+    std::vector<Real> y = x;
+    Real gini = boost::math::statistics::absolute_gini_coefficient(y);
+    BOOST_TEST(abs(frame.absolute_gini_coefficient() - gini) <= tol*gini);
+    y = x;
+    BOOST_TEST(abs(boost::math::statistics::absolute_gini_coefficient(exec, y) - gini) <= tol*gini);
+    BOOST_TEST(std::is_sorted(y.begin(), y.end(), [](Real a, Real b) { return abs(a) < abs(b); }));
+    y = x;
+    Real sample_gini = boost::math::statistics::sample_absolute_gini_coefficient(exec, y.begin(), y.end());
+    BOOST_TEST(abs(sample_gini - gini*n/(n-1)) <= tol*gini);
+
+    std::vector<std::complex<Real>> z(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        z[i] = {x[i], dis(gen)};
+    }
+    hs = boost::math::statistics::hoyer_sparsity(z);
+    BOOST_TEST(abs(boost::math::statistics::hoyer_sparsity(exec, z) - hs) <= tol*abs(hs));
+    auto z2 = z;
+    gini = boost::math::statistics::absolute_gini_coefficient(z2);
+    BOOST_TEST(abs(boost::math::statistics::absolute_gini_coefficient(exec, z) - gini) <= tol*gini);
+}
+#endif
+
 int main()
 {
     test_absolute_gini_coefficient<float>();
     test_absolute_gini_coefficient<double>();
     test_absolute_gini_coefficient<long double>();
 
+    test_absolute_gini_coefficient_exponents<float>();
+    test_absolute_gini_coefficient_exponents<double>();
+    test_absolute_gini_coefficient_exponents<long double>();
+
     test_hoyer_sparsity<float>();
     test_hoyer_sparsity<double>();
     test_hoyer_sparsity<long double>();
@@ -327,5 +505,16 @@ int main()
     test_m2m4_snr_estimator<double>();
     test_m2m4_snr_estimator<long double>();
 
+    test_signal_frame_statistics<float>();
+    test_signal_frame_statistics<double>();
+    test_signal_frame_statistics<long double>();
+
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    test_execution_policy<float>(std::execution::seq);
+    test_execution_policy<double>(std::execution::par);
+    test_execution_policy<double>(std::execution::par_unseq);
+    test_execution_policy<long double>(std::execution::par);
+#endif
+
     return boost::report_errors();
 }
@@ -0,0 +1,314 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <boost/math/interpolators/tensor_cardinal_cubic_b_spline.hpp>
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+#include <execution>
+#endif
+using boost::math::interpolators::tensor_cardinal_cubic_b_spline;
+
+template<class Real>
+void test_constant()
+{
+    Real c = 7.2;
+    std::vector<Real> v(12*9, c);
+    auto s = tensor_cardinal_cubic_b_spline<Real, 2>(v.begin(), {12, 9}, {Real(-1), Real(2)}, {Real(1)/8, Real(1)/4});
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<Real> dx(-1, Real(-1) + Real(11)/8);
+    std::uniform_real_distribution<Real> dy(2, 4);
+    // The rounding errors of the coefficients are amplified by 1/h in the gradient:
+    Real tol = 40*c*std::numeric_limits<Real>::epsilon()*8;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        Real x = dx(gen);
+        Real y = dy(gen);
+        CHECK_ULP_CLOSE(c, s(x, y), 8);
+        auto g = s.gradient(x, y);
+        CHECK_MOLLIFIED_CLOSE(Real(0), g[0], tol);
+        CHECK_MOLLIFIED_CLOSE(Real(0), g[1], tol);
+    }
+}
+
+// Products of cubics in each variable are reproduced exactly, endpoints included:
+template<class Real>
+void test_cubic_2d()
+{
+    auto p = [](Real x) { return ((x - 2)*x + 1)*x - 3; };
+    auto dp = [](Real x) { return (3*x - 4)*x + 1; };
+    auto q = [](Real y) { return (2*y*y + 1)*y + 5; };
+    auto dq = [](Real y) { return 6*y*y + 1; };
+    std::array<size_t, 2> n{20, 13};
+    std::array<Real, 2> x0{Real(-1), Real(0.5)};
+    std::array<Real, 2> h{Real(1)/16, Real(1)/8};
+    std::vector<Real> v(n[0]*n[1]);
+    for (size_t i = 0; i < n[0]; ++i)
+    {
+        for (size_t j = 0; j < n[1]; ++j)
+        {
+            v[i*n[1] + j] = p(x0[0] + i*h[0])*q(x0[1] + j*h[1]);
+        }
+    }
+    auto s = tensor_cardinal_cubic_b_spline<Real, 2>(v.begin(), n, x0, h);
+    Real tol = 300*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < n[0]; ++i)
+    {
+        for (size_t j = 0; j < n[1]; ++j)
+        {
+            CHECK_MOLLIFIED_CLOSE(v[i*n[1] + j], s(x0[0] + i*h[0], x0[1] + j*h[1]), tol);
+        }
+    }
+
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<Real> dx(s.domain(0).first, s.domain(0).second);
+    std::uniform_real_distribution<Real> dy(s.domain(1).first, s.domain(1).second);
+    for (size_t i = 0; i < 200; ++i)
+    {
+        Real x = dx(gen);
+        Real y = dy(gen);
+        CHECK_MOLLIFIED_CLOSE(p(x)*q(y), s(x, y), tol);
+        auto [z, g] = s.value_and_gradient({x, y});
+        CHECK_MOLLIFIED_CLOSE(p(x)*q(y), z, tol);
+        CHECK_MOLLIFIED_CLOSE(dp(x)*q(y), g[0], 20*tol);
+        CHECK_MOLLIFIED_CLOSE(p(x)*dq(y), g[1], 20*tol);
+    }
+    Real xf = s.domain(0).second;
+    Real yf = s.domain(1).second;
+    CHECK_MOLLIFIED_CLOSE(p(xf)*q(yf), s(xf, yf), tol);
+}
+
+template<class Real>
+void test_cubic_3d()
+{
+    auto p = [](Real x) { return (x*x - 2)*x + 1; };
+    auto dp = [](Real x) { return 3*x*x - 2; };
+    auto q = [](Real y) { return y*y + y; };
+    auto dq = [](Real y) { return 2*y + 1; };
+    auto r = [](Real z) { return z*z*z + 3; };
+    auto dr = [](Real z) { return 3*z*z; };
+    std::array<size_t, 3> n{9, 7, 11};
+    std::array<Real, 3> x0{Real(0), Real(-1), Real(1)};
+    std::array<Real, 3> h{Real(1)/4, Real(1)/2, Real(1)/8};
+    std::vector<Real> v(n[0]*n[1]*n[2]);
+    for (size_t i = 0; i < n[0]; ++i)
+    {
+        for (size_t j = 0; j < n[1]; ++j)
+        {
+            for (size_t k = 0; k < n[2]; ++k)
+            {
+                v[(i*n[1] + j)*n[2] + k] = p(x0[0] + i*h[0])*q(x0[1] + j*h[1])*r(x0[2] + k*h[2]);
+            }
+        }
+    }
+    auto s = tensor_cardinal_cubic_b_spline<Real, 3>(v.begin(), n, x0, h);
+    Real tol = 1000*std::numeric_limits<Real>::epsilon();
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<Real> dx(s.domain(0).first, s.domain(0).second);
+    std::uniform_real_distribution<Real> dy(s.domain(1).first, s.domain(1).second);
+    std::uniform_real_distribution<Real> dz(s.domain(2).first, s.domain(2).second);
+    for (size_t i = 0; i < 200; ++i)
+    {
+        Real x = dx(gen);
+        Real y = dy(gen);
+        Real z = dz(gen);
+        CHECK_MOLLIFIED_CLOSE(p(x)*q(y)*r(z), s(x, y, z), tol);
+        auto g = s.gradient(x, y, z);
+        CHECK_MOLLIFIED_CLOSE(dp(x)*q(y)*r(z), g[0], 20*tol);
+        CHECK_MOLLIFIED_CLOSE(p(x)*dq(y)*r(z), g[1], 20*tol);
+        CHECK_MOLLIFIED_CLOSE(p(x)*q(y)*dr(z), g[2], 20*tol);
+    }
+}
+
+// Random data is interpolated, and batches agree exactly with single evaluations:
+template<class Real>
+void test_batch()
+{
+    std::array<size_t, 3> n{6, 17, 8};
+    std::array<Real, 3> x0{Real(0), Real(0), Real(0)};
+    std::array<Real, 3> h{Real(1), Real(1)/4, Real(3)};
+    std::mt19937 gen(4);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    std::vector<Real> v(n[0]*n[1]*n[2]);
+    for (auto & t : v)
+    {
+        t = dis(gen);
+    }
+    auto s = tensor_cardinal_cubic_b_spline<Real, 3>(v.begin(), n, x0, h);
+    for (size_t i = 0; i < n[0]; ++i)
+    {
+        for (size_t j = 0; j < n[1]; ++j)
+        {
+            for (size_t k = 0; k < n[2]; ++k)
+            {
+                CHECK_ABSOLUTE_ERROR(v[(i*n[1] + j)*n[2] + k], s(i*h[0], j*h[1], k*h[2]), 50*std::numeric_limits<Real>::epsilon());
+            }
+        }
+    }
+
+    size_t m = 500;
+    std::vector<Real> x(3*m);
+    for (size_t i = 0; i < m; ++i)
+    {
+        for (size_t a = 0; a < 3; ++a)
+        {
+            x[3*i + a] = (dis(gen) + 1)*(n[a] - 1)*h[a]/2;
+        }
+    }
+    // Grid points and the far corner:
+    x[0] = 0; x[1] = 0; x[2] = 0;
+    x[3] = (n[0] - 1)*h[0]; x[4] = (n[1] - 1)*h[1]; x[5] = (n[2] - 1)*h[2];
+    x[6] = 2*h[0]; x[7] = 5*h[1]; x[8] = 3*h[2];
+    std::vector<Real> y(m);
+    std::vector<Real> g(3*m);
+    s.evaluate(x.data(), m, y.data(), g.data());
+    std::vector<Real> y2(m);
+    s.evaluate(x.data(), m, y2.data());
+    for (size_t i = 0; i < m; ++i)
+    {
+        CHECK_EQUAL(s(x[3*i], x[3*i + 1], x[3*i + 2]), y[i]);
+        CHECK_EQUAL(y[i], y2[i]);
+        auto gi = s.gradient(x[3*i], x[3*i + 1], x[3*i + 2]);
+        for (size_t a = 0; a < 3; ++a)
+        {
+            CHECK_EQUAL(gi[a], g[3*i + a]);
+        }
+    }
+
+    bool caught = false;
+    try
+    {
+        s(Real(-0.01), Real(1), Real(1));
+    }
+    catch (const std::domain_error &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+    caught = false;
+    try
+    {
+        x[3*7 + 2] = (n[2] - 1)*h[2]*2;
+        s.evaluate(x.data(), m, y.data());
+    }
+    catch (const std::domain_error &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+}
+
+// A smooth function converges at O(h^4):
+template<class Real>
+void test_smooth()
+{
+    using std::sin;
+    using std::cos;
+    using std::exp;
+    size_t n = 129;
+    Real h = Real(2)/(n - 1);
+    std::vector<Real> v(n*n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t j = 0; j < n; ++j)
+        {
+            v[i*n + j] = sin(3*i*h)*exp(-Real(j*h));
+        }
+    }
+    auto s = tensor_cardinal_cubic_b_spline<Real, 2>(v.begin(), {n, n}, {Real(0), Real(0)}, {h, h});
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<Real> dis(0, 2);
+    for (size_t i = 0; i < 100; ++i)
+    {
+        Real x = dis(gen);
+        Real y = dis(gen);
+        CHECK_ABSOLUTE_ERROR(sin(3*x)*exp(-y), s(x, y), Real(1e-6));
+        auto g = s.gradient(x, y);
+        CHECK_ABSOLUTE_ERROR(3*cos(3*x)*exp(-y), g[0], Real(1e-4));
+        CHECK_ABSOLUTE_ERROR(-sin(3*x)*exp(-y), g[1], Real(1e-4));
+    }
+}
+
+// Lines are solved independently, so every thread count gives the same spline; the default is sequential:
+template<class Real>
+void test_threads()
+{
+    using boost::math::interpolators::detail::tensor_cardinal_cubic_b_spline_imp;
+    // Enough points that four threads are used however many cores there are:
+    std::array<size_t, 2> n{510, 510};
+    std::array<Real, 2> x0{Real(0), Real(0)};
+    std::array<Real, 2> h{Real(1), Real(1)};
+    std::mt19937 gen(6);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    std::vector<Real> v(n[0]*n[1]);
+    for (auto & t : v)
+    {
+        t = dis(gen);
+    }
+    tensor_cardinal_cubic_b_spline_imp<Real, 2> serial(v.begin(), n, x0, h, 1);
+    tensor_cardinal_cubic_b_spline_imp<Real, 2> threaded(v.begin(), n, x0, h, 4);
+    auto s = tensor_cardinal_cubic_b_spline<Real, 2>(v.begin(), n, x0, h);
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    auto seq = tensor_cardinal_cubic_b_spline<Real, 2>(std::execution::seq, v.begin(), n, x0, h);
+    auto par = tensor_cardinal_cubic_b_spline<Real, 2>(std::execution::par, v.begin(), n, x0, h);
+#endif
+    size_t m = 1 << 18;
+    std::vector<Real> x(2*m);
+    for (auto & t : x)
+    {
+        t = (dis(gen) + 1)*(n[0] - 1)/2;
+    }
+    std::vector<Real> y(m);
+    std::vector<Real> g(2*m);
+    serial.evaluate(x.data(), m, y.data(), g.data(), 1);
+    std::vector<Real> y2(m);
+    std::vector<Real> g2(2*m);
+    threaded.evaluate(x.data(), m, y2.data(), g2.data(), 4);
+    CHECK_EQUAL(true, y == y2 && g == g2);
+    s.evaluate(x.data(), m, y2.data(), g2.data());
+    CHECK_EQUAL(true, y == y2 && g == g2);
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    seq.evaluate(std::execution::seq, x.data(), m, y2.data(), g2.data());
+    CHECK_EQUAL(true, y == y2 && g == g2);
+    par.evaluate(std::execution::par, x.data(), m, y2.data(), g2.data());
+    CHECK_EQUAL(true, y == y2 && g == g2);
+#endif
+}
+
+int main()
+{
+    test_constant<float>();
+    test_constant<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_constant<long double>();
+#endif
+
+    test_cubic_2d<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_cubic_2d<long double>();
+#endif
+
+    test_cubic_3d<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_cubic_3d<long double>();
+#endif
+
+    test_batch<float>();
+    test_batch<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_batch<long double>();
+#endif
+
+    test_smooth<double>();
+
+    test_threads<double>();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <boost/math/interpolators/tensor_cardinal_cubic_hermite.hpp>
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+#include <execution>
+#endif
+using boost::math::interpolators::tensor_cardinal_cubic_hermite;
+
+// Products of cubics in each variable are reproduced exactly when the mixed partials are supplied:
+template<class Real>
+void test_cubic_2d()
+{
+    auto p = [](Real x) { return ((x - 2)*x + 1)*x - 3; };
+    auto dp = [](Real x) { return (3*x - 4)*x + 1; };
+    auto q = [](Real y) { return (2*y*y + 1)*y + 5; };
+    auto dq = [](Real y) { return 6*y*y + 1; };
+    std::array<size_t, 2> n{7, 5};
+    std::array<Real, 2> x0{Real(-1), Real(0.5)};
+    std::array<Real, 2> h{Real(1)/2, Real(1)/4};
+    std::vector<Real> data(4*n[0]*n[1]);
+    for (size_t i = 0; i < n[0]; ++i)
+    {
+        for (size_t j = 0; j < n[1]; ++j)
+        {
+            Real x = x0[0] + i*h[0];
+            Real y = x0[1] + j*h[1];
+            Real* d = data.data() + 4*(i*n[1] + j);
+            d[0] = p(x)*q(y);
+            d[1] = dp(x)*q(y);
+            d[2] = p(x)*dq(y);
+            d[3] = dp(x)*dq(y);
+        }
+    }
+    auto s = tensor_cardinal_cubic_hermite<std::vector<Real>, 2>(std::move(data), n, x0, h);
+    Real tol = 100*std::numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < n[0]; ++i)
+    {
+        for (size_t j = 0; j < n[1]; ++j)
+        {
+            Real x = x0[0] + i*h[0];
+            Real y = x0[1] + j*h[1];
+            CHECK_ULP_CLOSE(p(x)*q(y), s(x, y), 2);
+        }
+    }
+
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<Real> dx(s.domain(0).first, s.domain(0).second);
+    std::uniform_real_distribution<Real> dy(s.domain(1).first, s.domain(1).second);
+    for (size_t i = 0; i < 200; ++i)
+    {
+        Real x = dx(gen);
+        Real y = dy(gen);
+        CHECK_MOLLIFIED_CLOSE(p(x)*q(y), s(x, y), tol);
+        auto [z, g] = s.value_and_gradient({x, y});
+        CHECK_MOLLIFIED_CLOSE(p(x)*q(y), z, tol);
+        CHECK_MOLLIFIED_CLOSE(dp(x)*q(y), g[0], 10*tol);
+        CHECK_MOLLIFIED_CLOSE(p(x)*dq(y), g[1], 10*tol);
+    }
+}
+
+template<class Real>
+void test_cubic_3d()
+{
+    auto p = [](Real x) { return (x*x - 2)*x + 1; };
+    auto dp = [](Real x) { return 3*x*x - 2; };
+    auto q = [](Real y) { return y*y + y; };
+    auto dq = [](Real y) { return 2*y + 1; };
+    auto r = [](Real z) { return z*z*z + 3; };
+    auto dr = [](Real z) { return 3*z*z; };
+    std::array<size_t, 3> n{4, 3, 6};
+    std::array<Real, 3> x0{Real(0), Real(-1), Real(1)};
+    std::array<Real, 3> h{Real(1)/4, Real(1), Real(1)/8};
+    std::vector<Real> data(8*n[0]*n[1]*n[2]);
+    for (size_t i = 0; i < n[0]; ++i)
+    {
+        for (size_t j = 0; j < n[1]; ++j)
+        {
+            for (size_t k = 0; k < n[2]; ++k)
+            {
+                Real x = x0[0] + i*h[0];
+                Real y = x0[1] + j*h[1];
+                Real z = x0[2] + k*h[2];
+                std::array<Real, 2> px{p(x), dp(x)};
+                std::array<Real, 2> qy{q(y), dq(y)};
+                std::array<Real, 2> rz{r(z), dr(z)};
+                for (size_t m = 0; m < 8; ++m)
+                {
+                    data[8*((i*n[1] + j)*n[2] + k) + m] = px[m & 1]*qy[(m >> 1) & 1]*rz[(m >> 2) & 1];
+                }
+            }
+        }
+    }
+    auto s = tensor_cardinal_cubic_hermite<std::vector<Real>, 3>(std::move(data), n, x0, h);
+    Real tol = 200*std::numeric_limits<Real>::epsilon();
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<Real> dx(s.domain(0).first, s.domain(0).second);
+    std::uniform_real_distribution<Real> dy(s.domain(1).first, s.domain(1).second);
+    std::uniform_real_distribution<Real> dz(s.domain(2).first, s.domain(2).second);
+    for (size_t i = 0; i < 200; ++i)
+    {
+        Real x = dx(gen);
+        Real y = dy(gen);
+        Real z = dz(gen);
+        CHECK_MOLLIFIED_CLOSE(p(x)*q(y)*r(z), s(x, y, z), tol);
+        auto g = s.gradient(x, y, z);
+        CHECK_MOLLIFIED_CLOSE(dp(x)*q(y)*r(z), g[0], 10*tol);
+        CHECK_MOLLIFIED_CLOSE(p(x)*dq(y)*r(z), g[1], 10*tol);
+        CHECK_MOLLIFIED_CLOSE(p(x)*q(y)*dr(z), g[2], 10*tol);
+    }
+    Real xf = s.domain(0).second;
+    Real yf = s.domain(1).second;
+    Real zf = s.domain(2).second;
+    CHECK_ULP_CLOSE(p(xf)*q(yf)*r(zf), s(xf, yf, zf), 2);
+}
+
+template<class Real>
+void test_batch()
+{
+    std::array<size_t, 2> n{9, 12};
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    std::vector<Real> data(4*n[0]*n[1]);
+    for (auto & d : data)
+    {
+        d = dis(gen);
+    }
+    auto s = tensor_cardinal_cubic_hermite<std::vector<Real>, 2>(std::move(data), n, {Real(0), Real(1)}, {Real(1)/8, Real(3)});
+    size_t m = 500;
+    std::vector<Real> x(2*m);
+    for (size_t i = 0; i < m; ++i)
+    {
+        x[2*i] = (dis(gen) + 1)*Real(1)/2;
+        x[2*i + 1] = 1 + (dis(gen) + 1)*Real(33)/2;
+    }
+    x[0] = 0; x[1] = 1;
+    x[2] = 1; x[3] = 34;
+    std::vector<Real> y(m);
+    std::vector<Real> g(2*m);
+    s.evaluate(x.data(), m, y.data(), g.data());
+    for (size_t i = 0; i < m; ++i)
+    {
+        CHECK_EQUAL(s(x[2*i], x[2*i + 1]), y[i]);
+        auto gi = s.gradient(x[2*i], x[2*i + 1]);
+        CHECK_EQUAL(gi[0], g[2*i]);
+        CHECK_EQUAL(gi[1], g[2*i + 1]);
+    }
+
+    bool caught = false;
+    try
+    {
+        s(Real(0.5), Real(34.5));
+    }
+    catch (const std::domain_error &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+
+    caught = false;
+    try
+    {
+        std::vector<Real> wrong(3*n[0]*n[1]);
+        auto t = tensor_cardinal_cubic_hermite<std::vector<Real>, 2>(std::move(wrong), n, {Real(0), Real(0)}, {Real(1), Real(1)});
+    }
+    catch (const std::domain_error &)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(true, caught);
+}
+
+// Points are evaluated independently, so every thread count gives the same values; the default is sequential:
+template<class Real>
+void test_threads()
+{
+    std::array<size_t, 2> n{9, 12};
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    std::vector<Real> data(4*n[0]*n[1]);
+    for (auto & d : data)
+    {
+        d = dis(gen);
+    }
+    auto s = tensor_cardinal_cubic_hermite<std::vector<Real>, 2>(std::move(data), n, {Real(0), Real(0)}, {Real(1), Real(1)});
+    // Enough points that four threads are used however many cores there are:
+    size_t m = 1 << 18;
+    std::vector<Real> x(2*m);
+    for (size_t i = 0; i < m; ++i)
+    {
+        x[2*i] = (dis(gen) + 1)*Real(8)/2;
+        x[2*i + 1] = (dis(gen) + 1)*Real(11)/2;
+    }
+    std::vector<Real> y(m);
+    std::vector<Real> g(2*m);
+    s.evaluate(x.data(), m, y.data(), g.data());
+    for (size_t i = 0; i < m; i += 997)
+    {
+        CHECK_EQUAL(s(x[2*i], x[2*i + 1]), y[i]);
+    }
+    std::vector<Real> y2(m);
+    std::vector<Real> g2(2*m);
+#ifndef BOOST_NO_CXX17_HDR_EXECUTION
+    s.evaluate(std::execution::seq, x.data(), m, y2.data(), g2.data());
+    CHECK_EQUAL(true, y == y2 && g == g2);
+    s.evaluate(std::execution::par, x.data(), m, y2.data(), g2.data());
+    CHECK_EQUAL(true, y == y2 && g == g2);
+#endif
+}
+
+int main()
+{
+    test_cubic_2d<float>();
+    test_cubic_2d<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_cubic_2d<long double>();
+#endif
+
+    test_cubic_3d<float>();
+    test_cubic_3d<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_cubic_3d<long double>();
+#endif
+
+    test_batch<float>();
+    test_batch<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_batch<long double>();
+#endif
+
+    test_threads<double>();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,269 @@
+/*
+ * Copyright agent 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <utility>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <tuple>
+#include "math_unit_test.hpp"
+#include <boost/math/tools/batch_roots.hpp>
+#include <boost/math/tools/toms748_solve.hpp>
+#include <boost/math/special_functions/cbrt.hpp>
+
+using boost::math::tools::batch_bisect;
+using boost::math::tools::batch_newton_raphson_iterate;
+using boost::math::tools::batch_halley_iterate;
+using boost::math::tools::batch_schroder_iterate;
+using boost::math::tools::batch_toms748_solve;
+using boost::math::tools::toms748_solve;
+using boost::math::tools::eps_tolerance;
+
+template<class Real>
+std::vector<Real> random_targets(std::size_t n)
+{
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<Real> dis(Real(0.001), Real(1000));
+    std::vector<Real> a(n);
+    for (auto& x : a)
+    {
+        x = dis(gen);
+    }
+    return a;
+}
+
+template<class Real>
+void test_batch_bisect()
+{
+    auto a = random_targets<Real>(500);
+    std::vector<Real> lo(a.size(), Real(0)), hi(a.size(), Real(11));
+    auto f = [&](std::size_t i, Real x) { return x*x*x - a[i]; };
+    std::uintmax_t max_iter = 1000;
+    batch_bisect(f, lo, hi, eps_tolerance<Real>(), max_iter);
+    CHECK_LE(max_iter, std::uintmax_t(std::numeric_limits<Real>::digits + 10));
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        Real expected = boost::math::cbrt(a[i]);
+        CHECK_LE(lo[i], hi[i]);
+        CHECK_ULP_CLOSE(expected, lo[i] + (hi[i] - lo[i]) / 2, 4);
+    }
+}
+
+template<class Real>
+void test_batch_newton()
+{
+    auto a = random_targets<Real>(1000);
+    std::vector<Real> lo(a.size(), Real(0)), hi(a.size(), Real(11)), guess(a.size());
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        guess[i] = a[i] / 3;
+    }
+    auto f = [&](std::size_t i, Real x) { return std::make_pair(x*x*x - a[i], 3*x*x); };
+    std::uintmax_t max_iter = 200;
+    batch_newton_raphson_iterate(f, guess, lo, hi, std::numeric_limits<Real>::digits, max_iter);
+    CHECK_LE(max_iter, std::uintmax_t(100));
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::cbrt(a[i]), guess[i], 4);
+    }
+
+    // Lanes with the root at an endpoint, or with a wild initial guess:
+    std::vector<Real> lo2{Real(2), Real(0), Real(0)}, hi2{Real(3), Real(2), Real(4)}, g2{Real(2.5), Real(1e6), Real(-7)};
+    std::vector<Real> b{Real(8), Real(8), Real(8)};
+    auto f2 = [&](std::size_t i, Real x) { return std::make_pair(x*x*x - b[i], 3*x*x); };
+    batch_newton_raphson_iterate(f2, g2, lo2, hi2, std::numeric_limits<Real>::digits);
+    for (auto x : g2)
+    {
+        CHECK_ULP_CLOSE(Real(2), x, 2);
+    }
+}
+
+template<class Real, class Solver>
+void test_batch_second_order(Solver solver)
+{
+    auto a = random_targets<Real>(1000);
+    std::vector<Real> lo(a.size(), Real(0)), hi(a.size(), Real(11)), guess(a.size(), Real(1));
+    auto f = [&](std::size_t i, Real x) { return std::make_tuple(x*x*x - a[i], 3*x*x, 6*x); };
+    std::uintmax_t max_iter = 200;
+    solver(f, guess, lo, hi, std::numeric_limits<Real>::digits, max_iter);
+    CHECK_LE(max_iter, std::uintmax_t(100));
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::cbrt(a[i]), guess[i], 4);
+    }
+}
+
+template<class Real>
+void test_bad_brackets()
+{
+    using namespace boost::math::policies;
+    typedef policy<evaluation_error<ignore_error> > pol;
+    // The middle lane has no sign change, the others must still be solved:
+    std::vector<Real> lo{Real(0), Real(3), Real(0)}, hi{Real(3), Real(4), Real(3)}, guess{Real(1), Real(3.5), Real(1)};
+    auto f = [](std::size_t, Real x) { return std::make_pair(x*x - 2, 2*x); };
+    std::uintmax_t max_iter = 100;
+    batch_newton_raphson_iterate(f, guess, lo, hi, std::numeric_limits<Real>::digits, max_iter, pol());
+    CHECK_ULP_CLOSE(std::sqrt(Real(2)), guess[0], 2);
+    // Ignoring the error leaves the guess for that lane untouched:
+    CHECK_EQUAL(Real(3.5), guess[1]);
+    CHECK_ULP_CLOSE(std::sqrt(Real(2)), guess[2], 2);
+}
+
+template<class Real>
+void test_batch_toms748()
+{
+    auto a = random_targets<Real>(1000);
+    auto f = [&](std::size_t i, Real x) { return x*x*x - a[i]; };
+    for (std::uintmax_t limit : {std::uintmax_t(5), std::uintmax_t(100)})
+    {
+        std::vector<Real> lo(a.size(), Real(0)), hi(a.size(), Real(11));
+        std::uintmax_t max_iter = limit;
+        batch_toms748_solve(f, lo, hi, eps_tolerance<Real>(), max_iter);
+        CHECK_LE(max_iter, limit);
+        // Each lane takes exactly the steps of the scalar solver:
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            std::uintmax_t scalar_iter = limit;
+            auto r = toms748_solve([&](Real x) { return f(i, x); }, Real(0), Real(11), eps_tolerance<Real>(), scalar_iter);
+            CHECK_LE(scalar_iter, max_iter);
+            CHECK_EQUAL(r.first, lo[i]);
+            CHECK_EQUAL(r.second, hi[i]);
+            if (limit == 100)
+            {
+                // The bracket is still a bracket, and has converged:
+                CHECK_LE(f(i, lo[i]) * f(i, hi[i]), Real(0));
+                CHECK_LE(hi[i] - lo[i], 4 * std::numeric_limits<Real>::epsilon() * lo[i]);
+            }
+        }
+    }
+
+    // Lanes with the root at an endpoint, a bad bracket, and one reversed:
+    using namespace boost::math::policies;
+    typedef policy<domain_error<ignore_error> > pol;
+    std::vector<Real> lo{Real(2), Real(0), Real(3), Real(0), Real(2)}, hi{Real(3), Real(2), Real(4), Real(3), Real(1)};
+    auto g = [](std::size_t, Real x) { return x*x*x - 8; };
+    std::uintmax_t max_iter = 100;
+    batch_toms748_solve(g, lo, hi, eps_tolerance<Real>(), max_iter, pol());
+    CHECK_EQUAL(Real(2), lo[0]);
+    CHECK_EQUAL(Real(2), hi[0]);
+    CHECK_EQUAL(Real(2), lo[1]);
+    CHECK_EQUAL(Real(2), hi[1]);
+    CHECK_NAN(lo[2]);
+    CHECK_ULP_CLOSE(Real(2), lo[3] + (hi[3] - lo[3]) / 2, 2);
+    CHECK_NAN(lo[4]);
+}
+
+//
+// A functor which evaluates a whole sweep at once is called once per sweep,
+// and gives the same results as one called for each problem:
+//
+template<class Real>
+struct whole_batch_cube_root
+{
+    const std::vector<Real>* a;
+    std::size_t* calls;
+
+    void operator()(std::size_t n, const std::size_t* lanes, const Real* x, Real* f0) const
+    {
+        ++*calls;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            f0[k] = x[k]*x[k]*x[k] - (*a)[lanes[k]];
+        }
+    }
+    void operator()(std::size_t n, const std::size_t* lanes, const Real* x, Real* f0, Real* f1) const
+    {
+        (*this)(n, lanes, x, f0);
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            f1[k] = 3*x[k]*x[k];
+        }
+    }
+    void operator()(std::size_t n, const std::size_t* lanes, const Real* x, Real* f0, Real* f1, Real* f2) const
+    {
+        (*this)(n, lanes, x, f0, f1);
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            f2[k] = 6*x[k];
+        }
+    }
+};
+
+template<class Real>
+void test_whole_batch()
+{
+    auto a = random_targets<Real>(1000);
+    std::size_t calls = 0;
+    whole_batch_cube_root<Real> batch{&a, &calls};
+    auto f = [&](std::size_t i, Real x) { return x*x*x - a[i]; };
+    auto f2 = [&](std::size_t i, Real x) { return std::make_tuple(x*x*x - a[i], 3*x*x, 6*x); };
+
+    std::vector<Real> lo(a.size(), Real(0)), hi(a.size(), Real(11));
+    std::vector<Real> lo2 = lo, hi2 = hi;
+    std::uintmax_t max_iter = 1000;
+    batch_bisect(batch, lo, hi, eps_tolerance<Real>(), max_iter);
+    CHECK_LE(calls, std::size_t(max_iter + 2));
+    batch_bisect(f, lo2, hi2, eps_tolerance<Real>());
+    CHECK_EQUAL(true, lo == lo2 && hi == hi2);
+
+    calls = 0;
+    lo.assign(a.size(), Real(0));
+    hi.assign(a.size(), Real(11));
+    lo2 = lo;
+    hi2 = hi;
+    max_iter = 100;
+    batch_toms748_solve(batch, lo, hi, eps_tolerance<Real>(), max_iter);
+    CHECK_EQUAL(std::size_t(max_iter), calls);
+    batch_toms748_solve(f, lo2, hi2, eps_tolerance<Real>());
+    CHECK_EQUAL(true, lo == lo2 && hi == hi2);
+
+    calls = 0;
+    lo.assign(a.size(), Real(0));
+    hi.assign(a.size(), Real(11));
+    std::vector<Real> guess(a.size(), Real(1)), guess2 = guess;
+    max_iter = 200;
+    batch_newton_raphson_iterate(batch, guess, lo, hi, std::numeric_limits<Real>::digits, max_iter);
+    CHECK_EQUAL(std::size_t(max_iter + 2), calls);
+    batch_newton_raphson_iterate([&](std::size_t i, Real x) { return std::make_pair(x*x*x - a[i], 3*x*x); }, guess2, lo, hi, std::numeric_limits<Real>::digits);
+    CHECK_EQUAL(true, guess == guess2);
+
+    guess.assign(a.size(), Real(1));
+    guess2 = guess;
+    batch_halley_iterate(batch, guess, lo, hi, std::numeric_limits<Real>::digits);
+    batch_halley_iterate(f2, guess2, lo, hi, std::numeric_limits<Real>::digits);
+    CHECK_EQUAL(true, guess == guess2);
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(boost::math::cbrt(a[i]), guess[i], 4);
+    }
+}
+
+int main()
+{
+    test_batch_bisect<float>();
+    test_batch_bisect<double>();
+    test_batch_bisect<long double>();
+
+    test_batch_newton<float>();
+    test_batch_newton<double>();
+    test_batch_newton<long double>();
+
+    test_batch_second_order<double>([](auto f, auto& g, auto const& lo, auto const& hi, int digits, std::uintmax_t& it) { batch_halley_iterate(f, g, lo, hi, digits, it); });
+    test_batch_second_order<double>([](auto f, auto& g, auto const& lo, auto const& hi, int digits, std::uintmax_t& it) { batch_schroder_iterate(f, g, lo, hi, digits, it); });
+    test_batch_second_order<long double>([](auto f, auto& g, auto const& lo, auto const& hi, int digits, std::uintmax_t& it) { batch_halley_iterate(f, g, lo, hi, digits, it); });
+
+    test_bad_brackets<double>();
+
+    test_batch_toms748<float>();
+    test_batch_toms748<double>();
+    test_batch_toms748<long double>();
+
+    test_whole_batch<float>();
+    test_whole_batch<double>();
+
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,109 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <utility>
+#include <vector>
+#include <thread>
+#include "math_unit_test.hpp"
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/math/special_functions/polygamma.hpp>
+
+using boost::math::bernoulli_b2n;
+using boost::math::tangent_t2n;
+using boost::math::reserve_bernoulli_b2n;
+using boost::math::bernoulli_b2n_cache_statistics;
+using boost::math::bernoulli_b2n_snapshot;
+
+template <class T>
+void test_reserve()
+{
+   boost::math::bernoulli_cache_statistics stats = bernoulli_b2n_cache_statistics<T>();
+   CHECK_LE(stats.size, stats.capacity);
+   std::size_t n = reserve_bernoulli_b2n<T>(120);
+   CHECK_LE(std::size_t(120), n);
+   stats = bernoulli_b2n_cache_statistics<T>();
+   CHECK_EQUAL(stats.size, n);
+   CHECK_EQUAL(stats.reset_count, std::size_t(0));
+   const std::size_t growth_count = stats.growth_count;
+   //
+   // Everything within the reserved range is now served from the cache, including
+   // calls made with a different policy, and calls made internally by polygamma:
+   //
+   typedef boost::math::policies::policy<boost::math::policies::overflow_error<boost::math::policies::ignore_error> > other_policy;
+   tangent_t2n<T>(40);
+   tangent_t2n<T>(110, other_policy());
+   bernoulli_b2n<T>(115, other_policy());
+   std::vector<T> t;
+   tangent_t2n<T>(0, 50, std::back_inserter(t));
+   boost::math::polygamma(30, T(2.5));
+   CHECK_EQUAL(bernoulli_b2n_cache_statistics<T>().growth_count, growth_count);
+   // Asking for less than we already have is a no-op:
+   CHECK_EQUAL(reserve_bernoulli_b2n<T>(10), n);
+   // Asking for more than the capacity fills the cache:
+   stats = bernoulli_b2n_cache_statistics<T>();
+   CHECK_EQUAL(reserve_bernoulli_b2n<T>(stats.capacity + 100), stats.capacity);
+   CHECK_EQUAL(bernoulli_b2n_cache_statistics<T>().growth_count, growth_count + 1);
+}
+
+template <class T>
+void test_snapshot(int n)
+{
+   bernoulli_b2n_snapshot<T> snapshot(n);
+   CHECK_EQUAL(snapshot.size(), std::size_t(n));
+   for (int i = 0; i < n; ++i)
+   {
+      CHECK_EQUAL(snapshot.bernoulli_b2n(i), bernoulli_b2n<T>(i));
+      CHECK_EQUAL(snapshot.tangent_t2n(i), tangent_t2n<T>(i));
+   }
+   CHECK_EQUAL(snapshot.tangent_t2n(3), T(16));
+   CHECK_EQUAL(snapshot.bernoulli_b2n(1), T(1) / 6);
+   bernoulli_b2n_snapshot<T> empty(0);
+   CHECK_EQUAL(empty.size(), std::size_t(0));
+}
+
+template <class T>
+void test_concurrent_growth()
+{
+   //
+   // Several threads race to grow the cache for a type which has not been used yet,
+   // all must see the same values:
+   //
+   const unsigned n = 300;
+   std::vector<std::vector<T> > results(4);
+   std::vector<std::thread> threads;
+   for (unsigned i = 0; i < results.size(); ++i)
+   {
+      threads.emplace_back([&results, i, n]() {
+         for (unsigned j = i; j < n; j += 7)
+         {
+            tangent_t2n<T>(static_cast<int>(j));
+         }
+         tangent_t2n<T>(0, n, std::back_inserter(results[i]));
+      });
+   }
+   for (auto& t : threads)
+   {
+      t.join();
+   }
+   for (unsigned i = 1; i < results.size(); ++i)
+   {
+      for (unsigned j = 0; j < n; ++j)
+      {
+         CHECK_EQUAL(results[i][j], results[0][j]);
+      }
+   }
+   CHECK_ULP_CLOSE(T(7936), results[0][5], 0);
+   CHECK_LE(std::size_t(n), bernoulli_b2n_cache_statistics<T>().size);
+}
+
+int main()
+{
+   test_reserve<double>();
+   test_reserve<long double>();
+   test_snapshot<float>(15);
+   test_snapshot<double>(60);
+   test_concurrent_growth<long double>();
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,215 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/math/special_functions/detail/constexpr_kernel_coefficients.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/lanczos.hpp>
+#include <boost/math/special_functions/detail/bessel_j0.hpp>
+#include <boost/math/special_functions/detail/bessel_j1.hpp>
+#include <boost/math/special_functions/detail/bessel_y0.hpp>
+#include <boost/math/special_functions/detail/bessel_y1.hpp>
+#include <boost/math/tools/rational.hpp>
+#include <cmath>
+#include "math_unit_test.hpp"
+
+//
+// The constexpr kernels keep their own copies of the coefficients of the regular
+// implementations.  Those are function local statics, so rather than compare the
+// tables directly, each approximation is rebuilt here from the constexpr copy with
+// exactly the same operations as the regular code, and the two results must be
+// identical.  Any coefficient that differs in the double it rounds to shows up as
+// a difference somewhere in its interval.
+//
+using boost::math::tools::evaluate_polynomial;
+using boost::math::tools::evaluate_rational;
+
+typedef boost::math::policies::policy<> policy_type;
+
+void test_erf()
+{
+   typedef boost::math::detail::erf_kernel_coefficients<double, 53> c;
+   std::integral_constant<int, 53> tag;
+   for(double z = 1e-10; z < 0.5; z = z * 1.01 + 1e-4)
+   {
+      double zz = z * z;
+      double result = z * (c::erf_Y + evaluate_polynomial(c::erf_P, zz) / evaluate_polynomial(c::erf_Q, zz));
+      CHECK_EQUAL(boost::math::detail::erf_imp(z, false, policy_type(), tag), result);
+   }
+   for(double z = 0.5; z < 28; z += 0.00731)
+   {
+      // The erfc branches, each a rational approximation times exp(-z^2) / z:
+      double result;
+      if(z < 1.5f)
+      {
+         result = c::erfc_Y1 + evaluate_polynomial(c::erfc_P1, double(z - 0.5)) / evaluate_polynomial(c::erfc_Q1, double(z - 0.5));
+         result *= std::exp(-z * z) / z;
+      }
+      else
+      {
+         if(z < 2.5f)
+            result = c::erfc_Y2 + evaluate_polynomial(c::erfc_P2, double(z - 1.5)) / evaluate_polynomial(c::erfc_Q2, double(z - 1.5));
+         else if(z < 4.5f)
+            result = c::erfc_Y3 + evaluate_polynomial(c::erfc_P3, double(z - 3.5)) / evaluate_polynomial(c::erfc_Q3, double(z - 3.5));
+         else
+            result = c::erfc_Y4 + evaluate_polynomial(c::erfc_P4, double(1 / z)) / evaluate_polynomial(c::erfc_Q4, double(1 / z));
+         int expon;
+         double hi = std::floor(std::ldexp(std::frexp(z, &expon), 26));
+         hi = std::ldexp(hi, expon - 26);
+         double lo = z - hi;
+         double sq = z * z;
+         double err_sqr = ((hi * hi - sq) + 2 * hi * lo) + lo * lo;
+         result *= std::exp(-sq) * std::exp(-err_sqr) / z;
+      }
+      CHECK_EQUAL(boost::math::detail::erf_imp(z, true, policy_type(), tag), result);
+   }
+}
+
+void test_lgamma_small()
+{
+   typedef boost::math::detail::lgamma_small_kernel_coefficients<double, 64> c;
+   std::integral_constant<int, 64> tag;
+   boost::math::lanczos::lanczos13m53 l;
+   for(double z = 1.0001; z < 3; z += 0.000917)
+   {
+      double zm1 = z - 1;
+      double zm2 = z - 2;
+      double result;
+      if(z > 2)
+      {
+         double r = zm2 * (z + 1);
+         double R = evaluate_polynomial(c::P1, zm2);
+         R /= evaluate_polynomial(c::Q1, zm2);
+         result = r * c::Y1 + r * R;
+      }
+      else if(z <= 1.5)
+      {
+         double r = evaluate_polynomial(c::P2, zm1) / evaluate_polynomial(c::Q2, zm1);
+         double prefix = zm1 * zm2;
+         result = prefix * c::Y2 + prefix * r;
+      }
+      else
+      {
+         double r = zm2 * zm1;
+         double R = evaluate_polynomial(c::P3, double(-zm2)) / evaluate_polynomial(c::Q3, double(-zm2));
+         result = r * c::Y3 + r * R;
+      }
+      CHECK_EQUAL(boost::math::detail::lgamma_small_imp(z, zm1, zm2, tag, policy_type(), l), result);
+   }
+}
+
+void test_lanczos()
+{
+   //
+   // With SSE2, lanczos13m53 has a vectorised double version with its own copy of the
+   // coefficients, which sums in a different order; only the generic version is
+   // evaluated exactly as here, so check that in float, and the double one to a few ulps:
+   //
+   typedef boost::math::lanczos::lanczos13m53 l;
+   typedef boost::math::detail::lanczos_kernel_coefficients<float, 53> cf;
+   typedef boost::math::detail::lanczos_kernel_coefficients<double, 53> c;
+   CHECK_EQUAL(l::g(), c::g);
+   for(double z = 0.001; z < 200; z = z * 1.03 + 0.001)
+   {
+      float zf = static_cast<float>(z);
+      CHECK_EQUAL(l::lanczos_sum(zf), evaluate_rational(cf::sum_num, cf::sum_denom, zf));
+      CHECK_EQUAL(l::lanczos_sum_expG_scaled(zf), evaluate_rational(cf::sum_expG_scaled_num, cf::sum_expG_scaled_denom, zf));
+      CHECK_ULP_CLOSE(l::lanczos_sum(z), evaluate_rational(c::sum_num, c::sum_denom, z), 4);
+      CHECK_ULP_CLOSE(l::lanczos_sum_expG_scaled(z), evaluate_rational(c::sum_expG_scaled_num, c::sum_expG_scaled_denom, z), 4);
+   }
+}
+
+//
+// The tails of all four Bessel functions share one form, so compare that on its own:
+//
+template <class C>
+void check_bessel_tail(double x, double& rc, double& rs)
+{
+   double y = 8 / x;
+   double y2 = y * y;
+   rc = evaluate_rational(C::PC, C::QC, y2);
+   rs = evaluate_rational(C::PS, C::QS, y2);
+}
+
+void test_bessel()
+{
+   typedef boost::math::detail::bessel_j0_kernel_coefficients<double, 64> c0;
+   typedef boost::math::detail::bessel_j1_kernel_coefficients<double, 64> c1;
+   typedef boost::math::detail::bessel_y0_kernel_coefficients<double, 64> d0;
+   typedef boost::math::detail::bessel_y1_kernel_coefficients<double, 64> d1;
+   const double pi = boost::math::constants::pi<double>();
+   for(double x = 0.00731; x < 40; x += 0.00731)
+   {
+      double y = x * x;
+      double j0, j1, y0, y1;
+      if(x <= 4)
+         j0 = (x + c0::x1) * ((x - c0::x11 / 256) - c0::x12) * evaluate_rational(c0::P1, c0::Q1, y);
+      else if(x <= 8.0)
+         j0 = (x + c0::x2) * ((x - c0::x21 / 256) - c0::x22) * evaluate_rational(c0::P2, c0::Q2, double(1 - (x * x) / 64));
+      else
+      {
+         double rc, rs;
+         check_bessel_tail<c0>(x, rc, rs);
+         double factor = boost::math::constants::one_div_root_pi<double>() / std::sqrt(x);
+         double sx = std::sin(x);
+         double cx = std::cos(x);
+         j0 = factor * (rc * (cx + sx) - (8 / x) * rs * (sx - cx));
+      }
+      if(x <= 4)
+         j1 = x * (x + c1::x1) * ((x - c1::x11 / 256) - c1::x12) * evaluate_rational(c1::P1, c1::Q1, y);
+      else if(x <= 8)
+         j1 = x * (x + c1::x2) * ((x - c1::x21 / 256) - c1::x22) * evaluate_rational(c1::P2, c1::Q2, y);
+      else
+      {
+         double rc, rs;
+         check_bessel_tail<c1>(x, rc, rs);
+         double factor = 1 / (std::sqrt(x) * boost::math::constants::root_pi<double>());
+         double sx = std::sin(x);
+         double cx = std::cos(x);
+         j1 = factor * (rc * (sx - cx) + (8 / x) * rs * (sx + cx));
+      }
+      if(x <= 3)
+         y0 = 2 * std::log(x / d0::x1) * boost::math::detail::bessel_j0(x) / pi + (x + d0::x1) * ((x - d0::x11 / 256) - d0::x12) * evaluate_rational(d0::P1, d0::Q1, y);
+      else if(x <= 5.5f)
+         y0 = 2 * std::log(x / d0::x2) * boost::math::detail::bessel_j0(x) / pi + (x + d0::x2) * ((x - d0::x21 / 256) - d0::x22) * evaluate_rational(d0::P2, d0::Q2, y);
+      else if(x <= 8)
+         y0 = 2 * std::log(x / d0::x3) * boost::math::detail::bessel_j0(x) / pi + (x + d0::x3) * ((x - d0::x31 / 256) - d0::x32) * evaluate_rational(d0::P3, d0::Q3, y);
+      else
+      {
+         double rc, rs;
+         check_bessel_tail<d0>(x, rc, rs);
+         double factor = boost::math::constants::one_div_root_pi<double>() / std::sqrt(x);
+         double sx = std::sin(x);
+         double cx = std::cos(x);
+         y0 = factor * (rc * (sx - cx) + (8 / x) * rs * (cx + sx));
+      }
+      if(x <= 4)
+         y1 = 2 * std::log(x / d1::x1) * boost::math::detail::bessel_j1(x) / pi + (x + d1::x1) * ((x - d1::x11 / 256) - d1::x12) / x * evaluate_rational(d1::P1, d1::Q1, y);
+      else if(x <= 8)
+         y1 = 2 * std::log(x / d1::x2) * boost::math::detail::bessel_j1(x) / pi + (x + d1::x2) * ((x - d1::x21 / 256) - d1::x22) / x * evaluate_rational(d1::P2, d1::Q2, y);
+      else
+      {
+         double rc, rs;
+         check_bessel_tail<d1>(x, rc, rs);
+         double factor = 1 / (std::sqrt(x) * boost::math::constants::root_pi<double>());
+         double sx = std::sin(x);
+         double cx = std::cos(x);
+         y1 = factor * ((8 / x) * rs * (sx - cx) - rc * (sx + cx));
+      }
+      CHECK_EQUAL(boost::math::detail::bessel_j0(x), j0);
+      CHECK_EQUAL(boost::math::detail::bessel_j1(x), j1);
+      CHECK_EQUAL(boost::math::detail::bessel_y0(x, policy_type()), y0);
+      CHECK_EQUAL(boost::math::detail::bessel_y1(x, policy_type()), y1);
+   }
+}
+
+int main()
+{
+   test_erf();
+   test_lgamma_small();
+   test_lanczos();
+   test_bessel();
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,144 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/math/special_functions/constexpr_kernels.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+#include <cmath>
+#include <limits>
+#include "math_unit_test.hpp"
+
+//
+// The reference values are computed at run time with the regular functions; for
+// double these are evaluated in long double by default, so the tolerances below
+// reflect evaluating the same approximations in double.
+//
+namespace ce = boost::math::detail::constexpr_math;
+
+static_assert(boost::math::tools::constexpr_evaluate_polynomial(std::array<double, 3>{{ 1, 2, 3 }}, 2.0) == 17, "Horner");
+static_assert(boost::math::tools::constexpr_evaluate_rational(std::array<double, 2>{{ 1, 1 }}, std::array<double, 2>{{ 1, 3 }}, 3.0) - 0.4 < 1e-16 && 0.4 - boost::math::tools::constexpr_evaluate_rational(std::array<double, 2>{{ 1, 1 }}, std::array<double, 2>{{ 1, 3 }}, 3.0) < 1e-16, "Rational with z > 1");
+static_assert(boost::math::constexpr_tgamma(5.0) == 24, "Exact at the integers");
+static_assert(boost::math::constexpr_lgamma(2.0) == 0, "Exact zero");
+static_assert(boost::math::constexpr_erf(0.0) == 0, "Exact zero");
+static_assert(boost::math::constexpr_erfc(30.0) == 0, "Underflow");
+static_assert(boost::math::constexpr_bessel_j0(0.0) == 1, "Exact one");
+static_assert(boost::math::constexpr_bessel_j1(0.0) == 0, "Exact zero");
+static_assert(boost::math::constexpr_tgamma(200.0) == std::numeric_limits<double>::infinity(), "Overflow");
+static_assert(boost::math::constexpr_bessel_y0(0.0) == -std::numeric_limits<double>::infinity(), "Pole");
+
+//
+// A table filled in by the compiler:
+//
+struct erf_table
+{
+   double values[41];
+};
+
+constexpr erf_table make_erf_table()
+{
+   erf_table result = {};
+   for(int i = 0; i <= 40; ++i)
+      result.values[i] = boost::math::constexpr_erf(i / 10.0);
+   return result;
+}
+
+constexpr erf_table table = make_erf_table();
+
+void test_elementary()
+{
+   constexpr double e = ce::exp(1.0);
+   CHECK_ULP_CLOSE(std::exp(1.0), e, 1);
+   for(double x = -740; x < 709; x += 0.731)
+      CHECK_ULP_CLOSE(std::exp(x), ce::exp(x), 1);
+   for(double x = 1e-300; x < 1e300; x *= 3.7)
+   {
+      CHECK_ULP_CLOSE(std::log(x), ce::log(x), 1);
+      CHECK_ULP_CLOSE(std::sqrt(x), ce::sqrt(x), 0);
+   }
+   // Both the Cody-Waite and the Payne-Hanek argument reductions:
+   for(double x = 0.01; x < 1e300; x *= 1.93)
+   {
+      CHECK_ULP_CLOSE(std::sin(x), ce::sin(x), 1);
+      CHECK_ULP_CLOSE(std::cos(x), ce::cos(x), 1);
+   }
+   constexpr double s = ce::sin(1e22);
+   CHECK_ULP_CLOSE(-0.8522008497671888, s, 1);
+}
+
+void test_erf()
+{
+   for(int i = 0; i <= 40; ++i)
+      CHECK_ULP_CLOSE(boost::math::erf(i / 10.0), table.values[i], 2);
+   for(double z = -6; z < 6; z += 0.0137)
+   {
+      CHECK_ULP_CLOSE(boost::math::erf(z), boost::math::constexpr_erf(z), 3);
+      CHECK_ULP_CLOSE(boost::math::erfc(z), boost::math::constexpr_erfc(z), 5);
+   }
+   for(double z = 6; z < 26; z += 0.31)
+      CHECK_ULP_CLOSE(boost::math::erfc(z), boost::math::constexpr_erfc(z), 5);
+   constexpr float f = boost::math::constexpr_erf(0.5f);
+   CHECK_ULP_CLOSE(boost::math::erf(0.5f), f, 1);
+   CHECK_NAN(boost::math::constexpr_erf(std::numeric_limits<double>::quiet_NaN()));
+}
+
+void test_gamma()
+{
+   for(double z = 0.0001; z < 171; z = z * 1.1 + 0.01)
+   {
+      CHECK_ULP_CLOSE(boost::math::tgamma(z), boost::math::constexpr_tgamma(z), 10);
+      CHECK_ULP_CLOSE(boost::math::lgamma(z), boost::math::constexpr_lgamma(z), 10);
+   }
+   // Away from the roots of lgamma, and through both reflection branches of tgamma:
+   for(double z = -3.1; z > -170; z = z * 1.05 - 0.013)
+   {
+      int s1 = 0;
+      int s2 = 0;
+      CHECK_ULP_CLOSE(boost::math::tgamma(z), boost::math::constexpr_tgamma(z), 20);
+      CHECK_ULP_CLOSE(boost::math::lgamma(z, &s1), boost::math::constexpr_lgamma(z, &s2), 20);
+      CHECK_EQUAL(s1, s2);
+   }
+   for(double z = 200; z < 1e30; z *= 13)
+      CHECK_ULP_CLOSE(boost::math::lgamma(z), boost::math::constexpr_lgamma(z), 2);
+   constexpr float f = boost::math::constexpr_tgamma(0.5f);
+   CHECK_ULP_CLOSE(boost::math::tgamma(0.5f), f, 1);
+   CHECK_NAN(boost::math::constexpr_tgamma(-2.0));
+   CHECK_EQUAL(boost::math::constexpr_lgamma(-2.0), std::numeric_limits<double>::infinity());
+}
+
+void test_bessel()
+{
+   //
+   // These lose relative accuracy near their zeros, just as the regular
+   // functions do when evaluated in double, so check the absolute error:
+   //
+   for(double x = -60; x < 60; x += 0.0731)
+   {
+      CHECK_ABSOLUTE_ERROR(boost::math::cyl_bessel_j(0, x), boost::math::constexpr_bessel_j0(x), 4 * std::numeric_limits<double>::epsilon());
+      CHECK_ABSOLUTE_ERROR(boost::math::cyl_bessel_j(1, x), boost::math::constexpr_bessel_j1(x), 4 * std::numeric_limits<double>::epsilon());
+   }
+   for(double x = 0.0125; x < 60; x += 0.0731)
+   {
+      CHECK_ABSOLUTE_ERROR(boost::math::cyl_neumann(0, x), boost::math::constexpr_bessel_y0(x), 4 * std::numeric_limits<double>::epsilon());
+      CHECK_ABSOLUTE_ERROR(boost::math::cyl_neumann(1, x), boost::math::constexpr_bessel_y1(x), 4 * std::numeric_limits<double>::epsilon() * (x < 1 ? 1 / x : 1));
+   }
+   for(double x = 100; x < 1e15; x *= 7.1)
+   {
+      CHECK_ABSOLUTE_ERROR(boost::math::cyl_bessel_j(0, x), boost::math::constexpr_bessel_j0(x), 4 * std::numeric_limits<double>::epsilon());
+      CHECK_ABSOLUTE_ERROR(boost::math::cyl_neumann(1, x), boost::math::constexpr_bessel_y1(x), 4 * std::numeric_limits<double>::epsilon());
+   }
+   constexpr double j0 = boost::math::constexpr_bessel_j0(2.5);
+   CHECK_ULP_CLOSE(boost::math::cyl_bessel_j(0, 2.5), j0, 4);
+   CHECK_NAN(boost::math::constexpr_bessel_y0(-1.0));
+}
+
+int main()
+{
+   test_elementary();
+   test_erf();
+   test_gamma();
+   test_bessel();
+   return boost::math::test::report_errors();
+}
@@ -65,6 +65,19 @@ void expected_results()
       ".*",                          // test data group
       ".*", 40, 15);                   // test function
 
+   if(BOOST_MATH_PROMOTE_FLOAT_POLICY == false)
+   {
+      //
+      // Ei evaluated in float loses a few bits in exp(z) / z for large z:
+      //
+      add_expected_result(
+         ".*",                          // compiler
+         ".*",                          // stdlib
+         ".*",                          // platform
+         "float",                       // test type(s)
+         ".*Ei.*",                      // test data group
+         ".*", 15, 5);                  // test function
+   }
    add_expected_result(
       ".*",                          // compiler
       ".*",                          // stdlib
@@ -0,0 +1,78 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/special_functions/relative_difference.hpp>
+#include "math_unit_test.hpp"
+
+//
+// Checks that the special functions evaluated with fast_policy are within the
+// documented error bound of the full precision results.  The bound is a few
+// float epsilon for both float and double:
+//
+using boost::math::policies::fast_policy;
+
+template <class T>
+void check_fast(T fast, T full)
+{
+   T tol = 4 * std::numeric_limits<float>::epsilon();
+   if(!CHECK_LE(boost::math::relative_difference(fast, full), tol))
+      std::cerr << "  fast result " << fast << " vs " << full << std::endl;
+}
+
+template <class T>
+void test_fast_policy()
+{
+   static_assert(std::is_same<decltype(boost::math::erf(T(1), fast_policy())), T>::value, "Result type is unchanged");
+   static_assert(boost::math::policies::digits<double, fast_policy>() == 24, "24 bits of precision");
+
+   for(T z = -5; z < 5; z += T(0.0137))
+   {
+      check_fast(boost::math::erf(z, fast_policy()), boost::math::erf(z));
+      check_fast(boost::math::erfc(z, fast_policy()), boost::math::erfc(z));
+   }
+   for(T z = 5; z < 9; z += T(0.0731))
+      check_fast(boost::math::erfc(z, fast_policy()), boost::math::erfc(z));
+
+   for(T z = T(0.0078125); z < 30; z = z * T(1.05) + T(0.001))
+   {
+      check_fast(boost::math::tgamma(z, fast_policy()), boost::math::tgamma(z));
+      check_fast(boost::math::tgamma1pm1(T(z - 1), fast_policy()), boost::math::tgamma1pm1(T(z - 1)));
+      check_fast(boost::math::gamma_p(T(10), z, fast_policy()), boost::math::gamma_p(T(10), z));
+      check_fast(boost::math::gamma_q(T(2.5), z, fast_policy()), boost::math::gamma_q(T(2.5), z));
+      check_fast(boost::math::beta(z, T(2.5), fast_policy()), boost::math::beta(z, T(2.5)));
+      check_fast(boost::math::cyl_bessel_i(0, z, fast_policy()), boost::math::cyl_bessel_i(0, z));
+      check_fast(boost::math::cyl_bessel_i(1, z, fast_policy()), boost::math::cyl_bessel_i(1, z));
+      check_fast(boost::math::cyl_bessel_k(0, z, fast_policy()), boost::math::cyl_bessel_k(0, z));
+      check_fast(boost::math::cyl_bessel_k(1, z, fast_policy()), boost::math::cyl_bessel_k(1, z));
+      check_fast(boost::math::cyl_bessel_k(3, z, fast_policy()), boost::math::cyl_bessel_k(3, z));
+   }
+   //
+   // lgamma has roots at 1 and 2, so check the absolute error, which is
+   // what the rational approximations there are optimised for:
+   //
+   for(T z = T(0.0078125); z < 100; z = z * T(1.05) + T(0.001))
+   {
+      T fast = boost::math::lgamma(z, fast_policy());
+      T full = boost::math::lgamma(z);
+      CHECK_LE(T(fabs(fast - full)), T(4 * std::numeric_limits<float>::epsilon() * (std::max)(T(1), T(fabs(full)))));
+   }
+   for(T x = T(0.01); x < 1; x += T(0.0123))
+   {
+      check_fast(boost::math::ibeta(T(3.5), T(12.25), x, fast_policy()), boost::math::ibeta(T(3.5), T(12.25), x));
+      check_fast(boost::math::ibeta(T(0.25), T(2), x, fast_policy()), boost::math::ibeta(T(0.25), T(2), x));
+      check_fast(boost::math::ibetac(T(20), T(0.5), x, fast_policy()), boost::math::ibetac(T(20), T(0.5), x));
+   }
+}
+
+int main()
+{
+   test_fast_policy<float>();
+   test_fast_policy<double>();
+   return boost::math::test::report_errors();
+}
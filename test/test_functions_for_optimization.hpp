@@ -0,0 +1,44 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TEST_FUNCTIONS_FOR_OPTIMIZATION_HPP
+#define TEST_FUNCTIONS_FOR_OPTIMIZATION_HPP
+#include <cmath>
+#include <boost/math/constants/constants.hpp>
+
+// Minimum at (1, 1, ..., 1), in a long curved valley:
+template <class Real, class ArgumentContainer> Real rosenbrock(ArgumentContainer const &x) {
+    Real result = 0;
+    for (size_t i = 0; i + 1 < x.size(); ++i) {
+        Real a = x[i + 1] - x[i] * x[i];
+        Real b = 1 - x[i];
+        result += 100 * a * a + b * b;
+    }
+    return result;
+}
+
+// Minimum at the origin, surrounded by a great many local minima:
+template <class Real, class ArgumentContainer> Real rastrigin(ArgumentContainer const &x) {
+    using std::cos;
+    using boost::math::constants::two_pi;
+    Real result = 10 * x.size();
+    for (size_t i = 0; i < x.size(); ++i) {
+        result += x[i] * x[i] - 10 * cos(two_pi<Real>() * x[i]);
+    }
+    return result;
+}
+
+// Minimum at (3, 0.5):
+template <class Real, class ArgumentContainer> Real beale(ArgumentContainer const &v) {
+    Real x = v[0];
+    Real y = v[1];
+    Real t1 = Real(1.5) - x + x * y;
+    Real t2 = Real(2.25) - x + x * y * y;
+    Real t3 = Real(2.625) - x + x * y * y * y;
+    return t1 * t1 + t2 * t2 + t3 * t3;
+}
+
+#endif
@@ -0,0 +1,127 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <stdexcept>
+#include "math_unit_test.hpp"
+#include <boost/math/distributions/hyperexponential.hpp>
+
+using boost::math::hyperexponential_distribution;
+using boost::math::fixed_hyperexponential_distribution;
+using boost::math::exponential_distribution;
+
+template <class Real>
+void test_fixed_phases()
+{
+   const std::array<Real, 3> probs = { Real(0.2), Real(0.3), Real(0.5) };
+   const std::array<Real, 3> rates = { Real(0.5), Real(1.0), Real(1.5) };
+
+   hyperexponential_distribution<Real> dist(probs, rates);
+   fixed_hyperexponential_distribution<Real, 3> fixed(probs, rates);
+
+   CHECK_EQUAL(fixed.num_phases(), std::size_t(3));
+   CHECK_EQUAL(dist.num_phases(), std::size_t(3));
+   for (std::size_t i = 0; i < 3; ++i)
+   {
+      CHECK_EQUAL(fixed.probabilities()[i], dist.probabilities()[i]);
+      CHECK_EQUAL(fixed.rates()[i], dist.rates()[i]);
+      CHECK_EQUAL(dist.probabilities_data()[i], dist.probabilities()[i]);
+      CHECK_EQUAL(dist.rates_data()[i], dist.rates()[i]);
+      CHECK_EQUAL(fixed.rates_data()[i], rates[i]);
+   }
+
+   const Real xs[] = { Real(0), Real(0.125), Real(1), Real(2.5), Real(10), Real(100), std::numeric_limits<Real>::infinity() };
+   for (Real x : xs)
+   {
+      // The mixture sums must agree exactly with summing over the exponential phases:
+      Real p = 0;
+      Real c = 0;
+      Real cc = 0;
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         exponential_distribution<Real> e(rates[i]);
+         p += dist.probabilities()[i] * pdf(e, x);
+         c += dist.probabilities()[i] * cdf(e, x);
+         cc += dist.probabilities()[i] * cdf(complement(e, x));
+      }
+      CHECK_EQUAL(pdf(dist, x), p);
+      CHECK_EQUAL(cdf(dist, x), c);
+      CHECK_EQUAL(cdf(complement(dist, x)), cc);
+      CHECK_EQUAL(pdf(fixed, x), p);
+      CHECK_EQUAL(cdf(fixed, x), c);
+      CHECK_EQUAL(cdf(complement(fixed, x)), cc);
+   }
+
+   const Real ps[] = { Real(0.001), Real(0.25), Real(0.5), Real(0.9), Real(0.999) };
+   for (Real q : ps)
+   {
+      CHECK_EQUAL(quantile(fixed, q), quantile(dist, q));
+      CHECK_EQUAL(quantile(complement(fixed, q)), quantile(complement(dist, q)));
+      CHECK_ULP_CLOSE(q, cdf(fixed, quantile(fixed, q)), 200);
+   }
+
+   CHECK_EQUAL(mean(fixed), mean(dist));
+   CHECK_EQUAL(variance(fixed), variance(dist));
+   CHECK_EQUAL(skewness(fixed), skewness(dist));
+   CHECK_EQUAL(kurtosis(fixed), kurtosis(dist));
+   CHECK_EQUAL(kurtosis_excess(fixed), kurtosis_excess(dist));
+   CHECK_EQUAL(mode(fixed), mode(dist));
+   CHECK_EQUAL(median(fixed), median(dist));
+   CHECK_EQUAL(standard_deviation(fixed), standard_deviation(dist));
+   CHECK_EQUAL(hazard(fixed, Real(2)), hazard(dist, Real(2)));
+   CHECK_EQUAL(range(fixed).second, range(dist).second);
+   CHECK_EQUAL(support(fixed).first, support(dist).first);
+
+   // Rates only, and default construction, give equal phase probabilities:
+   fixed_hyperexponential_distribution<Real, 3> equal(rates);
+   hyperexponential_distribution<Real> equal_dist(rates);
+   for (std::size_t i = 0; i < 3; ++i)
+   {
+      CHECK_EQUAL(equal.probabilities()[i], equal_dist.probabilities()[i]);
+   }
+   CHECK_EQUAL(cdf(equal, Real(1.5)), cdf(equal_dist, Real(1.5)));
+   fixed_hyperexponential_distribution<Real, 1> one;
+   CHECK_EQUAL(cdf(one, Real(1)), cdf(exponential_distribution<Real>(1), Real(1)));
+   CHECK_EQUAL(quantile(one, Real(0.5)), quantile(hyperexponential_distribution<Real>(), Real(0.5)));
+
+   // Errors:
+   const std::array<Real, 3> bad_rates = { Real(0.5), Real(-1), Real(1.5) };
+   int thrown = 0;
+   try
+   {
+      fixed_hyperexponential_distribution<Real, 3> bad(probs, bad_rates);
+   }
+   catch (std::domain_error const &)
+   {
+      ++thrown;
+   }
+   try
+   {
+      pdf(fixed, Real(-1));
+   }
+   catch (std::domain_error const &)
+   {
+      ++thrown;
+   }
+   try
+   {
+      quantile(fixed, Real(2));
+   }
+   catch (std::domain_error const &)
+   {
+      ++thrown;
+   }
+   CHECK_EQUAL(thrown, 3);
+}
+
+int main()
+{
+   test_fixed_phases<float>();
+   test_fixed_phases<double>();
+   test_fixed_phases<long double>();
+   return boost::math::test::report_errors();
+}
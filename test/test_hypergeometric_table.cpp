@@ -0,0 +1,125 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include "math_unit_test.hpp"
+#include <boost/math/distributions/hypergeometric.hpp>
+
+using namespace boost::math;
+
+template <class Real, class Policy>
+void check_table(unsigned r, unsigned n, unsigned N, unsigned stride, int tolerance)
+{
+   hypergeometric_distribution<Real, Policy> dist(r, n, N);
+   hypergeometric_table<Real, Policy> table(dist);
+   CHECK_EQUAL(table.lower(), range(dist).first);
+   CHECK_EQUAL(table.upper(), range(dist).second);
+
+   std::vector<Real> pdfs, cdfs, ccdfs;
+   table.pdf_values(std::back_inserter(pdfs));
+   table.cdf_values(std::back_inserter(cdfs));
+   table.cdf_complement_values(std::back_inserter(ccdfs));
+   CHECK_EQUAL(pdfs.size(), std::size_t(table.upper() - table.lower() + 1));
+   for (unsigned x = table.lower(); x <= table.upper(); x += stride)
+   {
+      unsigned i = x - table.lower();
+      CHECK_EQUAL(pdfs[i], table.pdf(x));
+      CHECK_EQUAL(cdfs[i], table.cdf(x));
+      CHECK_EQUAL(ccdfs[i], table.cdf_complement(x));
+      CHECK_ULP_CLOSE(pdf(dist, x), table.pdf(x), tolerance);
+      CHECK_ULP_CLOSE(cdf(dist, x), table.cdf(x), tolerance);
+      CHECK_ULP_CLOSE(cdf(complement(dist, x)), table.cdf_complement(x), tolerance);
+   }
+
+   // Quantiles must agree with the free functions, whatever the order of the probabilities:
+   std::vector<Real> p;
+   for (int i = 1; i < 400; ++i)
+   {
+      p.push_back(Real(i) / 400);
+   }
+   p.push_back(Real(1e-12));
+   p.push_back(Real(1) - Real(1e-6));
+   std::sort(p.begin(), p.end());
+   std::vector<Real> q(p.size()), qc(p.size());
+   table.quantile(p.begin(), p.end(), q.begin());
+   table.quantile_complement(p.begin(), p.end(), qc.begin());
+   for (std::size_t i = 0; i < p.size(); ++i)
+   {
+      CHECK_EQUAL(q[i], quantile(dist, p[i]));
+      CHECK_EQUAL(qc[i], quantile(complement(dist, p[i])));
+      CHECK_EQUAL(table.quantile(p[i]), q[i]);
+      CHECK_EQUAL(table.quantile_complement(p[i]), qc[i]);
+   }
+   std::reverse(p.begin(), p.end());
+   table.quantile(p.begin(), p.end(), q.begin());
+   for (std::size_t i = 0; i < p.size(); ++i)
+   {
+      CHECK_EQUAL(q[i], quantile(dist, p[i]));
+   }
+}
+
+template <class Real, class Policy>
+void test_tables(int tolerance)
+{
+   check_table<Real, Policy>(5, 10, 20, 1, tolerance);
+   check_table<Real, Policy>(20, 20, 20, 1, tolerance);
+   check_table<Real, Policy>(0, 10, 20, 1, tolerance);
+   check_table<Real, Policy>(50, 100, 300, 1, tolerance);
+   check_table<Real, Policy>(400, 600, 1000, 1, tolerance);
+   // Tails that underflow, and a support wide enough for the recurrence to be refreshed:
+   check_table<Real, Policy>(2000, 3000, 10000, 7, tolerance * 4);
+   // N beyond the prime factorisation range, the Lanczos approximation used for the
+   // pdf is only good to around 1e-14 when evaluated in extended precision:
+   check_table<Real, Policy>(5000, 6000, 200000, 97, std::numeric_limits<Real>::digits > 53 ? tolerance * 2000 : tolerance * 4);
+}
+
+void test_errors()
+{
+   hypergeometric_table<double> table(hypergeometric_distribution<double>(5, 10, 20));
+   int thrown = 0;
+   try
+   {
+      table.pdf(6);
+   }
+   catch (std::domain_error const &)
+   {
+      ++thrown;
+   }
+   try
+   {
+      table.quantile(1.5);
+   }
+   catch (std::domain_error const &)
+   {
+      ++thrown;
+   }
+   try
+   {
+      std::vector<double> p(1, -1), q(1);
+      table.quantile_complement(p.begin(), p.end(), q.begin());
+   }
+   catch (std::domain_error const &)
+   {
+      ++thrown;
+   }
+   CHECK_EQUAL(thrown, 3);
+}
+
+int main()
+{
+   using namespace boost::math::policies;
+   test_tables<float, policy<> >(20);
+   test_tables<double, policy<> >(200);
+   test_tables<double, policy<discrete_quantile<integer_round_down> > >(200);
+   test_tables<double, policy<discrete_quantile<integer_round_up> > >(200);
+   test_tables<double, policy<discrete_quantile<integer_round_nearest> > >(200);
+   test_tables<long double, policy<> >(200);
+   test_errors();
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,141 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/math/policies/iteration_statistics.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "math_unit_test.hpp"
+
+using namespace boost::math::policies;
+
+typedef policy<record_iterations<true> > recording_policy;
+
+const iteration_statistics* find(const std::vector<iteration_statistics>& stats, const std::string& name, iteration_kind kind)
+{
+   for (std::size_t i = 0; i < stats.size(); ++i)
+   {
+      if ((stats[i].function.find(name) != std::string::npos) && (stats[i].kind == kind))
+         return &stats[i];
+   }
+   return nullptr;
+}
+
+void check_consistent(const iteration_statistics& s)
+{
+   std::uintmax_t histogram_total = 0;
+   for (std::size_t b = 0; b < iteration_statistics::histogram_size; ++b)
+      histogram_total += s.histogram[b];
+   CHECK_EQUAL(histogram_total, s.evaluations);
+   CHECK_LE(s.max_iterations, s.total_iterations);
+}
+
+void test_recording()
+{
+   reset_iteration_statistics();
+   // The default policy records nothing:
+   double sum = 0;
+   for (int i = 1; i < 50; ++i)
+      sum += boost::math::ibeta(20.5, 30.25, i / 50.0);
+   std::vector<iteration_statistics> stats = iteration_statistics_snapshot();
+   std::uintmax_t total = 0;
+   for (std::size_t i = 0; i < stats.size(); ++i)
+      total += stats[i].evaluations;
+   CHECK_EQUAL(total, std::uintmax_t(0));
+
+   // Whereas this records both the series and the root finding iterations, and
+   // doesn't change the results:
+   {
+      iteration_timer timer("ibeta and gamma_p_inv");
+      for (int i = 1; i < 50; ++i)
+      {
+         CHECK_EQUAL(boost::math::ibeta(20.5, 30.25, i / 50.0, recording_policy()), boost::math::ibeta(20.5, 30.25, i / 50.0));
+         CHECK_EQUAL(boost::math::gamma_p_inv(35.5, i / 50.0, recording_policy()), boost::math::gamma_p_inv(35.5, i / 50.0));
+      }
+   }
+   stats = iteration_statistics_snapshot();
+   const iteration_statistics* series = find(stats, "ibeta", series_iterations);
+   const iteration_statistics* roots = find(stats, "gamma_p_inv", root_iterations);
+   const iteration_statistics* timer = find(stats, "ibeta and gamma_p_inv", timed_region);
+   CHECK_EQUAL(series != nullptr, true);
+   CHECK_EQUAL(roots != nullptr, true);
+   CHECK_EQUAL(timer != nullptr, true);
+   if (series && roots && timer)
+   {
+      CHECK_LE(std::uintmax_t(1), series->evaluations);
+      CHECK_LE(std::uintmax_t(1), series->max_iterations);
+      CHECK_LE(std::uintmax_t(49), roots->evaluations);
+      check_consistent(*series);
+      check_consistent(*roots);
+      CHECK_EQUAL(timer->evaluations, std::uintmax_t(1));
+      CHECK_LE(0.0, timer->seconds);
+   }
+
+   // Counts from other threads are merged into the snapshot, and survive the thread exiting:
+   std::uintmax_t before = roots ? roots->evaluations : 0;
+   std::vector<std::thread> threads;
+   for (int t = 0; t < 4; ++t)
+   {
+      threads.emplace_back([]()
+      {
+         for (int i = 1; i < 50; ++i)
+            boost::math::gamma_p_inv(35.5, i / 50.0, recording_policy());
+      });
+   }
+   for (std::size_t t = 0; t < threads.size(); ++t)
+      threads[t].join();
+   stats = iteration_statistics_snapshot();
+   roots = find(stats, "gamma_p_inv", root_iterations);
+   CHECK_EQUAL(roots != nullptr, true);
+   if (roots)
+   {
+      CHECK_EQUAL(roots->evaluations, before + 4 * 49);
+      check_consistent(*roots);
+   }
+
+   std::ostringstream ss;
+   write_iteration_statistics(ss, stats);
+   CHECK_EQUAL(ss.str().find("\"kind\": \"root\"") != std::string::npos, true);
+   CHECK_EQUAL(ss.str().find("\"histogram\": [") != std::string::npos, true);
+
+   reset_iteration_statistics();
+   stats = iteration_statistics_snapshot();
+   for (std::size_t i = 0; i < stats.size(); ++i)
+   {
+      CHECK_EQUAL(stats[i].evaluations, std::uintmax_t(0));
+      CHECK_EQUAL(stats[i].total_iterations, std::uintmax_t(0));
+   }
+   (void)sum;
+}
+
+int main()
+{
+   static_assert(std::is_same<policy<>::record_iterations_type, record_iterations<false> >::value, "Recording must be off by default");
+   static_assert(std::is_same<normalise<policy<>, record_iterations<true> >::type::record_iterations_type, record_iterations<true> >::value, "normalise must keep the policy");
+   // record_iterations shares policy<>'s 13 slots with everything else, so a policy with all of them in use keeps every setting:
+   typedef policy<domain_error<ignore_error>, pole_error<ignore_error>, overflow_error<ignore_error>, underflow_error<throw_on_error>,
+      denorm_error<throw_on_error>, rounding_error<ignore_error>, evaluation_error<ignore_error>, indeterminate_result_error<throw_on_error>,
+      promote_float<false>, promote_double<false>, discrete_quantile<real>, assert_undefined<false> > twelve_settings;
+   typedef normalise<twelve_settings, record_iterations<true> >::type full_policy;
+   static_assert(std::is_same<full_policy::record_iterations_type, record_iterations<true> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::domain_error_type, domain_error<ignore_error> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::pole_error_type, pole_error<ignore_error> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::overflow_error_type, overflow_error<ignore_error> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::underflow_error_type, underflow_error<throw_on_error> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::denorm_error_type, denorm_error<throw_on_error> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::rounding_error_type, rounding_error<ignore_error> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::evaluation_error_type, evaluation_error<ignore_error> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::indeterminate_result_error_type, indeterminate_result_error<throw_on_error> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::promote_float_type, promote_float<false> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::promote_double_type, promote_double<false> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::discrete_quantile_type, discrete_quantile<real> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<full_policy::assert_undefined_type, assert_undefined<false> >::value, "normalise must keep the policy");
+   static_assert(std::is_same<normalise<full_policy>::type, full_policy>::value, "normalise must be idempotent");
+   test_recording();
+   return boost::math::test::report_errors();
+}
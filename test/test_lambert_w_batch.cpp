@@ -0,0 +1,138 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <utility>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include "math_unit_test.hpp"
+#include <boost/math/special_functions/lambert_w.hpp>
+
+using boost::math::lambert_w0;
+using boost::math::lambert_wm1;
+
+typedef boost::math::policies::policy<
+   boost::math::policies::domain_error<boost::math::policies::ignore_error>,
+   boost::math::policies::overflow_error<boost::math::policies::ignore_error> > ignore_policy;
+
+template <class Real>
+std::vector<Real> w0_arguments()
+{
+   // Arguments spread over every region of the approximations, in random order:
+   std::mt19937 gen(12345);
+   std::uniform_real_distribution<double> near_branch(-0.36787944117144233, -0.3);
+   std::uniform_real_distribution<double> small(-0.3, 0.6);
+   std::uniform_real_distribution<double> log_large(-3, 100);
+   std::vector<Real> z;
+   for (int i = 0; i < 3000; ++i)
+   {
+      z.push_back(static_cast<Real>(near_branch(gen)));
+      z.push_back(static_cast<Real>(small(gen)));
+      Real x = static_cast<Real>(std::pow(10.0, log_large(gen)));
+      if (x < (std::numeric_limits<Real>::max)())
+      {
+         z.push_back(x);
+      }
+   }
+   z.push_back(0);
+   z.push_back(-boost::math::constants::exp_minus_one<Real>());
+   std::shuffle(z.begin(), z.end(), gen);
+   return z;
+}
+
+template <class Real>
+std::vector<Real> wm1_arguments()
+{
+   std::mt19937 gen(54321);
+   std::uniform_real_distribution<double> near_branch(-0.36787944117144233, -0.3);
+   std::uniform_real_distribution<double> log_small(-30, -0.5);
+   std::vector<Real> z;
+   for (int i = 0; i < 3000; ++i)
+   {
+      z.push_back(static_cast<Real>(near_branch(gen)));
+      Real x = -static_cast<Real>(std::pow(10.0, log_small(gen)));
+      if (-x > (std::numeric_limits<Real>::min)())
+      {
+         z.push_back(x);
+      }
+   }
+   z.push_back(-boost::math::constants::exp_minus_one<Real>());
+   z.push_back(static_cast<Real>(-0.35));
+   std::shuffle(z.begin(), z.end(), gen);
+   return z;
+}
+
+template <class Real>
+void test_batch_matches_scalar()
+{
+   std::vector<Real> z = w0_arguments<Real>();
+   std::vector<Real> w(z.size());
+   lambert_w0(z.begin(), z.end(), w.begin());
+   for (std::size_t i = 0; i < z.size(); ++i)
+   {
+      CHECK_ULP_CLOSE(lambert_w0(z[i]), w[i], 0);
+   }
+
+   z = wm1_arguments<Real>();
+   w.assign(z.size(), Real(0));
+   lambert_wm1(z.begin(), z.end(), w.begin());
+   for (std::size_t i = 0; i < z.size(); ++i)
+   {
+      CHECK_ULP_CLOSE(lambert_wm1(z[i]), w[i], 0);
+   }
+}
+
+template <class Real>
+void test_edge_cases()
+{
+   // Out of domain values are handled exactly as by the scalar functions:
+   const Real nan = std::numeric_limits<Real>::quiet_NaN();
+   std::vector<Real> z = { Real(1), nan, Real(-1), std::numeric_limits<Real>::infinity(), Real(0.5) };
+   std::vector<Real> w;
+   lambert_w0(z.begin(), z.end(), std::back_inserter(w), ignore_policy());
+   CHECK_EQUAL(w.size(), z.size());
+   CHECK_ULP_CLOSE(lambert_w0(Real(1)), w[0], 0);
+   CHECK_NAN(w[1]);
+   CHECK_NAN(w[2]);
+   CHECK_ULP_CLOSE(lambert_w0(Real(0.5)), w[4], 0);
+
+   z = { Real(-0.1), nan, Real(0.5), Real(-1e-10) };
+   w.clear();
+   lambert_wm1(z.begin(), z.end(), std::back_inserter(w), ignore_policy());
+   CHECK_ULP_CLOSE(lambert_wm1(Real(-0.1)), w[0], 0);
+   CHECK_NAN(w[1]);
+   CHECK_NAN(w[2]);
+   CHECK_ULP_CLOSE(lambert_wm1(Real(-1e-10)), w[3], 0);
+
+   // With the default policy the errors propagate:
+   bool thrown = false;
+   try
+   {
+      lambert_w0(z.begin(), z.end(), w.begin());
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+
+   // Empty ranges are fine:
+   std::vector<Real> empty;
+   CHECK_EQUAL(lambert_w0(empty.begin(), empty.end(), w.begin()) == w.begin(), true);
+}
+
+int main()
+{
+   test_batch_matches_scalar<float>();
+   test_batch_matches_scalar<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+   test_batch_matches_scalar<long double>();
+#endif
+   test_edge_cases<float>();
+   test_edge_cases<double>();
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,86 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/digamma.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/expint.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/special_functions/relative_difference.hpp>
+#include "math_unit_test.hpp"
+
+//
+// Checks that float evaluated in float, rather than promoted to double, is
+// within a few epsilon of the double precision result, using the 24-bit
+// approximations throughout:
+//
+typedef boost::math::policies::policy<boost::math::policies::promote_float<false> > native_policy;
+
+void check_native(float native, double full, float tol)
+{
+   if(!CHECK_LE(boost::math::epsilon_difference(native, static_cast<float>(full)), tol))
+      std::cerr << "  native result " << native << " vs " << full << std::endl;
+}
+
+int main()
+{
+   static_assert(std::is_same<decltype(boost::math::erf(1.0f, native_policy())), float>::value, "Result type is unchanged");
+
+   for(float z = -5; z < 5; z += 0.0137f)
+   {
+      check_native(boost::math::erf(z, native_policy()), boost::math::erf(double(z)), 2);
+      check_native(boost::math::erfc(z, native_policy()), boost::math::erfc(double(z)), 3);
+   }
+   for(float z = 5; z < 9; z += 0.0731f)
+      check_native(boost::math::erfc(z, native_policy()), boost::math::erfc(double(z)), 3);
+
+   for(float z = 0.0001f; z < 30; z = z * 1.05f + 0.001f)
+   {
+      check_native(boost::math::tgamma(z, native_policy()), boost::math::tgamma(double(z)), 4);
+      check_native(boost::math::digamma(z, native_policy()), boost::math::digamma(double(z)), 4);
+      check_native(boost::math::expint(1, z, native_policy()), boost::math::expint(1, double(z)), 4);
+      if(z > 1)
+         check_native(boost::math::expint(z, native_policy()), boost::math::expint(double(z)), 12);
+      check_native(boost::math::expint(-z, native_policy()), boost::math::expint(double(-z)), 4);
+      check_native(boost::math::cyl_bessel_i(0, z, native_policy()), boost::math::cyl_bessel_i(0, double(z)), 4);
+      check_native(boost::math::cyl_bessel_i(1, z, native_policy()), boost::math::cyl_bessel_i(1, double(z)), 4);
+      check_native(boost::math::cyl_bessel_k(0, z, native_policy()), boost::math::cyl_bessel_k(0, double(z)), 4);
+      check_native(boost::math::cyl_bessel_k(1, z, native_policy()), boost::math::cyl_bessel_k(1, double(z)), 4);
+      check_native(boost::math::gamma_q(2.5f, z, native_policy()), boost::math::gamma_q(2.5, double(z)), 8);
+      check_native(boost::math::beta(z, 2.5f, native_policy()), boost::math::beta(double(z), 2.5), 30);
+   }
+   //
+   // Arguments below 1 are shifted before the float Lanczos approximation is
+   // applied, which otherwise loses several digits as z -> 0:
+   //
+   for(float z = 1e-6f; z < 1; z *= 1.5f)
+   {
+      check_native(boost::math::tgamma(z, native_policy()), boost::math::tgamma(double(z)), 4);
+      check_native(boost::math::beta(z, 0.75f, native_policy()), boost::math::beta(double(z), 0.75), 8);
+   }
+   //
+   // lgamma has roots at 1 and 2, so check the absolute error:
+   //
+   for(float z = 0.0078125f; z < 100; z = z * 1.05f + 0.001f)
+   {
+      double full = boost::math::lgamma(double(z));
+      CHECK_LE(std::fabs(boost::math::lgamma(z, native_policy()) - full), 4 * std::numeric_limits<float>::epsilon() * (std::max)(1.0, std::fabs(full)));
+   }
+   //
+   // Bessel J0/J1/Y0/Y1 have zeros, so again the error is absolute:
+   //
+   for(float z = 0.0078125f; z < 20; z = z * 1.05f + 0.001f)
+   {
+      CHECK_LE(std::fabs(boost::math::cyl_bessel_j(0, z, native_policy()) - boost::math::cyl_bessel_j(0, double(z))), 4.0 * std::numeric_limits<float>::epsilon());
+      CHECK_LE(std::fabs(boost::math::cyl_bessel_j(1, z, native_policy()) - boost::math::cyl_bessel_j(1, double(z))), 4.0 * std::numeric_limits<float>::epsilon());
+      if(z > 1)
+      {
+         CHECK_LE(std::fabs(boost::math::cyl_neumann(0, z, native_policy()) - boost::math::cyl_neumann(0, double(z))), 4.0 * std::numeric_limits<float>::epsilon());
+         CHECK_LE(std::fabs(boost::math::cyl_neumann(1, z, native_policy()) - boost::math::cyl_neumann(1, double(z))), 4.0 * std::numeric_limits<float>::epsilon());
+      }
+   }
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,152 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <limits>
+#include <stdexcept>
+#include "math_unit_test.hpp"
+#include <boost/math/distributions/non_central_chi_squared.hpp>
+#include <boost/math/distributions/non_central_beta.hpp>
+#include <boost/math/distributions/non_central_f.hpp>
+#include <boost/math/distributions/non_central_t.hpp>
+
+using namespace boost::math;
+
+//
+// The evaluators must give exactly the same results as the free functions,
+// both one point at a time and over a range:
+//
+template <class Dist, class Evaluator, class Real>
+void check_evaluator(const Dist& dist, const std::vector<Real>& x)
+{
+   Evaluator eval(dist);
+   std::vector<Real> p(x.size()), q(x.size());
+   eval.cdf(x.begin(), x.end(), p.begin());
+   eval.cdf_complement(x.begin(), x.end(), q.begin());
+   for (std::size_t i = 0; i < x.size(); ++i)
+   {
+      Real expected_p = cdf(dist, x[i]);
+      Real expected_q = cdf(complement(dist, x[i]));
+      CHECK_EQUAL(eval.cdf(x[i]), expected_p);
+      CHECK_EQUAL(eval.cdf_complement(x[i]), expected_q);
+      CHECK_EQUAL(p[i], expected_p);
+      CHECK_EQUAL(q[i], expected_q);
+   }
+}
+
+template <class Real>
+void test_chi_squared()
+{
+   std::vector<Real> x;
+   for (int i = 0; i <= 200; ++i)
+   {
+      x.push_back(Real(i) * Real(i) / 40);
+   }
+   // Small non-centrality (Ding's method), large (Krishnamoorthy's method), and zero:
+   const Real params[][2] = { { Real(2), Real(0.5) }, { Real(10), Real(25) }, { Real(3.5), Real(250) }, { Real(1), Real(1000) }, { Real(4), Real(0) } };
+   for (const auto& pr : params)
+   {
+      non_central_chi_squared_distribution<Real> dist(pr[0], pr[1]);
+      check_evaluator<non_central_chi_squared_distribution<Real>, non_central_chi_squared_cdf_evaluator<Real> >(dist, x);
+      Real ps[] = { Real(0.01), Real(0.5), Real(0.95) };
+      for (Real pp : ps)
+      {
+         if (pr[1] != 0)
+         {
+            CHECK_ULP_CLOSE(pp, cdf(dist, quantile(dist, pp)), 5000);
+            CHECK_ULP_CLOSE(pp, cdf(complement(dist, quantile(complement(dist, pp)))), 5000);
+         }
+      }
+   }
+}
+
+template <class Real>
+void test_beta_and_f()
+{
+   std::vector<Real> x, f;
+   for (int i = 0; i <= 100; ++i)
+   {
+      x.push_back(Real(i) / 100);
+      f.push_back(Real(i) * Real(i) / 500);
+   }
+   const Real params[][3] = { { Real(2), Real(3), Real(1) }, { Real(0.5), Real(0.25), Real(5) }, { Real(10), Real(20), Real(80) }, { Real(5), Real(8), Real(150) }, { Real(2), Real(2), Real(0) } };
+   for (const auto& pr : params)
+   {
+      non_central_beta_distribution<Real> dist(pr[0], pr[1], pr[2]);
+      check_evaluator<non_central_beta_distribution<Real>, non_central_beta_cdf_evaluator<Real> >(dist, x);
+      non_central_f_distribution<Real> fdist(2 * pr[0], 2 * pr[1], pr[2]);
+      check_evaluator<non_central_f_distribution<Real>, non_central_f_cdf_evaluator<Real> >(fdist, f);
+      if (pr[2] != 0)
+      {
+         Real pp = Real(0.25);
+         CHECK_ULP_CLOSE(pp, cdf(dist, quantile(dist, pp)), 5000);
+         CHECK_ULP_CLOSE(pp, cdf(fdist, quantile(fdist, pp)), 5000);
+      }
+   }
+}
+
+template <class Real>
+void test_t()
+{
+   std::vector<Real> x;
+   for (int i = -100; i <= 100; ++i)
+   {
+      x.push_back(Real(i) / 8);
+   }
+   // Both signs of delta, the t < 0 reflection, the Student's t limits and infinite degrees of freedom:
+   const Real params[][2] = { { Real(3), Real(1) }, { Real(10), Real(-2.5) }, { Real(1.5), Real(12) }, { Real(40), Real(0.25) }, { Real(5), Real(0) }, { Real(1e30), Real(1) }, { std::numeric_limits<Real>::infinity(), Real(2) } };
+   for (const auto& pr : params)
+   {
+      non_central_t_distribution<Real> dist(pr[0], pr[1]);
+      check_evaluator<non_central_t_distribution<Real>, non_central_t_cdf_evaluator<Real> >(dist, x);
+      if ((pr[1] != 0) && (pr[0] < 1000))
+      {
+         Real ps[] = { Real(0.05), Real(0.5), Real(0.9) };
+         for (Real pp : ps)
+         {
+            CHECK_ULP_CLOSE(pp, cdf(dist, quantile(dist, pp)), 5000);
+         }
+      }
+   }
+}
+
+void test_errors()
+{
+   non_central_chi_squared_cdf_evaluator<double> chi(non_central_chi_squared_distribution<double>(2, 3));
+   int thrown = 0;
+   try
+   {
+      chi.cdf(-1.0);
+   }
+   catch (std::domain_error const &)
+   {
+      ++thrown;
+   }
+   non_central_beta_cdf_evaluator<double> beta(non_central_beta_distribution<double>(2, 3, 1));
+   try
+   {
+      beta.cdf_complement(2.0);
+   }
+   catch (std::domain_error const &)
+   {
+      ++thrown;
+   }
+   CHECK_EQUAL(thrown, 2);
+}
+
+int main()
+{
+   test_chi_squared<float>();
+   test_chi_squared<double>();
+   test_chi_squared<long double>();
+   test_beta_and_f<float>();
+   test_beta_and_f<double>();
+   test_beta_and_f<long double>();
+   test_t<float>();
+   test_t<double>();
+   test_t<long double>();
+   test_errors();
+   return boost::math::test::report_errors();
+}
@@ -371,6 +371,60 @@ void test_weights()
 }
 
 
+template<class Real>
+void test_batch()
+{
+    std::cout << "Testing batched evaluation of the vector barycentric rational interpolator on type "
+              << boost::typeindex::type_id<Real>().pretty_name() << "\n";
+    std::mt19937 gen(7);
+    boost::random::uniform_real_distribution<Real> dis(0.1f, 1);
+    std::vector<Real> t(200);
+    std::vector<std::array<Real, 3>> y(t.size());
+    t[0] = 0;
+    for (size_t i = 0; i < t.size(); ++i)
+    {
+        if (i > 0)
+        {
+            t[i] = t[i-1] + dis(gen);
+        }
+        y[i] = {dis(gen), dis(gen), dis(gen)};
+    }
+    std::vector<Real> t_copy = t;
+    boost::math::vector_barycentric_rational<decltype(t), decltype(y)> interpolator(std::move(t), std::move(y), 4);
+
+    // Unsorted, with a partial last block, and with nodes scattered among the other parameters:
+    std::vector<Real> s(203);
+    boost::random::uniform_real_distribution<Real> span(t_copy.front(), t_copy.back());
+    for (auto & r : s)
+    {
+        r = span(gen);
+    }
+    s[3] = t_copy[0];
+    s[17] = t_copy[50];
+    s[18] = t_copy[51];
+    s[202] = t_copy.back();
+    std::vector<std::array<Real, 3>> x(s.size());
+    std::vector<std::array<Real, 3>> dxdt(s.size());
+    interpolator.evaluate(s.data(), s.size(), x.data(), dxdt.data());
+    std::vector<std::array<Real, 3>> x_only(s.size());
+    interpolator.evaluate(s.data(), s.size(), x_only.data());
+    std::vector<std::array<Real, 3>> dxdt_only(s.size());
+    interpolator.evaluate(s.data(), s.size(), nullptr, dxdt_only.data());
+    Real tol = 100*numeric_limits<Real>::epsilon();
+    for (size_t i = 0; i < s.size(); ++i)
+    {
+        auto [p, dp] = interpolator.eval_with_prime(s[i]);
+        for (size_t j = 0; j < 3; ++j)
+        {
+            BOOST_CHECK_SMALL(x[i][j] - p[j], tol);
+            BOOST_CHECK_SMALL(dxdt[i][j] - dp[j], 10*tol*(1 + abs(dp[j])));
+            BOOST_CHECK_EQUAL(x_only[i][j], x[i][j]);
+            BOOST_CHECK_EQUAL(dxdt_only[i][j], dxdt[i][j]);
+        }
+    }
+    BOOST_CHECK_EQUAL(x[17][0], interpolator(t_copy[50])[0]);
+}
+
 BOOST_AUTO_TEST_CASE(vector_barycentric_rational)
 {
     test_weights<double>();
@@ -382,4 +436,6 @@ BOOST_AUTO_TEST_CASE(vector_barycentric_rational)
     test_interpolation_condition_std_array<double>();
     test_interpolation_condition_high_order<double>();
     test_agreement_with_1d<double>();
+    test_batch<float>();
+    test_batch<double>();
 }
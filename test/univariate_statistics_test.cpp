@@ -490,6 +490,21 @@ void test_first_four_moments(ExecutionPolicy&& exec)
     BOOST_TEST(abs(M2_2 - Real(2)) < tol);
     BOOST_TEST(abs(M3_2) < tol);
     BOOST_TEST(abs(M4_2 - Real(34)/Real(5)) < tol);
+
+    // Large enough to be split between threads, and skewed, so that the combination of the third and fourth moments is tested:
+    std::mt19937 gen(15);
+    std::exponential_distribution<double> dis(1);
+    v.resize(200000);
+    for (auto & x : v)
+    {
+        x = static_cast<Real>(dis(gen));
+    }
+    auto [M1_3, M2_3, M3_3, M4_3] = boost::math::statistics::first_four_moments(exec, v);
+    auto [M1_4, M2_4, M3_4, M4_4] = boost::math::statistics::first_four_moments(std::execution::seq, v);
+    BOOST_TEST(abs(M1_3 - M1_4) < 1000*tol*abs(M1_4));
+    BOOST_TEST(abs(M2_3 - M2_4) < 1000*tol*abs(M2_4));
+    BOOST_TEST(abs(M3_3 - M3_4) < 1000*tol*abs(M3_4));
+    BOOST_TEST(abs(M4_3 - M4_4) < 1000*tol*abs(M4_4));
 }
 
 template<class Real, class ExecutionPolicy>
@@ -130,9 +130,55 @@ void test_wavelet_transform()
 
 }
 
+template<typename Real, int p>
+void test_scalogram()
+{
+    std::cout << "Testing scalogram of " << p << " vanishing moment Daubechies wavelet on type " << boost::core::demangle(typeid(Real).name()) << "\n";
+    auto psi = boost::math::daubechies_wavelet<Real, p>();
+    auto f = [](Real x) {
+        return std::exp(-x*x/8)*std::cos(3*x);
+    };
+    auto Wf = daubechies_wavelet_transform(f, psi);
+    Real t0 = -4;
+    Real h = Real(1)/128;
+    std::size_t n = 1024;
+    // The last scale is long enough to take the FFT path:
+    std::vector<Real> scales{Real(0.5), Real(1), Real(-2.5), Real(0), Real(40)};
+    auto W = Wf.scalogram(scales, t0, h, n);
+    CHECK_EQUAL(scales.size()*n, W.size());
+    auto [a, b] = psi.support();
+    for (std::size_t i = 0; i < scales.size(); ++i)
+    {
+        Real s = scales[i];
+        for (std::size_t k = 0; k < n; k += 37)
+        {
+            Real t = t0 + k*h;
+            // Against the same trapezoidal sum computed directly:
+            Real expected = 0;
+            if (s != 0)
+            {
+                for (long long m = static_cast<long long>(std::ceil((std::min)(a*s, b*s)/h)); m*h <= (std::max)(a*s, b*s); ++m)
+                {
+                    expected += f(t + m*h)*psi(m*h/s);
+                }
+                expected *= h/sqrt(abs(s));
+            }
+            CHECK_ABSOLUTE_ERROR(expected, W[i*n + k], 500*std::numeric_limits<Real>::epsilon());
+            // And against the quadrature; the 2 vanishing moment wavelet is barely continuous,
+            // so the trapezoidal sum converges slowly:
+            if (std::abs(s) < 10)
+            {
+                CHECK_ABSOLUTE_ERROR(Wf(s, t), W[i*n + k], p == 2 ? Real(1e-3) : Real(1e-4));
+            }
+        }
+    }
+}
+
 int main()
 {
     try{
+       test_scalogram<double, 2>();
+       test_scalogram<double, 8>();
        test_wavelet_transform<double, 2>();
        test_wavelet_transform<double, 8>();
        test_wavelet_transform<double, 16>();
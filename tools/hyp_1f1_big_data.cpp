@@ -101,7 +101,6 @@ struct hypergeometric_1f1_gen
 
 int main(int, char* [])
 {
-   parameter_info<mp_t> arg1, arg2, arg3;
    test_data<mp_t> data;
 
    std::cout << "Welcome.\n"
@@ -147,21 +146,24 @@ int main(int, char* [])
    v.push_back(p);
    v.push_back(-p);
 
+   //
+   // Each point is an expensive interval arithmetic series, so they're all
+   // evaluated in parallel, checkpointing as we go so that an interrupted
+   // run can be restarted:
+   //
+   std::vector<std::array<parameter_info<mp_t>, 3> > grids;
    for (unsigned i = 0; i < v.size(); ++i)
    {
       for (unsigned j = 0; j < v.size(); ++j)
       {
          for (unsigned k = 0; k < v.size(); ++k)
          {
-            std::cout << i << " " << j << " " << k << std::endl;
-            std::cout << v[i] << " " << (v[j] * 3) / 2 << " " << (v[j] * 5) / 4 << std::endl;
-            arg1 = make_single_param(v[i]);
-            arg2 = make_single_param(mp_t((v[j] * 3) / 2));
-            arg3 = make_single_param(mp_t((v[k] * 5) / 4));
-            data.insert(hypergeometric_1f1_gen(), arg1, arg2, arg3);
+            std::array<parameter_info<mp_t>, 3> grid = { { make_single_param(v[i]), make_single_param(mp_t((v[j] * 3) / 2)), make_single_param(mp_t((v[k] * 5) / 4)) } };
+            grids.push_back(grid);
          }
       }
    }
+   data.insert_parallel(hypergeometric_1f1_gen(), grids, parallel_generation_options(0, 4, "hypergeometric_1f1_big.checkpoint"));
 
 
    std::cout << "Enter name of test data file [default=hypergeometric_1f1.ipp]";
@@ -16,9 +16,10 @@ using namespace boost::math::tools;
 // Force truncation to float precision of input values:
 // we must ensure that the input values are exactly representable
 // in whatever type we are testing, or the output values will all
-// be thrown off:
+// be thrown off.  Thread local since the data is generated on
+// several threads at once:
 //
-float external_f;
+thread_local float external_f;
 float force_truncate(const float* f)
 {
    external_f = *f;
@@ -119,7 +120,7 @@ int main(int argc, char*argv [])
       do{
          get_user_parameter_info(arg1, "a");
          get_user_parameter_info(arg2, "p");
-         data.insert(gamma_inverse_generator(), arg1, arg2);
+         data.insert_parallel(gamma_inverse_generator(), arg1, arg2);
 
          std::cout << "Any more data [y/n]?";
          std::getline(std::cin, line);
@@ -135,7 +136,7 @@ int main(int argc, char*argv [])
       do{
          get_user_parameter_info(arg1, "x");
          get_user_parameter_info(arg2, "p");
-         data.insert(gamma_inverse_generator_a(), arg1, arg2);
+         data.insert_parallel(gamma_inverse_generator_a(), arg1, arg2);
 
          std::cout << "Any more data [y/n]?";
          std::getline(std::cin, line);
@@ -154,7 +155,7 @@ int main(int argc, char*argv [])
 
       do{
          get_user_parameter_info(arg1, "a");
-         data.insert(igamma_data_generator(), arg1, arg2);
+         data.insert_parallel(igamma_data_generator(), arg1, arg2);
 
          std::cout << "Any more data [y/n]?";
          std::getline(std::cin, line);